@@ -0,0 +1,220 @@
+/*
+ * Copyright 2008 Search Solution Corporation
+ * Copyright 2016 CUBRID Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+/*
+ * bloom_filter.c - Bloom filter over 32-bit hash values
+ *
+ * Note: Items are added and probed by their hash value, so the filter can be used by any caller that already hashes
+ *       its keys (hash list scans, index keys, ...). The probed bit positions are derived from the hash with double
+ *       hashing after a 64-bit finalizer spreads the bits of the hash value.
+ */
+
+#include "bloom_filter.h"
+
+#include <assert.h>
+#include <string.h>
+
+#include "error_manager.h"
+#include "memory_alloc.h"
+
+#define BLOOM_MIN_BITS (1 << 9)	/* 512 bits */
+#define BLOOM_MAX_BITS (1 << 28)	/* 256M bits, 32MB */
+
+#define BLOOM_WORD(bf, bit) ((bf)->bits[(bit) >> 6])
+#define BLOOM_MASK(bit) (((UINT64) 1) << ((bit) & 63))
+
+static UINT64 bloom_mix (unsigned int hash);
+
+/*
+ * bloom_mix () - spread the bits of a 32-bit hash value over 64 bits
+ *   return: mixed value
+ *   hash(in): hash value
+ */
+static UINT64
+bloom_mix (unsigned int hash)
+{
+  UINT64 x = (UINT64) hash;
+
+  x ^= x >> 33;
+  x *= 0xff51afd7ed558ccdULL;
+  x ^= x >> 33;
+  x *= 0xc4ceb9fe1a85ec53ULL;
+  x ^= x >> 33;
+
+  return x;
+}
+
+/*
+ * bloom_create () - allocate a Bloom filter
+ *   return: Bloom filter or NULL on error
+ *   thread_p(in): thread entry
+ *   expected_items(in): expected number of items
+ *   bits_per_item(in): number of bits reserved for each item
+ *
+ * Note: The number of bits is rounded up to a power of two and bounded by BLOOM_MIN_BITS and BLOOM_MAX_BITS.
+ */
+BLOOM_FILTER *
+bloom_create (THREAD_ENTRY * thread_p, int expected_items, int bits_per_item)
+{
+  BLOOM_FILTER *bf;
+  UINT64 wanted_bits, nbits;
+  size_t size;
+
+  assert (bits_per_item > 0);
+
+  if (expected_items < 1)
+    {
+      expected_items = 1;
+    }
+
+  wanted_bits = (UINT64) expected_items * (UINT64) bits_per_item;
+  for (nbits = BLOOM_MIN_BITS; nbits < wanted_bits && nbits < BLOOM_MAX_BITS; nbits <<= 1)
+    {
+      ;
+    }
+
+  bf = (BLOOM_FILTER *) db_private_alloc (thread_p, sizeof (BLOOM_FILTER));
+  if (bf == NULL)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, sizeof (BLOOM_FILTER));
+      return NULL;
+    }
+
+  size = (size_t) (nbits / 8);
+  bf->bits = (UINT64 *) db_private_alloc (thread_p, size);
+  if (bf->bits == NULL)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, size);
+      db_private_free (thread_p, bf);
+      return NULL;
+    }
+
+  bf->nbits_mask = nbits - 1;
+
+  /* optimal number of hash functions is ln (2) * bits per item */
+  bf->nhashes = (int) ((bits_per_item * 69 + 50) / 100);
+  if (bf->nhashes < 1)
+    {
+      bf->nhashes = 1;
+    }
+  else if (bf->nhashes > 16)
+    {
+      bf->nhashes = 16;
+    }
+
+  bloom_clear (bf);
+
+  return bf;
+}
+
+/*
+ * bloom_destroy () - free a Bloom filter
+ *   return: void
+ *   thread_p(in): thread entry
+ *   bf(in): Bloom filter
+ */
+void
+bloom_destroy (THREAD_ENTRY * thread_p, BLOOM_FILTER * bf)
+{
+  if (bf == NULL)
+    {
+      return;
+    }
+
+  if (bf->bits != NULL)
+    {
+      db_private_free (thread_p, bf->bits);
+    }
+  db_private_free (thread_p, bf);
+}
+
+/*
+ * bloom_clear () - remove all items from a Bloom filter
+ *   return: void
+ *   bf(in): Bloom filter
+ */
+void
+bloom_clear (BLOOM_FILTER * bf)
+{
+  memset (bf->bits, 0, bloom_size (bf));
+  bf->nitems = 0;
+}
+
+/*
+ * bloom_add () - add an item to a Bloom filter
+ *   return: void
+ *   bf(in): Bloom filter
+ *   hash(in): hash value of the item
+ */
+void
+bloom_add (BLOOM_FILTER * bf, unsigned int hash)
+{
+  UINT64 mixed, h1, h2, bit;
+  int i;
+
+  mixed = bloom_mix (hash);
+  h1 = mixed;
+  h2 = (mixed >> 32) | 1;
+
+  for (i = 0; i < bf->nhashes; i++)
+    {
+      bit = (h1 + i * h2) & bf->nbits_mask;
+      BLOOM_WORD (bf, bit) |= BLOOM_MASK (bit);
+    }
+
+  bf->nitems++;
+}
+
+/*
+ * bloom_may_contain () - check whether an item may be in a Bloom filter
+ *   return: false if the item was certainly never added, true otherwise
+ *   bf(in): Bloom filter
+ *   hash(in): hash value of the item
+ */
+bool
+bloom_may_contain (const BLOOM_FILTER * bf, unsigned int hash)
+{
+  UINT64 mixed, h1, h2, bit;
+  int i;
+
+  mixed = bloom_mix (hash);
+  h1 = mixed;
+  h2 = (mixed >> 32) | 1;
+
+  for (i = 0; i < bf->nhashes; i++)
+    {
+      bit = (h1 + i * h2) & bf->nbits_mask;
+      if ((BLOOM_WORD (bf, bit) & BLOOM_MASK (bit)) == 0)
+	{
+	  return false;
+	}
+    }
+
+  return true;
+}
+
+/*
+ * bloom_size () - size in bytes of the bit array of a Bloom filter
+ *   return: size
+ *   bf(in): Bloom filter
+ */
+size_t
+bloom_size (const BLOOM_FILTER * bf)
+{
+  return (size_t) ((bf->nbits_mask + 1) / 8);
+}
@@ -0,0 +1,55 @@
+/*
+ * Copyright 2008 Search Solution Corporation
+ * Copyright 2016 CUBRID Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+/*
+ * bloom_filter.h - Bloom filter over 32-bit hash values
+ */
+
+#ifndef _BLOOM_FILTER_H_
+#define _BLOOM_FILTER_H_
+
+#if !defined (SERVER_MODE) && !defined (SA_MODE)
+#error Belongs to server module
+#endif /* !defined (SERVER_MODE) && !defined (SA_MODE) */
+
+#include "config.h"
+#include "porting.h"
+#include "thread_compat.hpp"
+
+/* default number of bits reserved for each expected item; gives a false positive rate of about 1% */
+#define BLOOM_DEFAULT_BITS_PER_ITEM 10
+
+typedef struct bloom_filter BLOOM_FILTER;
+struct bloom_filter
+{
+  UINT64 *bits;			/* bit array */
+  UINT64 nbits_mask;		/* number of bits - 1; the number of bits is a power of two */
+  int nhashes;			/* number of probed bits for each item */
+  int nitems;			/* number of added items */
+};
+
+extern BLOOM_FILTER *bloom_create (THREAD_ENTRY * thread_p, int expected_items, int bits_per_item);
+extern void bloom_destroy (THREAD_ENTRY * thread_p, BLOOM_FILTER * bf);
+extern void bloom_clear (BLOOM_FILTER * bf);
+
+extern void bloom_add (BLOOM_FILTER * bf, unsigned int hash);
+extern bool bloom_may_contain (const BLOOM_FILTER * bf, unsigned int hash);
+
+extern size_t bloom_size (const BLOOM_FILTER * bf);
+
+#endif /* _BLOOM_FILTER_H_ */
@@ -1657,6 +1657,93 @@ lang_get_collation (const int coll_id)
   return lang_Collations[coll_id];
 }
 
+/*
+ * lang_get_key_prefix - build an order preserving fixed size prefix of a
+ *			 string
+ *   return: false if the collation does not support such prefixes
+ *   lang_coll(in): collation data
+ *   str(in): string
+ *   size(in): string size
+ *   ignore_trailing_space(in): same as for fastcmp
+ *   prefix(out): prefix, as a big endian integer
+ *
+ *  Note: The character weights of the string are encoded as UTF-8 and the
+ *	  first bytes of the encoding are zero padded to eight bytes. For the
+ *	  collations that compare weights character by character (no
+ *	  expansions or contractions), if the prefixes of two strings differ,
+ *	  fastcmp orders the strings like the prefixes. Equal prefixes do not
+ *	  mean equal strings.
+ */
+bool
+lang_get_key_prefix (const LANG_COLLATION * lang_coll, const unsigned char *str, const int size,
+		     bool ignore_trailing_space, UINT64 * prefix)
+{
+  unsigned char buf[sizeof (UINT64) + INTL_UTF8_MAX_CHAR_SIZE];
+  const unsigned char *str_end = str + size;
+  unsigned char *next;
+  const unsigned int *weight_ptr;
+  unsigned int cp, w;
+  int len = 0, i;
+
+  if (lang_coll->fastcmp == lang_fastcmp_binary)
+    {
+      /* all bytes count, including trailing spaces */
+      for (; str < str_end && len < (int) sizeof (UINT64); str++)
+	{
+	  buf[len++] = *str;
+	}
+    }
+  else if (lang_coll->fastcmp == lang_fastcmp_byte)
+    {
+      weight_ptr = ignore_trailing_space ? lang_coll->coll.weights_ti : lang_coll->coll.weights;
+
+      for (; str < str_end && len < (int) sizeof (UINT64); str++)
+	{
+	  w = (*str == SPACE) ? ZERO : weight_ptr[*str];
+	  if (w > 0x10ffff)
+	    {
+	      return false;
+	    }
+	  len += intl_cp_to_utf8 (w, buf + len);
+	}
+    }
+  else if (lang_coll->fastcmp == lang_strcmp_utf8)
+    {
+      weight_ptr = (lang_coll->built_in && ignore_trailing_space) ? lang_coll->coll.weights_ti : lang_coll->coll.weights;
+
+      while (str < str_end && len < (int) sizeof (UINT64))
+	{
+	  cp = intl_utf8_to_cp (str, CAST_BUFLEN (str_end - str), &next);
+	  if (cp < (unsigned int) lang_coll->coll.w_count)
+	    {
+	      w = (cp == SPACE) ? ZERO : weight_ptr[cp];
+	    }
+	  else
+	    {
+	      w = cp;
+	    }
+	  if (w > 0x10ffff)
+	    {
+	      return false;
+	    }
+	  len += intl_cp_to_utf8 (w, buf + len);
+	  str = next;
+	}
+    }
+  else
+    {
+      return false;
+    }
+
+  *prefix = 0;
+  for (i = 0; i < (int) sizeof (UINT64); i++)
+    {
+      *prefix = (*prefix << 8) | ((i < len) ? buf[i] : 0);
+    }
+
+  return true;
+}
+
 
 /*
  * lang_get_collation_name - return collation name
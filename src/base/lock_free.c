@@ -54,6 +54,9 @@ LF_TRAN_SYSTEM hfid_table_Ts = LF_TRAN_SYSTEM_INITIALIZER;
 LF_TRAN_SYSTEM xcache_Ts = LF_TRAN_SYSTEM_INITIALIZER;
 LF_TRAN_SYSTEM fpcache_Ts = LF_TRAN_SYSTEM_INITIALIZER;
 LF_TRAN_SYSTEM dwb_slots_Ts = LF_TRAN_SYSTEM_INITIALIZER;
+LF_TRAN_SYSTEM btree_ahi_Ts = LF_TRAN_SYSTEM_INITIALIZER;
+LF_TRAN_SYSTEM btree_bloom_Ts = LF_TRAN_SYSTEM_INITIALIZER;
+LF_TRAN_SYSTEM btree_delta_Ts = LF_TRAN_SYSTEM_INITIALIZER;
 
 static bool tran_systems_initialized = false;
 
@@ -505,6 +508,19 @@ lf_initialize_transaction_systems (int max_threads)
       goto error;
     }
 
+  if (lf_tran_system_init (&btree_ahi_Ts, max_threads) != NO_ERROR)
+    {
+      goto error;
+    }
+  if (lf_tran_system_init (&btree_bloom_Ts, max_threads) != NO_ERROR)
+    {
+      goto error;
+    }
+  if (lf_tran_system_init (&btree_delta_Ts, max_threads) != NO_ERROR)
+    {
+      goto error;
+    }
+
   tran_systems_initialized = true;
   return NO_ERROR;
 
@@ -530,6 +546,9 @@ lf_destroy_transaction_systems (void)
   lf_tran_system_destroy (&xcache_Ts);
   lf_tran_system_destroy (&fpcache_Ts);
   lf_tran_system_destroy (&dwb_slots_Ts);
+  lf_tran_system_destroy (&btree_ahi_Ts);
+  lf_tran_system_destroy (&btree_bloom_Ts);
+  lf_tran_system_destroy (&btree_delta_Ts);
 
   tran_systems_initialized = false;
 }
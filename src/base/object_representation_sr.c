@@ -437,6 +437,16 @@ orc_free_diskrep (DISK_REPR * rep)
 		  free_and_init (rep->fixed[i].value);
 		}
 
+	      if (rep->fixed[i].histogram != NULL)
+		{
+		  free_and_init (rep->fixed[i].histogram);
+		}
+
+	      if (rep->fixed[i].column_groups != NULL)
+		{
+		  free_and_init (rep->fixed[i].column_groups);
+		}
+
 	      if (rep->fixed[i].bt_stats != NULL)
 		{
 		  for (j = 0; j < rep->fixed[i].n_btstats; j++)
@@ -464,6 +474,16 @@ orc_free_diskrep (DISK_REPR * rep)
 		  free_and_init (rep->variable[i].value);
 		}
 
+	      if (rep->variable[i].histogram != NULL)
+		{
+		  free_and_init (rep->variable[i].histogram);
+		}
+
+	      if (rep->variable[i].column_groups != NULL)
+		{
+		  free_and_init (rep->variable[i].column_groups);
+		}
+
 	      if (rep->variable[i].bt_stats != NULL)
 		{
 		  for (j = 0; j < rep->variable[i].n_btstats; j++)
@@ -3456,6 +3476,91 @@ or_class_get_partition_info (RECDES * record, OR_PARTITION * partition_info, REP
   return NO_ERROR;
 }
 
+/*
+ * or_class_get_column_groups () - Get the column groups declared on a class by CREATE STATISTICS
+ *   return: error code
+ *   record (in)     : class record
+ *   max_groups (in) : room for column groups
+ *   max_attrs (in)  : room for attributes of a column group
+ *   n_groups (out)  : number of column groups
+ *   n_attrs (out)   : n_attrs[i] is the number of attributes of group i
+ *   attr_ids (out)  : attributes of group i start at attr_ids[i * max_attrs]
+ *
+ * Note: The groups are kept in the class properties as a sequence of sequences of attribute ids. Groups that do not
+ *       fit are left out.
+ */
+int
+or_class_get_column_groups (RECDES * record, int max_groups, int max_attrs, int *n_groups, int *n_attrs,
+			    int *attr_ids)
+{
+  DB_SET *props = NULL, *groups, *group;
+  DB_VALUE value, attr_value;
+  int count, size, i, j;
+  int error = NO_ERROR;
+
+  assert (record != NULL);
+
+  *n_groups = 0;
+
+  if (OR_VAR_IS_NULL (record->data, ORC_PROPERTIES_INDEX))
+    {
+      return NO_ERROR;
+    }
+
+  or_unpack_setref (record->data + OR_VAR_OFFSET (record->data, ORC_PROPERTIES_INDEX), &props);
+  if (props == NULL)
+    {
+      return NO_ERROR;
+    }
+
+  if (!or_cl_get_prop_nocopy (props, SM_PROPERTY_COLUMN_GROUPS, &value))
+    {
+      goto end;
+    }
+  if (DB_VALUE_TYPE (&value) != DB_TYPE_SEQUENCE)
+    {
+      error = ER_SM_INVALID_PROPERTY;
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, error, 0);
+      goto end;
+    }
+
+  groups = db_get_set (&value);
+  count = set_size (groups);
+  for (i = 0; i < count && *n_groups < max_groups; i++)
+    {
+      error = set_get_element_nocopy (groups, i, &value);
+      if (error != NO_ERROR || DB_VALUE_TYPE (&value) != DB_TYPE_SEQUENCE)
+	{
+	  error = ER_SM_INVALID_PROPERTY;
+	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, error, 0);
+	  goto end;
+	}
+
+      group = db_get_set (&value);
+      size = set_size (group);
+      if (size > max_attrs)
+	{
+	  continue;
+	}
+      for (j = 0; j < size; j++)
+	{
+	  error = set_get_element_nocopy (group, j, &attr_value);
+	  if (error != NO_ERROR || DB_VALUE_TYPE (&attr_value) != DB_TYPE_INTEGER)
+	    {
+	      error = ER_SM_INVALID_PROPERTY;
+	      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, error, 0);
+	      goto end;
+	    }
+	  attr_ids[*n_groups * max_attrs + j] = db_get_int (&attr_value);
+	}
+      n_attrs[(*n_groups)++] = size;
+    }
+
+end:
+  set_free (props);
+  return error;
+}
+
 /*
  * or_get_constraint_comment () - Get constraint/index comment from a record
  *                                  descriptor of a class record
@@ -728,6 +728,38 @@ static const char sysprm_ha_conf_file_name[] = "cubrid_ha.conf";
 
 #define PRM_NAME_STATDUMP_FORCE_ADD_INT_MAX "statdump_force_add_int_max"
 
+#define PRM_NAME_JOIN_BLOOM_FILTER "join_bloom_filter"
+
+#define PRM_NAME_MAX_SUBQUERY_MEMO_SIZE "max_subquery_memo_size"
+
+#define PRM_NAME_BTREE_OPTIMISTIC_DESCENT "btree_optimistic_descent"
+
+#define PRM_NAME_BTREE_ADAPTIVE_HASH_ENTRIES "btree_adaptive_hash_entries"
+
+#define PRM_NAME_BTREE_UNIQUE_BLOOM_FILTER "btree_unique_bloom_filter"
+
+#define PRM_NAME_INDEX_INSERT_BUFFER_SIZE "index_insert_buffer_size"
+
+#define PRM_NAME_CHECKDB_THREAD_COUNT "checkdb_thread_count"
+
+#define PRM_NAME_STATS_DML_DELTA "stats_dml_delta"
+
+#define PRM_NAME_STATS_SAMPLE_ROWS "stats_sample_rows"
+
+#define PRM_NAME_STATS_THREAD_COUNT "stats_thread_count"
+
+#define PRM_NAME_OPTIMIZER_DP_JOIN_MAX_TABLES "optimizer_dp_join_max_tables"
+
+#define PRM_NAME_RUNTIME_PARTITION_PRUNING "runtime_partition_pruning"
+
+#define PRM_NAME_PARTITION_WISE_JOIN "partition_wise_join"
+
+#define PRM_NAME_PLAN_RECOMPILE_CARDINALITY_RATIO "plan_recompile_cardinality_ratio"
+
+#define PRM_NAME_PARTITION_ORDERED_MERGE "partition_ordered_merge"
+
+#define PRM_NAME_XASL_CACHE_MAX_VARIANTS "max_plan_cache_variants"
+
 /*
  * Note about ERROR_LIST and INTEGER_LIST type
  * ERROR_LIST type is an array of bool type with the size of -(ER_LAST_ERROR)
@@ -2380,6 +2412,88 @@ bool PRM_STATDUMP_FORCE_ADD_INT_MAX = false;
 static bool prm_statdump_force_add_int_max_default = false;
 static unsigned int prm_statdump_force_add_int_max_flag = 0;
 
+bool PRM_JOIN_BLOOM_FILTER = true;
+static bool prm_join_bloom_filter_default = true;
+static unsigned int prm_join_bloom_filter_flag = 0;
+
+UINT64 PRM_MAX_SUBQUERY_MEMO_SIZE = 1 * 1024 * 1024;
+static UINT64 prm_max_subquery_memo_size_default = 1 * 1024 * 1024;
+static UINT64 prm_max_subquery_memo_size_lower = 0;
+static UINT64 prm_max_subquery_memo_size_upper = 128 * 1024 * 1024;
+static unsigned int prm_max_subquery_memo_size_flag = 0;
+
+bool PRM_BTREE_OPTIMISTIC_DESCENT = true;
+static bool prm_btree_optimistic_descent_default = true;
+static unsigned int prm_btree_optimistic_descent_flag = 0;
+
+int PRM_BTREE_ADAPTIVE_HASH_ENTRIES = 65536;
+static int prm_btree_adaptive_hash_entries_default = 65536;
+static int prm_btree_adaptive_hash_entries_lower = 0;
+static int prm_btree_adaptive_hash_entries_upper = 1048576;
+static unsigned int prm_btree_adaptive_hash_entries_flag = 0;
+
+bool PRM_BTREE_UNIQUE_BLOOM_FILTER = false;
+static bool prm_btree_unique_bloom_filter_default = false;
+static unsigned int prm_btree_unique_bloom_filter_flag = 0;
+
+UINT64 PRM_INDEX_INSERT_BUFFER_SIZE = 16 * ONE_M;
+static UINT64 prm_index_insert_buffer_size_default = 16 * ONE_M;
+static UINT64 prm_index_insert_buffer_size_lower = 0;
+static UINT64 prm_index_insert_buffer_size_upper = ONE_G;
+static unsigned int prm_index_insert_buffer_size_flag = 0;
+
+int PRM_CHECKDB_THREAD_COUNT = 4;
+static int prm_checkdb_thread_count_default = 4;
+static int prm_checkdb_thread_count_lower = 0;
+static int prm_checkdb_thread_count_upper = 64;
+static unsigned int prm_checkdb_thread_count_flag = 0;
+
+bool PRM_STATS_DML_DELTA = true;
+static bool prm_stats_dml_delta_default = true;
+static unsigned int prm_stats_dml_delta_flag = 0;
+
+int PRM_STATS_SAMPLE_ROWS = 10000;
+static int prm_stats_sample_rows_default = 10000;
+static int prm_stats_sample_rows_lower = 0;
+static int prm_stats_sample_rows_upper = INT_MAX;
+static unsigned int prm_stats_sample_rows_flag = 0;
+
+int PRM_STATS_THREAD_COUNT = 4;
+static int prm_stats_thread_count_default = 4;
+static int prm_stats_thread_count_lower = 0;
+static int prm_stats_thread_count_upper = 64;
+static unsigned int prm_stats_thread_count_flag = 0;
+
+int PRM_OPTIMIZER_DP_JOIN_MAX_TABLES = 12;
+static int prm_optimizer_dp_join_max_tables_default = 12;
+static int prm_optimizer_dp_join_max_tables_lower = 0;
+static int prm_optimizer_dp_join_max_tables_upper = 20;
+static unsigned int prm_optimizer_dp_join_max_tables_flag = 0;
+
+bool PRM_RUNTIME_PARTITION_PRUNING = true;
+static bool prm_runtime_partition_pruning_default = true;
+static unsigned int prm_runtime_partition_pruning_flag = 0;
+
+bool PRM_PARTITION_WISE_JOIN = true;
+static bool prm_partition_wise_join_default = true;
+static unsigned int prm_partition_wise_join_flag = 0;
+
+int PRM_PLAN_RECOMPILE_CARDINALITY_RATIO = 100;
+static int prm_plan_recompile_cardinality_ratio_default = 100;
+static int prm_plan_recompile_cardinality_ratio_lower = 0;
+static int prm_plan_recompile_cardinality_ratio_upper = 1000000;
+static unsigned int prm_plan_recompile_cardinality_ratio_flag = 0;
+
+bool PRM_PARTITION_ORDERED_MERGE = true;
+static bool prm_partition_ordered_merge_default = true;
+static unsigned int prm_partition_ordered_merge_flag = 0;
+
+int PRM_XASL_CACHE_MAX_VARIANTS = 4;
+static int prm_xasl_cache_max_variants_default = 4;
+static int prm_xasl_cache_max_variants_lower = 0;
+static int prm_xasl_cache_max_variants_upper = 100;
+static unsigned int prm_xasl_cache_max_variants_flag = 0;
+
 typedef int (*DUP_PRM_FUNC) (void *, SYSPRM_DATATYPE, void *, SYSPRM_DATATYPE);
 
 static int prm_size_to_io_pages (void *out_val, SYSPRM_DATATYPE out_type, void *in_val, SYSPRM_DATATYPE in_type);
@@ -6265,6 +6379,191 @@ SYSPRM_PARAM prm_Def[] = {
    (void *) &prm_ha_sql_log_max_count_lower,
    (char *) NULL,
    (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_JOIN_BLOOM_FILTER,
+   PRM_NAME_JOIN_BLOOM_FILTER,
+   (PRM_FOR_SERVER | PRM_USER_CHANGE),
+   PRM_BOOLEAN,
+   &prm_join_bloom_filter_flag,
+   (void *) &prm_join_bloom_filter_default,
+   (void *) &PRM_JOIN_BLOOM_FILTER,
+   (void *) NULL, (void *) NULL,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_MAX_SUBQUERY_MEMO_SIZE,
+   PRM_NAME_MAX_SUBQUERY_MEMO_SIZE,
+   (PRM_FOR_SERVER | PRM_USER_CHANGE | PRM_SIZE_UNIT),
+   PRM_BIGINT,
+   &prm_max_subquery_memo_size_flag,
+   (void *) &prm_max_subquery_memo_size_default,
+   (void *) &PRM_MAX_SUBQUERY_MEMO_SIZE,
+   (void *) &prm_max_subquery_memo_size_upper,
+   (void *) &prm_max_subquery_memo_size_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_BTREE_OPTIMISTIC_DESCENT,
+   PRM_NAME_BTREE_OPTIMISTIC_DESCENT,
+   (PRM_FOR_SERVER | PRM_HIDDEN),
+   PRM_BOOLEAN,
+   &prm_btree_optimistic_descent_flag,
+   (void *) &prm_btree_optimistic_descent_default,
+   (void *) &PRM_BTREE_OPTIMISTIC_DESCENT,
+   (void *) NULL, (void *) NULL,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_BTREE_ADAPTIVE_HASH_ENTRIES,
+   PRM_NAME_BTREE_ADAPTIVE_HASH_ENTRIES,
+   (PRM_FOR_SERVER),
+   PRM_INTEGER,
+   &prm_btree_adaptive_hash_entries_flag,
+   (void *) &prm_btree_adaptive_hash_entries_default,
+   (void *) &PRM_BTREE_ADAPTIVE_HASH_ENTRIES,
+   (void *) &prm_btree_adaptive_hash_entries_upper,
+   (void *) &prm_btree_adaptive_hash_entries_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_BTREE_UNIQUE_BLOOM_FILTER,
+   PRM_NAME_BTREE_UNIQUE_BLOOM_FILTER,
+   (PRM_FOR_SERVER),
+   PRM_BOOLEAN,
+   &prm_btree_unique_bloom_filter_flag,
+   (void *) &prm_btree_unique_bloom_filter_default,
+   (void *) &PRM_BTREE_UNIQUE_BLOOM_FILTER,
+   (void *) NULL, (void *) NULL,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_INDEX_INSERT_BUFFER_SIZE,
+   PRM_NAME_INDEX_INSERT_BUFFER_SIZE,
+   (PRM_USER_CHANGE | PRM_FOR_SERVER | PRM_SIZE_UNIT),
+   PRM_BIGINT,
+   &prm_index_insert_buffer_size_flag,
+   (void *) &prm_index_insert_buffer_size_default,
+   (void *) &PRM_INDEX_INSERT_BUFFER_SIZE,
+   (void *) &prm_index_insert_buffer_size_upper,
+   (void *) &prm_index_insert_buffer_size_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_CHECKDB_THREAD_COUNT,
+   PRM_NAME_CHECKDB_THREAD_COUNT,
+   (PRM_USER_CHANGE | PRM_FOR_SERVER),
+   PRM_INTEGER,
+   &prm_checkdb_thread_count_flag,
+   (void *) &prm_checkdb_thread_count_default,
+   (void *) &PRM_CHECKDB_THREAD_COUNT,
+   (void *) &prm_checkdb_thread_count_upper,
+   (void *) &prm_checkdb_thread_count_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_STATS_DML_DELTA,
+   PRM_NAME_STATS_DML_DELTA,
+   (PRM_FOR_SERVER),
+   PRM_BOOLEAN,
+   &prm_stats_dml_delta_flag,
+   (void *) &prm_stats_dml_delta_default,
+   (void *) &PRM_STATS_DML_DELTA,
+   (void *) NULL, (void *) NULL,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_STATS_SAMPLE_ROWS,
+   PRM_NAME_STATS_SAMPLE_ROWS,
+   (PRM_USER_CHANGE | PRM_FOR_SERVER),
+   PRM_INTEGER,
+   &prm_stats_sample_rows_flag,
+   (void *) &prm_stats_sample_rows_default,
+   (void *) &PRM_STATS_SAMPLE_ROWS,
+   (void *) &prm_stats_sample_rows_upper,
+   (void *) &prm_stats_sample_rows_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_STATS_THREAD_COUNT,
+   PRM_NAME_STATS_THREAD_COUNT,
+   (PRM_USER_CHANGE | PRM_FOR_SERVER),
+   PRM_INTEGER,
+   &prm_stats_thread_count_flag,
+   (void *) &prm_stats_thread_count_default,
+   (void *) &PRM_STATS_THREAD_COUNT,
+   (void *) &prm_stats_thread_count_upper,
+   (void *) &prm_stats_thread_count_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_OPTIMIZER_DP_JOIN_MAX_TABLES,
+   PRM_NAME_OPTIMIZER_DP_JOIN_MAX_TABLES,
+   (PRM_FOR_CLIENT | PRM_USER_CHANGE),
+   PRM_INTEGER,
+   &prm_optimizer_dp_join_max_tables_flag,
+   (void *) &prm_optimizer_dp_join_max_tables_default,
+   (void *) &PRM_OPTIMIZER_DP_JOIN_MAX_TABLES,
+   (void *) &prm_optimizer_dp_join_max_tables_upper,
+   (void *) &prm_optimizer_dp_join_max_tables_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_RUNTIME_PARTITION_PRUNING,
+   PRM_NAME_RUNTIME_PARTITION_PRUNING,
+   (PRM_FOR_SERVER | PRM_USER_CHANGE),
+   PRM_BOOLEAN,
+   &prm_runtime_partition_pruning_flag,
+   (void *) &prm_runtime_partition_pruning_default,
+   (void *) &PRM_RUNTIME_PARTITION_PRUNING,
+   (void *) NULL, (void *) NULL,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_PARTITION_WISE_JOIN,
+   PRM_NAME_PARTITION_WISE_JOIN,
+   (PRM_FOR_SERVER | PRM_USER_CHANGE),
+   PRM_BOOLEAN,
+   &prm_partition_wise_join_flag,
+   (void *) &prm_partition_wise_join_default,
+   (void *) &PRM_PARTITION_WISE_JOIN,
+   (void *) NULL, (void *) NULL,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_PLAN_RECOMPILE_CARDINALITY_RATIO,
+   PRM_NAME_PLAN_RECOMPILE_CARDINALITY_RATIO,
+   (PRM_FOR_SERVER | PRM_USER_CHANGE),
+   PRM_INTEGER,
+   &prm_plan_recompile_cardinality_ratio_flag,
+   (void *) &prm_plan_recompile_cardinality_ratio_default,
+   (void *) &PRM_PLAN_RECOMPILE_CARDINALITY_RATIO,
+   (void *) &prm_plan_recompile_cardinality_ratio_upper,
+   (void *) &prm_plan_recompile_cardinality_ratio_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_PARTITION_ORDERED_MERGE,
+   PRM_NAME_PARTITION_ORDERED_MERGE,
+   (PRM_FOR_CLIENT | PRM_USER_CHANGE),
+   PRM_BOOLEAN,
+   &prm_partition_ordered_merge_flag,
+   (void *) &prm_partition_ordered_merge_default,
+   (void *) &PRM_PARTITION_ORDERED_MERGE,
+   (void *) NULL, (void *) NULL,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_XASL_CACHE_MAX_VARIANTS,
+   PRM_NAME_XASL_CACHE_MAX_VARIANTS,
+   (PRM_FOR_CLIENT | PRM_FOR_SERVER),
+   PRM_INTEGER,
+   &prm_xasl_cache_max_variants_flag,
+   (void *) &prm_xasl_cache_max_variants_default,
+   (void *) &PRM_XASL_CACHE_MAX_VARIANTS,
+   (void *) &prm_xasl_cache_max_variants_upper,
+   (void *) &prm_xasl_cache_max_variants_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
    (DUP_PRM_FUNC) NULL}
 };
 
@@ -471,8 +471,24 @@ enum param_id
   PRM_ID_STATDUMP_FORCE_ADD_INT_MAX,	/* Hidden parameter for QA only */
   PRM_ID_HA_SQL_LOG_PATH,
   PRM_ID_HA_SQL_LOG_MAX_COUNT,
+  PRM_ID_JOIN_BLOOM_FILTER,
+  PRM_ID_MAX_SUBQUERY_MEMO_SIZE,
+  PRM_ID_BTREE_OPTIMISTIC_DESCENT,
+  PRM_ID_BTREE_ADAPTIVE_HASH_ENTRIES,
+  PRM_ID_BTREE_UNIQUE_BLOOM_FILTER,
+  PRM_ID_INDEX_INSERT_BUFFER_SIZE,
+  PRM_ID_CHECKDB_THREAD_COUNT,
+  PRM_ID_STATS_DML_DELTA,
+  PRM_ID_STATS_SAMPLE_ROWS,
+  PRM_ID_STATS_THREAD_COUNT,
+  PRM_ID_OPTIMIZER_DP_JOIN_MAX_TABLES,
+  PRM_ID_RUNTIME_PARTITION_PRUNING,
+  PRM_ID_PARTITION_WISE_JOIN,
+  PRM_ID_PLAN_RECOMPILE_CARDINALITY_RATIO,
+  PRM_ID_PARTITION_ORDERED_MERGE,
+  PRM_ID_XASL_CACHE_MAX_VARIANTS,
   /* change PRM_LAST_ID when adding new system parameters */
-  PRM_LAST_ID = PRM_ID_HA_SQL_LOG_MAX_COUNT
+  PRM_LAST_ID = PRM_ID_XASL_CACHE_MAX_VARIANTS
 };
 typedef enum param_id PARAM_ID;
 
@@ -199,8 +199,8 @@ extern int xehash_destroy (THREAD_ENTRY * thread_p, EHID * ehid);
 
 extern char *xstats_get_statistics_from_server (THREAD_ENTRY * thread_p, OID * class_id, unsigned int timestamp,
 						int *length);
-extern int xstats_update_statistics (THREAD_ENTRY * thread_p, OID * classoid, bool with_fullscan);
-extern int xstats_update_all_statistics (THREAD_ENTRY * thread_p, bool with_fullscan);
+extern int xstats_update_statistics (THREAD_ENTRY * thread_p, OID * classoid, bool with_fullscan, int sample_rows);
+extern int xstats_update_all_statistics (THREAD_ENTRY * thread_p, bool with_fullscan, int sample_rows);
 
 extern DKNPAGES xdisk_get_total_numpages (THREAD_ENTRY * thread_p, VOLID volid);
 extern DKNPAGES xdisk_get_free_numpages (THREAD_ENTRY * thread_p, VOLID volid);
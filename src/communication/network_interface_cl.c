@@ -5625,16 +5625,17 @@ stats_get_statistics_from_server (OID * classoid, unsigned int timestamp, int *l
  *
  *   classoid(in):
  *   with_fullscan(in):
+ *   sample_rows(in): objects of WITH SAMPLE, or STATS_SAMPLE_ROWS_DEFAULT
  *
  * NOTE:
  */
 int
-stats_update_statistics (OID * classoid, int with_fullscan)
+stats_update_statistics (OID * classoid, int with_fullscan, int sample_rows)
 {
 #if defined(CS_MODE)
   int error = ER_NET_CLIENT_DATA_RECEIVE;
   int req_error;
-  OR_ALIGNED_BUF (OR_OID_SIZE + OR_INT_SIZE) a_request;
+  OR_ALIGNED_BUF (OR_OID_SIZE + OR_INT_SIZE + OR_INT_SIZE) a_request;
   char *request;
   OR_ALIGNED_BUF (OR_INT_SIZE) a_reply;
   char *reply;
@@ -5645,6 +5646,7 @@ stats_update_statistics (OID * classoid, int with_fullscan)
 
   ptr = or_pack_oid (request, classoid);
   ptr = or_pack_int (ptr, with_fullscan);
+  ptr = or_pack_int (ptr, sample_rows);
 
   req_error =
     net_client_request (NET_SERVER_QST_UPDATE_STATISTICS, request, OR_ALIGNED_BUF_SIZE (a_request), reply,
@@ -5660,7 +5662,9 @@ stats_update_statistics (OID * classoid, int with_fullscan)
 
   THREAD_ENTRY *thread_p = enter_server ();
 
-  success = xstats_update_statistics (thread_p, classoid, (with_fullscan ? STATS_WITH_FULLSCAN : STATS_WITH_SAMPLING));
+  success =
+    xstats_update_statistics (thread_p, classoid, (with_fullscan ? STATS_WITH_FULLSCAN : STATS_WITH_SAMPLING),
+			      sample_rows);
 
   exit_server (*thread_p);
 
@@ -5673,16 +5677,17 @@ stats_update_statistics (OID * classoid, int with_fullscan)
  *
  * return:
  *   with_fullscan(in): true iff WITH FULLSCAN
+ *   sample_rows(in): objects of WITH SAMPLE, or STATS_SAMPLE_ROWS_DEFAULT
  *
  * NOTE:
  */
 int
-stats_update_all_statistics (int with_fullscan)
+stats_update_all_statistics (int with_fullscan, int sample_rows)
 {
 #if defined(CS_MODE)
   int error = ER_NET_CLIENT_DATA_RECEIVE;
   int req_error;
-  OR_ALIGNED_BUF (OR_INT_SIZE) a_request;
+  OR_ALIGNED_BUF (OR_INT_SIZE + OR_INT_SIZE) a_request;
   char *request;
   OR_ALIGNED_BUF (OR_INT_SIZE) a_reply;
   char *reply;
@@ -5692,6 +5697,7 @@ stats_update_all_statistics (int with_fullscan)
   reply = OR_ALIGNED_BUF_START (a_reply);
 
   ptr = or_pack_int (request, with_fullscan);
+  ptr = or_pack_int (ptr, sample_rows);
 
   req_error =
     net_client_request (NET_SERVER_QST_UPDATE_ALL_STATISTICS, request, OR_ALIGNED_BUF_SIZE (a_request), reply,
@@ -5707,7 +5713,8 @@ stats_update_all_statistics (int with_fullscan)
 
   THREAD_ENTRY *thread_p = enter_server ();
 
-  success = xstats_update_all_statistics (thread_p, (with_fullscan ? STATS_WITH_FULLSCAN : STATS_WITH_SAMPLING));
+  success =
+    xstats_update_all_statistics (thread_p, (with_fullscan ? STATS_WITH_FULLSCAN : STATS_WITH_SAMPLING), sample_rows);
 
   exit_server (*thread_p);
 
@@ -6545,9 +6552,14 @@ qmgr_prepare_query (COMPILE_CONTEXT * context, xasl_stream * stream)
   char *request = NULL, *reply = NULL, *ptr = NULL, *reply_buffer = NULL;
   OR_ALIGNED_BUF (OR_INT_SIZE + OR_INT_SIZE + OR_XASL_ID_SIZE) a_reply;
   int get_xasl_header = stream->xasl_header != NULL;
+  int i;
 
   INIT_XASL_NODE_HEADER (stream->xasl_header);
 
+  /* rows given by the server are used only by the compile following this request */
+  context->is_plan_variant_requested = false;
+  context->n_cardinality_feedbacks = 0;
+
   reply = OR_ALIGNED_BUF_START (a_reply);
 
   /* sql hash text */
@@ -6613,10 +6625,20 @@ qmgr_prepare_query (COMPILE_CONTEXT * context, xasl_stream * stream)
 		}
 	      if (ptr < reply_buffer + reply_buffer_size)
 		{
-		  /* Doesn't really matter what it's packed... We need to force recompile; see sqmgr_prepare_query */
-		  assert ((ptr + OR_INT_SIZE) == (reply_buffer + reply_buffer_size));
+		  /* We need to force recompile; see sqmgr_prepare_query */
 		  assert (!context->recompile_xasl);
 		  context->recompile_xasl = true;
+
+		  ptr = or_unpack_int (ptr, &i);
+		  context->is_plan_variant_requested = (bool) i;
+		  ptr = or_unpack_int (ptr, &context->n_cardinality_feedbacks);
+		  assert (context->n_cardinality_feedbacks <= COMPILE_MAX_CARDINALITY_FEEDBACKS);
+		  for (i = 0; i < context->n_cardinality_feedbacks; i++)
+		    {
+		      ptr = or_unpack_int (ptr, &context->cardinality_feedbacks[i].key);
+		      ptr = or_unpack_int (ptr, &context->cardinality_feedbacks[i].rows);
+		    }
+		  assert (ptr == (reply_buffer + reply_buffer_size));
 		}
 	    }
 	}
@@ -230,8 +230,8 @@ extern HA_SERVER_STATE boot_change_ha_mode (HA_SERVER_STATE state, bool force, i
 extern int boot_notify_ha_log_applier_state (HA_LOG_APPLIER_STATE state);
 extern int stats_get_statistics_from_server (OID * classoid, unsigned int timestamp, int *length_ptr,
 					     char **stats_buffer);
-extern int stats_update_statistics (OID * classoid, int with_fullscan);
-extern int stats_update_all_statistics (int with_fullscan);
+extern int stats_update_statistics (OID * classoid, int with_fullscan, int sample_rows);
+extern int stats_update_all_statistics (int with_fullscan, int sample_rows);
 
 extern int btree_add_index (BTID * btid, TP_DOMAIN * key_type, OID * class_oid, int attr_id, int unique_pk);
 extern int btree_load_index (BTID * btid, const char *bt_name, TP_DOMAIN * key_type, OID * class_oids, int n_classes,
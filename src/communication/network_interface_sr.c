@@ -3968,7 +3968,7 @@ sboot_notify_ha_log_applier_state (THREAD_ENTRY * thread_p, unsigned int rid, ch
 void
 sqst_update_statistics (THREAD_ENTRY * thread_p, unsigned int rid, char *request, int reqlen)
 {
-  int error, with_fullscan;
+  int error, with_fullscan, sample_rows;
   OID classoid;
   char *ptr;
   OR_ALIGNED_BUF (OR_INT_SIZE) a_reply;
@@ -3976,8 +3976,11 @@ sqst_update_statistics (THREAD_ENTRY * thread_p, unsigned int rid, char *request
 
   ptr = or_unpack_oid (request, &classoid);
   ptr = or_unpack_int (ptr, &with_fullscan);
+  ptr = or_unpack_int (ptr, &sample_rows);
 
-  error = xstats_update_statistics (thread_p, &classoid, (with_fullscan ? STATS_WITH_FULLSCAN : STATS_WITH_SAMPLING));
+  error =
+    xstats_update_statistics (thread_p, &classoid, (with_fullscan ? STATS_WITH_FULLSCAN : STATS_WITH_SAMPLING),
+			      sample_rows);
   if (error != NO_ERROR)
     {
       (void) return_error_to_client (thread_p, rid);
@@ -4001,14 +4004,16 @@ sqst_update_statistics (THREAD_ENTRY * thread_p, unsigned int rid, char *request
 void
 sqst_update_all_statistics (THREAD_ENTRY * thread_p, unsigned int rid, char *request, int reqlen)
 {
-  int error, with_fullscan;
+  int error, with_fullscan, sample_rows;
   char *ptr;
   OR_ALIGNED_BUF (OR_INT_SIZE) a_reply;
   char *reply = OR_ALIGNED_BUF_START (a_reply);
 
   ptr = or_unpack_int (request, &with_fullscan);
+  ptr = or_unpack_int (ptr, &sample_rows);
 
-  error = xstats_update_all_statistics (thread_p, (with_fullscan ? STATS_WITH_FULLSCAN : STATS_WITH_SAMPLING));
+  error =
+    xstats_update_all_statistics (thread_p, (with_fullscan ? STATS_WITH_FULLSCAN : STATS_WITH_SAMPLING), sample_rows);
   if (error != NO_ERROR)
     {
       (void) return_error_to_client (thread_p, rid);
@@ -4814,7 +4819,10 @@ sqmgr_prepare_query (THREAD_ENTRY * thread_p, unsigned int rid, char *request, i
   XASL_NODE_HEADER xasl_header;
   OR_ALIGNED_BUF (OR_INT_SIZE + OR_INT_SIZE + OR_XASL_ID_SIZE) a_reply;
   int error = NO_ERROR;
-  COMPILE_CONTEXT context = { NULL, NULL, 0, NULL, NULL, 0, false, false, false, SHA1_HASH_INITIALIZER };
+  int i;
+  COMPILE_CONTEXT context = { NULL, NULL, 0, NULL, NULL, 0, false, false, false, SHA1_HASH_INITIALIZER,
+    false, false, NULL, 0
+  };
   XASL_STREAM stream = { NULL, NULL, NULL, 0 };
   bool was_recompile_xasl = false;
   bool force_recompile = false;
@@ -4900,7 +4908,7 @@ sqmgr_prepare_query (THREAD_ENTRY * thread_p, unsigned int rid, char *request, i
 	{
 	  /* pack XASL node header */
 	  reply_buffer_size = get_xasl_header ? XASL_NODE_HEADER_SIZE : 0;
-	  reply_buffer_size += force_recompile ? OR_INT_SIZE : 0;
+	  reply_buffer_size += force_recompile ? 2 * OR_INT_SIZE + context.n_cardinality_feedbacks * 2 * OR_INT_SIZE : 0;
 	  assert (reply_buffer_size > 0);
 
 	  reply_buffer = (char *) malloc (reply_buffer_size);
@@ -4919,8 +4927,14 @@ sqmgr_prepare_query (THREAD_ENTRY * thread_p, unsigned int rid, char *request, i
 		}
 	      if (force_recompile)
 		{
-		  /* Doesn't really matter what we pack... */
-		  ptr = or_pack_int (ptr, 1);
+		  /* why the plan is recompiled; see xcache_get_recompile_request */
+		  ptr = or_pack_int (ptr, (int) context.is_plan_variant_requested);
+		  ptr = or_pack_int (ptr, context.n_cardinality_feedbacks);
+		  for (i = 0; i < context.n_cardinality_feedbacks; i++)
+		    {
+		      ptr = or_pack_int (ptr, context.cardinality_feedbacks[i].key);
+		      ptr = or_pack_int (ptr, context.cardinality_feedbacks[i].rows);
+		    }
 		}
 	    }
 	}
@@ -54,6 +54,7 @@
 #include "jsp_cl.h"
 #include "class_object.h"
 #include "object_print.h"
+#include "object_representation.h"
 #include "dbtype.h"
 #include "tde.h"
 
@@ -201,6 +202,8 @@ static void emit_primary_and_unique_def (extract_context & ctxt, print_output &
 					 const char *class_type);
 static void emit_reverse_unique_def (extract_context & ctxt, print_output & output_ctx, DB_OBJECT * class_);
 static void emit_index_def (extract_context & ctxt, print_output & output_ctx, DB_OBJECT * class_);
+static int has_column_groups (DB_OBJECT * class_);
+static void emit_column_group_def (extract_context & ctxt, print_output & output_ctx, DB_OBJECT * class_);
 static void emit_domain_def (extract_context & ctxt, print_output & output_ctx, DB_DOMAIN * domains);
 static int emit_autoincrement_def (print_output & output_ctx, DB_ATTRIBUTE * attribute);
 static void emit_method_def (extract_context & ctxt, print_output & output_ctx, DB_METHOD * method,
@@ -1420,6 +1423,7 @@ emit_indexes (extract_context & ctxt, print_output & output_ctx, DB_OBJLIST * cl
       if (db_is_vclass (cl->op) <= 0)
 	{
 	  emit_index_def (ctxt, output_ctx, cl->op);
+	  emit_column_group_def (ctxt, output_ctx, cl->op);
 	}
     }
 
@@ -2246,6 +2250,8 @@ emit_instance_attributes (extract_context & ctxt, print_output & output_ctx, DB_
   if (has_indexes != NULL)
     {
       *has_indexes |= index_flag;
+      /* CREATE STATISTICS of the class go with its indexes, after the objects are loaded */
+      *has_indexes |= has_column_groups (class_);
     }
 
 
@@ -3519,6 +3525,111 @@ emit_index_def (extract_context & ctxt, print_output & output_ctx, DB_OBJECT * c
     }
 }
 
+/*
+ * has_column_groups - check if column groups are declared on this class by CREATE STATISTICS
+ *    return: non-zero if the class has column groups
+ *    class(in): the class to check
+ */
+static int
+has_column_groups (DB_OBJECT * class_)
+{
+  SM_CLASS *class_p;
+  DB_VALUE value;
+  int found = 0;
+
+  if (au_fetch_class (class_, &class_p, AU_FETCH_READ, AU_SELECT) == NO_ERROR)
+    {
+      found = classobj_get_prop (class_p->properties, SM_PROPERTY_COLUMN_GROUPS, &value);
+      if (found > 0)
+	{
+	  pr_clear_value (&value);
+	}
+    }
+
+  return (found > 0);
+}
+
+/*
+ * emit_column_group_def - emit the column groups declared on this class by CREATE STATISTICS
+ *    return: void
+ *    class(in): the class to emit the column groups for
+ *
+ * Note: Partitions use the column groups of their partitioned class and have none of their own. Groups having an
+ *       attribute that was dropped are left out.
+ */
+static void
+emit_column_group_def (extract_context & ctxt, print_output & output_ctx, DB_OBJECT * class_)
+{
+  SM_CLASS *class_p;
+  SM_ATTRIBUTE *att;
+  DB_VALUE value, group_value, attr_value;
+  DB_SEQ *groups, *group;
+  const char *cls_name;
+  char owner_name[DB_MAX_IDENTIFIER_LENGTH] = { '\0' };
+  char *class_name = NULL;
+  char output_owner[DB_MAX_USER_LENGTH + 4] = { '\0' };
+  int n_groups, n_attrs, i, j;
+
+  if (au_fetch_class (class_, &class_p, AU_FETCH_READ, AU_SELECT) != NO_ERROR)
+    {
+      return;
+    }
+
+  if (classobj_get_prop (class_p->properties, SM_PROPERTY_COLUMN_GROUPS, &value) <= 0)
+    {
+      return;
+    }
+
+  cls_name = db_get_class_name (class_);
+  if (DB_VALUE_TYPE (&value) != DB_TYPE_SEQUENCE || cls_name == NULL)
+    {
+      pr_clear_value (&value);
+      return;
+    }
+
+  SPLIT_USER_SPECIFIED_NAME (cls_name, owner_name, class_name);
+  PRINT_OWNER_NAME (owner_name, (ctxt.is_dba_user || ctxt.is_dba_group_member), output_owner, sizeof (output_owner));
+
+  groups = db_get_set (&value);
+  n_groups = set_size (groups);
+  for (i = 0; i < n_groups; i++)
+    {
+      if (set_get_element (groups, i, &group_value) != NO_ERROR)
+	{
+	  continue;
+	}
+
+      if (DB_VALUE_TYPE (&group_value) == DB_TYPE_SEQUENCE)
+	{
+	  group = db_get_set (&group_value);
+	  n_attrs = set_size (group);
+	  for (j = 0; j < n_attrs; j++)
+	    {
+	      if (set_get_element (group, j, &attr_value) != NO_ERROR || DB_VALUE_TYPE (&attr_value) != DB_TYPE_INTEGER
+		  || classobj_find_attribute_id (class_p, db_get_int (&attr_value), 0) == NULL)
+		{
+		  break;
+		}
+	    }
+
+	  if (j == n_attrs)
+	    {
+	      output_ctx ("CREATE STATISTICS ON %s%s%s%s (", output_owner, PRINT_IDENTIFIER (class_name));
+	      for (j = 0; j < n_attrs; j++)
+		{
+		  (void) set_get_element (group, j, &attr_value);
+		  att = classobj_find_attribute_id (class_p, db_get_int (&attr_value), 0);
+		  output_ctx ("%s%s%s%s", (j > 0) ? ", " : "", PRINT_IDENTIFIER (att->header.name));
+		}
+	      output_ctx (");\n");
+	    }
+	}
+      pr_clear_value (&group_value);
+    }
+
+  pr_clear_value (&value);
+}
+
 
 /*
  * emit_domain_def - emit a domain defintion part
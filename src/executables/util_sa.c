@@ -1421,7 +1421,7 @@ optimizedb (UTIL_FUNCTION_ARG * arg)
 	}
 
       if ((class_mop = db_find_class (class_name_p)) == NULL
-	  || sm_update_statistics (class_mop, STATS_WITH_SAMPLING) != NO_ERROR)
+	  || sm_update_statistics (class_mop, STATS_WITH_SAMPLING, STATS_SAMPLE_ROWS_DEFAULT) != NO_ERROR)
 	{
 	  PRINT_AND_LOG_ERR_MSG ("%s\n", db_error_string (3));
 	  db_shutdown ();
@@ -1430,7 +1430,7 @@ optimizedb (UTIL_FUNCTION_ARG * arg)
     }
   else
     {
-      if (sm_update_all_statistics (STATS_WITH_SAMPLING) != NO_ERROR)
+      if (sm_update_all_statistics (STATS_WITH_SAMPLING, STATS_SAMPLE_ROWS_DEFAULT) != NO_ERROR)
 	{
 	  PRINT_AND_LOG_ERR_MSG ("%s\n", db_error_string (3));
 	  db_shutdown ();
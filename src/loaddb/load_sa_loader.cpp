@@ -6627,7 +6627,7 @@ ldr_update_statistics (void)
 		   class_name);
 	  fflush (stdout);
 	}
-      err = sm_update_statistics (table->class_, STATS_WITH_SAMPLING);
+      err = sm_update_statistics (table->class_, STATS_WITH_SAMPLING, STATS_SAMPLE_ROWS_DEFAULT);
     }
   return err;
 }
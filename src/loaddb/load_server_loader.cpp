@@ -736,9 +736,22 @@ namespace cubload
     else
       {
 	log_sysop_start (m_thread_ref);
+
+	// Keys of non-unique indexes are inserted in key order after all records of the batch
+	locator_start_index_insert_buffer (&m_scancache);
+
 	int error_code = locator_multi_insert_force (m_thread_ref, &m_scancache.node.hfid, &m_scancache.node.class_oid,
 			 m_recdes_collected, true, op_type, &m_scancache, &force_count, pruning_type, NULL, NULL,
 			 UPDATE_INPLACE_NONE, true);
+	if (error_code == NO_ERROR)
+	  {
+	    error_code = locator_flush_index_insert_buffer (m_thread_ref, &m_scancache);
+	  }
+	else
+	  {
+	    // drop the keys of records that are not inserted
+	    locator_clear_index_insert_buffer (&m_scancache);
+	  }
 	if (error_code != NO_ERROR)
 	  {
 	    ASSERT_ERROR ();
@@ -4236,13 +4236,14 @@ sm_get_statistics_force (MOP classop)
  *   return: NO_ERROR on success, non-zero for ERROR
  *   classop(in): class object
  *   with_fullscan(in): true iff WITH FULLSCAN
+ *   sample_rows(in): objects of WITH SAMPLE, or STATS_SAMPLE_ROWS_DEFAULT
  *
  * NOTE: We will delay updating statistics until a transaction is committed
  *       when it is requested during other processing, such as
  *       "alter table ..." or "create index ...".
  */
 int
-sm_update_statistics (MOP classop, bool with_fullscan)
+sm_update_statistics (MOP classop, bool with_fullscan, int sample_rows)
 {
   int error = NO_ERROR, is_class = 0;
   SM_CLASS *class_;
@@ -4270,7 +4271,7 @@ sm_update_statistics (MOP classop, bool with_fullscan)
 	  return er_errid ();
 	}
 
-      error = stats_update_statistics (WS_OID (classop), (with_fullscan ? 1 : 0));
+      error = stats_update_statistics (WS_OID (classop), (with_fullscan ? 1 : 0), sample_rows);
       if (error == NO_ERROR)
 	{
 	  /* only recache if the class itself is cached */
@@ -4375,15 +4376,64 @@ sm_update_statistics_without_gathering_stats (MOP classop, bool with_fullscan)
   return error;
 }
 
+/*
+ * sm_update_column_group_statistics () - Declare or drop a group of attributes of a class, then update the
+ *					  statistics of the class.
+ *   return: NO_ERROR on success, non-zero for ERROR
+ *   classop(in): class object
+ *   n_attrs(in): number of attributes of group
+ *   attr_ids(in): distinct attributes of group; the first one leads the group
+ *   is_drop(in): true to drop the group
+ *
+ * NOTE: The group is declared with the schema of the class, so it is unloaded with the class and gathered again by
+ *       every statistics update. Partitions use the groups of their partitioned class.
+ */
+int
+sm_update_column_group_statistics (MOP classop, int n_attrs, int *attr_ids, bool is_drop)
+{
+  SM_TEMPLATE *def;
+  int error = NO_ERROR;
+
+  assert_release (classop != NULL);
+
+  def = smt_edit_class_mop (classop, AU_ALTER);
+  if (def == NULL)
+    {
+      ASSERT_ERROR_AND_SET (error);
+      return error;
+    }
+
+  error = smt_change_column_group (def, n_attrs, attr_ids, is_drop);
+  if (error == NO_ERROR)
+    {
+      error = sm_update_class (def, NULL);
+    }
+  if (error != NO_ERROR)
+    {
+      smt_quit (def);
+      return error;
+    }
+
+  /* the server reads the declared groups from the class */
+  if (locator_flush_class (classop) != NO_ERROR)
+    {
+      ASSERT_ERROR_AND_SET (error);
+      return error;
+    }
+
+  return sm_update_statistics (classop, STATS_WITH_SAMPLING, STATS_SAMPLE_ROWS_DEFAULT);
+}
+
 /*
  * sm_update_all_statistics() - Update the statistics for all classes
  * 			        in the database.
  *   with_fullscan(in): true iff WITH FULLSCAN
+ *   sample_rows(in): objects of WITH SAMPLE, or STATS_SAMPLE_ROWS_DEFAULT
  *   return: NO_ERROR on success, non-zero for ERROR
  */
 
 int
-sm_update_all_statistics (bool with_fullscan)
+sm_update_all_statistics (bool with_fullscan, int sample_rows)
 {
   int error = NO_ERROR;
   DB_OBJLIST *cl;
@@ -4396,7 +4446,7 @@ sm_update_all_statistics (bool with_fullscan)
       return er_errid ();
     }
 
-  error = stats_update_all_statistics ((with_fullscan ? 1 : 0));
+  error = stats_update_all_statistics ((with_fullscan ? 1 : 0), sample_rows);
   if (error == NO_ERROR)
     {
       /* Need to reset the statistics cache for all resident classes */
@@ -4473,7 +4523,7 @@ sm_update_catalog_statistics (const char *class_name, bool with_fullscan)
   obj = db_find_class (class_name);
   if (obj != NULL)
     {
-      error = sm_update_statistics (obj, with_fullscan);
+      error = sm_update_statistics (obj, with_fullscan, STATS_SAMPLE_ROWS_DEFAULT);
     }
   else
     {
@@ -193,8 +193,9 @@ extern int sm_touch_class (MOP classmop);
 /* Statistics functions */
 extern SM_CLASS *sm_get_class_with_statistics (MOP classop);
 extern CLASS_STATS *sm_get_statistics_force (MOP classop);
-extern int sm_update_statistics (MOP classop, bool with_fullscan);
-extern int sm_update_all_statistics (bool with_fullscan);
+extern int sm_update_statistics (MOP classop, bool with_fullscan, int sample_rows);
+extern int sm_update_all_statistics (bool with_fullscan, int sample_rows);
+extern int sm_update_column_group_statistics (MOP classop, int n_attrs, int *attr_ids, bool is_drop);
 
 /* Misc information functions */
 extern const char *sm_get_ch_name (MOP op);
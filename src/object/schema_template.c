@@ -3122,6 +3122,204 @@ error_exit:
   goto end;
 }
 
+/*
+ * smt_find_column_group() - Find a column group among the groups declared on a class.
+ *   return: index of group, or -1 if not found
+ *   groups(in): sequence of column groups, each a sequence of attribute ids
+ *   n_attrs(in): number of attributes of group
+ *   attr_ids(in): distinct attributes of group, in any order
+ */
+static int
+smt_find_column_group (DB_SEQ * groups, int n_attrs, const int *attr_ids)
+{
+  DB_VALUE group_value, attr_value;
+  DB_SEQ *group;
+  int found = -1, n_groups, i, j, k;
+
+  n_groups = set_size (groups);
+  for (i = 0; i < n_groups && found < 0; i++)
+    {
+      if (set_get_element (groups, i, &group_value) != NO_ERROR)
+	{
+	  continue;
+	}
+
+      if (DB_VALUE_TYPE (&group_value) == DB_TYPE_SEQUENCE && set_size (db_get_set (&group_value)) == n_attrs)
+	{
+	  group = db_get_set (&group_value);
+	  for (j = 0; j < n_attrs; j++)
+	    {
+	      for (k = 0; k < n_attrs; k++)
+		{
+		  if (set_get_element (group, k, &attr_value) == NO_ERROR
+		      && DB_VALUE_TYPE (&attr_value) == DB_TYPE_INTEGER && db_get_int (&attr_value) == attr_ids[j])
+		    {
+		      break;
+		    }
+		}
+	      if (k == n_attrs)
+		{
+		  break;
+		}
+	    }
+	  if (j == n_attrs)
+	    {
+	      found = i;
+	    }
+	}
+      pr_clear_value (&group_value);
+    }
+
+  return found;
+}
+
+/*
+ * smt_change_column_group() - Declare or drop a column group in the properties of a template.
+ *   return: NO_ERROR on success, non-zero for ERROR
+ *   template(in/out): schema template
+ *   n_attrs(in): number of attributes of group
+ *   attr_ids(in): distinct attributes of group; the first one keeps the statistics of the group
+ *   is_drop(in): true to drop the group
+ *
+ * Note: The groups are kept with the schema of the class, as a sequence of sequences of attribute ids; the server
+ *       gathers their statistics on the class and on its partitions. Groups having an attribute that was dropped
+ *       are removed here too.
+ */
+int
+smt_change_column_group (SM_TEMPLATE * template_, int n_attrs, const int *attr_ids, bool is_drop)
+{
+  DB_VALUE value, new_value, group_value, attr_value;
+  DB_SEQ *groups = NULL, *group = NULL;
+  int found, n_groups, i, j;
+  int error = NO_ERROR;
+
+  assert (template_ != NULL && template_->current != NULL);
+
+  db_make_null (&value);
+  db_make_null (&new_value);
+
+  if (template_->properties == NULL)
+    {
+      template_->properties = classobj_make_prop ();
+      if (template_->properties == NULL)
+	{
+	  ASSERT_ERROR_AND_SET (error);
+	  return error;
+	}
+    }
+
+  if (classobj_get_prop (template_->properties, SM_PROPERTY_COLUMN_GROUPS, &value) > 0)
+    {
+      if (DB_VALUE_TYPE (&value) != DB_TYPE_SEQUENCE)
+	{
+	  ERROR0 (error, ER_SM_INVALID_PROPERTY);
+	  goto end;
+	}
+      groups = db_get_set (&value);
+    }
+  else
+    {
+      groups = set_create_sequence (0);
+      if (groups == NULL)
+	{
+	  ASSERT_ERROR_AND_SET (error);
+	  goto end;
+	}
+    }
+
+  /* remove the groups having an attribute that was dropped */
+  for (i = set_size (groups) - 1; i >= 0; i--)
+    {
+      if (set_get_element (groups, i, &group_value) != NO_ERROR)
+	{
+	  ASSERT_ERROR_AND_SET (error);
+	  goto end;
+	}
+      if (DB_VALUE_TYPE (&group_value) == DB_TYPE_SEQUENCE)
+	{
+	  group = db_get_set (&group_value);
+	  for (j = 0; j < set_size (group); j++)
+	    {
+	      if (set_get_element (group, j, &attr_value) != NO_ERROR || DB_VALUE_TYPE (&attr_value) != DB_TYPE_INTEGER
+		  || classobj_find_attribute_id (template_->current, db_get_int (&attr_value), 0) == NULL)
+		{
+		  break;
+		}
+	    }
+	  if (j < set_size (group))
+	    {
+	      (void) set_drop_seq_element (groups, i);
+	    }
+	  group = NULL;
+	}
+      pr_clear_value (&group_value);
+    }
+
+  found = smt_find_column_group (groups, n_attrs, attr_ids);
+  n_groups = set_size (groups);
+  if (is_drop)
+    {
+      if (found < 0)
+	{
+	  ERROR0 (error, ER_OBJ_INVALID_ARGUMENTS);
+	  goto end;
+	}
+      error = set_drop_seq_element (groups, found);
+    }
+  else
+    {
+      if (found >= 0 || n_groups >= STATS_COLUMN_GROUPS_MAX)
+	{
+	  /* declared already, or too many groups */
+	  ERROR0 (error, ER_OBJ_INVALID_ARGUMENTS);
+	  goto end;
+	}
+
+      group = set_create_sequence (n_attrs);
+      if (group == NULL)
+	{
+	  ASSERT_ERROR_AND_SET (error);
+	  goto end;
+	}
+      for (j = 0; j < n_attrs && error == NO_ERROR; j++)
+	{
+	  db_make_int (&attr_value, attr_ids[j]);
+	  error = set_put_element (group, j, &attr_value);
+	}
+      if (error == NO_ERROR)
+	{
+	  db_make_sequence (&group_value, group);
+	  error = set_put_element (groups, n_groups, &group_value);
+	}
+      set_free (group);
+    }
+  if (error != NO_ERROR)
+    {
+      goto end;
+    }
+
+  if (set_size (groups) == 0)
+    {
+      (void) classobj_drop_prop (template_->properties, SM_PROPERTY_COLUMN_GROUPS);
+    }
+  else
+    {
+      db_make_sequence (&new_value, groups);
+      (void) classobj_put_prop (template_->properties, SM_PROPERTY_COLUMN_GROUPS, &new_value);
+    }
+
+end:
+  if (DB_IS_NULL (&value) && groups != NULL)
+    {
+      /* created here; otherwise freed with the property value */
+      set_free (groups);
+    }
+  pr_clear_value (&value);
+  pr_clear_value (&new_value);
+
+  return error;
+}
+
 /* TEMPLATE DELETION FUNCTIONS */
 
 /*
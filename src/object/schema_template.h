@@ -118,6 +118,9 @@ extern int smt_rename_constraint (SM_TEMPLATE * ctemplate, const char *old_name,
 /* Change comment function */
 extern int smt_change_constraint_comment (SM_TEMPLATE * ctemplate, const char *index_name, const char *comment);
 
+/* Change column group function */
+extern int smt_change_column_group (SM_TEMPLATE * template_, int n_attrs, const int *attr_ids, bool is_drop);
+
 /* Change index status function */
 extern int smt_change_constraint_status (SM_TEMPLATE * ctemplate, const char *index_name, SM_INDEX_STATUS index_status);
 
@@ -84,6 +84,7 @@ class regu_variable_node;
 #define PLAN_DUMP_ENABLED(level)	((level) >= 0x100)
 #define SIMPLE_DUMP(level)		((level) & 0x100)
 #define DETAILED_DUMP(level)		((level) & 0x200)
+#define PLANNER_STATS_DUMP(level)	((level) & 0x400)	/* times and join searches of planning */
 
 typedef struct qo_env QO_ENV;
 typedef struct qo_node QO_NODE;
@@ -125,6 +126,10 @@ typedef struct
   int pkeys_size;		/* pkeys array size */
   int *pkeys;			/* partial keys info for example: index (a, b, ..., x) pkeys[0] -> # of {a} pkeys[1] ->
 				 * # of {a, b} ... pkeys[key_size-1] -> # of {a, b, ..., x} */
+  struct stats_histogram *histogram;	/* value distribution of the attribute; NULL if unknown */
+  int attr_id;			/* id of the attribute; -1 if unknown */
+  int n_column_groups;		/* number of column_groups */
+  struct stats_column_group *column_groups;	/* correlated attributes led by the attribute; NULL if unknown */
   bool valid_limits;
   bool is_indexed;
 } QO_ATTR_CUM_STATS;
@@ -168,6 +173,7 @@ extern bool qo_is_index_iss_scan (QO_PLAN * plan);
 extern bool qo_is_index_loose_scan (QO_PLAN * plan);
 extern bool qo_is_index_mro_scan (QO_PLAN * plan);
 extern bool qo_plan_multi_range_opt (QO_PLAN * plan);
+extern bool qo_plan_ordered_partitions (QO_PLAN * plan);
 extern void qo_set_cost (DB_OBJECT * target, DB_VALUE * result, DB_VALUE * plan, DB_VALUE * cost);
 
 /*
@@ -177,6 +183,7 @@ extern int qo_xasl_get_num_terms (QO_XASL_INDEX_INFO * info);
 extern PT_NODE **qo_xasl_get_terms (QO_XASL_INDEX_INFO *);
 extern PT_NODE *qo_check_nullable_expr (PARSER_CONTEXT * parser, PT_NODE * node, void *arg, int *continue_walk);
 extern PT_NODE *mq_optimize (PARSER_CONTEXT * parser, PT_NODE * statement);
+extern bool qo_is_null_extended_spec (PT_NODE * spec);
 
 #if 0
 extern void *qo_malloc (QO_ENV *, unsigned, const char *, int);
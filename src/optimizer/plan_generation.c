@@ -1944,6 +1944,11 @@ gen_outer (QO_ENV * env, QO_PLAN * plan, BITSET * subqueries, XASL_NODE * inner_
 	    left_list = parser_append_node (left_nlist, left_elist);
 	    left_xasl = make_buildlist_proc (env, left_list);
 	    left_xasl = gen_outer (env, outer, &EMPTY_SET, NULL, NULL, left_xasl);
+	    if (left_xasl != NULL)
+	      {
+		left_xasl->cardinality = (outer->info)->cardinality;
+		left_xasl->cardinality_key = qo_get_cardinality_key (env, &((outer->info)->nodes));
+	      }
 	    bitset_assign (&((outer->info)->projected_segs), &temp_segs);	/* restore */
 
 	    /* build inner segs namelist */
@@ -1957,6 +1962,11 @@ gen_outer (QO_ENV * env, QO_PLAN * plan, BITSET * subqueries, XASL_NODE * inner_
 	    rght_list = parser_append_node (rght_nlist, rght_elist);
 	    rght_xasl = make_buildlist_proc (env, rght_list);
 	    rght_xasl = gen_outer (env, inner, &EMPTY_SET, NULL, NULL, rght_xasl);
+	    if (rght_xasl != NULL)
+	      {
+		rght_xasl->cardinality = (inner->info)->cardinality;
+		rght_xasl->cardinality_key = qo_get_cardinality_key (env, &((inner->info)->nodes));
+	      }
 	    bitset_assign (&((inner->info)->projected_segs), &temp_segs);	/* restore */
 
 	    merge =
@@ -2284,6 +2294,12 @@ gen_inner (QO_ENV * env, QO_PLAN * plan, BITSET * predset, BITSET * subqueries,
       namelist = make_namelist_from_projected_segs (env, plan);
       listfile = make_buildlist_proc (env, namelist);
       listfile = gen_outer (env, plan, &EMPTY_SET, NULL, NULL, listfile);
+      if (listfile != NULL)
+	{
+	  /* save the estimate to check it against the rows of the temporary list */
+	  listfile->cardinality = (plan->info)->cardinality;
+	  listfile->cardinality_key = qo_get_cardinality_key (env, &((plan->info)->nodes));
+	}
       scan = make_scan_proc (env);
       scan = init_list_scan_proc (env, scan, listfile, namelist, predset, NULL);
       if (namelist)
@@ -2348,6 +2364,7 @@ preserve_info (QO_ENV * env, QO_PLAN * plan, XASL_NODE * xasl)
 	{
 	  xasl->projected_size = (plan->info)->projected_size;
 	  xasl->cardinality = (plan->info)->cardinality;
+	  xasl->cardinality_key = qo_get_cardinality_key (env, &((plan->info)->nodes));
 	}
     }
 
@@ -2591,6 +2608,23 @@ qo_is_index_mro_scan (QO_PLAN * plan)
   return false;
 }
 
+/*
+ * qo_plan_ordered_partitions () - check if the plan scans the partitions of a class in the order of ORDER BY
+ *   return: true/false
+ *   plan(in): QO_PLAN, the scan itself or the ORDER BY or SORT_LIMIT sort over it
+ */
+bool
+qo_plan_ordered_partitions (QO_PLAN * plan)
+{
+  if (plan != NULL && plan->plan_type == QO_PLANTYPE_SORT
+      && (plan->plan_un.sort.sort_type == SORT_ORDERBY || plan->plan_un.sort.sort_type == SORT_LIMIT))
+    {
+      plan = plan->plan_un.sort.subplan;
+    }
+
+  return (plan != NULL && plan->plan_type == QO_PLANTYPE_SCAN && plan->plan_un.scan.index_ordered_partitions);
+}
+
 /*
  * qo_plan_multi_range_opt () - check the plan info for multi range opt
  *   return: true/false
@@ -4706,6 +4740,10 @@ make_sort_limit_proc (QO_ENV * env, QO_PLAN * plan, PT_NODE * namelist, XASL_NOD
   listfile = make_buildlist_proc (env, node_list);
   listfile = gen_outer (env, plan->plan_un.sort.subplan, &EMPTY_SET, NULL, NULL, listfile);
   listfile = add_sort_spec (env, listfile, plan, xasl->ordbynum_val, false);
+  if (listfile != NULL && qo_plan_ordered_partitions (plan))
+    {
+      XASL_SET_FLAG (listfile, XASL_ORDERED_PARTITION_SCAN);
+    }
 
 cleanup:
   if (node_list != NULL)
@@ -106,6 +106,8 @@
 #define NOMINAL_HEAP_SIZE(class)	200	/* pages */
 #define NOMINAL_OBJECT_SIZE(class)	 64	/* bytes */
 
+#define QO_COLUMN_GROUP_SARGS_MAX 64	/* equality sargs of a node matched to its column groups */
+
 /* Figure out how many bytes a QO_NODE_INDEX struct with n entries requires. */
 #define SIZEOF_NODE_INDEX(n) \
     (sizeof(QO_NODE_INDEX) + (((n)-1)* sizeof(QO_NODE_INDEX_ENTRY)))
@@ -203,6 +205,7 @@ static void qo_estimate_statistics (MOP class_mop, CLASS_STATS *);
 static void qo_node_free (QO_NODE *);
 static void qo_node_dump (QO_NODE *, FILE *);
 static void qo_node_add_sarg (QO_NODE *, QO_TERM *);
+static void qo_node_apply_column_groups (QO_ENV * env, QO_NODE * node);
 
 static void qo_seg_free (QO_SEGMENT *);
 
@@ -611,6 +614,11 @@ qo_optimize_helper (QO_ENV * env)
     {
       qo_env_dump (env, db_query_get_plan_dump_fp ());
     }
+  if (plan && PLANNER_STATS_DUMP (level) && env->plan_dump_enabled)
+    {
+      /* the counters are of the search just done */
+      qo_planner_stats (db_query_get_plan_dump_fp ());
+    }
   if (plan == NULL)
     {
       qo_env_free (env);
@@ -5015,6 +5023,10 @@ qo_get_attr_info_func_index (QO_ENV * env, QO_SEGMENT * seg, const char *expr_st
   cum_statsp->key_type = NULL;
   cum_statsp->pkeys_size = 0;
   cum_statsp->pkeys = NULL;
+  cum_statsp->histogram = NULL;
+  cum_statsp->attr_id = -1;
+  cum_statsp->n_column_groups = 0;
+  cum_statsp->column_groups = NULL;
 
   /* set the statistics from the class information(QO_CLASS_INFO_ENTRY) */
   for (i = 0; i < n; class_info_entryp++, i++)
@@ -5187,6 +5199,10 @@ qo_get_attr_info (QO_ENV * env, QO_SEGMENT * seg)
       cum_statsp->key_type = NULL;
       cum_statsp->pkeys_size = 0;
       cum_statsp->pkeys = NULL;
+      cum_statsp->histogram = NULL;
+      cum_statsp->attr_id = -1;
+      cum_statsp->n_column_groups = 0;
+      cum_statsp->column_groups = NULL;
 
       return attr_infop;
     }
@@ -5200,6 +5216,10 @@ qo_get_attr_info (QO_ENV * env, QO_SEGMENT * seg)
   cum_statsp->key_type = NULL;
   cum_statsp->pkeys_size = 0;
   cum_statsp->pkeys = NULL;
+  cum_statsp->histogram = NULL;
+  cum_statsp->attr_id = -1;
+  cum_statsp->n_column_groups = 0;
+  cum_statsp->column_groups = NULL;
 
   /* set the statistics from the class information(QO_CLASS_INFO_ENTRY) */
   for (i = 0; i < n; class_info_entryp++, i++)
@@ -5251,6 +5271,15 @@ qo_get_attr_info (QO_ENV * env, QO_SEGMENT * seg)
 	  cum_statsp->valid_limits = true;
 	}
 
+      if (n == 1)
+	{
+	  /* the histogram and column groups of a class hierarchy are not known */
+	  cum_statsp->histogram = attr_statsp->histogram;
+	  cum_statsp->attr_id = attr_statsp->id;
+	  cum_statsp->n_column_groups = attr_statsp->n_column_groups;
+	  cum_statsp->column_groups = attr_statsp->column_groups;
+	}
+
       n_func_indexes = 0;
       n_unavail_indexes = 0;
       for (j = 0; j < attr_statsp->n_btstats; j++)
@@ -6098,6 +6127,12 @@ qo_discover_edges (QO_ENV * env)
 	}
     }
 
+  /* sargs on correlated attributes are not independent of each other */
+  for (i = 0; i < env->nnodes; i++)
+    {
+      qo_node_apply_column_groups (env, QO_ENV_NODE (env, i));
+    }
+
   /*
    * Check some invariants.  If something has gone wrong during the
    * discovery phase to violate these invariants, it will mean certain
@@ -8239,6 +8274,150 @@ qo_node_add_sarg (QO_NODE * node, QO_TERM * sarg)
     }
 }
 
+/*
+ * qo_node_apply_column_groups () - Correct the selectivity of a node for equality sargs on the attributes of its
+ *				    column groups
+ *   return:
+ *   env(in): optimizer environment
+ *   node(in/out): node whose sargs were added
+ *
+ * Note: qo_node_add_sarg () multiplies the selectivities of sargs as if they were independent. The equality sargs on
+ *	 two or more attributes of a column group (CREATE STATISTICS) are combined again: the attribute determining the
+ *	 others best is selected first, the others select what it does not determine. A group whose attributes are
+ *	 all compared selects no less than one of its distinct values.
+ */
+static void
+qo_node_apply_column_groups (QO_ENV * env, QO_NODE * node)
+{
+  QO_TERM *term;
+  QO_SEGMENT *seg;
+  QO_ATTR_CUM_STATS *cum_statsp;
+  STATS_COLUMN_GROUP *group;
+  PT_NODE *pt_expr;
+  BITSET_ITERATOR iter;
+  int sarg_attr_ids[QO_COLUMN_GROUP_SARGS_MAX];
+  double sarg_sels[QO_COLUMN_GROUP_SARGS_MAX];
+  QO_ATTR_CUM_STATS *sarg_stats[QO_COLUMN_GROUP_SARGS_MAX];
+  bool sarg_used[QO_COLUMN_GROUP_SARGS_MAX];
+  int covered[STATS_COLUMN_GROUP_ATTRS_MAX];
+  int n_sargs, n_covered, determinant, t, s, g, k;
+  double independent, rest, sel, sel_limit;
+
+  if (QO_NODE_INFO (node) == NULL || QO_NODE_INFO_N (node) != 1 || bitset_cardinality (&(QO_NODE_SARGS (node))) < 2)
+    {
+      /* column groups of a class hierarchy are not known */
+      return;
+    }
+
+  /* equality sargs of single attributes */
+  n_sargs = 0;
+  for (t = bitset_iterate (&(QO_NODE_SARGS (node)), &iter); t != -1 && n_sargs < QO_COLUMN_GROUP_SARGS_MAX;
+       t = bitset_next_member (&iter))
+    {
+      term = QO_ENV_TERM (env, t);
+      pt_expr = QO_TERM_PT_EXPR (term);
+      if (!QO_TERM_IS_FLAGED (term, QO_TERM_SINGLE_PRED) || !QO_TERM_IS_FLAGED (term, QO_TERM_EQUAL_OP)
+	  || QO_TERM_IS_FLAGED (term, QO_TERM_RANGELIST) || bitset_cardinality (&(QO_TERM_SEGS (term))) != 1
+	  || pt_expr == NULL || pt_expr->node_type != PT_EXPR
+	  || (pt_expr->info.expr.arg1->node_type != PT_NAME
+	      && (pt_expr->info.expr.arg2 == NULL || pt_expr->info.expr.arg2->node_type != PT_NAME)))
+	{
+	  continue;
+	}
+
+      seg = QO_ENV_SEG (env, bitset_first_member (&(QO_TERM_SEGS (term))));
+      if (QO_SEG_INFO (seg) == NULL || QO_SEG_INFO (seg)->cum_stats.attr_id < 0)
+	{
+	  continue;
+	}
+
+      sarg_attr_ids[n_sargs] = QO_SEG_INFO (seg)->cum_stats.attr_id;
+      sarg_sels[n_sargs] = QO_TERM_SELECTIVITY (term);
+      sarg_stats[n_sargs] = &QO_SEG_INFO (seg)->cum_stats;
+      sarg_used[n_sargs] = false;
+      n_sargs++;
+    }
+
+  for (s = 0; s < n_sargs; s++)
+    {
+      cum_statsp = sarg_stats[s];
+      for (g = 0; g < cum_statsp->n_column_groups; g++)
+	{
+	  group = &cum_statsp->column_groups[g];
+
+	  /* sargs comparing the attributes of group; each attribute once */
+	  n_covered = 0;
+	  for (k = 0; k < group->n_attrs; k++)
+	    {
+	      for (t = 0; t < n_sargs; t++)
+		{
+		  if (!sarg_used[t] && sarg_attr_ids[t] == group->attr_ids[k])
+		    {
+		      break;
+		    }
+		}
+	      covered[k] = (t < n_sargs) ? t : -1;
+	      n_covered += (t < n_sargs) ? 1 : 0;
+	    }
+	  if (n_covered < 2)
+	    {
+	      continue;
+	    }
+
+	  /* the attribute determining the others best */
+	  determinant = -1;
+	  independent = 1.0;
+	  for (k = 0; k < group->n_attrs; k++)
+	    {
+	      if (covered[k] < 0)
+		{
+		  continue;
+		}
+	      independent *= sarg_sels[covered[k]];
+	      if (determinant < 0 || group->degrees[k] > group->degrees[determinant])
+		{
+		  determinant = k;
+		}
+	    }
+
+	  rest = 1.0;
+	  for (k = 0; k < group->n_attrs; k++)
+	    {
+	      if (covered[k] >= 0 && k != determinant)
+		{
+		  rest *= sarg_sels[covered[k]];
+		}
+	    }
+	  sel = qo_and_selectivity (env, sarg_sels[covered[determinant]], rest, group->degrees[determinant]);
+	  if (n_covered == group->n_attrs && group->ndv >= 1.0)
+	    {
+	      sel = MAX (sel, MIN (1.0 / group->ndv, sarg_sels[covered[determinant]]));
+	    }
+
+	  if (independent <= 0.0 || sel <= independent)
+	    {
+	      continue;
+	    }
+
+	  for (k = 0; k < group->n_attrs; k++)
+	    {
+	      if (covered[k] >= 0)
+		{
+		  sarg_used[covered[k]] = true;
+		}
+	    }
+
+	  QO_NODE_SELECTIVITY (node) = MIN (QO_NODE_SELECTIVITY (node) / independent * sel, 1.0);
+	}
+    }
+
+  sel_limit = (QO_NODE_NCARD (node) == 0) ? 0 : (1.0 / (double) QO_NODE_NCARD (node));
+  if (QO_NODE_SELECTIVITY (node) < sel_limit)
+    {
+      QO_NODE_SELECTIVITY (node) = sel_limit;
+    }
+}
+
 /*
  * qo_node_fprint () -
  *   return:
@@ -9274,6 +9453,7 @@ qo_print_stats (FILE * f)
   fputs ("\n", f);
   qo_info_stats (f);
   qo_plans_stats (f);
+  qo_planner_stats (f);
 #if defined (CUBRID_DEBUG)
   set_stats (f);
 #endif
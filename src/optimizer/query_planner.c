@@ -50,7 +50,10 @@
 #include "schema_manager.h"
 #include "network_interface_cl.h"
 #include "dbtype.h"
+#include "numeric_opfunc.h"
 #include "regu_var.hpp"
+#include "tsc_timer.h"
+#include "memory_hash.h"
 
 #define INDENT_INCR		4
 #define INDENT_FMT		"%*c"
@@ -94,6 +97,14 @@ typedef int (*QO_WALK_FUNCTION) (QO_PLAN *, void *);
 static int infos_allocated = 0;
 static int infos_deallocated = 0;
 
+/* planning phase counters of the last optimized query */
+static UINT64 qo_planning_usecs = 0;
+static UINT64 qo_join_search_usecs = 0;
+static int qo_join_visits = 0;
+static int qo_dp_join_searches = 0;
+static int qo_windowed_join_searches = 0;
+static int qo_permutation_join_searches = 0;
+
 static int qo_plans_allocated;
 static int qo_plans_deallocated;
 static int qo_plans_malloced;
@@ -157,6 +168,7 @@ static QO_PLAN *qo_find_best_plan_on_planvec (QO_PLANVEC *, double);
 
 static void qo_info_nodes_init (QO_ENV *);
 static QO_INFO *qo_alloc_info (QO_PLANNER *, BITSET *, BITSET *, BITSET *, double);
+static void qo_apply_cardinality_feedback (QO_ENV * env, BITSET * nodes, double *cardinality);
 static void qo_free_info (QO_INFO *);
 static void qo_detach_info (QO_INFO *);
 static void qo_dump_planvec (QO_PLANVEC *, FILE *, int);
@@ -168,6 +180,8 @@ static void planner_visit_node (QO_PLANNER *, QO_PARTITION *, PT_HINT_ENUM, QO_N
 static double planner_nodeset_join_cost (QO_PLANNER *, BITSET *);
 static void planner_permutate (QO_PLANNER *, QO_PARTITION *, PT_HINT_ENUM, QO_NODE *, BITSET *, BITSET *, BITSET *,
 			       BITSET *, BITSET *, BITSET *, BITSET *, BITSET *, int, int *);
+static void planner_dp_extend (QO_PLANNER *, QO_PARTITION *, PT_HINT_ENUM, QO_INFO *, BITSET *, BITSET *, BITSET *);
+static QO_INFO *planner_dp_search (QO_PLANNER *, QO_PARTITION *, PT_HINT_ENUM, BITSET *, BITSET *, BITSET *);
 
 static QO_PLAN *qo_find_best_nljoin_inner_plan_on_info (QO_PLAN *, QO_INFO *, JOIN_TYPE, int);
 static QO_PLAN *qo_find_best_plan_on_info (QO_INFO *, QO_EQCLASS *, double);
@@ -232,7 +246,8 @@ static int qo_validate_index_for_groupby (QO_ENV * env, QO_NODE_INDEX_ENTRY * ni
 static PT_NODE *qo_search_isnull_key_expr (PARSER_CONTEXT * parser, PT_NODE * tree, void *arg, int *continue_walk);
 static bool qo_check_orderby_skip_descending (QO_PLAN * plan);
 static bool qo_check_groupby_skip_descending (QO_PLAN * plan, PT_NODE * list);
-static PT_NODE *qo_plan_compute_iscan_sort_list (QO_PLAN * root, PT_NODE * group_by, bool * is_index_w_prefix);
+static PT_NODE *qo_plan_compute_iscan_sort_list (QO_PLAN * root, PT_NODE * group_by, bool * is_index_w_prefix,
+						 bool is_partition_scan);
 
 static int qo_walk_plan_tree (QO_PLAN * plan, QO_WALK_FUNCTION f, void *arg);
 static void qo_set_use_desc (QO_PLAN * plan);
@@ -242,6 +257,8 @@ static int qo_validate_indexes_for_orderby (QO_PLAN * plan, void *arg);
 static int qo_unset_multi_range_optimization (QO_PLAN * plan, void *arg);
 static bool qo_plan_is_orderby_skip_candidate (QO_PLAN * plan);
 static bool qo_is_sort_limit (QO_PLAN * plan);
+static bool qo_check_ordered_partitions (QO_PLAN * plan);
+static void qo_ordered_partitions_cost (QO_PLAN * plan);
 
 static json_t *qo_plan_scan_print_json (QO_PLAN * plan);
 static json_t *qo_plan_sort_print_json (QO_PLAN * plan);
@@ -393,7 +410,6 @@ typedef enum PRED_CLASS
 
 static double qo_or_selectivity (QO_ENV * env, double lhs_sel, double rhs_sel);
 
-static double qo_and_selectivity (QO_ENV * env, double lhs_sel, double rhs_sel);
 
 static double qo_not_selectivity (QO_ENV * env, double sel);
 
@@ -411,6 +427,23 @@ static PRED_CLASS qo_classify (PT_NODE * attr);
 
 static int qo_index_cardinality (QO_ENV * env, PT_NODE * attr);
 
+static STATS_HISTOGRAM *qo_attr_histogram (QO_ENV * env, PT_NODE * attr);
+
+static double qo_histogram_equal_selectivity (QO_ENV * env, PT_NODE * attr, PT_NODE * value_node);
+
+static double qo_histogram_other_selectivity (STATS_HISTOGRAM * histogram);
+
+static int qo_selectivity_range (double selectivity);
+
+static DB_VALUE *qo_peek_host_var (QO_ENV * env, STATS_HISTOGRAM * histogram, PT_NODE * host_var);
+
+static double qo_histogram_between_selectivity (QO_ENV * env, PT_NODE * attr, PT_OP_TYPE between_op, PT_NODE * arg1,
+						PT_NODE * arg2);
+
+static double qo_histogram_below (STATS_HISTOGRAM * histogram, DB_VALUE * value, bool inclusive);
+
+static bool qo_histogram_position (const DB_VALUE * value, double *position);
+
 /*
  * log3 () -
  *   return:
@@ -937,7 +970,7 @@ qo_top_plan_new (QO_PLAN * plan)
 	}			/* for (t = ...) */
       found_instnum = (t == -1) ? false : true;
 
-      plan->iscan_sort_list = qo_plan_compute_iscan_sort_list (plan, NULL, &is_index_w_prefix);
+      plan->iscan_sort_list = qo_plan_compute_iscan_sort_list (plan, NULL, &is_index_w_prefix, false);
 
       /* GROUP BY */
       /* if we have rollup, we do not skip the group by */
@@ -945,7 +978,7 @@ qo_top_plan_new (QO_PLAN * plan)
 	{
 	  PT_NODE *group_sort_list = NULL;
 
-	  group_sort_list = qo_plan_compute_iscan_sort_list (plan, group_by, &is_index_w_prefix);
+	  group_sort_list = qo_plan_compute_iscan_sort_list (plan, group_by, &is_index_w_prefix, false);
 
 	  if (group_sort_list)
 	    {
@@ -1078,8 +1111,13 @@ qo_top_plan_new (QO_PLAN * plan)
 	    }
 	  else
 	    {
+	      if (plan->plan_type == QO_PLANTYPE_SCAN && qo_check_ordered_partitions (plan))
+		{
+		  /* the top-n sort of ORDER BY ... LIMIT reads only the first rows of each partition */
+		  qo_ordered_partitions_cost (plan);
+		}
 	      /* if the order by is not skipped we drop the plan because it didn't helped us */
-	      if (qo_is_iscan_from_orderby (plan))
+	      else if (qo_is_iscan_from_orderby (plan))
 		{
 		  qo_worst_cost (plan);
 		  return plan;
@@ -1433,6 +1471,7 @@ qo_scan_new (QO_INFO * info, QO_NODE * node, QO_SCANMETHOD scan_method)
   plan->plan_un.scan.index_cover = false;
   plan->plan_un.scan.index_iss = false;
   plan->plan_un.scan.index_loose = false;
+  plan->plan_un.scan.index_ordered_partitions = false;
   plan->plan_un.scan.index = NULL;
 
   plan->multi_range_opt_use = PLAN_MULTI_RANGE_OPT_NO;
@@ -1828,7 +1867,7 @@ qo_index_scan_new (QO_INFO * info, QO_NODE * node, QO_NODE_INDEX_ENTRY * ni_entr
       bool dummy;
 
       plan->multi_range_opt_use = PLAN_MULTI_RANGE_OPT_USE;
-      plan->iscan_sort_list = qo_plan_compute_iscan_sort_list (plan, NULL, &dummy);
+      plan->iscan_sort_list = qo_plan_compute_iscan_sort_list (plan, NULL, &dummy, false);
     }
 
   assert (plan->plan_un.scan.index != NULL);
@@ -2171,6 +2210,11 @@ qo_scan_fprint (QO_PLAN * plan, FILE * f, int howfar)
 	  fprintf (f, " (multi_range_opt)");
 	}
 
+      if (plan->plan_un.scan.index_ordered_partitions)
+	{
+	  fprintf (f, plan->use_iscan_descending ? " (ordered partitions, desc_index)" : " (ordered partitions)");
+	}
+
       if (plan->plan_un.scan.index && plan->plan_un.scan.index->head->use_descending)
 	{
 	  fprintf (f, " (desc_index)");
@@ -2295,6 +2339,11 @@ qo_scan_info (QO_PLAN * plan, FILE * f, int howfar)
 	  fprintf (f, " (multi_range_opt)");
 	}
 
+      if (plan->plan_un.scan.index_ordered_partitions)
+	{
+	  fprintf (f, plan->use_iscan_descending ? " (ordered partitions, desc_index)" : " (ordered partitions)");
+	}
+
       if (plan->plan_un.scan.index && plan->plan_un.scan.index->head->use_descending)
 	{
 	  fprintf (f, " (desc_index)");
@@ -2815,7 +2864,7 @@ qo_join_new (QO_INFO * info, JOIN_TYPE join_type, QO_JOINMETHOD join_method, QO_
       bool dummy;
 
       plan->multi_range_opt_use = PLAN_MULTI_RANGE_OPT_USE;
-      plan->iscan_sort_list = qo_plan_compute_iscan_sort_list (plan, NULL, &dummy);
+      plan->iscan_sort_list = qo_plan_compute_iscan_sort_list (plan, NULL, &dummy, false);
     }
 
   qo_plan_compute_cost (plan);
@@ -5194,6 +5243,69 @@ qo_info_nodes_init (QO_ENV * env)
   infos_deallocated = 0;
 }
 
+/*
+ * qo_get_cardinality_key () - Make the key of an intermediate result from its joined nodes
+ *   return: key; never zero
+ *   env(in): optimizer environment
+ *   nodes(in): joined nodes
+ *
+ * Note: The key is saved to XASL nodes whose rows are checked against the estimate by the server. The server gives
+ *       the rows back with the same key when the plan is recompiled; see qo_apply_cardinality_feedback ().
+ */
+int
+qo_get_cardinality_key (QO_ENV * env, BITSET * nodes)
+{
+  BITSET_ITERATOR bi;
+  PT_NODE *range_var;
+  unsigned int key;
+  int i;
+
+  key = (unsigned int) env->nnodes;
+  for (i = bitset_iterate (nodes, &bi); i != -1; i = bitset_next_member (&bi))
+    {
+      key = key * 31 + (unsigned int) i;
+      range_var = QO_NODE_ENTITY_SPEC (QO_ENV_NODE (env, i))->info.spec.range_var;
+      if (range_var != NULL && range_var->info.name.original != NULL)
+	{
+	  key = key * 31 + mht_1strlowerhash (range_var->info.name.original, INT_MAX);
+	}
+    }
+
+  key &= INT_MAX;
+  return (key == 0) ? 1 : (int) key;
+}
+
+/*
+ * qo_apply_cardinality_feedback () - Replace the estimated cardinality of joined nodes by the rows found by
+ *				      execution of the plan which is recompiled
+ *   return: nothing
+ *   env(in): optimizer environment
+ *   nodes(in): joined nodes
+ *   cardinality(in/out): estimated cardinality
+ */
+static void
+qo_apply_cardinality_feedback (QO_ENV * env, BITSET * nodes, double *cardinality)
+{
+  COMPILE_CONTEXT *context = &QO_ENV_PARSER (env)->context;
+  int key;
+  int i;
+
+  if (context->n_cardinality_feedbacks <= 0)
+    {
+      return;
+    }
+
+  key = qo_get_cardinality_key (env, nodes);
+  for (i = 0; i < context->n_cardinality_feedbacks; i++)
+    {
+      if (context->cardinality_feedbacks[i].key == key)
+	{
+	  *cardinality = MAX ((double) context->cardinality_feedbacks[i].rows, 1.0);
+	  return;
+	}
+    }
+}
+
 /*
  * qo_alloc_info () -
  *   return:
@@ -5234,6 +5346,10 @@ qo_alloc_info (QO_PLANNER * planner, BITSET * nodes, BITSET * terms, BITSET * eq
   qo_compute_projected_segs (planner, nodes, terms, &info->projected_segs);
   info->projected_size = qo_compute_projected_size (planner, &info->projected_segs);
   info->cardinality = cardinality;
+  if (cardinality < QO_INFINITY)
+    {
+      qo_apply_cardinality_feedback (planner->env, nodes, &info->cardinality);
+    }
 
   qo_init_planvec (&info->best_no_order);
 
@@ -6315,6 +6431,20 @@ qo_info_stats (FILE * f)
   fprintf (f, "%d/%d info nodes allocated/deallocated\n", infos_allocated, infos_deallocated);
 }
 
+/*
+ * qo_planner_stats () - print the planning phase counters of the last optimized query
+ *   return:
+ *   f(in):
+ */
+void
+qo_planner_stats (FILE * f)
+{
+  fprintf (f, "%lld usecs planning, %lld usecs join search\n", (long long) qo_planning_usecs,
+	   (long long) qo_join_search_usecs);
+  fprintf (f, "%d/%d/%d join searches dp/windowed/permutation, %d join visits\n", qo_dp_join_searches,
+	   qo_windowed_join_searches, qo_permutation_join_searches, qo_join_visits);
+}
+
 /*
  * qo_alloc_planner () -
  *   return:
@@ -6349,6 +6479,7 @@ qo_alloc_planner (QO_ENV * env)
       planner->node_mask = (unsigned long) DB_UINT32_MAX;
     }
   planner->join_unit = 0;
+  planner->dp_enumerate = false;
   planner->term = env->terms;
   planner->T = env->nterms;
   planner->segment = env->segs;
@@ -6526,6 +6657,7 @@ planner_visit_node (QO_PLANNER * planner, QO_PARTITION * partition, PT_HINT_ENUM
   bitset_init (&info_terms, planner->env);
   bitset_init (&pinned_subqueries, planner->env);
 
+  qo_join_visits++;
 
   if (head_node == NULL)
     {
@@ -7135,7 +7267,17 @@ go_ahead_subvisit:
    * permutations (i.e., we have considered every one of the nodes). If not, we need to try to recursively generate
    * suffixes.
    */
-  if (bitset_cardinality (visited_nodes) >= planner->join_unit)
+  if (planner->dp_enumerate)
+    {
+      /* planner_dp_search () visits the larger subsets by itself. Only the info of the entire partition may be used
+       * to prune plans; the plans of other subsets of the same size are not comparable.
+       */
+      if (!planner->best_info && bitset_is_equivalent (visited_nodes, &(QO_PARTITION_NODES (partition))))
+	{
+	  planner->best_info = new_info;
+	}
+    }
+  else if (bitset_cardinality (visited_nodes) >= planner->join_unit)
     {
       /* If this is the info node that corresponds to the final plan (i.e., every node in the partition is covered by
        * the plans at this node), *AND* we have something to put in it, then record that fact in the planner.  This
@@ -7469,6 +7611,249 @@ planner_permutate (QO_PLANNER * planner, QO_PARTITION * partition, PT_HINT_ENUM
   return;
 }
 
+/*
+ * planner_dp_extend () - join each neighbour node to the subset of nodes of head_info
+ *   return:
+ *   planner(in):
+ *   partition(in):
+ *   hint(in):
+ *   head_info(in): info of a connected subset of the partition nodes
+ *   neighbors(in): nodes joined to each node by an edge
+ *   partition_terms(in): terms of the partition
+ *   remaining_subqueries(in):
+ */
+static void
+planner_dp_extend (QO_PLANNER * planner, QO_PARTITION * partition, PT_HINT_ENUM hint, QO_INFO * head_info,
+		   BITSET * neighbors, BITSET * partition_terms, BITSET * remaining_subqueries)
+{
+  QO_ENV *env = planner->env;
+  int i;
+  BITSET_ITERATOR bi;
+  QO_NODE *head_node, *tail_node;
+  QO_SUBQUERY *subq;
+  BITSET visited_nodes;
+  BITSET visited_rel_nodes;
+  BITSET visited_terms;
+  BITSET nested_path_nodes;
+  BITSET remaining_nodes;
+  BITSET remaining_terms;
+  BITSET subset_subqueries;
+  BITSET tail_nodes;
+
+  bitset_init (&visited_nodes, env);
+  bitset_init (&visited_rel_nodes, env);
+  bitset_init (&visited_terms, env);
+  bitset_init (&nested_path_nodes, env);
+  bitset_init (&remaining_nodes, env);
+  bitset_init (&remaining_terms, env);
+  bitset_init (&subset_subqueries, env);
+  bitset_init (&tail_nodes, env);
+
+  /* rebuild the state planner_visit_node () would have when it reached the subset */
+  bitset_assign (&visited_nodes, &(head_info->nodes));
+  for (i = bitset_iterate (&visited_nodes, &bi); i != -1; i = bitset_next_member (&bi))
+    {
+      bitset_add (&visited_rel_nodes, QO_NODE_REL_IDX (QO_ENV_NODE (env, i)));
+      bitset_union (&tail_nodes, &neighbors[i]);
+    }
+
+  bitset_assign (&visited_terms, &(head_info->terms));
+  bitset_assign (&remaining_terms, partition_terms);
+  bitset_difference (&remaining_terms, &visited_terms);
+
+  bitset_assign (&remaining_nodes, &(QO_PARTITION_NODES (partition)));
+  bitset_difference (&remaining_nodes, &visited_nodes);
+
+  /* subqueries are pinned by the smallest subset that covers them */
+  bitset_assign (&subset_subqueries, remaining_subqueries);
+  for (i = bitset_iterate (remaining_subqueries, &bi); i != -1; i = bitset_next_member (&bi))
+    {
+      subq = &planner->subqueries[i];
+      if (bitset_subset (&visited_nodes, &(subq->nodes)) && bitset_subset (&visited_terms, &(subq->terms)))
+	{
+	  bitset_remove (&subset_subqueries, i);
+	}
+    }
+
+  /* do not permit cross join plan; only the neighbours of the subset are joined */
+  bitset_intersect (&tail_nodes, &remaining_nodes);
+
+  head_node = QO_ENV_NODE (env, bitset_first_member (&visited_nodes));
+
+  for (i = bitset_iterate (&tail_nodes, &bi); i != -1; i = bitset_next_member (&bi))
+    {
+      tail_node = QO_ENV_NODE (env, i);
+
+      /* node dependency check; */
+      if (!bitset_subset (&visited_nodes, &(QO_NODE_DEP_SET (tail_node)))
+	  || !bitset_subset (&visited_nodes, &(QO_NODE_OUTER_DEP_SET (tail_node))))
+	{
+	  continue;
+	}
+
+      BITSET_CLEAR (nested_path_nodes);
+
+      (void) planner_visit_node (planner, partition, hint, head_node, tail_node, &visited_nodes, &visited_rel_nodes,
+				 &visited_terms, &nested_path_nodes, &remaining_nodes, &remaining_terms,
+				 &subset_subqueries, 0);
+    }
+
+  bitset_delset (&visited_nodes);
+  bitset_delset (&visited_rel_nodes);
+  bitset_delset (&visited_terms);
+  bitset_delset (&nested_path_nodes);
+  bitset_delset (&remaining_nodes);
+  bitset_delset (&remaining_terms);
+  bitset_delset (&subset_subqueries);
+  bitset_delset (&tail_nodes);
+}
+
+/*
+ * planner_dp_search () - search the join orders of a partition by dynamic programming over its connected subsets
+ *   return: info of the entire partition, NULL if no join order was found
+ *   planner(in):
+ *   partition(in):
+ *   hint(in):
+ *   first_nodes(in): candidates for the outermost node; any node may be outermost if empty
+ *   partition_terms(in): terms of the partition
+ *   remaining_subqueries(in):
+ *
+ * Note: The subsets are visited by size. Each connected subset of size k - 1 is joined to each of its neighbours,
+ *       so the best plans of a subset of size k are found by examining every way of adding its last node. The plans
+ *       are memoized in the join_info of the subset, and subsets not connected by join edges are never built.
+ *       Unlike planner_permutate (), no join order prefix is examined twice.
+ */
+static QO_INFO *
+planner_dp_search (QO_PLANNER * planner, QO_PARTITION * partition, PT_HINT_ENUM hint, BITSET * first_nodes,
+		   BITSET * partition_terms, BITSET * remaining_subqueries)
+{
+  QO_ENV *env = planner->env;
+  int i, j, level, nodes_cnt, heads_cnt;
+  BITSET_ITERATOR bi, bj;
+  QO_TERM *term;
+  QO_NODE *node;
+  QO_INFO *info, *last_info;
+  BITSET *neighbors;
+  BITSET rel_nodes;
+  size_t size;
+
+  nodes_cnt = bitset_cardinality (&(QO_PARTITION_NODES (partition)));
+
+  size = sizeof (BITSET) * planner->N;
+  neighbors = (BITSET *) malloc (size);
+  if (neighbors == NULL)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, size);
+      return NULL;
+    }
+
+  for (i = 0; i < (signed) planner->N; i++)
+    {
+      bitset_init (&neighbors[i], env);
+    }
+  bitset_init (&rel_nodes, env);
+
+  /* nodes of the same edge are neighbours */
+  for (i = bitset_iterate (partition_terms, &bi); i != -1; i = bitset_next_member (&bi))
+    {
+      term = QO_ENV_TERM (env, i);
+      if (!QO_IS_EDGE_TERM (term))
+	{
+	  continue;
+	}
+
+      for (j = bitset_iterate (&(QO_TERM_NODES (term)), &bj); j != -1; j = bitset_next_member (&bj))
+	{
+	  bitset_union (&neighbors[j], &(QO_TERM_NODES (term)));
+	}
+    }
+
+  planner->best_info = NULL;	/* init */
+  planner->dp_enumerate = true;
+
+  for (level = 2; level <= nodes_cnt; level++)
+    {
+      planner->join_unit = level;
+      heads_cnt = 0;
+
+      if (level == 2)
+	{
+	  /* join the outermost nodes to their neighbours */
+	  for (i = bitset_iterate (&(QO_PARTITION_NODES (partition)), &bi); i != -1; i = bitset_next_member (&bi))
+	    {
+	      node = QO_ENV_NODE (env, i);
+
+	      /* head node dependency check; */
+	      if (!bitset_is_empty (&(QO_NODE_DEP_SET (node))) || !bitset_is_empty (&(QO_NODE_OUTER_DEP_SET (node))))
+		{
+		  continue;
+		}
+
+	      /* the first join node check */
+	      if (!bitset_is_empty (first_nodes) && !BITSET_MEMBER (*first_nodes, i))
+		{
+		  continue;
+		}
+
+	      planner_dp_extend (planner, partition, hint, planner->node_info[i], neighbors, partition_terms,
+				 remaining_subqueries);
+	      heads_cnt++;
+	    }
+	}
+      else
+	{
+	  /* join the subsets built at the previous level to their neighbours. new infos are pushed in front of the
+	   * info list, so the list is not changed from last_info on.
+	   */
+	  last_info = planner->info_list;
+	  for (info = last_info; info != NULL; info = info->next)
+	    {
+	      if (info->join_unit != level - 1 || bitset_cardinality (&(info->nodes)) != level - 1
+		  || !bitset_subset (&(QO_PARTITION_NODES (partition)), &(info->nodes))
+		  || info->best_no_order.nplans == 0)
+		{
+		  continue;
+		}
+
+	      BITSET_CLEAR (rel_nodes);
+	      for (i = bitset_iterate (&(info->nodes), &bi); i != -1; i = bitset_next_member (&bi))
+		{
+		  bitset_add (&rel_nodes, QO_NODE_REL_IDX (QO_ENV_NODE (env, i)));
+		}
+	      if (planner->join_info[QO_INFO_INDEX (QO_PARTITION_M_OFFSET (partition), rel_nodes)] != info)
+		{
+		  continue;
+		}
+
+	      planner_dp_extend (planner, partition, hint, info, neighbors, partition_terms, remaining_subqueries);
+	      heads_cnt++;
+	    }
+	}
+
+      if (heads_cnt == 0)
+	{
+	  /* no subset of this size can be joined; give up */
+	  break;
+	}
+    }
+
+  planner->dp_enumerate = false;
+
+  for (i = 0; i < (signed) planner->N; i++)
+    {
+      bitset_delset (&neighbors[i]);
+    }
+  free_and_init (neighbors);
+  bitset_delset (&rel_nodes);
+
+  if (planner->best_info != NULL && planner->best_info->best_no_order.nplans == 0)
+    {
+      planner->best_info = NULL;
+    }
+
+  return planner->best_info;
+}
+
 /*
  * qo_planner_search () -
  *   return:
@@ -7479,6 +7864,7 @@ qo_planner_search (QO_ENV * env)
 {
   QO_PLANNER *planner;
   QO_PLAN *plan;
+  TSC_TICKS start_tick, end_tick;
 
   planner = NULL;
   plan = NULL;
@@ -7491,7 +7877,17 @@ qo_planner_search (QO_ENV * env)
 
   qo_info_nodes_init (env);
   qo_plans_init (env);
+
+  qo_join_search_usecs = 0;
+  qo_join_visits = 0;
+  qo_dp_join_searches = qo_windowed_join_searches = qo_permutation_join_searches = 0;
+  tsc_getticks (&start_tick);
+
   plan = qo_search_planner (planner);
+
+  tsc_getticks (&end_tick);
+  qo_planning_usecs = tsc_elapsed_utime (end_tick, start_tick);
+
   qo_clean_planner (planner);
 
   return plan;
@@ -7924,6 +8320,12 @@ qo_generate_sort_limit_plan (QO_ENV * env, QO_INFO * infop, QO_PLAN * subplan)
       return 0;
     }
 
+  if (subplan->plan_type == QO_PLANTYPE_SCAN)
+    {
+      /* the top-n sort of the SORT_LIMIT plan may merge the partitions of an index scan */
+      (void) qo_check_ordered_partitions (subplan);
+    }
+
   plan = qo_sort_new (subplan, QO_UNORDERED, SORT_LIMIT);
   if (plan == NULL)
     {
@@ -8428,15 +8830,17 @@ qo_clean_planner (QO_PLANNER * planner)
   qo_plans_teardown (planner->env);
 }
 
-/* Tables considered at a time during a join
- * -------------------------------------------
- * Tables joined | Tables considered at a time
- * --------------+----------------------------
- *  4..25        | 4
- * 26..37        | 3
- * 38..          | 2
- * -------------------------------------------
- * Refer Sybase Ataptive Server
+/* Join order search of a partition
+ * ---------------------------------------------------------------
+ * Tables joined                   | Search
+ * --------------------------------+------------------------------
+ *  ..optimizer_dp_join_max_tables | dynamic programming
+ *  more tables, 4..25             | 4 tables considered at a time
+ *               26..37            | 3 tables considered at a time
+ *               38..              | 2 tables considered at a time
+ * ---------------------------------------------------------------
+ * Refer Sybase Ataptive Server for the tables considered at a time.
+ * Path terms and the ORDERED hint need the permutation of all tables.
  */
 
 /*
@@ -8456,7 +8860,9 @@ qo_search_partition_join (QO_PLANNER * planner, QO_PARTITION * partition, BITSET
   QO_TERM *term;
   QO_NODE *node;
   int num_path_inner;
+  bool use_dp;
   QO_INFO *visited_info;
+  TSC_TICKS start_tick, end_tick;
   BITSET visited_nodes;
   BITSET visited_rel_nodes;
   BITSET visited_terms;
@@ -8474,6 +8880,8 @@ qo_search_partition_join (QO_PLANNER * planner, QO_PARTITION * partition, BITSET
   bitset_init (&remaining_nodes, env);
   bitset_init (&remaining_terms, env);
 
+  tsc_getticks (&start_tick);
+
   /* include useful nodes */
   bitset_assign (&remaining_nodes, &(QO_PARTITION_NODES (partition)));
   nodes_cnt = bitset_cardinality (&remaining_nodes);
@@ -8505,14 +8913,24 @@ qo_search_partition_join (QO_PLANNER * planner, QO_PARTITION * partition, BITSET
   hint = tree->info.query.q.select.hint;
 
   /* set #tables consider at a time */
+  use_dp = false;
   if (num_path_inner || (hint & PT_HINT_ORDERED))
     {
       /* inner join type path term exist; WHERE x.y.z = ? or there is a SQL hint ORDERED */
       planner->join_unit = nodes_cnt;	/* give up */
+      qo_permutation_join_searches++;
+    }
+  else if (nodes_cnt <= prm_get_integer_value (PRM_ID_OPTIMIZER_DP_JOIN_MAX_TABLES))
+    {
+      /* join_unit is used if dynamic programming fails */
+      planner->join_unit = nodes_cnt;
+      use_dp = true;
+      qo_dp_join_searches++;
     }
   else
     {
       planner->join_unit = (nodes_cnt <= 25) ? MIN (4, nodes_cnt) : (nodes_cnt <= 37) ? 3 : 2;
+      qo_windowed_join_searches++;
     }
 
   if (num_path_inner || (hint & PT_HINT_ORDERED))
@@ -8757,7 +9175,20 @@ qo_search_partition_join (QO_PLANNER * planner, QO_PARTITION * partition, BITSET
       bitset_delset (&derived_nodes);
     }
 
-  /* STEP 1: do join search with visited nodes */
+  /* STEP 1: do join search by dynamic programming */
+
+  if (use_dp)
+    {
+      if (planner_dp_search (planner, partition, hint, &first_nodes, &remaining_terms, remaining_subqueries) != NULL)
+	{
+	  goto end;		/* found best total join plan */
+	}
+
+      /* something wrong for dynamic programming; retry total join search */
+      planner->join_unit = nodes_cnt;
+    }
+
+  /* STEP 2: do join search with visited nodes */
 
   node = NULL;			/* init */
 
@@ -8797,7 +9228,7 @@ qo_search_partition_join (QO_PLANNER * planner, QO_PARTITION * partition, BITSET
 	      /* set #tables consider at a time */
 	      planner->join_unit = nodes_cnt;
 
-	      /* STEP 2: do total join search without visited nodes */
+	      /* STEP 3: do total join search without visited nodes */
 
 	      continue;
 	    }
@@ -8835,6 +9266,11 @@ qo_search_partition_join (QO_PLANNER * planner, QO_PARTITION * partition, BITSET
 
     }
 
+end:
+
+  tsc_getticks (&end_tick);
+  qo_join_search_usecs += tsc_elapsed_utime (end_tick, start_tick);
+
   bitset_delset (&visited_rel_nodes);
   bitset_delset (&visited_nodes);
   bitset_delset (&visited_terms);
@@ -9118,7 +9554,7 @@ qo_expr_selectivity (QO_ENV * env, PT_NODE * pt_expr)
 	case PT_AND:
 	  lhs_selectivity = qo_expr_selectivity (env, node->info.expr.arg1);
 	  rhs_selectivity = qo_expr_selectivity (env, node->info.expr.arg2);
-	  selectivity = qo_and_selectivity (env, lhs_selectivity, rhs_selectivity);
+	  selectivity = qo_and_selectivity (env, lhs_selectivity, rhs_selectivity, 0.0);
 	  break;
 
 	case PT_NOT:
@@ -9254,9 +9690,13 @@ qo_or_selectivity (QO_ENV * env, double lhs_sel, double rhs_sel)
  *   env(in):
  *   lhs_sel(in):
  *   rhs_sel(in):
+ *   dependency(in): fraction of objects whose lhs value determines the rhs value; 0 if lhs and rhs are independent
+ *
+ * Note: The objects whose lhs value determines the rhs value are selected by lhs only, the others by both; so the
+ *	 selectivity is lhs_sel * (dependency + (1 - dependency) * rhs_sel), and no more than either selectivity.
  */
-static double
-qo_and_selectivity (QO_ENV * env, double lhs_sel, double rhs_sel)
+double
+qo_and_selectivity (QO_ENV * env, double lhs_sel, double rhs_sel, double dependency)
 {
   double result;
 
@@ -9265,7 +9705,9 @@ qo_and_selectivity (QO_ENV * env, double lhs_sel, double rhs_sel)
   QO_ASSERT (env, rhs_sel >= 0.0);
   QO_ASSERT (env, rhs_sel <= 1.0);
 
-  result = lhs_sel * rhs_sel;
+  dependency = MAX (0.0, MIN (dependency, 1.0));
+  result = lhs_sel * (dependency + (1.0 - dependency) * rhs_sel);
+  result = MIN (result, MIN (lhs_sel, rhs_sel));
 
   return result;
 }
@@ -9299,7 +9741,7 @@ qo_equal_selectivity (QO_ENV * env, PT_NODE * pt_expr)
   PT_NODE *lhs, *rhs, *multi_attr;
   PRED_CLASS pc_lhs, pc_rhs;
   int lhs_icard, rhs_icard, icard;
-  double selectivity;
+  double selectivity, lhs_selectivity, rhs_selectivity;
 
   lhs = pt_expr->info.expr.arg1;
   rhs = pt_expr->info.expr.arg2;
@@ -9330,7 +9772,17 @@ qo_equal_selectivity (QO_ENV * env, PT_NODE * pt_expr)
 	    }
 	  else
 	    {
-	      selectivity = DEFAULT_EQUIJOIN_SELECTIVITY;
+	      /* the attribute having more distinct values decides */
+	      lhs_selectivity = qo_histogram_equal_selectivity (env, lhs, NULL);
+	      rhs_selectivity = qo_histogram_equal_selectivity (env, rhs, NULL);
+	      if (lhs_selectivity >= 0.0 && rhs_selectivity >= 0.0)
+		{
+		  selectivity = MIN (lhs_selectivity, rhs_selectivity);
+		}
+	      else
+		{
+		  selectivity = DEFAULT_EQUIJOIN_SELECTIVITY;
+		}
 	    }
 
 	  break;
@@ -9342,13 +9794,20 @@ qo_equal_selectivity (QO_ENV * env, PT_NODE * pt_expr)
 	case PC_OTHER:
 	  /* attr = const */
 
+	  /* the histogram knows the frequency of a constant, or of a peeked host variable */
+	  if ((pc_rhs == PC_CONST || pc_rhs == PC_HOST_VAR)
+	      && (selectivity = qo_histogram_equal_selectivity (env, lhs, rhs)) >= 0.0)
+	    {
+	      break;
+	    }
+
 	  /* check for index on the attribute.  NOTE: For an equality predicate, we treat subqueries as constants. */
 	  lhs_icard = qo_index_cardinality (env, lhs);
 	  if (lhs_icard != 0)
 	    {
 	      selectivity = (1.0 / lhs_icard);
 	    }
-	  else
+	  else if ((selectivity = qo_histogram_equal_selectivity (env, lhs, NULL)) < 0.0)
 	    {
 	      selectivity = DEFAULT_EQUAL_SELECTIVITY;
 	    }
@@ -9374,13 +9833,20 @@ qo_equal_selectivity (QO_ENV * env, PT_NODE * pt_expr)
 	case PC_ATTR:
 	  /* const = attr */
 
+	  /* the histogram knows the frequency of a constant, or of a peeked host variable */
+	  if ((pc_lhs == PC_CONST || pc_lhs == PC_HOST_VAR)
+	      && (selectivity = qo_histogram_equal_selectivity (env, rhs, lhs)) >= 0.0)
+	    {
+	      break;
+	    }
+
 	  /* check for index on the attribute.  NOTE: For an equality predicate, we treat subqueries as constants. */
 	  rhs_icard = qo_index_cardinality (env, rhs);
 	  if (rhs_icard != 0)
 	    {
 	      selectivity = (1.0 / rhs_icard);
 	    }
-	  else
+	  else if ((selectivity = qo_histogram_equal_selectivity (env, rhs, NULL)) < 0.0)
 	    {
 	      selectivity = DEFAULT_EQUAL_SELECTIVITY;
 	    }
@@ -9549,33 +10015,80 @@ qo_equal_selectivity (QO_ENV * env, PT_NODE * pt_expr)
  *   env(in): Pointer to an environment structure
  *   pt_expr(in): comparison expression
  *
- * Note: This uses the System R algorithm
+ * Note: This uses the System R algorithm, or the histogram of the attribute compared to a constant
  */
 static double
 qo_comp_selectivity (QO_ENV * env, PT_NODE * pt_expr)
 {
-  return DEFAULT_COMP_SELECTIVITY;
-}
+  PT_NODE *attr, *value;
+  PT_OP_TYPE op, between_op;
+  double selectivity;
 
-/*
- * qo_between_selectivity () - Compute the selectivity of a between predicate
- *   return: double
- *   env(in): Pointer to an environment structure
+  op = pt_expr->info.expr.op;
+  attr = pt_expr->info.expr.arg1;
+  value = pt_expr->info.expr.arg2;
+  if (qo_classify (attr) != PC_ATTR)
+    {
+      /* const op attr */
+      attr = pt_expr->info.expr.arg2;
+      value = pt_expr->info.expr.arg1;
+      op = pt_converse_op (op);
+    }
+  if (qo_classify (attr) != PC_ATTR || qo_classify (value) != PC_CONST)
+    {
+      return DEFAULT_COMP_SELECTIVITY;
+    }
+
+  switch (op)
+    {
+    case PT_LT:
+      between_op = PT_BETWEEN_INF_LT;
+      break;
+    case PT_LE:
+      between_op = PT_BETWEEN_INF_LE;
+      break;
+    case PT_GT:
+      between_op = PT_BETWEEN_GT_INF;
+      break;
+    case PT_GE:
+      between_op = PT_BETWEEN_GE_INF;
+      break;
+    default:
+      return DEFAULT_COMP_SELECTIVITY;
+    }
+
+  selectivity = qo_histogram_between_selectivity (env, attr, between_op, value, NULL);
+
+  return (selectivity >= 0.0) ? selectivity : DEFAULT_COMP_SELECTIVITY;
+}
+
+/*
+ * qo_between_selectivity () - Compute the selectivity of a between predicate
+ *   return: double
+ *   env(in): Pointer to an environment structure
  *   pt_expr(in): between expression
  *
- * Note: This uses the System R algorithm
+ * Note: This uses the System R algorithm, or the histogram of the attribute between constants
  */
 static double
 qo_between_selectivity (QO_ENV * env, PT_NODE * pt_expr)
 {
   PT_NODE *and_node;
+  double selectivity = -1.0;
 
   and_node = pt_expr->info.expr.arg2;
 
   QO_ASSERT (env, and_node->node_type == PT_EXPR);
   QO_ASSERT (env, pt_is_between_range_op (and_node->info.expr.op));
 
-  return DEFAULT_BETWEEN_SELECTIVITY;
+  if (qo_classify (pt_expr->info.expr.arg1) == PC_ATTR)
+    {
+      selectivity =
+	qo_histogram_between_selectivity (env, pt_expr->info.expr.arg1, and_node->info.expr.op,
+					  and_node->info.expr.arg1, and_node->info.expr.arg2);
+    }
+
+  return (selectivity >= 0.0) ? selectivity : DEFAULT_BETWEEN_SELECTIVITY;
 }
 
 /*
@@ -9650,8 +10163,18 @@ qo_range_selectivity (QO_ENV * env, PT_NODE * pt_expr)
 
       pc1 = qo_classify (arg1);
 
-      if (op_type == PT_BETWEEN_GE_LE || op_type == PT_BETWEEN_GE_LT || op_type == PT_BETWEEN_GT_LE
-	  || op_type == PT_BETWEEN_GT_LT)
+      selectivity = -1.0;
+      if (pc2 == PC_ATTR && pc1 == PC_CONST)
+	{
+	  selectivity = qo_histogram_between_selectivity (env, lhs, op_type, arg1, arg2);
+	}
+
+      if (selectivity >= 0.0)
+	{
+	  /* estimated by histogram */
+	}
+      else if (op_type == PT_BETWEEN_GE_LE || op_type == PT_BETWEEN_GE_LT || op_type == PT_BETWEEN_GT_LE
+	       || op_type == PT_BETWEEN_GT_LT)
 	{
 	  selectivity = DEFAULT_BETWEEN_SELECTIVITY;
 	}
@@ -9923,6 +10446,455 @@ qo_index_cardinality (QO_ENV * env, PT_NODE * attr)
   return info->cum_stats.pkeys[0];
 }
 
+/*
+ * qo_attr_histogram () - Get the histogram of the attribute
+ *   return: histogram of the attribute, or NULL if unknown
+ *   env(in): optimizer environment
+ *   attr(in): pt node for the attribute
+ */
+static STATS_HISTOGRAM *
+qo_attr_histogram (QO_ENV * env, PT_NODE * attr)
+{
+  PT_NODE *dummy;
+  QO_NODE *nodep;
+  QO_SEGMENT *segp;
+  QO_ATTR_INFO *info;
+
+  if (attr->node_type == PT_DOT_)
+    {
+      attr = attr->info.dot.arg2;
+    }
+
+  if (attr->node_type != PT_NAME || attr->info.name.meta_class == PT_RESERVED)
+    {
+      return NULL;
+    }
+
+  nodep = lookup_node (attr, env, &dummy);
+  if (nodep == NULL)
+    {
+      return NULL;
+    }
+
+  segp = lookup_seg (nodep, attr, env);
+  if (segp == NULL)
+    {
+      return NULL;
+    }
+
+  info = QO_SEG_INFO (segp);
+  if (info == NULL)
+    {
+      return NULL;
+    }
+
+  return info->cum_stats.histogram;
+}
+
+/*
+ * qo_histogram_equal_selectivity () - Compute the selectivity of attr = value from the histogram of the attribute
+ *   return: selectivity, or a negative value if the histogram is not known
+ *   env(in): optimizer environment
+ *   attr(in): pt node for the attribute
+ *   value_node(in): compared value; NULL or a non-constant node for a value that is not known yet
+ *
+ * Note: A host variable is known only if its value is peeked; see qo_peek_host_var ().
+ */
+static double
+qo_histogram_equal_selectivity (QO_ENV * env, PT_NODE * attr, PT_NODE * value_node)
+{
+  STATS_HISTOGRAM *histogram;
+  DB_VALUE *value = NULL;
+  DB_VALUE_COMPARE_RESULT cmp;
+  int i;
+
+  histogram = qo_attr_histogram (env, attr);
+  if (histogram == NULL)
+    {
+      return -1.0;
+    }
+
+  if (value_node != NULL && qo_classify (value_node) == PC_CONST)
+    {
+      value = pt_value_to_db (QO_ENV_PARSER (env), value_node);
+    }
+  else if (value_node != NULL && qo_classify (value_node) == PC_HOST_VAR)
+    {
+      value = qo_peek_host_var (env, histogram, value_node);
+      if (value == NULL)
+	{
+	  /* plan is generic for any value of the host variable */
+	  return -1.0;
+	}
+    }
+
+  if (value == NULL)
+    {
+      /* the average value */
+      return (histogram->ndv >= 1.0) ? MAX (1.0 - histogram->null_frac, 0.0) / histogram->ndv : -1.0;
+    }
+
+  for (i = 0; i < histogram->n_mcvs; i++)
+    {
+      cmp = tp_value_compare (value, &histogram->mcvs[i], 1, 0);
+      if (cmp == DB_UNK)
+	{
+	  return -1.0;
+	}
+      if (cmp == DB_EQ)
+	{
+	  return histogram->mcv_freqs[i];
+	}
+    }
+
+  return qo_histogram_other_selectivity (histogram);
+}
+
+/*
+ * qo_histogram_other_selectivity () - Compute the selectivity of a value which is not most common
+ *   return: selectivity
+ *   histogram(in): histogram of the attribute
+ */
+static double
+qo_histogram_other_selectivity (STATS_HISTOGRAM * histogram)
+{
+  double mcv_sum, rest, n_others;
+  int i;
+
+  mcv_sum = 0.0;
+  for (i = 0; i < histogram->n_mcvs; i++)
+    {
+      mcv_sum += histogram->mcv_freqs[i];
+    }
+
+  /* values which are not most common share the rest of the objects */
+  rest = MAX (1.0 - histogram->null_frac - mcv_sum, 0.0);
+  n_others = MAX (histogram->ndv - histogram->n_mcvs, 1.0);
+
+  return rest / n_others;
+}
+
+/*
+ * qo_selectivity_range () - Get the range of a selectivity; each range is ten times the previous one
+ *   return: range, less than XASL_PLAN_PEEK_RANGES
+ *   selectivity(in):
+ */
+static int
+qo_selectivity_range (double selectivity)
+{
+  double bound = 0.001;
+  int range;
+
+  for (range = 0; range < XASL_PLAN_PEEK_RANGES - 1 && selectivity >= bound; range++)
+    {
+      bound *= 10.0;
+    }
+
+  return range;
+}
+
+/*
+ * qo_peek_host_var () - Get the value of a host variable compared with an attribute, if plan is made for it
+ *   return: value of host variable, or NULL if plan is generic for any value of the host variable
+ *   env(in): optimizer environment
+ *   histogram(in): histogram of the attribute
+ *   host_var(in): host variable compared with the attribute
+ *
+ * Note: The most common values of the attribute whose selectivity is in another range than the selectivity of the
+ *	 other values are listed to the compile context, for the first XASL_PLAN_MAX_PEEKS host variables. The list is
+ *	 kept with the plan; the server matches the bound values against it to pick the plan variant of the ranges of
+ *	 the values, and asks to recompile a variant which is not cached yet. The values bound to host variables are
+ *	 peeked only when compiling a variant; a value is used only if it is listed, otherwise the plan is generic.
+ */
+static DB_VALUE *
+qo_peek_host_var (QO_ENV * env, STATS_HISTOGRAM * histogram, PT_NODE * host_var)
+{
+  PARSER_CONTEXT *parser = QO_ENV_PARSER (env);
+  COMPILE_CONTEXT *context = &parser->context;
+  XASL_PLAN_PEEK *peek, *matched = NULL;
+  DB_VALUE *value = NULL, *peek_value;
+  bool is_listed = false;
+  int index, position, other_range, range, i;
+
+  if (!context->collect_plan_peeks || host_var->node_type != PT_HOST_VAR
+      || host_var->info.host_var.var_type != PT_HOST_IN)
+    {
+      return NULL;
+    }
+
+  index = host_var->info.host_var.index;
+  if (context->peek_host_vars)
+    {
+      value = pt_host_var_db_value (parser, host_var);
+    }
+
+  position = 0;
+  for (peek = context->plan_peeks; peek != NULL; peek = peek->next)
+    {
+      if (peek->host_var_index == index)
+	{
+	  /* already listed for another term */
+	  is_listed = true;
+	  if (value != NULL && tp_value_compare (value, peek->value, 1, 0) == DB_EQ)
+	    {
+	      matched = peek;
+	    }
+	}
+      position = MAX (position, peek->position + 1);
+    }
+  if (is_listed)
+    {
+      return (matched != NULL) ? value : NULL;
+    }
+  if (position >= XASL_PLAN_MAX_PEEKS)
+    {
+      return NULL;
+    }
+
+  other_range = qo_selectivity_range (qo_histogram_other_selectivity (histogram));
+  for (i = 0; i < histogram->n_mcvs; i++)
+    {
+      range = qo_selectivity_range (histogram->mcv_freqs[i]);
+      if (range == other_range)
+	{
+	  continue;
+	}
+
+      peek = (XASL_PLAN_PEEK *) parser_alloc (parser, sizeof (XASL_PLAN_PEEK));
+      peek_value = (DB_VALUE *) parser_alloc (parser, sizeof (DB_VALUE));
+      if (peek == NULL || peek_value == NULL || db_value_clone (&histogram->mcvs[i], peek_value) != NO_ERROR)
+	{
+	  return NULL;
+	}
+      /* cleared with the parser, after the plan is packed */
+      pt_register_orphan_db_value (parser, peek_value);
+
+      peek->value = peek_value;
+      peek->host_var_index = index;
+      peek->position = position;
+      peek->range = range;
+      peek->next = context->plan_peeks;
+      context->plan_peeks = peek;
+
+      if (value != NULL && matched == NULL && tp_value_compare (value, peek_value, 1, 0) == DB_EQ)
+	{
+	  matched = peek;
+	}
+    }
+  if (matched == NULL)
+    {
+      return NULL;
+    }
+
+  context->plan_variant += xasl_plan_variant_digit (matched->position, matched->range);
+
+  return value;
+}
+
+/*
+ * qo_histogram_between_selectivity () - Compute the selectivity of a range of the attribute from its histogram
+ *   return: selectivity, or a negative value if the histogram is not known
+ *   env(in): optimizer environment
+ *   attr(in): pt node for the attribute
+ *   between_op(in): between range operator; PT_BETWEEN_AND, PT_BETWEEN_GE_LE, ...
+ *   arg1(in): lower bound, or the only bound of a range having one
+ *   arg2(in): upper bound of a range having two bounds
+ */
+static double
+qo_histogram_between_selectivity (QO_ENV * env, PT_NODE * attr, PT_OP_TYPE between_op, PT_NODE * arg1,
+				  PT_NODE * arg2)
+{
+  STATS_HISTOGRAM *histogram;
+  DB_VALUE *lower = NULL, *upper = NULL;
+  PT_OP_TYPE lop, uop;
+  double below_lower, below_upper;
+
+  if (between_op == PT_BETWEEN_EQ_NA)
+    {
+      return qo_histogram_equal_selectivity (env, attr, arg1);
+    }
+
+  histogram = qo_attr_histogram (env, attr);
+  if (histogram == NULL || pt_between_to_comp_op (between_op, &lop, &uop) != 0)
+    {
+      return -1.0;
+    }
+
+  /* ranges with one bound have it in arg1 */
+  if (lop != PT_GT_INF)
+    {
+      if (arg1 == NULL || qo_classify (arg1) != PC_CONST)
+	{
+	  return -1.0;
+	}
+      lower = pt_value_to_db (QO_ENV_PARSER (env), arg1);
+      arg1 = arg2;
+    }
+  if (uop != PT_LT_INF)
+    {
+      if (arg1 == NULL || qo_classify (arg1) != PC_CONST)
+	{
+	  return -1.0;
+	}
+      upper = pt_value_to_db (QO_ENV_PARSER (env), arg1);
+    }
+
+  below_lower = (lop == PT_GT_INF) ? 0.0 : qo_histogram_below (histogram, lower, lop == PT_GT);
+  below_upper = (uop == PT_LT_INF) ? 1.0 - histogram->null_frac : qo_histogram_below (histogram, upper, uop == PT_LE);
+  if (below_lower < 0.0 || below_upper < 0.0)
+    {
+      return -1.0;
+    }
+
+  return MIN (MAX (below_upper - below_lower, 0.0), 1.0);
+}
+
+/*
+ * qo_histogram_below () - Compute the fraction of objects having a value less than the given value
+ *   return: fraction of objects, or a negative value if the value cannot be placed in the histogram
+ *   histogram(in): histogram of an attribute
+ *   value(in): value
+ *   inclusive(in): count the objects equal to the value
+ *
+ * Note: Values of a bucket are assumed uniformly distributed between its bounds.
+ */
+static double
+qo_histogram_below (STATS_HISTOGRAM * histogram, DB_VALUE * value, bool inclusive)
+{
+  DB_VALUE_COMPARE_RESULT cmp;
+  double fraction, mcv_sum, rest, position, low_pos, high_pos, in_bucket;
+  int n_buckets, i;
+
+  if (value == NULL || DB_IS_NULL (value))
+    {
+      return -1.0;
+    }
+
+  fraction = mcv_sum = 0.0;
+  for (i = 0; i < histogram->n_mcvs; i++)
+    {
+      mcv_sum += histogram->mcv_freqs[i];
+
+      cmp = tp_value_compare (&histogram->mcvs[i], value, 1, 0);
+      if (cmp == DB_UNK)
+	{
+	  return -1.0;
+	}
+      if (cmp == DB_LT || (inclusive && cmp == DB_EQ))
+	{
+	  fraction += histogram->mcv_freqs[i];
+	}
+    }
+
+  rest = MAX (1.0 - histogram->null_frac - mcv_sum, 0.0);
+  if (histogram->n_bounds < 2)
+    {
+      /* where the other values are is not known */
+      return (histogram->n_mcvs > 0) ? fraction + rest / 2 : -1.0;
+    }
+
+  n_buckets = histogram->n_bounds - 1;
+
+  cmp = tp_value_compare (value, &histogram->bounds[0], 1, 0);
+  if (cmp == DB_UNK)
+    {
+      return -1.0;
+    }
+  if (cmp == DB_LT || (!inclusive && cmp == DB_EQ))
+    {
+      return fraction;
+    }
+
+  cmp = tp_value_compare (value, &histogram->bounds[n_buckets], 1, 0);
+  if (cmp == DB_GT || (inclusive && cmp == DB_EQ))
+    {
+      return fraction + rest;
+    }
+
+  /* find the bucket of the value */
+  for (i = 0; i < n_buckets - 1; i++)
+    {
+      cmp = tp_value_compare (value, &histogram->bounds[i + 1], 1, 0);
+      if (cmp == DB_LT || (!inclusive && cmp == DB_EQ))
+	{
+	  break;
+	}
+    }
+
+  in_bucket = 0.5;
+  if (qo_histogram_position (value, &position) && qo_histogram_position (&histogram->bounds[i], &low_pos)
+      && qo_histogram_position (&histogram->bounds[i + 1], &high_pos) && high_pos > low_pos)
+    {
+      in_bucket = (position - low_pos) / (high_pos - low_pos);
+      in_bucket = MIN (MAX (in_bucket, 0.0), 1.0);
+    }
+
+  return fraction + rest * (i + in_bucket) / n_buckets;
+}
+
+/*
+ * qo_histogram_position () - Map a value to a number to interpolate it between bucket bounds
+ *   return: true if the value has a position
+ *   value(in): value
+ *   position(out): position of value
+ */
+static bool
+qo_histogram_position (const DB_VALUE * value, double *position)
+{
+  const DB_DATETIME *datetime;
+
+  switch (DB_VALUE_TYPE (value))
+    {
+    case DB_TYPE_SHORT:
+      *position = db_get_short (value);
+      return true;
+
+    case DB_TYPE_INTEGER:
+      *position = db_get_int (value);
+      return true;
+
+    case DB_TYPE_BIGINT:
+      *position = (double) db_get_bigint (value);
+      return true;
+
+    case DB_TYPE_FLOAT:
+      *position = db_get_float (value);
+      return true;
+
+    case DB_TYPE_DOUBLE:
+      *position = db_get_double (value);
+      return true;
+
+    case DB_TYPE_MONETARY:
+      *position = db_get_monetary (value)->amount;
+      return true;
+
+    case DB_TYPE_NUMERIC:
+      numeric_coerce_num_to_double (db_locate_numeric (value), DB_VALUE_SCALE (value), position);
+      return true;
+
+    case DB_TYPE_DATE:
+      *position = *db_get_date (value);
+      return true;
+
+    case DB_TYPE_TIME:
+      *position = *db_get_time (value);
+      return true;
+
+    case DB_TYPE_TIMESTAMP:
+      *position = *db_get_timestamp (value);
+      return true;
+
+    case DB_TYPE_DATETIME:
+      datetime = db_get_datetime (value);
+      *position = (double) datetime->date * MILLISECONDS_OF_ONE_DAY + datetime->time;
+      return true;
+
+    default:
+      return false;
+    }
+}
+
 /*
  * qo_is_all_unique_index_columns_are_equi_terms () -
  *   check if the current plan uses and
@@ -10797,10 +11769,12 @@ qo_check_groupby_skip_descending (QO_PLAN * plan, PT_NODE * list)
  *   root(in):
  *   group_by(in):
  *   is_index_w_prefix(out):
+ *   is_partition_scan(in): compute the order of the scan of each partition of a partitioned class
  *
  */
 static PT_NODE *
-qo_plan_compute_iscan_sort_list (QO_PLAN * root, PT_NODE * group_by, bool * is_index_w_prefix)
+qo_plan_compute_iscan_sort_list (QO_PLAN * root, PT_NODE * group_by, bool * is_index_w_prefix,
+				 bool is_partition_scan)
 {
   QO_PLAN *plan;
   QO_ENV *env;
@@ -10871,9 +11845,11 @@ qo_plan_compute_iscan_sort_list (QO_PLAN * root, PT_NODE * group_by, bool * is_i
       /* if there's no class information or the class is not normal class */
       goto exit_on_end;		/* nop */
     }
-  else if (QO_NODE_IS_CLASS_HIERARCHY (plan->plan_un.scan.node))
+  else if (QO_NODE_IS_CLASS_HIERARCHY (plan->plan_un.scan.node)
+	   && !(is_partition_scan && QO_NODE_INFO_N (plan->plan_un.scan.node) == 1
+		&& QO_NODE_IS_CLASS_PARTITIONED (plan->plan_un.scan.node)))
     {
-      /* exclude class hierarchy scan */
+      /* exclude class hierarchy scan; the partitions of a partitioned class have the indexes of the class */
       goto exit_on_end;		/* nop */
     }
 
@@ -11144,7 +12120,7 @@ qo_plan_is_orderby_skip_candidate (QO_PLAN * plan)
   statement = QO_ENV_PT_TREE (env);
   order_by = statement->info.query.order_by;
 
-  plan->iscan_sort_list = qo_plan_compute_iscan_sort_list (plan, NULL, &is_prefix);
+  plan->iscan_sort_list = qo_plan_compute_iscan_sort_list (plan, NULL, &is_prefix, false);
 
   if (plan->iscan_sort_list == NULL || is_prefix)
     {
@@ -11168,6 +12144,160 @@ cleanup:
   return is_orderby_skip;
 }
 
+/*
+ * qo_check_ordered_partitions () - check if the partitions of an index scan return their rows in the order of
+ *				    ORDER BY ... LIMIT
+ * return : true/false
+ * plan (in) : index scan plan
+ *
+ * Note: The partitions are still scanned one after the other, so ORDER BY is not skipped. But the rows of each
+ *	 partition come in order, and the executor ends the scan of a partition at the first row that its top-n sort
+ *	 rejects. The direction of the scan of the partitions is saved to use_iscan_descending.
+ */
+static bool
+qo_check_ordered_partitions (QO_PLAN * plan)
+{
+  QO_ENV *env;
+  QO_NODE *node;
+  PARSER_CONTEXT *parser;
+  PT_NODE *tree, *order_by;
+  BITSET_ITERATOR iter;
+  int t;
+  bool is_prefix = false, is_ordered = false, is_descending = false;
+
+  if (!prm_get_bool_value (PRM_ID_PARTITION_ORDERED_MERGE))
+    {
+      return false;
+    }
+
+  if (plan->plan_un.scan.index_ordered_partitions)
+    {
+      /* already checked */
+      return true;
+    }
+
+  if (!qo_is_interesting_order_scan (plan) || qo_is_index_loose_scan (plan) || qo_is_index_iss_scan (plan)
+      || qo_plan_multi_range_opt (plan) || plan->iscan_sort_list != NULL)
+    {
+      return false;
+    }
+
+  node = plan->plan_un.scan.node;
+  if (QO_NODE_INFO (node) == NULL || QO_NODE_INFO_N (node) != 1 || !QO_NODE_IS_CLASS_PARTITIONED (node))
+    {
+      return false;
+    }
+
+  env = (plan->info)->env;
+  parser = QO_ENV_PARSER (env);
+  tree = QO_ENV_PT_TREE (env);
+  if (tree == NULL || !PT_IS_SELECT (tree))
+    {
+      return false;
+    }
+
+  order_by = tree->info.query.order_by;
+  if (order_by == NULL || tree->info.query.orderby_for == NULL || tree->info.query.all_distinct == PT_DISTINCT
+      || tree->info.query.q.select.group_by != NULL || tree->info.query.q.select.connect_by != NULL
+      || pt_has_aggregate (parser, tree) || pt_has_analytic (parser, tree))
+    {
+      return false;
+    }
+
+  if (tree->info.query.q.select.hint & (PT_HINT_USE_IDX_DESC | PT_HINT_NO_IDX_DESC))
+    {
+      /* the hints override the direction of the scan */
+      return false;
+    }
+
+  for (t = bitset_iterate (&(plan->sarged_terms), &iter); t != -1; t = bitset_next_member (&iter))
+    {
+      if (QO_TERM_CLASS (QO_ENV_TERM (env, t)) == QO_TC_TOTALLY_AFTER_JOIN)
+	{
+	  /* inst_num () numbers the rows before they are sorted */
+	  return false;
+	}
+    }
+
+  if (qo_is_iscan_from_orderby (plan) && !qo_validate_index_for_orderby (env, plan->plan_un.scan.index))
+    {
+      /* rows with null keys are not in the index */
+      return false;
+    }
+
+  plan->iscan_sort_list = qo_plan_compute_iscan_sort_list (plan, NULL, &is_prefix, true);
+  if (plan->iscan_sort_list != NULL && !is_prefix)
+    {
+      is_ordered = pt_sort_spec_cover (plan->iscan_sort_list, order_by);
+      if (!is_ordered)
+	{
+	  is_ordered = is_descending = qo_check_orderby_skip_descending (plan);
+	}
+    }
+
+  if (plan->iscan_sort_list != NULL)
+    {
+      parser_free_tree (parser, plan->iscan_sort_list);
+      plan->iscan_sort_list = NULL;
+    }
+
+  if (is_ordered)
+    {
+      plan->plan_un.scan.index_ordered_partitions = true;
+      plan->use_iscan_descending = is_descending;
+    }
+
+  return is_ordered;
+}
+
+/*
+ * qo_ordered_partitions_cost () - reduce the cost of an index scan whose partitions are merged by the top-n sort
+ * return : void
+ * plan (in) : index scan plan with ordered partitions
+ *
+ * Note: At most LIMIT rows of each partition are read.
+ */
+static void
+qo_ordered_partitions_cost (QO_PLAN * plan)
+{
+  QO_ENV *env = (plan->info)->env;
+  DB_OBJLIST *partition;
+  DB_VALUE limit_val;
+  double rows, read_rows;
+  int partition_count = 0;
+
+  assert (plan->plan_un.scan.index_ordered_partitions);
+
+  if (plan->variable_cpu_cost == QO_INFINITY || plan->variable_io_cost == QO_INFINITY)
+    {
+      return;
+    }
+
+  if (pt_get_query_limit_value (QO_ENV_PARSER (env), QO_ENV_PT_TREE (env), &limit_val) != NO_ERROR
+      || DB_IS_NULL (&limit_val))
+    {
+      /* the limit is not known until execution */
+      pr_clear_value (&limit_val);
+      return;
+    }
+
+  for (partition = QO_NODE_INFO_SMCLASS (plan->plan_un.scan.node)->users; partition != NULL;
+       partition = partition->next)
+    {
+      partition_count++;
+    }
+
+  rows = MAX (1.0, (plan->info)->cardinality);
+  read_rows = (double) db_get_bigint (&limit_val) * MAX (1, partition_count);
+  pr_clear_value (&limit_val);
+
+  if (read_rows < rows)
+    {
+      plan->variable_cpu_cost *= read_rows / rows;
+      plan->variable_io_cost *= read_rows / rows;
+    }
+}
+
 /*
  * qo_is_sort_limit () - verify if plan is a SORT-LIMIT plan
  * return : true/false
@@ -153,6 +153,7 @@ struct qo_plan
       bool index_cover;		/* covered index scan flag */
       bool index_iss;		/* index skip scan flag */
       bool index_loose;		/* loose index scan flag */
+      bool index_ordered_partitions;	/* each partition is scanned in the order of ORDER BY */
       QO_NODE_INDEX_ENTRY *index;
       BITSET multi_col_range_segs;	/* range condition segs for multi_col_term */
       BITSET hash_terms;	/* hash_terms for hash list scan */
@@ -352,6 +353,12 @@ struct qo_planner
    * The last join level.
    */
   int join_unit;
+
+  /*
+   * true while planner_dp_search() enumerates the join orders; each
+   * visit then joins only one more node to the visited subset.
+   */
+  bool dp_enumerate;
   unsigned int S;
   unsigned int EQ;
   unsigned int P;
@@ -393,6 +400,7 @@ extern QO_PLAN *qo_planner_search (QO_ENV *);
 extern void qo_planner_free (QO_PLANNER *);
 extern void qo_plans_stats (FILE *);
 extern void qo_info_stats (FILE *);
+extern void qo_planner_stats (FILE *);
 
 extern bool qo_is_seq_scan (QO_PLAN *);
 extern bool qo_is_iscan (QO_PLAN *);
@@ -401,4 +409,6 @@ extern bool qo_is_iscan_from_orderby (QO_PLAN *);
 extern bool qo_is_interesting_order_scan (QO_PLAN *);
 extern bool qo_is_all_unique_index_columns_are_equi_terms (QO_PLAN * plan);
 extern bool qo_has_sort_limit_subplan (QO_PLAN * plan);
+extern double qo_and_selectivity (QO_ENV * env, double lhs_sel, double rhs_sel, double dependency);
+extern int qo_get_cardinality_key (QO_ENV * env, BITSET * nodes);
 #endif /* _QUERY_PLANNER_H_ */
@@ -139,6 +139,17 @@ static bool qo_check_foreign_key_referencing_primary_key_in_child_spec (PARSER_C
 									reduce_reference_info);
 static void qo_reduce_predicate_for_parent_spec (PARSER_CONTEXT * parser, PT_NODE * query,
 						 QO_REDUCE_REFERENCE_INFO * reduce_reference_info);
+static bool qo_refers_to_specs (PARSER_CONTEXT * parser, PT_NODE * node, PT_NODE * spec_list);
+static bool qo_is_not_null_attr (PT_NODE * spec_list, PT_NODE * attr);
+static bool qo_is_unnest_key_compatible (PT_NODE * outer_key, PT_NODE * inner_key);
+static bool qo_is_unnestable_subquery (PARSER_CONTEXT * parser, PT_NODE * query, PT_NODE * subquery,
+				       PT_NODE * in_arg, bool is_anti);
+static CLASS_STATS *qo_get_spec_class_stats (PT_NODE * spec, MOP * class_mop);
+static int qo_get_unnest_key_index_height (PT_NODE * key, PT_NODE * from);
+static bool qo_is_unnest_cheaper (PARSER_CONTEXT * parser, PT_NODE * query, PT_NODE * subquery);
+static int qo_unnest_subquery (PARSER_CONTEXT * parser, PT_NODE * query, PT_NODE * subquery, PT_NODE * in_arg,
+			       bool is_anti, int *idx, short *max_location, PT_NODE ** new_terms);
+static int qo_unnest_subqueries (PARSER_CONTEXT * parser, PT_NODE * node, int *idx);
 
 #define QO_CHECK_AND_REDUCE_EQUALITY_TERMS(parser, node, where) \
   do { \
@@ -7831,6 +7842,716 @@ qo_rewrite_subqueries (PARSER_CONTEXT * parser, PT_NODE * node, void *arg, int *
   return node;
 }
 
+/*
+ * qo_refers_to_specs () - check whether a node refers to one of the given specs
+ *   return: true if a name of node is bound to a spec of spec_list
+ *   parser(in):
+ *   node(in): node to check; the nodes linked by next are not checked
+ *   spec_list(in):
+ */
+static bool
+qo_refers_to_specs (PARSER_CONTEXT * parser, PT_NODE * node, PT_NODE * spec_list)
+{
+  PT_NODE *spec, *save_next;
+  SPEC_ID_INFO info;
+
+  if (node == NULL)
+    {
+      return false;
+    }
+
+  /* save, cut-off link */
+  save_next = node->next;
+  node->next = NULL;
+
+  info.appears = false;
+  for (spec = spec_list; spec != NULL && !info.appears; spec = spec->next)
+    {
+      info.id = spec->info.spec.id;
+      (void) parser_walk_tree (parser, node, qo_get_name_by_spec_id, &info, NULL, NULL);
+    }
+
+  node->next = save_next;	/* restore link */
+
+  return info.appears;
+}
+
+/*
+ * qo_is_null_extended_spec () - check whether an outer join may null-extend the rows of a spec
+ *   return:
+ *   spec(in): spec of a FROM list; the specs that follow it are joined to it
+ *
+ * Note: the right spec of a left outer join and the specs left of a right outer join are null-extended.
+ */
+bool
+qo_is_null_extended_spec (PT_NODE * spec)
+{
+  PT_NODE *next_spec;
+
+  if (spec->info.spec.join_type == PT_JOIN_LEFT_OUTER || spec->info.spec.join_type == PT_JOIN_FULL_OUTER)
+    {
+      return true;
+    }
+  for (next_spec = spec->next; next_spec != NULL; next_spec = next_spec->next)
+    {
+      if (next_spec->info.spec.join_type == PT_JOIN_RIGHT_OUTER
+	  || next_spec->info.spec.join_type == PT_JOIN_FULL_OUTER)
+	{
+	  return true;
+	}
+    }
+
+  return false;
+}
+
+/*
+ * qo_is_not_null_attr () - check whether an attribute has the NOT NULL constraint and is never null-extended
+ *   return:
+ *   spec_list(in): specs the attribute may be bound to
+ *   attr(in):
+ *
+ * Note: an attribute of the inner side of an outer join is NULL for unmatched rows, whatever its constraints.
+ */
+static bool
+qo_is_not_null_attr (PT_NODE * spec_list, PT_NODE * attr)
+{
+  PT_NODE *spec;
+  DB_OBJECT *class_obj = NULL;
+  DB_ATTRIBUTE *db_att;
+
+  if (attr == NULL || attr->node_type != PT_NAME || attr->info.name.meta_class != PT_NORMAL)
+    {
+      return false;
+    }
+
+  for (spec = spec_list; spec != NULL; spec = spec->next)
+    {
+      if (spec->info.spec.id == attr->info.name.spec_id)
+	{
+	  break;
+	}
+    }
+
+  /* subclasses need not have the constraint */
+  if (spec == NULL || PT_SPEC_IS_ALL (spec))
+    {
+      return false;
+    }
+
+  if (qo_is_null_extended_spec (spec))
+    {
+      return false;
+    }
+
+  PT_SPEC_GET_DB_OBJECT (spec, class_obj);
+  if (class_obj == NULL)
+    {
+      return false;
+    }
+
+  db_att = db_get_attribute (class_obj, attr->info.name.original);
+  if (db_att == NULL)
+    {
+      er_clear ();
+      return false;
+    }
+
+  return db_attribute_is_non_null (db_att) ? true : false;
+}
+
+/*
+ * qo_is_unnest_key_compatible () - check whether a join on outer_key = inner_key matches each outer row to at most
+ *				     one distinct inner key
+ *   return:
+ *   outer_key(in):
+ *   inner_key(in):
+ */
+static bool
+qo_is_unnest_key_compatible (PT_NODE * outer_key, PT_NODE * inner_key)
+{
+  if (outer_key->type_enum != inner_key->type_enum || !tp_valid_indextype (pt_type_enum_to_db (outer_key->type_enum)))
+    {
+      return false;
+    }
+
+  /* DISTINCT of the derived table must compare keys like the join term */
+  if (PT_HAS_COLLATION (outer_key->type_enum)
+      && (outer_key->data_type == NULL || inner_key->data_type == NULL
+	  || outer_key->data_type->info.data_type.collation_id != inner_key->data_type->info.data_type.collation_id))
+    {
+      return false;
+    }
+
+  return true;
+}
+
+/*
+ * qo_is_unnestable_subquery () - check whether a subquery of the WHERE clause can be rewritten to a join
+ *   return:
+ *   parser(in):
+ *   query(in): SELECT node whose WHERE clause has the subquery
+ *   subquery(in):
+ *   in_arg(in): left argument of IN, NOT IN; NULL for EXISTS, NOT EXISTS
+ *   is_anti(in): true for NOT EXISTS, NOT IN
+ *
+ * Note: the subquery may refer to the query only by equality terms 'inner_expr = outer_attr' of its WHERE clause.
+ *       These terms become the join keys.
+ */
+static bool
+qo_is_unnestable_subquery (PARSER_CONTEXT * parser, PT_NODE * query, PT_NODE * subquery, PT_NODE * in_arg,
+			   bool is_anti)
+{
+  PT_NODE *from, *spec, *select_list, *term, *arg1, *arg2;
+  int keys_cnt;
+
+  if (subquery == NULL || subquery->node_type != PT_SELECT)
+    {
+      return false;
+    }
+
+  if (subquery->info.query.q.select.hint & PT_HINT_NO_UNNEST)
+    {
+      return false;
+    }
+
+  if (subquery->info.query.correlation_level > 1)
+    {
+      return false;
+    }
+
+  /* an uncorrelated EXISTS, IN is evaluated only once */
+  if (subquery->info.query.correlation_level == 0 && !(in_arg != NULL && is_anti))
+    {
+      return false;
+    }
+
+  from = subquery->info.query.q.select.from;
+  if (from == NULL || subquery->info.query.q.select.connect_by != NULL
+      || subquery->info.query.q.select.group_by != NULL || subquery->info.query.q.select.having != NULL
+      || subquery->info.query.limit != NULL || subquery->info.query.orderby_for != NULL
+      || subquery->info.query.with != NULL || PT_SELECT_INFO_IS_FLAGED (subquery, PT_SELECT_INFO_HAS_AGG)
+      || pt_has_aggregate (parser, subquery) || pt_has_analytic (parser, subquery)
+      || pt_has_inst_or_orderby_num (parser, subquery))
+    {
+      return false;
+    }
+
+  /* derived tables of the subquery must not be correlated to the query */
+  for (spec = from; spec != NULL; spec = spec->next)
+    {
+      if (qo_refers_to_specs (parser, spec, query->info.query.q.select.from))
+	{
+	  return false;
+	}
+    }
+
+  keys_cnt = 0;
+
+  if (in_arg != NULL)
+    {
+      select_list = pt_get_select_list (parser, subquery);
+      if (select_list == NULL || select_list->next != NULL || !pt_is_attr (in_arg)
+	  || !qo_is_unnest_key_compatible (in_arg, select_list)
+	  || qo_refers_to_specs (parser, select_list, query->info.query.q.select.from))
+	{
+	  return false;
+	}
+
+      /* an anti-join cannot tell a NULL key from a missing one; NOT IN is false or unknown for both */
+      if (is_anti
+	  && (!qo_is_not_null_attr (query->info.query.q.select.from, in_arg)
+	      || !qo_is_not_null_attr (from, select_list)))
+	{
+	  return false;
+	}
+
+      keys_cnt++;
+    }
+
+  for (term = subquery->info.query.q.select.where; term != NULL; term = term->next)
+    {
+      if (!qo_refers_to_specs (parser, term, query->info.query.q.select.from))
+	{
+	  continue;
+	}
+
+      /* correlated term must be 'inner_expr = outer_attr' */
+      if (term->or_next != NULL || term->node_type != PT_EXPR || term->info.expr.op != PT_EQ
+	  || term->info.expr.location != 0)
+	{
+	  return false;
+	}
+
+      arg1 = term->info.expr.arg1;
+      arg2 = term->info.expr.arg2;
+      if (arg1 == NULL || arg2 == NULL)
+	{
+	  return false;
+	}
+
+      if (qo_refers_to_specs (parser, arg1, query->info.query.q.select.from))
+	{
+	  /* make arg2 the outer attr */
+	  PT_NODE *tmp = arg1;
+	  arg1 = arg2;
+	  arg2 = tmp;
+	}
+
+      if (arg2->node_type != PT_NAME || arg2->info.name.meta_class != PT_NORMAL
+	  || qo_refers_to_specs (parser, arg1, query->info.query.q.select.from)
+	  || !qo_refers_to_specs (parser, arg1, from) || !qo_is_unnest_key_compatible (arg2, arg1))
+	{
+	  return false;
+	}
+
+      keys_cnt++;
+    }
+
+  return keys_cnt > 0;
+}
+
+/*
+ * qo_get_spec_class_stats () - get the statistics of the class of a spec
+ *   return: class statistics; NULL if spec is not a single class or its statistics are not available
+ *   spec(in):
+ *   class_mop(out): class of spec
+ */
+static CLASS_STATS *
+qo_get_spec_class_stats (PT_NODE * spec, MOP * class_mop)
+{
+  PT_NODE *entity;
+  SM_CLASS *smclass;
+
+  entity = spec->info.spec.entity_name;
+  if (spec->info.spec.derived_table != NULL || entity == NULL || entity->node_type != PT_NAME
+      || entity->info.name.db_object == NULL || spec->info.spec.flat_entity_list == NULL
+      || spec->info.spec.flat_entity_list->next != NULL)
+    {
+      return NULL;
+    }
+
+  *class_mop = entity->info.name.db_object;
+  smclass = sm_get_class_with_statistics (*class_mop);
+  if (smclass == NULL)
+    {
+      er_clear ();
+      return NULL;
+    }
+
+  return smclass->stats;
+}
+
+/*
+ * qo_get_unnest_key_index_height () - get the height of the lowest index that starts with a key of a subquery
+ *   return: index height; 0 if the key is not the first column of an index
+ *   key(in): inner key of a correlated term
+ *   from(in): specs of the subquery
+ */
+static int
+qo_get_unnest_key_index_height (PT_NODE * key, PT_NODE * from)
+{
+  PT_NODE *spec;
+  CLASS_STATS *stats;
+  ATTR_STATS *attr_stats;
+  MOP class_mop;
+  int attr_id, height, i, j;
+
+  if (key->node_type != PT_NAME || key->info.name.meta_class != PT_NORMAL)
+    {
+      return 0;
+    }
+
+  for (spec = from; spec != NULL; spec = spec->next)
+    {
+      if (spec->info.spec.id == key->info.name.spec_id)
+	{
+	  break;
+	}
+    }
+  if (spec == NULL || (stats = qo_get_spec_class_stats (spec, &class_mop)) == NULL || stats->attr_stats == NULL)
+    {
+      return 0;
+    }
+
+  attr_id = sm_att_id (class_mop, key->info.name.original);
+  height = 0;
+  for (i = 0, attr_stats = stats->attr_stats; i < stats->n_attrs; i++, attr_stats++)
+    {
+      if (attr_stats->id != attr_id)
+	{
+	  continue;
+	}
+      for (j = 0; j < attr_stats->n_btstats; j++)
+	{
+	  if (attr_stats->bt_stats[j].has_function == 0
+	      && (height == 0 || attr_stats->bt_stats[j].height < height))
+	    {
+	      height = MAX (attr_stats->bt_stats[j].height, 1);
+	    }
+	}
+      break;
+    }
+
+  return height;
+}
+
+/*
+ * qo_is_unnest_cheaper () - check if a correlated subquery costs less as a derived table evaluated once
+ *   return: true to unnest the subquery
+ *   parser(in):
+ *   query(in): SELECT node whose WHERE clause has the subquery
+ *   subquery(in):
+ *
+ * Note: Left in place, the subquery is evaluated once per row of query. An evaluation reads an index path if a
+ *       correlated key starts an index, and all pages of the subquery classes otherwise. Unnested, the pages of the
+ *       subquery classes are read once. The rows of query are estimated by its largest class; its own predicates are
+ *       ignored, so the estimate leans towards unnesting. Without statistics the subquery is unnested.
+ */
+static bool
+qo_is_unnest_cheaper (PARSER_CONTEXT * parser, PT_NODE * query, PT_NODE * subquery)
+{
+  PT_NODE *spec, *term, *key;
+  CLASS_STATS *stats;
+  MOP class_mop;
+  double outer_card, inner_pages, row_cost;
+  int height;
+
+  if (subquery->info.query.correlation_level == 0)
+    {
+      /* NOT IN of an uncorrelated subquery */
+      return true;
+    }
+
+  outer_card = 0;
+  for (spec = query->info.query.q.select.from; spec != NULL; spec = spec->next)
+    {
+      stats = qo_get_spec_class_stats (spec, &class_mop);
+      if (stats == NULL)
+	{
+	  return true;
+	}
+      outer_card = MAX (outer_card, (double) stats->heap_num_objects);
+    }
+
+  inner_pages = 0;
+  for (spec = subquery->info.query.q.select.from; spec != NULL; spec = spec->next)
+    {
+      stats = qo_get_spec_class_stats (spec, &class_mop);
+      if (stats == NULL)
+	{
+	  return true;
+	}
+      inner_pages += MAX ((double) stats->heap_num_pages, 1.0);
+    }
+
+  row_cost = inner_pages;
+  for (term = subquery->info.query.q.select.where; term != NULL; term = term->next)
+    {
+      if (term->node_type != PT_EXPR || term->info.expr.op != PT_EQ
+	  || !qo_refers_to_specs (parser, term, query->info.query.q.select.from))
+	{
+	  continue;
+	}
+
+      key = term->info.expr.arg1;
+      if (qo_refers_to_specs (parser, key, query->info.query.q.select.from))
+	{
+	  key = term->info.expr.arg2;
+	}
+
+      height = qo_get_unnest_key_index_height (key, subquery->info.query.q.select.from);
+      if (height > 0)
+	{
+	  row_cost = MIN (row_cost, (double) height);
+	}
+    }
+
+  return outer_card * row_cost >= inner_pages;
+}
+
+/*
+ * qo_unnest_subquery () - rewrite a subquery of the WHERE clause to a join with a derived table
+ *   return: error code
+ *   parser(in):
+ *   query(in): SELECT node whose WHERE clause has the subquery
+ *   subquery(in):
+ *   in_arg(in): left argument of IN, NOT IN; NULL for EXISTS, NOT EXISTS
+ *   is_anti(in): true for NOT EXISTS, NOT IN
+ *   idx(in/out): sequence of derived table attribute names
+ *   max_location(in/out): last location of the specs of query
+ *   new_terms(out): terms to replace the subquery term; NULL if the subquery is not rewritten
+ */
+static int
+qo_unnest_subquery (PARSER_CONTEXT * parser, PT_NODE * query, PT_NODE * subquery, PT_NODE * in_arg, bool is_anti,
+		    int *idx, short *max_location, PT_NODE ** new_terms)
+{
+  PT_NODE *outer_keys, *inner_keys, *term, **termp, *arg1, *arg2;
+  PT_NODE *new_spec, *new_attr, *new_attr_next, *outer_key_next, *eq_terms, *is_null;
+  RESET_LOCATION_INFO locate_info;
+
+  *new_terms = NULL;
+
+  if (!qo_is_unnestable_subquery (parser, query, subquery, in_arg, is_anti)
+      || !qo_is_unnest_cheaper (parser, query, subquery))
+    {
+      return NO_ERROR;
+    }
+
+  /* collect keys; the compared column of IN is the first */
+  if (in_arg != NULL)
+    {
+      outer_keys = in_arg;
+      inner_keys = subquery->info.query.q.select.list;
+    }
+  else
+    {
+      outer_keys = inner_keys = NULL;
+      parser_free_tree (parser, subquery->info.query.q.select.list);
+    }
+  subquery->info.query.q.select.list = NULL;
+
+  termp = &subquery->info.query.q.select.where;
+  while ((term = *termp) != NULL)
+    {
+      if (!qo_refers_to_specs (parser, term, query->info.query.q.select.from))
+	{
+	  termp = &term->next;
+	  continue;
+	}
+
+      arg1 = term->info.expr.arg1;
+      arg2 = term->info.expr.arg2;
+      if (qo_refers_to_specs (parser, arg1, query->info.query.q.select.from))
+	{
+	  PT_NODE *tmp = arg1;
+	  arg1 = arg2;
+	  arg2 = tmp;
+	}
+
+      /* outer attr is no longer correlated */
+      arg2->info.name.correlation_level = 0;
+
+      inner_keys = parser_append_node (arg1, inner_keys);
+      outer_keys = parser_append_node (arg2, outer_keys);
+
+      /* remove the term from the subquery */
+      *termp = term->next;
+      term->next = NULL;
+      term->info.expr.arg1 = term->info.expr.arg2 = NULL;
+      parser_free_node (parser, term);
+    }
+
+  /* a distinct key matches each row of query at most once */
+  subquery->info.query.q.select.list = inner_keys;
+  subquery->info.query.all_distinct = PT_DISTINCT;
+  subquery->info.query.correlation_level = 0;
+  if (subquery->info.query.order_by != NULL)
+    {
+      parser_free_tree (parser, subquery->info.query.order_by);
+      subquery->info.query.order_by = NULL;
+    }
+
+  /* make new derived spec and append it to FROM */
+  if (mq_make_derived_spec (parser, query, subquery, idx, &new_spec, &new_attr) == NULL)
+    {
+      return ER_FAILED;
+    }
+
+  /* create 'outer_key = new_attr' */
+  eq_terms = NULL;
+  for (; outer_keys != NULL && new_attr != NULL; outer_keys = outer_key_next, new_attr = new_attr_next)
+    {
+      /* save, cut-off link */
+      outer_key_next = outer_keys->next;
+      outer_keys->next = NULL;
+      new_attr_next = new_attr->next;
+      new_attr->next = NULL;
+
+      term = parser_new_node (parser, PT_EXPR);
+      if (term == NULL)
+	{
+	  PT_INTERNAL_ERROR (parser, "allocate new node");
+	  return ER_FAILED;
+	}
+
+      term->type_enum = PT_TYPE_LOGICAL;
+      term->info.expr.op = PT_EQ;
+      term->info.expr.arg1 = outer_keys;
+      term->info.expr.arg2 = new_attr;
+
+      eq_terms = parser_append_node (term, eq_terms);
+    }
+
+  if (!is_anti)
+    {
+      /* semi-join */
+      *new_terms = eq_terms;
+      return NO_ERROR;
+    }
+
+  /* anti-join: query LEFT OUTER JOIN derived ON 'outer_key = new_attr' WHERE new_attr IS NULL */
+  is_null = parser_new_node (parser, PT_EXPR);
+  if (is_null == NULL)
+    {
+      PT_INTERNAL_ERROR (parser, "allocate new node");
+      return ER_FAILED;
+    }
+
+  is_null->type_enum = PT_TYPE_LOGICAL;
+  is_null->info.expr.op = PT_IS_NULL;
+  is_null->info.expr.arg1 = parser_copy_tree (parser, eq_terms->info.expr.arg2);
+
+  (*max_location)++;
+  new_spec->info.spec.join_type = PT_JOIN_LEFT_OUTER;
+  new_spec->info.spec.location = *max_location;
+
+  /* mark join terms as ON condition of the new spec */
+  locate_info.start = 0;
+  locate_info.end = *max_location;
+  (void) parser_walk_tree (parser, eq_terms, qo_modify_location, &locate_info, NULL, NULL);
+
+  *new_terms = parser_append_node (eq_terms, is_null);
+
+  return NO_ERROR;
+}
+
+/*
+ * qo_unnest_subqueries () - rewrite correlated subqueries of the WHERE clause to semi-joins and anti-joins
+ *   return: error code
+ *   parser(in):
+ *   node(in): SELECT node
+ *   idx(in/out): sequence of derived table attribute names
+ *
+ * Note: A subquery is rewritten to a derived table that selects the distinct values of its correlation keys:
+ *
+ *	   EXISTS (SELECT ... FROM s WHERE s.a = t.a AND p)
+ *	     -> t.a = av.av1, FROM ..., (SELECT DISTINCT s.a FROM s WHERE p) av (av1)
+ *	   NOT EXISTS (SELECT ... FROM s WHERE s.a = t.a AND p)
+ *	     -> av.av1 IS NULL, FROM ... LEFT OUTER JOIN (SELECT DISTINCT s.a FROM s WHERE p) av (av1)
+ *		ON t.a = av.av1
+ *
+ *       IN and NOT IN join the compared column as the first key. Because the keys of the derived table are distinct,
+ *       the join returns each row at most once, and the subquery is evaluated once instead of once per row; the
+ *       planner may join the derived table by hash list scan or merge join. NOT IN is rewritten only if neither of
+ *       its columns can be NULL.
+ *
+ *       A correlated subquery is rewritten only if evaluating it once costs less than evaluating it for each row of
+ *       the query; see qo_is_unnest_cheaper (). NO_UNNEST on the query or on the subquery keeps it as it is.
+ */
+static int
+qo_unnest_subqueries (PARSER_CONTEXT * parser, PT_NODE * node, int *idx)
+{
+  PT_NODE *spec, *cnf_node, **cnf_nodep, *subquery, *in_arg, *new_terms, *last;
+  short max_location;
+  bool is_anti, do_anti;
+  int error;
+
+  if (node->node_type != PT_SELECT || node->info.query.q.select.connect_by != NULL
+      || node->info.query.q.select.from == NULL || (node->info.query.q.select.hint & PT_HINT_NO_UNNEST))
+    {
+      return NO_ERROR;
+    }
+
+  max_location = 0;
+  for (spec = node->info.query.q.select.from; spec != NULL; spec = spec->next)
+    {
+      /* keep the join order of outer joins and path expressions */
+      if (spec->info.spec.join_type == PT_JOIN_LEFT_OUTER || spec->info.spec.join_type == PT_JOIN_RIGHT_OUTER
+	  || spec->info.spec.join_type == PT_JOIN_FULL_OUTER || spec->info.spec.path_entities != NULL)
+	{
+	  return NO_ERROR;
+	}
+      max_location = MAX (max_location, spec->info.spec.location);
+    }
+
+  /* semi-joins first; anti-joins are outer joins and must be the last specs */
+  for (do_anti = false;; do_anti = true)
+    {
+      cnf_nodep = &node->info.query.q.select.where;
+      while ((cnf_node = *cnf_nodep) != NULL)
+	{
+	  subquery = in_arg = NULL;
+	  is_anti = false;
+
+	  if (cnf_node->or_next == NULL && cnf_node->node_type == PT_EXPR && cnf_node->info.expr.location == 0)
+	    {
+	      switch (cnf_node->info.expr.op)
+		{
+		case PT_EXISTS:
+		  subquery = cnf_node->info.expr.arg1;
+		  break;
+		case PT_NOT:
+		  if (cnf_node->info.expr.arg1 != NULL && cnf_node->info.expr.arg1->node_type == PT_EXPR
+		      && cnf_node->info.expr.arg1->info.expr.op == PT_EXISTS)
+		    {
+		      subquery = cnf_node->info.expr.arg1->info.expr.arg1;
+		      is_anti = true;
+		    }
+		  break;
+		case PT_IS_IN:
+		case PT_EQ_SOME:
+		  in_arg = cnf_node->info.expr.arg1;
+		  subquery = cnf_node->info.expr.arg2;
+		  break;
+		case PT_IS_NOT_IN:
+		case PT_NE_ALL:
+		  in_arg = cnf_node->info.expr.arg1;
+		  subquery = cnf_node->info.expr.arg2;
+		  is_anti = true;
+		  break;
+		default:
+		  break;
+		}
+	    }
+
+	  if (subquery == NULL || is_anti != do_anti || (in_arg != NULL && in_arg->next != NULL))
+	    {
+	      cnf_nodep = &cnf_node->next;
+	      continue;
+	    }
+
+	  error = qo_unnest_subquery (parser, node, subquery, in_arg, is_anti, idx, &max_location, &new_terms);
+	  if (error != NO_ERROR)
+	    {
+	      return error;
+	    }
+
+	  if (new_terms == NULL)
+	    {
+	      cnf_nodep = &cnf_node->next;
+	      continue;
+	    }
+
+	  /* replace the subquery term with new terms */
+	  for (last = new_terms; last->next != NULL; last = last->next)
+	    {
+	      ;
+	    }
+	  last->next = cnf_node->next;
+	  *cnf_nodep = new_terms;
+	  cnf_nodep = &last->next;
+
+	  cnf_node->next = NULL;
+	  if (cnf_node->info.expr.op == PT_NOT)
+	    {
+	      cnf_node->info.expr.arg1->info.expr.arg1 = NULL;
+	    }
+	  else
+	    {
+	      cnf_node->info.expr.arg1 = cnf_node->info.expr.arg2 = NULL;
+	    }
+	  parser_free_tree (parser, cnf_node);
+	}
+
+      if (do_anti)
+	{
+	  break;
+	}
+    }
+
+  return NO_ERROR;
+}
+
 /*
  * qo_is_partition_attr () -
  *   return:
@@ -8454,6 +9175,12 @@ qo_optimize_queries (PARSER_CONTEXT * parser, PT_NODE * node, void *arg, int *co
 
 	  /* rewrite uncorrelated subquery to join query */
 	  qo_rewrite_subqueries (parser, node, &idx, &continue_walk);
+
+	  /* rewrite correlated subquery to semi-join, anti-join query */
+	  if (qo_unnest_subqueries (parser, node, &idx) != NO_ERROR)
+	    {
+	      return node;
+	    }
 	}
 
       /* rewrite optimization on WHERE, HAVING clause */
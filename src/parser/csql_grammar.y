@@ -3002,6 +3002,20 @@ create_stmt
 			$$ = node;
 			PARSER_SAVE_ERR_CONTEXT ($$, @$.buffer_pos)
 
+		DBG_PRINT}}
+	| CREATE STATISTICS ON_ class_name '(' identifier_list ')'
+		{{ DBG_TRACE_GRAMMAR(create_stmt, | CREATE STATISTICS ON_ class_name '(' identifier_list ')');
+
+			PT_NODE *ups = parser_new_node (this_parser, PT_UPDATE_STATS);
+			if (ups)
+			  {
+			    ups->info.update_stats.class_list = $4;
+			    ups->info.update_stats.column_group = $6;
+			    ups->info.update_stats.column_group_op = 1;
+			  }
+			$$ = ups;
+			PARSER_SAVE_ERR_CONTEXT ($$, @$.buffer_pos)
+
 		DBG_PRINT}}
 	| CREATE IdName
 		{{ DBG_TRACE_GRAMMAR(create_stmt, | CREATE IdName);
@@ -4447,6 +4461,20 @@ drop_stmt
 			$$ = node;
 			PARSER_SAVE_ERR_CONTEXT ($$, @$.buffer_pos)
 
+		DBG_PRINT}}
+	| DROP STATISTICS ON_ class_name '(' identifier_list ')'
+		{{ DBG_TRACE_GRAMMAR(drop_stmt, | DROP STATISTICS ON_ class_name '(' identifier_list ')');
+
+			PT_NODE *ups = parser_new_node (this_parser, PT_UPDATE_STATS);
+			if (ups)
+			  {
+			    ups->info.update_stats.class_list = $4;
+			    ups->info.update_stats.column_group = $6;
+			    ups->info.update_stats.column_group_op = -1;
+			  }
+			$$ = ups;
+			PARSER_SAVE_ERR_CONTEXT ($$, @$.buffer_pos)
+
 		DBG_PRINT}}
 	| DROP PROCEDURE identifier_list
 		{{ DBG_TRACE_GRAMMAR(drop_stmt, | DROP PROCEDURE identifier_list);
@@ -4639,7 +4667,8 @@ update_statistics_stmt
 			  {
 			    ups->info.update_stats.class_list = $4;
 			    ups->info.update_stats.all_classes = 0;
-			    ups->info.update_stats.with_fullscan = $5;
+			    ups->info.update_stats.with_fullscan = ($5 < 0);
+			    ups->info.update_stats.sample_rows = MAX ($5, 0);
 			  }
 			$$ = ups;
 			PARSER_SAVE_ERR_CONTEXT ($$, @$.buffer_pos)
@@ -4653,7 +4682,8 @@ update_statistics_stmt
 			  {
 			    ups->info.update_stats.class_list = NULL;
 			    ups->info.update_stats.all_classes = 1;
-			    ups->info.update_stats.with_fullscan = $6;
+			    ups->info.update_stats.with_fullscan = ($6 < 0);
+			    ups->info.update_stats.sample_rows = MAX ($6, 0);
 			  }
 			$$ = ups;
 			PARSER_SAVE_ERR_CONTEXT ($$, @$.buffer_pos)
@@ -4667,7 +4697,8 @@ update_statistics_stmt
 			  {
 			    ups->info.update_stats.class_list = NULL;
 			    ups->info.update_stats.all_classes = -1;
-			    ups->info.update_stats.with_fullscan = $6;
+			    ups->info.update_stats.with_fullscan = ($6 < 0);
+			    ups->info.update_stats.sample_rows = MAX ($6, 0);
 			  }
 			$$ = ups;
 			PARSER_SAVE_ERR_CONTEXT ($$, @$.buffer_pos)
@@ -4717,7 +4748,28 @@ opt_with_fullscan
         | WITH FULLSCAN
                 {{ DBG_TRACE_GRAMMAR(opt_with_fullscan, |  WITH FULLSCAN);
 
-                        $$ = 1;
+                        $$ = -1;
+
+                DBG_PRINT}}
+        | WITH identifier unsigned_integer ROWS
+                {{ DBG_TRACE_GRAMMAR(opt_with_fullscan, |  WITH identifier unsigned_integer ROWS);
+
+                        /* SAMPLE is not a keyword, so that it stays a plain identifier everywhere else */
+                        if (intl_identifier_casecmp ($2->info.name.original, "sample") != 0)
+                          {
+                            PT_ERRORf (this_parser, $2, "check syntax at %s, expected SAMPLE.",
+                                       parser_print_tree (this_parser, $2));
+                          }
+
+                        /* -1 is WITH FULLSCAN; the sample is given in objects */
+                        if ($3->type_enum == PT_TYPE_INTEGER)
+                          {
+                            $$ = MAX ($3->info.value.data_value.i, 1);
+                          }
+                        else
+                          {
+                            $$ = INT_MAX;
+                          }
 
                 DBG_PRINT}}
         ;
@@ -25718,6 +25770,7 @@ PT_HINT parser_hint_table[] = {
   INIT_PT_HINT("NO_PUSH_PRED", PT_HINT_NO_PUSH_PRED),
   INIT_PT_HINT("NO_MERGE", PT_HINT_NO_MERGE),
   INIT_PT_HINT("NO_ELIMINATE_JOIN", PT_HINT_NO_ELIMINATE_JOIN),
+  INIT_PT_HINT("NO_UNNEST", PT_HINT_NO_UNNEST),
   INIT_PT_HINT("SKIP_UPDATE_NULL", PT_HINT_SKIP_UPDATE_NULL),
   INIT_PT_HINT("NO_INDEX_LS", PT_HINT_NO_INDEX_LS),
   INIT_PT_HINT("INDEX_LS", PT_HINT_INDEX_LS),
@@ -1359,6 +1359,7 @@ typedef UINT64 PT_HINT_ENUM;
 #define  PT_HINT_NO_PUSH_PRED  0x200000000ULL	/* do not push predicates */
 #define  PT_HINT_NO_MERGE  0x400000000ULL	/* do not merge view or in-line view */
 #define  PT_HINT_NO_ELIMINATE_JOIN  0x800000000ULL	/* do not eliminate join */
+#define  PT_HINT_NO_UNNEST  0x1000000000ULL	/* do not unnest correlated subqueries */
 
 /* Codes for error messages */
 typedef enum
@@ -3056,6 +3057,9 @@ struct pt_update_stats_info
   PT_NODE *class_list;		/* PT_NAME */
   int all_classes;		/* 1 iff ALL CLASSES */
   int with_fullscan;		/* 1 iff WITH FULLSCAN */
+  int sample_rows;		/* n of WITH SAMPLE n ROWS, 0 otherwise */
+  PT_NODE *column_group;	/* PT_NAME list of CREATE/DROP STATISTICS */
+  int column_group_op;		/* 1 iff CREATE STATISTICS, -1 iff DROP STATISTICS */
 };
 
 /* GET STATISTICS INFO */
@@ -14153,6 +14153,11 @@ pt_print_select (PARSER_CONTEXT * parser, PT_NODE * p)
 	      q = pt_append_nulstring (parser, q, "NO_ELIMINATE_JOIN ");
 	    }
 
+	  if (p->info.query.q.select.hint & PT_HINT_NO_UNNEST)
+	    {
+	      q = pt_append_nulstring (parser, q, "NO_UNNEST ");
+	    }
+
 	  if (p->info.query.q.select.hint & PT_HINT_NO_INDEX_LS)
 	    {
 	      q = pt_append_nulstring (parser, q, "NO_INDEX_LS ");
@@ -15419,6 +15424,7 @@ static PT_NODE *
 pt_apply_update_stats (PARSER_CONTEXT * parser, PT_NODE * p, void *arg)
 {
   PT_APPLY_WALK (parser, p->info.update_stats.class_list, arg);
+  PT_APPLY_WALK (parser, p->info.update_stats.column_group, arg);
   return p;
 }
 
@@ -15433,6 +15439,19 @@ pt_print_update_stats (PARSER_CONTEXT * parser, PT_NODE * p)
 {
   PARSER_VARCHAR *b = 0, *r1;
 
+  if (p->info.update_stats.column_group_op != 0)
+    {
+      b = pt_append_nulstring (parser, b, (p->info.update_stats.column_group_op > 0)
+			       ? "create statistics on " : "drop statistics on ");
+      r1 = pt_print_bytes_l (parser, p->info.update_stats.class_list);
+      b = pt_append_varchar (parser, b, r1);
+      r1 = pt_print_bytes_l (parser, p->info.update_stats.column_group);
+      b = pt_append_nulstring (parser, b, " (");
+      b = pt_append_varchar (parser, b, r1);
+      b = pt_append_nulstring (parser, b, ")");
+      return b;
+    }
+
   b = pt_append_nulstring (parser, b, "update statistics on ");
   if (p->info.update_stats.all_classes > 0)
     {
@@ -15453,6 +15472,13 @@ pt_print_update_stats (PARSER_CONTEXT * parser, PT_NODE * p)
       assert (p->info.update_stats.with_fullscan == 1);
       b = pt_append_nulstring (parser, b, " with fullscan");
     }
+  else if (p->info.update_stats.sample_rows > 0)
+    {
+      char buf[64];
+
+      sprintf (buf, " with sample %d rows", p->info.update_stats.sample_rows);
+      b = pt_append_nulstring (parser, b, buf);
+    }
 
   return b;
 }
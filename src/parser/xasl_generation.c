@@ -581,6 +581,9 @@ static VAL_LIST *pt_make_val_list (PARSER_CONTEXT * parser, PT_NODE * attribute_
 static TABLE_INFO *pt_make_table_info (PARSER_CONTEXT * parser, PT_NODE * table_spec);
 
 static SYMBOL_INFO *pt_symbol_info_alloc (void);
+static void pt_add_correlated_value (SYMBOL_INFO * scope, SYMBOL_INFO * home, DB_VALUE * dbval, TP_DOMAIN * domain);
+static PT_NODE *pt_is_memoizable_query_pre (PARSER_CONTEXT * parser, PT_NODE * node, void *arg, int *continue_walk);
+static REGU_VARIABLE_LIST pt_to_memo_key_list (PARSER_CONTEXT * parser, PT_NODE * query, SYMBOL_INFO * symbols);
 
 static PRED_EXPR *pt_make_pred_expr_pred (const PRED_EXPR * arg1, const PRED_EXPR * arg2, const BOOL_OP bop);
 
@@ -1320,6 +1323,7 @@ pt_make_pred_term_comp (const REGU_VARIABLE * arg1, const REGU_VARIABLE * arg2,
 	  et_comp->rhs = (REGU_VARIABLE *) arg2;
 	  et_comp->rel_op = rop;
 	  et_comp->type = data_type;
+	  et_comp->fast_cmp = NULL;
 	}
     }
 
@@ -3646,11 +3650,162 @@ pt_symbol_info_alloc (void)
       symbols->listfile_attr_offset = 0;
 
       symbols->query_node = NULL;
+
+      symbols->correlated_values = NULL;
+      symbols->has_unkeyed_correlation = false;
     }
 
   return symbols;
 }
 
+/*
+ * pt_add_correlated_value () - remember a correlated reference in the scopes it crosses
+ *   return:
+ *   scope(in): innermost scope of the reference
+ *   home(in): scope the referenced attribute belongs to
+ *   dbval(in): value holder of the attribute; NULL if the reference is not a plain value
+ *   domain(in): domain of the attribute
+ *
+ * Note: The result of a query is a function of the values it references from its enclosing scopes. The scopes
+ *       between the reference and the home of the attribute collect those values so that a single tuple subquery
+ *       can be memoized on them (see pt_to_memo_key_list ()).
+ */
+static void
+pt_add_correlated_value (SYMBOL_INFO * scope, SYMBOL_INFO * home, DB_VALUE * dbval, TP_DOMAIN * domain)
+{
+  REGU_VARIABLE_LIST regu_list;
+
+  for (; scope != NULL && scope != home; scope = scope->stack)
+    {
+      if (dbval == NULL)
+	{
+	  scope->has_unkeyed_correlation = true;
+	  continue;
+	}
+
+      for (regu_list = scope->correlated_values; regu_list != NULL; regu_list = regu_list->next)
+	{
+	  if (regu_list->value.value.dbvalptr == dbval)
+	    {
+	      break;
+	    }
+	}
+      if (regu_list != NULL)
+	{
+	  /* already referenced */
+	  continue;
+	}
+
+      regu_alloc (regu_list);
+      if (regu_list == NULL)
+	{
+	  scope->has_unkeyed_correlation = true;
+	  continue;
+	}
+
+      regu_list->value.type = TYPE_CONSTANT;
+      regu_list->value.domain = domain;
+      regu_list->value.value.dbvalptr = dbval;
+      regu_list->next = scope->correlated_values;
+      scope->correlated_values = regu_list;
+    }
+}
+
+/*
+ * pt_is_memoizable_query_pre () - check that a query returns the same result for the same correlated values
+ *   return:
+ *   parser(in):
+ *   node(in):
+ *   arg(out): bool, set to false if the query is not memoizable
+ *   continue_walk(in/out):
+ */
+static PT_NODE *
+pt_is_memoizable_query_pre (PARSER_CONTEXT * parser, PT_NODE * node, void *arg, int *continue_walk)
+{
+  bool *is_memoizable = (bool *) arg;
+
+  switch (node->node_type)
+    {
+    case PT_EXPR:
+      if (PT_IS_SERIAL (node->info.expr.op) || PT_REQUIRES_HIERARCHICAL_QUERY (node->info.expr.op))
+	{
+	  *is_memoizable = false;
+	}
+      switch (node->info.expr.op)
+	{
+	case PT_RAND:
+	case PT_RANDOM:
+	case PT_DRAND:
+	case PT_DRANDOM:
+	case PT_SYS_GUID:
+	case PT_SLEEP:
+	case PT_DEFINE_VARIABLE:
+	case PT_EVALUATE_VARIABLE:
+	case PT_ROW_COUNT:
+	case PT_LAST_INSERT_ID:
+	case PT_TRACE_STATS:
+	  *is_memoizable = false;
+	  break;
+
+	default:
+	  break;
+	}
+      break;
+
+    case PT_SPEC:
+      if (PT_SPEC_IS_CTE (node) && node->info.spec.cte_pointer->info.pointer.node != NULL
+	  && node->info.spec.cte_pointer->info.pointer.node->info.cte.recursive_part != NULL)
+	{
+	  /* the working table of a recursive CTE changes between iterations */
+	  *is_memoizable = false;
+	}
+      break;
+
+    case PT_METHOD_CALL:
+    case PT_INSERT:
+    case PT_UPDATE:
+    case PT_DELETE:
+    case PT_MERGE:
+      *is_memoizable = false;
+      break;
+
+    default:
+      break;
+    }
+
+  if (!*is_memoizable)
+    {
+      *continue_walk = PT_STOP_WALK;
+    }
+
+  return node;
+}
+
+/*
+ * pt_to_memo_key_list () - get the correlated values a query result depends on
+ *   return: list of correlated values, or NULL if the query cannot be memoized
+ *   parser(in):
+ *   query(in): query node being translated
+ *   symbols(in): scope of the query
+ *
+ * Note: The server keeps the results of a correlated single tuple subquery keyed on these values and skips its
+ *       execution when the same values come again.
+ */
+static REGU_VARIABLE_LIST
+pt_to_memo_key_list (PARSER_CONTEXT * parser, PT_NODE * query, SYMBOL_INFO * symbols)
+{
+  bool is_memoizable = true;
+
+  if (symbols == NULL || symbols->correlated_values == NULL || symbols->has_unkeyed_correlation)
+    {
+      return NULL;
+    }
+
+  (void) parser_walk_tree (parser, query, pt_is_memoizable_query_pre, &is_memoizable, NULL, NULL);
+
+  return is_memoizable ? symbols->correlated_values : NULL;
+}
+
 
 /*
  * pt_is_single_tuple () -
@@ -9944,7 +10099,7 @@ static REGU_VARIABLE *
 pt_attribute_to_regu (PARSER_CONTEXT * parser, PT_NODE * attr)
 {
   REGU_VARIABLE *regu = NULL;
-  SYMBOL_INFO *symbols;
+  SYMBOL_INFO *symbols, *scope;
   DB_VALUE *dbval = NULL;
   TABLE_INFO *table_info;
   int list_index;
@@ -10097,6 +10252,7 @@ pt_attribute_to_regu (PARSER_CONTEXT * parser, PT_NODE * attr)
 	    {
 	      /* The attribute is correlated variable. Find it in an enclosing scope(s). Note that this subquery has
 	       * also just been determined to be a correlated subquery. */
+	      scope = symbols;
 	      if (symbols->stack == NULL)
 		{
 		  if (!pt_has_error (parser))
@@ -10122,6 +10278,7 @@ pt_attribute_to_regu (PARSER_CONTEXT * parser, PT_NODE * attr)
 		      dbval =
 			pt_index_value (table_info->value_list,
 					pt_find_attribute (parser, attr, table_info->attribute_list));
+		      pt_add_correlated_value (scope, symbols, dbval, regu->domain);
 		      if (dbval)
 			{
 			  regu->value.dbvalptr = dbval;
@@ -12039,6 +12196,11 @@ pt_to_index_info (PARSER_CONTEXT * parser, DB_OBJECT * class_, PRED_EXPR * where
 
   indx_infop->class_oid = class_->oid_info.oid;
   indx_infop->use_desc_index = index_entryp->use_descending;
+  if (qo_plan_ordered_partitions (plan))
+    {
+      /* the partitions are scanned in the direction of ORDER BY */
+      indx_infop->use_desc_index = plan->use_iscan_descending;
+    }
   indx_infop->orderby_skip = index_entryp->orderby_skip;
   indx_infop->groupby_skip = index_entryp->groupby_skip;
 
@@ -16756,6 +16918,12 @@ pt_to_buildlist_proc (PARSER_CONTEXT * parser, PT_NODE * select_node, QO_PLAN *
 	      xasl->orderby_list = pt_to_orderby (parser, select_node->info.query.order_by, select_node);
 	      /* clear flag */
 	      XASL_CLEAR_FLAG (xasl, XASL_SKIP_ORDERBY_LIST);
+
+	      if (qo_plan && qo_plan_ordered_partitions (qo_plan))
+		{
+		  /* the top-n sort may end the scan of each partition early */
+		  XASL_SET_FLAG (xasl, XASL_ORDERED_PARTITION_SCAN);
+		}
 	    }
 
 	  /* sanity check */
@@ -16830,7 +16998,8 @@ pt_to_buildlist_proc (PARSER_CONTEXT * parser, PT_NODE * select_node, QO_PLAN *
 	}
 
       /* set index scan order */
-      xasl->iscan_oid_order = ((orderby_skip) ? false : prm_get_bool_value (PRM_ID_BT_INDEX_SCAN_OID_ORDER));
+      xasl->iscan_oid_order = ((orderby_skip || XASL_IS_FLAGED (xasl, XASL_ORDERED_PARTITION_SCAN))
+			       ? false : prm_get_bool_value (PRM_ID_BT_INDEX_SCAN_OID_ORDER));
 
       /* save single tuple info */
       if (select_node->info.query.flag.single_tuple == 1)
@@ -21880,6 +22049,10 @@ parser_generate_xasl_post (PARSER_CONTEXT * parser, PT_NODE * node, void *arg, i
 
       /* build XASL for the query */
       xasl = parser_generate_xasl_proc (parser, node, info->query_list);
+      if (xasl != NULL)
+	{
+	  xasl->memo_key_list = pt_to_memo_key_list (parser, node, parser->symbols);
+	}
       pt_pop_symbol_info (parser);
       if (node->node_type == PT_SELECT)
 	{
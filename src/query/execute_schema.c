@@ -6489,7 +6489,7 @@ do_analyze_partition (PARSER_CONTEXT * parser, PT_NODE * alter, SM_PARTITION_ALT
       while (name)
 	{
 	  assert (name->info.name.db_object != NULL);
-	  error = sm_update_statistics (name->info.name.db_object, STATS_WITH_SAMPLING);
+	  error = sm_update_statistics (name->info.name.db_object, STATS_WITH_SAMPLING, STATS_SAMPLE_ROWS_DEFAULT);
 	  if (error != NO_ERROR)
 	    {
 	      return error;
@@ -6507,7 +6507,7 @@ do_analyze_partition (PARSER_CONTEXT * parser, PT_NODE * alter, SM_PARTITION_ALT
 	{
 	  return error;
 	}
-      error = sm_update_statistics (pinfo->root_op, STATS_WITH_SAMPLING);
+      error = sm_update_statistics (pinfo->root_op, STATS_WITH_SAMPLING, STATS_SAMPLE_ROWS_DEFAULT);
       if (error != NO_ERROR)
 	{
 	  return error;
@@ -6527,7 +6527,7 @@ do_analyze_partition (PARSER_CONTEXT * parser, PT_NODE * alter, SM_PARTITION_ALT
 	      continue;
 	    }
 
-	  error = sm_update_statistics (obj->op, STATS_WITH_SAMPLING);
+	  error = sm_update_statistics (obj->op, STATS_WITH_SAMPLING, STATS_SAMPLE_ROWS_DEFAULT);
 	  if (error != NO_ERROR)
 	    {
 	      return error;
@@ -4141,6 +4141,7 @@ static CST_ITEM cst_item_tbl[] = {
   {CST_UNDEFINED, "", 0, 0}
 };
 
+static int do_update_column_group_stats (PARSER_CONTEXT * parser, PT_NODE * statement);
 static char *extract_att_name (const char *str);
 static int extract_bt_idx (const char *str);
 static int make_cst_item_value (DB_OBJECT * obj, const char *str, DB_VALUE * db_val);
@@ -4158,6 +4159,12 @@ do_update_stats (PARSER_CONTEXT * parser, PT_NODE * statement)
 
   CHECK_MODIFICATION_ERROR ();
 
+  if (statement->info.update_stats.column_group_op != 0)
+    {
+      // CREATE/DROP STATISTICS
+      return do_update_column_group_stats (parser, statement);
+    }
+
   if (statement->info.update_stats.all_classes > 0)
     {
       // ALL CLASSES
@@ -4168,7 +4175,8 @@ do_update_stats (PARSER_CONTEXT * parser, PT_NODE * statement)
 	}
 
       error = sm_update_all_statistics (statement->info.update_stats.with_fullscan
-					? STATS_WITH_FULLSCAN : STATS_WITH_SAMPLING);
+					? STATS_WITH_FULLSCAN : STATS_WITH_SAMPLING,
+					statement->info.update_stats.sample_rows);
       return error;
     }
   else if (statement->info.update_stats.all_classes < 0)
@@ -4221,13 +4229,88 @@ do_update_stats (PARSER_CONTEXT * parser, PT_NODE * statement)
 	  class_mop = cls->info.name.db_object;
 
 	  error = sm_update_statistics (class_mop, (statement->info.update_stats.with_fullscan
-						    ? STATS_WITH_FULLSCAN : STATS_WITH_SAMPLING));
+						    ? STATS_WITH_FULLSCAN : STATS_WITH_SAMPLING),
+					statement->info.update_stats.sample_rows);
 	}
 
       return error;
     }
 }
 
+/*
+ * do_update_column_group_stats() - Declares or drops the statistics of a group of columns of a class
+ *   return: Error code
+ *   parser(in): Parser context
+ *   statement(in/out): Parse tree of a create or drop statistics statement
+ */
+static int
+do_update_column_group_stats (PARSER_CONTEXT * parser, PT_NODE * statement)
+{
+  PT_NODE *cls = statement->info.update_stats.class_list;
+  PT_NODE *att;
+  DB_OBJECT *class_mop;
+  SM_CLASS *smclass;
+  SM_ATTRIBUTE *attr;
+  int attr_ids[STATS_COLUMN_GROUP_ATTRS_MAX];
+  int n_attrs = 0, i;
+  int error = NO_ERROR;
+
+  assert (cls != NULL && cls->next == NULL);
+
+  class_mop = db_find_class (cls->info.name.original);
+  if (class_mop == NULL)
+    {
+      ERROR_SET_ERROR_1ARG (error, ER_LC_UNKNOWN_CLASSNAME, cls->info.name.original);
+      return error;
+    }
+  cls->info.name.db_object = class_mop;
+
+  // the group is declared with the schema of the class; lock it as an alter would
+  error = au_fetch_class (class_mop, &smclass, AU_FETCH_UPDATE, AU_ALTER);
+  if (error != NO_ERROR)
+    {
+      return error;
+    }
+
+  if (smclass->partition != NULL && smclass->partition->pname != NULL)
+    {
+      // partitions use the groups declared on their partitioned class
+      ERROR_SET_ERROR (error, ER_OBJ_INVALID_ARGUMENTS);
+      return error;
+    }
+
+  for (att = statement->info.update_stats.column_group; att != NULL; att = att->next)
+    {
+      attr = classobj_find_attribute (smclass, att->info.name.original, 0);
+      if (attr == NULL)
+	{
+	  ERROR_SET_ERROR_1ARG (error, ER_SM_ATTRIBUTE_NOT_FOUND, att->info.name.original);
+	  return error;
+	}
+
+      for (i = 0; i < n_attrs && attr_ids[i] != attr->id; i++)
+	{
+	  ;
+	}
+      if (i < n_attrs || n_attrs == STATS_COLUMN_GROUP_ATTRS_MAX)
+	{
+	  // duplicate or too many columns
+	  ERROR_SET_ERROR (error, ER_OBJ_INVALID_ARGUMENTS);
+	  return error;
+	}
+      attr_ids[n_attrs++] = attr->id;
+    }
+
+  if (n_attrs < 2)
+    {
+      ERROR_SET_ERROR (error, ER_OBJ_INVALID_ARGUMENTS);
+      return error;
+    }
+
+  return sm_update_column_group_statistics (class_mop, n_attrs, attr_ids,
+					    statement->info.update_stats.column_group_op < 0);
+}
+
 /*
  * extract_att_name() -
  *   return:
@@ -14354,6 +14437,8 @@ do_prepare_select (PARSER_CONTEXT * parser, PT_NODE * statement)
 
   /* look up server's XASL cache for this query string and get XASL file id (XASL_ID) returned if found */
   contextp->recompile_xasl = statement->flag.recompile;
+  contextp->is_plan_variant_requested = false;
+  contextp->n_cardinality_feedbacks = 0;
   if (statement->flag.recompile == 0)
     {
       XASL_NODE_HEADER xasl_header;
@@ -14393,6 +14478,14 @@ do_prepare_select (PARSER_CONTEXT * parser, PT_NODE * statement)
       /* mark the beginning of another level of xasl packing */
       pt_enter_packing_buf ();
 
+      /* let the optimizer list the host variables whose values change the plan; their values are peeked only when
+       * the server asks to recompile the plan for the values bound to them, not when the plan is recompiled for
+       * changed statistics */
+      contextp->plan_peeks = NULL;
+      contextp->plan_variant = 0;
+      contextp->collect_plan_peeks = prm_get_integer_value (PRM_ID_XASL_CACHE_MAX_VARIANTS) > 0;
+      contextp->peek_host_vars = contextp->collect_plan_peeks && contextp->is_plan_variant_requested;
+
       AU_SAVE_AND_DISABLE (au_save);	/* this prevents authorization checking during generating XASL */
       /* parser_generate_xasl() will build XASL tree from parse tree */
       contextp->xasl = parser_generate_xasl (parser, statement);
@@ -14402,6 +14495,17 @@ do_prepare_select (PARSER_CONTEXT * parser, PT_NODE * statement)
 	}
       AU_RESTORE (au_save);
 
+      contextp->collect_plan_peeks = false;
+      contextp->peek_host_vars = false;
+      if (contextp->xasl && contextp->plan_peeks != NULL)
+	{
+	  /* plan variants are cached apart from the generic plan */
+	  contextp->xasl->plan_peeks = contextp->plan_peeks;
+	  contextp->xasl->header.plan_variant = contextp->plan_variant;
+	  XASL_PLAN_VARIANT_MIX_SHA1 (&contextp->sha1, contextp->plan_variant);
+	}
+      contextp->plan_peeks = NULL;
+
       if (contextp->xasl && (err == NO_ERROR) && !pt_has_error (parser))
 	{
 	  /* convert the created XASL tree to the byte stream for transmission to the server */
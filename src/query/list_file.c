@@ -3052,6 +3052,48 @@ error:
   return NULL;
 }
 
+/*
+ * qfile_append_list () - append the tuples of a list file at the end of
+ *                        another list file
+ *   return: NO_ERROR or ER_FAILED
+ *   dest_list_id_p(in/out): list file to append to
+ *   src_list_id_p(in): list file to append; it is not affected
+ *
+ * Note: Unlike qfile_combine_two_list with QFILE_FLAG_UNION | QFILE_FLAG_ALL,
+ *       the destination list id is kept and only the source tuples are read,
+ *       so repeatedly appending small lists to a large one does not depend on
+ *       the size of the large one.
+ */
+int
+qfile_append_list (THREAD_ENTRY * thread_p, QFILE_LIST_ID * dest_list_id_p, QFILE_LIST_ID * src_list_id_p)
+{
+  if (src_list_id_p->tuple_cnt == 0)
+    {
+      return NO_ERROR;
+    }
+
+  if (qfile_reopen_list_as_append_mode (thread_p, dest_list_id_p) != NO_ERROR)
+    {
+      return ER_FAILED;
+    }
+
+  if (qfile_unify_types (dest_list_id_p, src_list_id_p) != NO_ERROR)
+    {
+      qfile_close_list (thread_p, dest_list_id_p);
+      return ER_FAILED;
+    }
+
+  if (qfile_copy_tuple (thread_p, dest_list_id_p, src_list_id_p) != NO_ERROR)
+    {
+      qfile_close_list (thread_p, dest_list_id_p);
+      return ER_FAILED;
+    }
+
+  qfile_close_list (thread_p, dest_list_id_p);
+
+  return NO_ERROR;
+}
+
 /*
  * qfile_reallocate_tuple () - reallocates a tuple to the desired size.
  *              If it cant, it sets an error and returns 0
@@ -32,6 +32,7 @@
 #include "query_executor.h"
 #include "query_opfunc.h"
 #include "stream_to_xasl.h"
+#include "system_parameter.h"
 #include "xasl.h"
 #include "xasl_predicate.hpp"
 #include "xasl_unpack_info.hpp"
@@ -145,6 +146,7 @@ static int partition_get_value_from_inarith (PRUNING_CONTEXT * pinfo, const REGU
 					     bool * is_present);
 static int partition_get_value_from_regu_var (PRUNING_CONTEXT * pinfo, const REGU_VARIABLE * key, DB_VALUE * value_p,
 					      bool * is_value);
+static bool partition_is_runtime_value (PRUNING_CONTEXT * pinfo, const REGU_VARIABLE * regu_var);
 static MATCH_STATUS partition_prune_range (PRUNING_CONTEXT * pinfo, const DB_VALUE * val, const PRUNING_OP op,
 					   PRUNING_BITSET * pruned);
 static MATCH_STATUS partition_prune_list (PRUNING_CONTEXT * pinfo, const DB_VALUE * val, const PRUNING_OP op,
@@ -153,6 +155,10 @@ static MATCH_STATUS partition_prune_hash (PRUNING_CONTEXT * pinfo, const DB_VALU
 					  PRUNING_BITSET * pruned);
 static int partition_find_partition_for_record (PRUNING_CONTEXT * pinfo, const OID * class_oid, RECDES * recdes,
 						OID * partition_oid, HFID * partition_hfid);
+static MATCH_STATUS partition_match_heap_scan (PRUNING_CONTEXT * pinfo, PRUNING_BITSET * pruned);
+
+static MATCH_STATUS partition_match_index_scan (PRUNING_CONTEXT * pinfo, PRUNING_BITSET * pruned);
+
 static int partition_prune_heap_scan (PRUNING_CONTEXT * pinfo);
 
 static int partition_prune_index_scan (PRUNING_CONTEXT * pinfo);
@@ -910,6 +916,7 @@ pruningset_to_spec_list (PRUNING_CONTEXT * pinfo, const PRUNING_BITSET * pruned)
     {
       COPY_OID (&spec[i].oid, &pinfo->partitions[pos + 1].class_oid);
       HFID_COPY (&spec[i].hfid, &pinfo->partitions[pos + 1].class_hfid);
+      spec[i].position = pos;
 
       if (i == cnt - 1)
 	{
@@ -1335,6 +1342,7 @@ partition_prune_range (PRUNING_CONTEXT * pinfo, const DB_VALUE * val, const PRUN
   OR_PARTITION *part;
   DB_VALUE min, max;
   int rmin = DB_UNK, rmax = DB_UNK;
+  bool is_unknown = false;
   MATCH_STATUS status;
 
   db_make_null (&min);
@@ -1389,6 +1397,11 @@ partition_prune_range (PRUNING_CONTEXT * pinfo, const DB_VALUE * val, const PRUN
 	  rmax = tp_value_compare (val, &max, 1, 1);
 	}
 
+      if (rmin == DB_UNK || rmax == DB_UNK)
+	{
+	  is_unknown = true;
+	}
+
       status = MATCH_OK;
       switch (op)
 	{
@@ -1466,8 +1479,9 @@ cleanup:
   pr_clear_value (&min);
   pr_clear_value (&max);
 
-  if (status == MATCH_OK && added == 0)
+  if (status == MATCH_OK && added == 0 && (!pinfo->is_runtime || is_unknown))
     {
+      /* run-time pruning matches one partition at a time and needs to know the partition cannot hold the value */
       status = MATCH_NOT_FOUND;
     }
 
@@ -1588,6 +1602,20 @@ partition_get_value_from_regu_var (PRUNING_CONTEXT * pinfo, const REGU_VARIABLE
 	break;
       }
 
+    case TYPE_CONSTANT:
+      if (!partition_is_runtime_value (pinfo, regu))
+	{
+	  db_make_null (value_p);
+	  *is_value = false;
+	  return NO_ERROR;
+	}
+      if (pr_clone_value (regu->value.dbvalptr, value_p) != NO_ERROR)
+	{
+	  goto error;
+	}
+      *is_value = true;
+      break;
+
     case TYPE_FUNC:
       {
 	if (regu->value.funcp->ftype != F_MIDXKEY)
@@ -1628,13 +1656,46 @@ error:
   return ER_FAILED;
 }
 
+/*
+ * partition_is_runtime_value () - test if the value of a TYPE_CONSTANT regu variable can be used for pruning
+ * return : true if the value can be used, false otherwise
+ * pinfo (in)	 : pruning context
+ * regu_var (in) : regu variable of TYPE_CONSTANT
+ *
+ * Note: TYPE_CONSTANT holds a column of an outer scan or the result of an uncorrelated subquery. These values are set
+ *	 only while the query runs, so only run-time pruning uses them, unless the scan is not inner to another scan of
+ *	 its XASL and the values were set before it was opened. Subqueries linked to the regu variable are executed
+ *	 when the value is fetched and may be correlated to the pruned scan, so they are never used.
+ */
+static bool
+partition_is_runtime_value (PRUNING_CONTEXT * pinfo, const REGU_VARIABLE * regu_var)
+{
+  assert (regu_var->type == TYPE_CONSTANT);
+
+  if (regu_var->xasl != NULL || regu_var->value.dbvalptr == NULL)
+    {
+      return false;
+    }
+
+  if (pinfo->is_outer_values_set)
+    {
+      /* e.g. key = (SELECT ...) on the first scan of a query */
+      return true;
+    }
+
+  pinfo->has_runtime_values = true;
+
+  return pinfo->is_runtime;
+}
+
 /*
  * partition_is_reguvar_const () - test if a regu_variable is a constant
  * return : true if constant, false otherwise
+ * pinfo (in)	 : pruning context
  * regu_var (in) :
  */
 static bool
-partition_is_reguvar_const (const REGU_VARIABLE * regu_var)
+partition_is_reguvar_const (PRUNING_CONTEXT * pinfo, const REGU_VARIABLE * regu_var)
 {
   if (regu_var == NULL)
     {
@@ -1646,20 +1707,22 @@ partition_is_reguvar_const (const REGU_VARIABLE * regu_var)
     case TYPE_POS_VALUE:
     case TYPE_REGUVAL_LIST:
       return true;
+    case TYPE_CONSTANT:
+      return partition_is_runtime_value (pinfo, regu_var);
     case TYPE_INARITH:
     case TYPE_OUTARITH:
       {
 	ARITH_TYPE *arithptr = regu_var->value.arithptr;
-	if (arithptr->leftptr != NULL && !partition_is_reguvar_const (arithptr->leftptr))
+	if (arithptr->leftptr != NULL && !partition_is_reguvar_const (pinfo, arithptr->leftptr))
 	  {
 	    return false;
 	  }
-	if (arithptr->rightptr != NULL && !partition_is_reguvar_const (arithptr->rightptr))
+	if (arithptr->rightptr != NULL && !partition_is_reguvar_const (pinfo, arithptr->rightptr))
 	  {
 	    return false;
 	  }
 
-	if (arithptr->thirdptr != NULL && !partition_is_reguvar_const (arithptr->thirdptr))
+	if (arithptr->thirdptr != NULL && !partition_is_reguvar_const (pinfo, arithptr->thirdptr))
 	  {
 	    return false;
 	  }
@@ -1748,11 +1811,18 @@ partition_get_value_from_key (PRUNING_CONTEXT * pinfo, const REGU_VARIABLE * key
       break;
 
     case TYPE_CONSTANT:
-      /* TYPE_CONSTANT comes from an index join. Since we haven't actually scanned anything yet, this value is not set
-       * so we cannot use it here */
-      db_make_null (attr_key);
-      error = NO_ERROR;
-      *is_present = false;
+      /* TYPE_CONSTANT comes from an index join. The value is set only after the outer scan fetched a row, so only
+       * run-time pruning can use it */
+      if (!partition_is_runtime_value (pinfo, key))
+	{
+	  db_make_null (attr_key);
+	  error = NO_ERROR;
+	  *is_present = false;
+	  break;
+	}
+      error = pr_clone_value (key->value.dbvalptr, attr_key);
+
+      *is_present = true;
       break;
 
     default:
@@ -1794,7 +1864,7 @@ partition_get_value_from_inarith (PRUNING_CONTEXT * pinfo, const REGU_VARIABLE *
   *is_value = false;
   db_make_null (value_p);
 
-  if (!partition_is_reguvar_const (src))
+  if (!partition_is_reguvar_const (pinfo, src))
     {
       return NO_ERROR;
     }
@@ -2184,6 +2254,9 @@ partition_init_pruning_context (PRUNING_CONTEXT * pinfo)
   pinfo->pruning_type = DB_PARTITIONED_CLASS;
   pinfo->is_attr_info_inited = false;
   pinfo->is_from_cache = false;
+  pinfo->is_runtime = false;
+  pinfo->is_outer_values_set = false;
+  pinfo->has_runtime_values = false;
 }
 
 /*
@@ -2700,6 +2773,23 @@ partition_get_position_in_key (PRUNING_CONTEXT * pinfo, BTID * btid)
   return NO_ERROR;
 }
 
+/*
+ * partition_match_heap_scan () - get partitions matching the predicates of an access spec for heap scan
+ * return : match status
+ * pinfo (in)	  : pruning context
+ * pruned (in/out): pruned partitions
+ */
+static MATCH_STATUS
+partition_match_heap_scan (PRUNING_CONTEXT * pinfo, PRUNING_BITSET * pruned)
+{
+  if (pinfo->spec->where_pred == NULL)
+    {
+      return MATCH_NOT_FOUND;
+    }
+
+  return partition_match_pred_expr (pinfo, pinfo->spec->where_pred, pruned);
+}
+
 /*
  * partition_prune_heap_scan () - prune a access spec for heap scan
  * return : error code or NO_ERROR
@@ -2717,18 +2807,11 @@ partition_prune_heap_scan (PRUNING_CONTEXT * pinfo)
 
   pruningset_init (&pruned, PARTITIONS_COUNT (pinfo));
 
-  if (pinfo->spec->where_pred == NULL)
-    {
-      status = MATCH_NOT_FOUND;
-    }
-  else
+  status = partition_match_heap_scan (pinfo, &pruned);
+  if (pinfo->error_code != NO_ERROR)
     {
-      status = partition_match_pred_expr (pinfo, pinfo->spec->where_pred, &pruned);
-      if (pinfo->error_code != NO_ERROR)
-	{
-	  ASSERT_ERROR ();
-	  return pinfo->error_code;
-	}
+      ASSERT_ERROR ();
+      return pinfo->error_code;
     }
 
   if (status != MATCH_NOT_FOUND)
@@ -2754,31 +2837,27 @@ partition_prune_heap_scan (PRUNING_CONTEXT * pinfo)
 }
 
 /*
- * partition_prune_index_scan () - perform partition pruning on an index scan
- * return : error code or NO_ERROR
- * pinfo (in) : pruning context
+ * partition_match_index_scan () - get partitions matching the predicates and the index key of an access spec for
+ *				    index scan
+ * return : match status
+ * pinfo (in)	  : pruning context
+ * pruned (in/out): pruned partitions
  */
-static int
-partition_prune_index_scan (PRUNING_CONTEXT * pinfo)
+static MATCH_STATUS
+partition_match_index_scan (PRUNING_CONTEXT * pinfo, PRUNING_BITSET * pruned)
 {
-  int error = NO_ERROR;
-  PRUNING_BITSET pruned;
   MATCH_STATUS status = MATCH_NOT_FOUND;
 
-  assert (pinfo != NULL);
-  assert (pinfo->partitions != NULL);
-  assert (pinfo->spec != NULL);
   assert (pinfo->spec->indexptr != NULL);
 
-  pruningset_init (&pruned, PARTITIONS_COUNT (pinfo));
   if (pinfo->spec->where_pred != NULL)
     {
-      status = partition_match_pred_expr (pinfo, pinfo->spec->where_pred, &pruned);
+      status = partition_match_pred_expr (pinfo, pinfo->spec->where_pred, pruned);
     }
 
   if (pinfo->spec->where_key != NULL)
     {
-      status = partition_match_pred_expr (pinfo, pinfo->spec->where_key, &pruned);
+      status = partition_match_pred_expr (pinfo, pinfo->spec->where_key, pruned);
     }
 
   if (pinfo->attr_position != -1)
@@ -2787,22 +2866,45 @@ partition_prune_index_scan (PRUNING_CONTEXT * pinfo)
 	{
 	  /* The first position is missing in ISS and we're dealing with a virtual predicate key = NULL. In this case,
 	   * all partitions qualify for the search */
-	  pruningset_set_all (&pruned);
+	  pruningset_set_all (pruned);
 	  status = MATCH_OK;
 	}
       else if (pinfo->spec->indexptr->func_idx_col_id != -1)
 	{
 	  /* We are dealing with a function index, so all partitions qualify for the search. */
-	  pruningset_set_all (&pruned);
+	  pruningset_set_all (pruned);
 	  status = MATCH_OK;
 	}
       else
 	{
 	  status =
 	    partition_match_index_key (pinfo, &pinfo->spec->indexptr->key_info, pinfo->spec->indexptr->range_type,
-				       &pruned);
+				       pruned);
 	}
     }
+
+  return status;
+}
+
+/*
+ * partition_prune_index_scan () - perform partition pruning on an index scan
+ * return : error code or NO_ERROR
+ * pinfo (in) : pruning context
+ */
+static int
+partition_prune_index_scan (PRUNING_CONTEXT * pinfo)
+{
+  int error = NO_ERROR;
+  PRUNING_BITSET pruned;
+  MATCH_STATUS status = MATCH_NOT_FOUND;
+
+  assert (pinfo != NULL);
+  assert (pinfo->partitions != NULL);
+  assert (pinfo->spec != NULL);
+  assert (pinfo->spec->indexptr != NULL);
+
+  pruningset_init (&pruned, PARTITIONS_COUNT (pinfo));
+  status = partition_match_index_scan (pinfo, &pruned);
   if (status == MATCH_NOT_FOUND)
     {
       if (pinfo->error_code != NO_ERROR)
@@ -2865,6 +2967,7 @@ partition_prune_spec (THREAD_ENTRY * thread_p, val_descr * vd, access_spec_node
 
   (void) partition_init_pruning_context (&pinfo);
 
+  partition_clear_runtime_pruning (thread_p, spec);
   spec->curent = NULL;
   spec->parts = NULL;
 
@@ -2884,6 +2987,7 @@ partition_prune_spec (THREAD_ENTRY * thread_p, val_descr * vd, access_spec_node
 
   pinfo.spec = spec;
   pinfo.vd = vd;
+  pinfo.is_outer_values_set = spec->is_outer_values_set;
 
   if (spec->access == ACCESS_METHOD_SEQUENTIAL || spec->access == ACCESS_METHOD_SEQUENTIAL_RECORD_INFO
       || spec->access == ACCESS_METHOD_SEQUENTIAL_PAGE_SCAN)
@@ -2930,7 +3034,24 @@ partition_prune_spec (THREAD_ENTRY * thread_p, val_descr * vd, access_spec_node
 	}
     }
 
-  partition_clear_pruning_context (&pinfo);
+  if (error == NO_ERROR && pinfo.has_runtime_values && spec->parts != NULL
+      && (prm_get_bool_value (PRM_ID_RUNTIME_PARTITION_PRUNING) || prm_get_bool_value (PRM_ID_PARTITION_WISE_JOIN)))
+    {
+      /* keep the context to prune again each time the values of outer scans change or to join partition-wise */
+      spec->runtime_pruning = (PRUNING_CONTEXT *) db_private_alloc (thread_p, sizeof (PRUNING_CONTEXT));
+      if (spec->runtime_pruning == NULL)
+	{
+	  ASSERT_ERROR_AND_SET (error);
+	  partition_clear_pruning_context (&pinfo);
+	  return error;
+	}
+      *spec->runtime_pruning = pinfo;
+      spec->runtime_pruning->is_runtime = true;
+    }
+  else
+    {
+      partition_clear_pruning_context (&pinfo);
+    }
 
   if (error == NO_ERROR)
     {
@@ -2940,6 +3061,572 @@ partition_prune_spec (THREAD_ENTRY * thread_p, val_descr * vd, access_spec_node
   return error;
 }
 
+/*
+ * partition_prune_runtime () - check if the current partition of an access spec can hold rows for the values of outer
+ *				 scans
+ * return : error code or NO_ERROR
+ * thread_p (in)   :
+ * spec (in)	   : access spec
+ * is_pruned (out) : true if the current partition has no rows for the current values
+ *
+ * Note: Access specs are pruned when the scan is opened, using only constants and host variables. Predicates that
+ *	 compare the partitioning key with a column of an outer scan (e.g. the key of an index join) or with the result
+ *	 of a subquery are checked again by this function each time the scan is restarted for a new outer row. For range
+ *	 partitioning only the current partition is matched, so the cost of the check does not grow with the number of
+ *	 partitions.
+ */
+int
+partition_prune_runtime (THREAD_ENTRY * thread_p, access_spec_node * spec, bool * is_pruned)
+{
+  PRUNING_CONTEXT *pinfo = spec->runtime_pruning;
+  PRUNING_CONTEXT part_info;
+  OR_PARTITION parts[2];
+  PRUNING_BITSET pruned;
+  MATCH_STATUS status = MATCH_NOT_FOUND;
+  int position;
+
+  *is_pruned = false;
+
+  if (pinfo == NULL || spec->curent == NULL || !prm_get_bool_value (PRM_ID_RUNTIME_PARTITION_PRUNING))
+    {
+      /* nothing to prune or the root class is scanned */
+      return NO_ERROR;
+    }
+
+  assert (pinfo->is_runtime);
+
+  part_info = *pinfo;
+  part_info.thread_p = thread_p;
+  part_info.error_code = NO_ERROR;
+  if (pinfo->partition_type != DB_PARTITION_RANGE)
+    {
+      /* the partition of a value is looked up in all partitions */
+      position = spec->curent->position;
+    }
+  else
+    {
+      /* match the predicates against the range of the current partition only */
+      parts[0] = pinfo->partitions[0];
+      parts[1] = pinfo->partitions[spec->curent->position + 1];
+      part_info.partitions = parts;
+      part_info.count = 2;
+      position = 0;
+    }
+
+  pruningset_init (&pruned, PARTITIONS_COUNT (&part_info));
+  if (spec->access == ACCESS_METHOD_SEQUENTIAL || spec->access == ACCESS_METHOD_SEQUENTIAL_RECORD_INFO
+      || spec->access == ACCESS_METHOD_SEQUENTIAL_PAGE_SCAN)
+    {
+      status = partition_match_heap_scan (&part_info, &pruned);
+    }
+  else
+    {
+      status = partition_match_index_scan (&part_info, &pruned);
+    }
+
+  if (part_info.error_code != NO_ERROR)
+    {
+      ASSERT_ERROR ();
+      return part_info.error_code;
+    }
+
+  *is_pruned = (status != MATCH_NOT_FOUND && !pruningset_is_set (&pruned, position));
+
+  return NO_ERROR;
+}
+
+/*
+ * partition_clear_runtime_pruning () - free the pruning context kept for run-time pruning of an access spec
+ * return : void
+ * thread_p (in) :
+ * spec (in)	 : access spec
+ */
+void
+partition_clear_runtime_pruning (THREAD_ENTRY * thread_p, access_spec_node * spec)
+{
+  spec->join_spec = NULL;
+  if (spec->join_pruning != NULL)
+    {
+      spec->join_pruning->thread_p = thread_p;
+      partition_clear_pruning_context (spec->join_pruning);
+      db_private_free_and_init (thread_p, spec->join_pruning);
+    }
+
+  if (spec->runtime_pruning == NULL)
+    {
+      return;
+    }
+
+  spec->runtime_pruning->thread_p = thread_p;
+  partition_clear_pruning_context (spec->runtime_pruning);
+  db_private_free_and_init (thread_p, spec->runtime_pruning);
+}
+
+/*
+ * partition_get_join_value () - get the value of an outer scan referenced by a regu variable
+ * return : value or NULL
+ * regu (in) : regu variable
+ */
+static DB_VALUE *
+partition_get_join_value (const REGU_VARIABLE * regu)
+{
+  if (regu == NULL || regu->type != TYPE_CONSTANT || regu->xasl != NULL)
+    {
+      return NULL;
+    }
+
+  return regu->value.dbvalptr;
+}
+
+/*
+ * partition_find_join_value () - find the value of an outer scan the partitioning key is equal to in a predicate
+ * return : value or NULL
+ * pinfo (in) : pruning context
+ * pr (in)    : predicate
+ *
+ * Note: Only conjunctions are searched, so each row of the scan has a partitioning key equal to the value.
+ */
+static DB_VALUE *
+partition_find_join_value (PRUNING_CONTEXT * pinfo, const PRED_EXPR * pr)
+{
+  REGU_VARIABLE *part_expr = pinfo->partition_pred->func_regu;
+  DB_VALUE *value = NULL;
+
+  if (pr == NULL)
+    {
+      return NULL;
+    }
+
+  if (pr->type == T_PRED)
+    {
+      if (pr->pe.m_pred.bool_op != B_AND)
+	{
+	  return NULL;
+	}
+
+      value = partition_find_join_value (pinfo, pr->pe.m_pred.lhs);
+      if (value == NULL)
+	{
+	  value = partition_find_join_value (pinfo, pr->pe.m_pred.rhs);
+	}
+      return value;
+    }
+
+  if (pr->type != T_EVAL_TERM || pr->pe.m_eval_term.et_type != T_COMP_EVAL_TERM
+      || pr->pe.m_eval_term.et.et_comp.rel_op != R_EQ)
+    {
+      return NULL;
+    }
+
+  if (partition_do_regu_variables_match (pinfo, pr->pe.m_eval_term.et.et_comp.lhs, part_expr))
+    {
+      value = partition_get_join_value (pr->pe.m_eval_term.et.et_comp.rhs);
+    }
+  else if (partition_do_regu_variables_match (pinfo, pr->pe.m_eval_term.et.et_comp.rhs, part_expr))
+    {
+      value = partition_get_join_value (pr->pe.m_eval_term.et.et_comp.lhs);
+    }
+
+  return value;
+}
+
+/*
+ * partition_find_join_key_value () - find the value of an outer scan the partitioning key is equal to in the key of
+ *				       an index scan
+ * return : value or NULL
+ * pinfo (in)	 : pruning context
+ * indexptr (in) : index info of the scan
+ */
+static DB_VALUE *
+partition_find_join_key_value (PRUNING_CONTEXT * pinfo, const INDX_INFO * indexptr)
+{
+  const KEY_INFO *key = &indexptr->key_info;
+  REGU_VARIABLE *key1;
+  REGU_VARIABLE_LIST operand;
+  int i;
+
+  if (pinfo->attr_position == -1 || indexptr->use_iss || indexptr->func_idx_col_id != -1)
+    {
+      return NULL;
+    }
+
+  if (key->key_cnt != 1 || key->key_ranges[0].range != EQ_NA || key->key_ranges[0].key1 == NULL)
+    {
+      return NULL;
+    }
+
+  key1 = key->key_ranges[0].key1;
+  if (key1->type == TYPE_FUNC && key1->value.funcp->ftype == F_MIDXKEY)
+    {
+      operand = key1->value.funcp->operand;
+      for (i = 0; operand != NULL && i < pinfo->attr_position; i++)
+	{
+	  operand = operand->next;
+	}
+      return (operand != NULL) ? partition_get_join_value (&operand->value) : NULL;
+    }
+
+  return (pinfo->attr_position == 0) ? partition_get_join_value (key1) : NULL;
+}
+
+/*
+ * partition_is_key_fetched_to () - check if a scan fetches an attribute into a value
+ * return : true if the attribute is fetched into value
+ * spec (in)	: access spec
+ * attr_id (in) : attribute id
+ * value (in)	: value
+ */
+static bool
+partition_is_key_fetched_to (const access_spec_node * spec, ATTR_ID attr_id, const DB_VALUE * value)
+{
+  REGU_VARIABLE_LIST regu_lists[3], regu_list;
+  int i;
+
+  regu_lists[0] = spec->s.cls_node.cls_regu_list_pred;
+  regu_lists[1] = spec->s.cls_node.cls_regu_list_rest;
+  regu_lists[2] = spec->s.cls_node.cls_regu_list_key;
+
+  for (i = 0; i < 3; i++)
+    {
+      for (regu_list = regu_lists[i]; regu_list != NULL; regu_list = regu_list->next)
+	{
+	  if (regu_list->value.type == TYPE_ATTR_ID && regu_list->value.value.attr_descr.id == attr_id
+	      && regu_list->value.vfetch_to == value)
+	    {
+	      return true;
+	    }
+	}
+    }
+
+  return false;
+}
+
+/*
+ * partition_prepare_join () - join a scan partition-wise with an outer scan
+ * return : error code or NO_ERROR
+ * thread_p (in)   :
+ * spec (in)	   : access spec of the inner scan
+ * outer_spec (in) : access spec of the outer scan
+ *
+ * Note: If both classes are partitioned the same way and the partitioning key of the inner scan is equal to the
+ *	 partitioning key of the outer scan, a partition of the inner class can only hold rows joined with the rows of
+ *	 the partitions of the outer class that have overlapping ranges or values. Once the join is prepared,
+ *	 partition_join_matches () tells the executor which pairs of partitions need to be scanned, instead of joining
+ *	 every partition of the outer class with every partition of the inner class.
+ */
+int
+partition_prepare_join (THREAD_ENTRY * thread_p, access_spec_node * spec, access_spec_node * outer_spec)
+{
+  PRUNING_CONTEXT *pinfo = spec->runtime_pruning;
+  PRUNING_CONTEXT *outer_pinfo = NULL;
+  REGU_VARIABLE *outer_expr;
+  DB_VALUE *value = NULL;
+  TP_DOMAIN *domain;
+  int error = NO_ERROR;
+
+  if (pinfo == NULL || spec->join_spec != NULL || !prm_get_bool_value (PRM_ID_PARTITION_WISE_JOIN))
+    {
+      return NO_ERROR;
+    }
+  if (outer_spec->pruning_type != DB_PARTITIONED_CLASS || outer_spec->type != TARGET_CLASS
+      || outer_spec->parts == NULL)
+    {
+      return NO_ERROR;
+    }
+  if (pinfo->partition_pred->func_regu->type != TYPE_ATTR_ID)
+    {
+      return NO_ERROR;
+    }
+
+  value = partition_find_join_value (pinfo, spec->where_pred);
+  if (value == NULL)
+    {
+      value = partition_find_join_value (pinfo, spec->where_key);
+    }
+  if (value == NULL && spec->indexptr != NULL && IS_ANY_INDEX_ACCESS (spec->access))
+    {
+      value = partition_find_join_key_value (pinfo, spec->indexptr);
+    }
+  if (value == NULL)
+    {
+      return NO_ERROR;
+    }
+
+  outer_pinfo = (PRUNING_CONTEXT *) db_private_alloc (thread_p, sizeof (PRUNING_CONTEXT));
+  if (outer_pinfo == NULL)
+    {
+      ASSERT_ERROR_AND_SET (error);
+      return error;
+    }
+  partition_init_pruning_context (outer_pinfo);
+
+  error = partition_load_pruning_context (thread_p, &ACCESS_SPEC_CLS_OID (outer_spec), outer_spec->pruning_type,
+					  outer_pinfo);
+  if (error != NO_ERROR)
+    {
+      ASSERT_ERROR ();
+      db_private_free_and_init (thread_p, outer_pinfo);
+      return error;
+    }
+
+  if (outer_pinfo->partitions == NULL || outer_pinfo->partition_type != pinfo->partition_type)
+    {
+      goto not_joined;
+    }
+
+  /* the key of the outer scan must be fetched into the value the inner key is compared with */
+  outer_expr = outer_pinfo->partition_pred->func_regu;
+  if (outer_expr->type != TYPE_ATTR_ID
+      || !partition_is_key_fetched_to (outer_spec, outer_expr->value.attr_descr.id, value))
+    {
+      goto not_joined;
+    }
+
+  /* values are matched against bounds of both classes, so both keys must compare the same way */
+  domain = pinfo->partition_pred->func_regu->domain;
+  if (domain == NULL || outer_expr->domain == NULL || !tp_domain_match (domain, outer_expr->domain, TP_EXACT_MATCH))
+    {
+      goto not_joined;
+    }
+
+  if (pinfo->partition_type == DB_PARTITION_HASH)
+    {
+      /* equal keys have the same hash only for types that have a single representation of each value */
+      if (pinfo->count != outer_pinfo->count)
+	{
+	  goto not_joined;
+	}
+      switch (TP_DOMAIN_TYPE (domain))
+	{
+	case DB_TYPE_INTEGER:
+	case DB_TYPE_SHORT:
+	case DB_TYPE_BIGINT:
+	case DB_TYPE_DATE:
+	  break;
+	default:
+	  goto not_joined;
+	}
+    }
+
+  spec->join_spec = outer_spec;
+  spec->join_pruning = outer_pinfo;
+  return NO_ERROR;
+
+not_joined:
+  partition_clear_pruning_context (outer_pinfo);
+  db_private_free_and_init (thread_p, outer_pinfo);
+  return NO_ERROR;
+}
+
+/*
+ * partition_is_grouped_by_key () - check if a group key holds the partitioning key of the class scanned by a spec
+ * return : error code or NO_ERROR
+ * thread_p (in)    :
+ * spec (in)	    : access spec
+ * group_key (in)   : regu variables of the group key evaluated on the rows of the scan
+ * is_grouped (out) : true if a column of the group key is the partitioning key
+ *
+ * Note: Rows of different partitions never fall into the same group if the group key holds the partitioning key, so
+ *	 groups are complete once the scan of their partition is finished.
+ */
+int
+partition_is_grouped_by_key (THREAD_ENTRY * thread_p, access_spec_node * spec, regu_variable_list_node * group_key,
+			     bool * is_grouped)
+{
+  PRUNING_CONTEXT pinfo;
+  REGU_VARIABLE_LIST regu_list;
+  ATTR_ID attr_id;
+  int error = NO_ERROR;
+
+  *is_grouped = false;
+
+  if (spec->pruning_type != DB_PARTITIONED_CLASS || spec->type != TARGET_CLASS || spec->parts == NULL)
+    {
+      return NO_ERROR;
+    }
+
+  partition_init_pruning_context (&pinfo);
+  error = partition_load_pruning_context (thread_p, &ACCESS_SPEC_CLS_OID (spec), spec->pruning_type, &pinfo);
+  if (error != NO_ERROR)
+    {
+      ASSERT_ERROR ();
+      return error;
+    }
+
+  if (pinfo.partitions == NULL || pinfo.partition_pred->func_regu->type != TYPE_ATTR_ID)
+    {
+      partition_clear_pruning_context (&pinfo);
+      return NO_ERROR;
+    }
+  attr_id = pinfo.partition_pred->func_regu->value.attr_descr.id;
+
+  for (regu_list = group_key; regu_list != NULL && !*is_grouped; regu_list = regu_list->next)
+    {
+      if (regu_list->value.type == TYPE_CONSTANT && regu_list->value.xasl == NULL)
+	{
+	  *is_grouped = partition_is_key_fetched_to (spec, attr_id, regu_list->value.value.dbvalptr);
+	}
+    }
+
+  partition_clear_pruning_context (&pinfo);
+  return NO_ERROR;
+}
+
+/*
+ * partition_range_bounds_overlap () - check if the ranges of two range partitions overlap
+ * return : true if the ranges overlap or cannot be compared
+ * left (in)  : partition
+ * right (in) : partition
+ */
+static bool
+partition_range_bounds_overlap (const OR_PARTITION * left, const OR_PARTITION * right)
+{
+  DB_VALUE left_min, left_max, right_min, right_max;
+  int cmp;
+  bool overlap = true;
+
+  db_make_null (&left_min);
+  db_make_null (&left_max);
+  db_make_null (&right_min);
+  db_make_null (&right_max);
+
+  if (db_set_get (left->values, 0, &left_min) != NO_ERROR || db_set_get (left->values, 1, &left_max) != NO_ERROR
+      || db_set_get (right->values, 0, &right_min) != NO_ERROR
+      || db_set_get (right->values, 1, &right_max) != NO_ERROR)
+    {
+      er_clear ();
+      goto end;
+    }
+
+  /* ranges are [min, max); NULL bounds are MINVALUE and MAXVALUE */
+  if (!DB_IS_NULL (&left_min) && !DB_IS_NULL (&right_max))
+    {
+      cmp = tp_value_compare (&left_min, &right_max, 1, 1);
+      if (cmp == DB_EQ || cmp == DB_GT)
+	{
+	  overlap = false;
+	  goto end;
+	}
+    }
+  if (!DB_IS_NULL (&right_min) && !DB_IS_NULL (&left_max))
+    {
+      cmp = tp_value_compare (&right_min, &left_max, 1, 1);
+      if (cmp == DB_EQ || cmp == DB_GT)
+	{
+	  overlap = false;
+	  goto end;
+	}
+    }
+
+end:
+  pr_clear_value (&left_min);
+  pr_clear_value (&left_max);
+  pr_clear_value (&right_min);
+  pr_clear_value (&right_max);
+
+  return overlap;
+}
+
+/*
+ * partition_list_values_overlap () - check if two list partitions have a common value
+ * return : true if a non-null value is in both partitions or if values cannot be compared
+ * left (in)  : partition
+ * right (in) : partition
+ */
+static bool
+partition_list_values_overlap (const OR_PARTITION * left, const OR_PARTITION * right)
+{
+  DB_VALUE left_val, right_val;
+  int left_size, right_size, i, j, cmp;
+  bool overlap = false;
+
+  left_size = db_set_size (left->values);
+  right_size = db_set_size (right->values);
+  if (left_size < 0 || right_size < 0)
+    {
+      return true;
+    }
+
+  for (i = 0; i < left_size && !overlap; i++)
+    {
+      if (db_set_get (left->values, i, &left_val) != NO_ERROR)
+	{
+	  er_clear ();
+	  return true;
+	}
+      if (DB_IS_NULL (&left_val))
+	{
+	  /* null keys are never joined */
+	  pr_clear_value (&left_val);
+	  continue;
+	}
+
+      for (j = 0; j < right_size && !overlap; j++)
+	{
+	  if (db_set_get (right->values, j, &right_val) != NO_ERROR)
+	    {
+	      er_clear ();
+	      overlap = true;
+	      break;
+	    }
+	  if (!DB_IS_NULL (&right_val))
+	    {
+	      cmp = tp_value_compare (&left_val, &right_val, 1, 1);
+	      overlap = (cmp == DB_EQ || cmp == DB_UNK);
+	    }
+	  pr_clear_value (&right_val);
+	}
+      pr_clear_value (&left_val);
+    }
+
+  return overlap;
+}
+
+/*
+ * partition_join_matches () - check if the current partitions of a scan joined partition-wise and of its outer scan
+ *				can hold joined rows
+ * return : false if no row of the current outer partition is joined with a row of the current partition
+ * spec (in) : access spec of the inner scan
+ */
+bool
+partition_join_matches (access_spec_node * spec)
+{
+  PRUNING_CONTEXT *pinfo = spec->runtime_pruning;
+  PRUNING_CONTEXT *outer_pinfo = spec->join_pruning;
+  const OR_PARTITION *part, *outer_part;
+
+  if (spec->join_spec == NULL || pinfo == NULL || outer_pinfo == NULL)
+    {
+      return true;
+    }
+  if (spec->curent == NULL || spec->join_spec->curent == NULL)
+    {
+      /* one of the root classes is scanned */
+      return true;
+    }
+
+  assert (spec->curent->position < PARTITIONS_COUNT (pinfo));
+  assert (spec->join_spec->curent->position < PARTITIONS_COUNT (outer_pinfo));
+
+  part = &pinfo->partitions[spec->curent->position + 1];
+  outer_part = &outer_pinfo->partitions[spec->join_spec->curent->position + 1];
+
+  switch (pinfo->partition_type)
+    {
+    case DB_PARTITION_HASH:
+      return spec->curent->position == spec->join_spec->curent->position;
+
+    case DB_PARTITION_RANGE:
+      return partition_range_bounds_overlap (outer_part, part);
+
+    case DB_PARTITION_LIST:
+      return partition_list_values_overlap (outer_part, part);
+
+    default:
+      return true;
+    }
+}
+
 /*
  * partition_find_partition_for_record () - find the partition in which a
  *					    record should be placed
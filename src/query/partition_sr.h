@@ -34,6 +34,7 @@
 struct access_spec_node;
 struct func_pred;
 struct func_pred_unpack_info;
+struct regu_variable_list_node;
 struct val_descr;
 struct xasl_unpack_info;
 
@@ -90,6 +91,9 @@ struct pruning_context
 				 * DB_PARTITION_CLASS */
   bool is_attr_info_inited;
   bool is_from_cache;		/* true if this context is cached */
+  bool is_runtime;		/* true if values of outer scans may be used for pruning */
+  bool is_outer_values_set;	/* true if values of outer scans and subqueries were set before the scan was opened */
+  bool has_runtime_values;	/* true if pruning found values of outer scans it could not use */
 };
 
 extern void partition_init_pruning_context (PRUNING_CONTEXT * pinfo);
@@ -111,6 +115,17 @@ extern PRUNING_SCAN_CACHE *partition_new_scancache (PRUNING_CONTEXT * pcontext);
 
 extern int partition_prune_spec (THREAD_ENTRY * thread_p, val_descr * vd, access_spec_node * access_spec);
 
+extern int partition_prune_runtime (THREAD_ENTRY * thread_p, access_spec_node * spec, bool * is_pruned);
+
+extern void partition_clear_runtime_pruning (THREAD_ENTRY * thread_p, access_spec_node * spec);
+
+extern int partition_prepare_join (THREAD_ENTRY * thread_p, access_spec_node * spec, access_spec_node * outer_spec);
+
+extern bool partition_join_matches (access_spec_node * spec);
+
+extern int partition_is_grouped_by_key (THREAD_ENTRY * thread_p, access_spec_node * spec,
+					regu_variable_list_node * group_key, bool * is_grouped);
+
 extern int partition_prune_insert (THREAD_ENTRY * thread_p, const OID * class_oid, RECDES * recdes,
 				   HEAP_SCANCACHE * scan_cache, PRUNING_CONTEXT * pcontext, int op_type,
 				   OID * pruned_class_oid, HFID * pruned_hfid, OID * superclass_oid);
@@ -75,6 +75,7 @@ namespace cubquery
     AGGREGATE_HASH_STATE state;	/* state of hash aggregation */
     tp_domain **key_domains;	/* hash key domains */
     cubxasl::aggregate_accumulator_domain **accumulator_domains;	/* accumulator domains */
+    bool is_partition_grouped;	/* hash key holds the partitioning key of the scanned class */
 
     /* runtime statistics stuff */
     int hash_size;		/* hash table size */
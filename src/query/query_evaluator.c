@@ -83,6 +83,9 @@ static DB_LOGICAL eval_sort_list_to_sort_list (THREAD_ENTRY * thread_p, QFILE_LI
 					       QFILE_LIST_ID * list_id2, REL_OP rel_operator);
 static DB_LOGICAL eval_set_list_cmp (THREAD_ENTRY * thread_p, const COMP_EVAL_TERM * et_comp, val_descr * vd,
 				     DB_VALUE * dbval1, DB_VALUE * dbval2);
+static bool eval_is_fast_rel_cmp_operand (const REGU_VARIABLE * regu);
+static DB_LOGICAL eval_comp_term_rel_cmp (THREAD_ENTRY * thread_p, DB_VALUE * dbval1, DB_VALUE * dbval2,
+					  const COMP_EVAL_TERM * et_comp);
 
 /*
  * eval_negative () - negate the result
@@ -338,6 +341,217 @@ eval_value_rel_cmp (THREAD_ENTRY * thread_p, DB_VALUE * dbval1, DB_VALUE * dbval
     }
 }
 
+/*
+ * Specialized comparison kernels
+ *
+ * When XASL unpacking finds a comparison term between columns and/or constants of the same fixed-width type, it
+ * binds the term to one of the kernels below (see eval_bind_comp_eval_term ()). The kernel compares the native
+ * values directly instead of going through tp_value_compare_with_error () and the primitive type dispatch.
+ *
+ * Since host variables and coerced constants may still be of a different type at run time, every kernel checks the
+ * actual types of both values and returns V_UNKNOWN when they do not match, so that the caller falls back to the
+ * generic comparison. Both values are expected to be not NULL.
+ */
+
+// *INDENT-OFF*
+template <typename T> struct eval_fast_value;
+
+template <> struct eval_fast_value<DB_C_SHORT>
+{
+  static const DB_TYPE type = DB_TYPE_SHORT;
+  static DB_C_SHORT get (const DB_VALUE * dbval)
+  {
+    return db_get_short (dbval);
+  }
+};
+
+template <> struct eval_fast_value<int>
+{
+  static const DB_TYPE type = DB_TYPE_INTEGER;
+  static int get (const DB_VALUE * dbval)
+  {
+    return db_get_int (dbval);
+  }
+};
+
+template <> struct eval_fast_value<DB_BIGINT>
+{
+  static const DB_TYPE type = DB_TYPE_BIGINT;
+  static DB_BIGINT get (const DB_VALUE * dbval)
+  {
+    return db_get_bigint (dbval);
+  }
+};
+
+/*
+ * eval_fast_rel_cmp () - compare two values of type T according to the relational operator Op
+ *   return: V_TRUE or V_FALSE, V_UNKNOWN if the values are not both of type T
+ *   dbval1(in): first db_value
+ *   dbval2(in): second db_value
+ */
+template <typename T, REL_OP Op>
+static DB_LOGICAL
+eval_fast_rel_cmp (const DB_VALUE * dbval1, const DB_VALUE * dbval2)
+{
+  assert (!DB_IS_NULL (dbval1) && !DB_IS_NULL (dbval2));
+
+  if (DB_VALUE_DOMAIN_TYPE (dbval1) != eval_fast_value<T>::type
+      || DB_VALUE_DOMAIN_TYPE (dbval2) != eval_fast_value<T>::type)
+    {
+      return V_UNKNOWN;
+    }
+
+  const T v1 = eval_fast_value<T>::get (dbval1);
+  const T v2 = eval_fast_value<T>::get (dbval2);
+
+  switch (Op)
+    {
+    case R_EQ:
+      return (v1 == v2) ? V_TRUE : V_FALSE;
+    case R_NE:
+      return (v1 != v2) ? V_TRUE : V_FALSE;
+    case R_GT:
+      return (v1 > v2) ? V_TRUE : V_FALSE;
+    case R_GE:
+      return (v1 >= v2) ? V_TRUE : V_FALSE;
+    case R_LT:
+      return (v1 < v2) ? V_TRUE : V_FALSE;
+    case R_LE:
+      return (v1 <= v2) ? V_TRUE : V_FALSE;
+    default:
+      assert (false);
+      return V_UNKNOWN;
+    }
+}
+
+/*
+ * eval_get_fast_rel_cmp () - get the comparison kernel of type T for the given relational operator
+ *   return: kernel or NULL if the operator has no specialized kernel
+ *   rel_operator(in): relational operator
+ */
+template <typename T>
+static COMP_EVAL_FAST_FNC
+eval_get_fast_rel_cmp (REL_OP rel_operator)
+{
+  switch (rel_operator)
+    {
+    case R_EQ:
+      return eval_fast_rel_cmp<T, R_EQ>;
+    case R_NE:
+      return eval_fast_rel_cmp<T, R_NE>;
+    case R_GT:
+      return eval_fast_rel_cmp<T, R_GT>;
+    case R_GE:
+      return eval_fast_rel_cmp<T, R_GE>;
+    case R_LT:
+      return eval_fast_rel_cmp<T, R_LT>;
+    case R_LE:
+      return eval_fast_rel_cmp<T, R_LE>;
+    default:
+      /* R_EQ_TORDER and R_NULLSAFE_EQ must see NULL values; set and list comparisons are not specialized */
+      return NULL;
+    }
+}
+// *INDENT-ON*
+
+/*
+ * eval_is_fast_rel_cmp_operand () - can the regu variable be an operand of a specialized comparison kernel?
+ *   return: true for columns and constants
+ *   regu(in): regu variable
+ */
+static bool
+eval_is_fast_rel_cmp_operand (const REGU_VARIABLE * regu)
+{
+  switch (regu->type)
+    {
+    case TYPE_ATTR_ID:
+    case TYPE_CLASS_ATTR_ID:
+    case TYPE_SHARED_ATTR_ID:
+    case TYPE_POSITION:
+    case TYPE_DBVAL:
+    case TYPE_CONSTANT:
+    case TYPE_POS_VALUE:
+      return true;
+
+    default:
+      return false;
+    }
+}
+
+/*
+ * eval_bind_comp_eval_term () - bind a comparison term to a specialized comparison kernel
+ *   return: nothing
+ *   et_comp(in/out): comparison term
+ *
+ * Note: Called when the term is unpacked. Only column-vs-constant and column-vs-column comparisons of the same
+ *       fixed-width integer type are bound; other terms keep fast_cmp NULL and use eval_value_rel_cmp ().
+ */
+void
+eval_bind_comp_eval_term (COMP_EVAL_TERM * et_comp)
+{
+  DB_TYPE lhs_type, rhs_type;
+
+  et_comp->fast_cmp = NULL;
+
+  if (et_comp->lhs == NULL || et_comp->rhs == NULL)
+    {
+      return;
+    }
+
+  if (!eval_is_fast_rel_cmp_operand (et_comp->lhs) || !eval_is_fast_rel_cmp_operand (et_comp->rhs))
+    {
+      return;
+    }
+
+  lhs_type = TP_DOMAIN_TYPE (et_comp->lhs->domain);
+  rhs_type = TP_DOMAIN_TYPE (et_comp->rhs->domain);
+  if (lhs_type != rhs_type)
+    {
+      return;
+    }
+
+  // *INDENT-OFF*
+  switch (lhs_type)
+    {
+    case DB_TYPE_SHORT:
+      et_comp->fast_cmp = eval_get_fast_rel_cmp<DB_C_SHORT> (et_comp->rel_op);
+      break;
+    case DB_TYPE_INTEGER:
+      et_comp->fast_cmp = eval_get_fast_rel_cmp<int> (et_comp->rel_op);
+      break;
+    case DB_TYPE_BIGINT:
+      et_comp->fast_cmp = eval_get_fast_rel_cmp<DB_BIGINT> (et_comp->rel_op);
+      break;
+    default:
+      break;
+    }
+  // *INDENT-ON*
+}
+
+/*
+ * eval_comp_term_rel_cmp () - compare the values of a comparison term, using its specialized kernel if bound
+ *   return: DB_LOGICAL (V_TRUE, V_FALSE, V_UNKNOWN or V_ERROR)
+ *   dbval1(in): first db_value
+ *   dbval2(in): second db_value
+ *   et_comp(in): comparison term
+ */
+static DB_LOGICAL
+eval_comp_term_rel_cmp (THREAD_ENTRY * thread_p, DB_VALUE * dbval1, DB_VALUE * dbval2, const COMP_EVAL_TERM * et_comp)
+{
+  DB_LOGICAL result;
+
+  if (et_comp->fast_cmp != NULL)
+    {
+      result = et_comp->fast_cmp (dbval1, dbval2);
+      if (result != V_UNKNOWN)
+	{
+	  return result;
+	}
+    }
+
+  return eval_value_rel_cmp (thread_p, dbval1, dbval2, et_comp->rel_op, et_comp);
+}
+
 /*
  * eval_some_eval () -
  *   return: DB_LOGICAL (V_TRUE, V_FALSE, V_UNKNOWN, V_ERROR)
@@ -1924,7 +2138,7 @@ eval_pred (THREAD_ENTRY * thread_p, const PRED_EXPR * pr, val_descr * vd, OID *
 	       * general case: compare values, db_value_compare will
 	       * take care of any coercion necessary.
 	       */
-	      result = eval_value_rel_cmp (thread_p, peek_val1, peek_val2, et_comp->rel_op, et_comp);
+	      result = eval_comp_term_rel_cmp (thread_p, peek_val1, peek_val2, et_comp);
 	    }
 	  break;
 
@@ -2145,7 +2359,7 @@ eval_pred_comp0 (THREAD_ENTRY * thread_p, const PRED_EXPR * pr, val_descr * vd,
    * general case: compare values, db_value_compare will
    * take care of any coercion necessary.
    */
-  return eval_value_rel_cmp (thread_p, peek_val1, peek_val2, et_comp->rel_op, et_comp);
+  return eval_comp_term_rel_cmp (thread_p, peek_val1, peek_val2, et_comp);
 }
 
 /*
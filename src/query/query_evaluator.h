@@ -52,6 +52,7 @@ struct val_list_node;
 namespace cubxasl
 {
   struct pred_expr;
+  struct comp_eval_term;
 }
 using PRED_EXPR = cubxasl::pred_expr;
 // *INDENT-ON*
@@ -146,5 +147,6 @@ extern DB_LOGICAL eval_data_filter (THREAD_ENTRY * thread_p, OID * oid, RECDES *
 				    FILTER_INFO * filter);
 extern DB_LOGICAL eval_key_filter (THREAD_ENTRY * thread_p, DB_VALUE * value, FILTER_INFO * filter);
 extern DB_LOGICAL update_logical_result (THREAD_ENTRY * thread_p, DB_LOGICAL ev_res, int *qualification);
+extern void eval_bind_comp_eval_term (cubxasl::comp_eval_term * et_comp);
 
 #endif /* _QUERY_EVALUATOR_H_ */
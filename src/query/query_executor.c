@@ -84,13 +84,6 @@
 
 // XASL_STATE
 typedef struct xasl_state XASL_STATE;
-struct xasl_state
-{
-  VAL_DESCR vd;			/* Value Descriptor */
-  QUERY_ID query_id;		/* Query associated with XASL */
-  int qp_xasl_line;		/* Error line */
-};
-
 #define GOTO_EXIT_ON_ERROR \
   do \
     { \
@@ -126,6 +119,31 @@ struct xasl_state
 /* maximum selectivity allowed for hash aggregate evaluation */
 #define HASH_AGGREGATE_VH_SELECTIVITY_THRESHOLD         0.5f
 
+/* default number of subquery memo entries */
+#define SUBQUERY_MEMO_DEFAULT_TABLE_SIZE 256
+
+/* minimum amount of lookups that have to be done before deciding if the
+   subquery memo is worth keeping */
+#define SUBQUERY_MEMO_HIT_RATIO_LOOKUP_THRESHOLD   1000
+
+/* minimum hit ratio for the subquery memo to be kept */
+#define SUBQUERY_MEMO_MIN_HIT_RATIO                0.2f
+
+/* minimum rows of an intermediate result, estimated or produced, for a cardinality error to be worth a recompile */
+#define QEXEC_CARDINALITY_CHECK_MIN_ROWS           1000
+
+/* memo of the results of a correlated single tuple subquery, keyed on its correlated values */
+struct subquery_memo
+{
+  MHT_TABLE *hash_table;	/* HASH_SCAN_KEY -> DB_VALUE array of single_tuple->val_cnt values */
+  HASH_SCAN_KEY *temp_key;	/* key of the current correlated values */
+  UINT64 memory_size;		/* memory held by the keys and values of the hash table */
+  UINT64 lookups;		/* number of lookups */
+  UINT64 hits;			/* number of lookups that found the result */
+  bool is_full;			/* no more entries are added */
+  bool is_disabled;		/* hit ratio is too low, memo is no longer used */
+};
+
 
 #define QEXEC_CLEAR_AGG_LIST_VALUE(agg_list) \
   do \
@@ -316,6 +334,16 @@ struct ordbynum_info
   int reserved[2];
 };
 
+/* hashes of a CONNECT BY parent and of all its ancestors; a child whose hash is not found cannot close a cycle */
+typedef struct connect_by_ancestors CONNECT_BY_ANCESTORS;
+struct connect_by_ancestors
+{
+  unsigned int *hashes;		/* sorted hashes of the ancestor chain */
+  int count;			/* number of hashes */
+  int capacity;			/* allocated number of hashes */
+  bool is_built;		/* hashes belong to the current parent */
+};
+
 /* parent pos info stack */
 typedef struct parent_pos_info PARENT_POS_INFO;
 struct parent_pos_info
@@ -376,11 +404,11 @@ typedef enum analytic_stage ANALYTIC_STAGE;
 typedef enum
 {
   TOPN_SUCCESS,
+  TOPN_REJECTED,
   TOPN_OVERFLOW,
   TOPN_FAILURE
 } TOPN_STATUS;
 
-static DB_LOGICAL qexec_eval_instnum_pred (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xasl_state);
 static int qexec_add_composite_lock (THREAD_ENTRY * thread_p, REGU_VARIABLE_LIST reg_var_list, XASL_STATE * xasl_state,
 				     LK_COMPOSITE_LOCK * composite_lock, int upd_del_cls_cnt, OID * default_cls_oid);
 static QPROC_TPLDESCR_STATUS qexec_generate_tuple_descriptor (THREAD_ENTRY * thread_p, QFILE_LIST_ID * list_id,
@@ -438,6 +466,7 @@ static int qexec_hash_gby_agg_tuple (THREAD_ENTRY * thread_p, XASL_NODE * xasl,
 				     BUILDLIST_PROC_NODE * proc, QFILE_TUPLE_RECORD * tplrec,
 				     QFILE_TUPLE_DESCRIPTOR * tpldesc, QFILE_LIST_ID * groupby_list,
 				     bool * output_tuple);
+static int qexec_hash_gby_flush_partition (THREAD_ENTRY * thread_p, XASL_NODE * xasl);
 static void qexec_gby_start_group_dim (THREAD_ENTRY * thread_p, GROUPBY_STATE * gbstate, const RECDES * recdes);
 static void qexec_gby_start_group (THREAD_ENTRY * thread_p, GROUPBY_STATE * gbstate, const RECDES * recdes, int N);
 static void qexec_gby_finalize_group_val_list (THREAD_ENTRY * thread_p, GROUPBY_STATE * gbstate, int N);
@@ -462,6 +491,10 @@ static ANALYTIC_STATE *qexec_initialize_analytic_state (THREAD_ENTRY * thread_p,
 							QFILE_TUPLE_RECORD * tplrec);
 static SORT_STATUS qexec_analytic_get_next (THREAD_ENTRY * thread_p, RECDES * recdes, void *arg);
 static int qexec_analytic_put_next (THREAD_ENTRY * thread_p, const RECDES * recdes, void *arg);
+static int qexec_analytic_is_input_sorted (THREAD_ENTRY * thread_p, ANALYTIC_STATE * analytic_state,
+					   QFILE_LIST_ID * list_id, bool * is_sorted);
+static int qexec_analytic_stream_input (THREAD_ENTRY * thread_p, ANALYTIC_STATE * analytic_state);
+static int qexec_analytic_alloc_key_recdes (THREAD_ENTRY * thread_p, RECDES * key_rec, int size);
 static int qexec_analytic_eval_instnum_pred (THREAD_ENTRY * thread_p, ANALYTIC_STATE * analytic_state,
 					     ANALYTIC_STAGE stage);
 static int qexec_analytic_start_group (THREAD_ENTRY * thread_p, XASL_STATE * xasl_state,
@@ -546,6 +579,15 @@ static int qexec_check_for_cycle (THREAD_ENTRY * thread_p, OUTPTR_LIST * outptr_
 				  QFILE_TUPLE_VALUE_TYPE_LIST * type_list, QFILE_LIST_ID * list_id_p, int *iscycle);
 static int qexec_compare_valptr_with_tuple (OUTPTR_LIST * outptr_list, QFILE_TUPLE tpl,
 					    QFILE_TUPLE_VALUE_TYPE_LIST * type_list, int *are_equal);
+static bool qexec_is_cycle_hashable_type (DB_TYPE type);
+static int qexec_hash_tuple_for_cycle (OUTPTR_LIST * outptr_list, QFILE_TUPLE tpl,
+				       QFILE_TUPLE_VALUE_TYPE_LIST * type_list, unsigned int *hash);
+static bool qexec_hash_valptr_for_cycle (OUTPTR_LIST * outptr_list, QFILE_TUPLE_VALUE_TYPE_LIST * type_list,
+					 unsigned int *hash);
+static int qexec_compare_cycle_hash (const void *a, const void *b);
+static int qexec_build_connect_by_ancestors (THREAD_ENTRY * thread_p, OUTPTR_LIST * outptr_list, QFILE_TUPLE tpl,
+					     QFILE_TUPLE_VALUE_TYPE_LIST * type_list, QFILE_LIST_ID * list_id_p,
+					     CONNECT_BY_ANCESTORS * ancestors);
 static int qexec_listfile_orderby (THREAD_ENTRY * thread_p, XASL_NODE * xasl, QFILE_LIST_ID * list_file,
 				   SORT_LIST * orderby_list, XASL_STATE * xasl_state, OUTPTR_LIST * outptr_list);
 static int qexec_end_buildvalueblock_iterations (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xasl_state,
@@ -553,6 +595,16 @@ static int qexec_end_buildvalueblock_iterations (THREAD_ENTRY * thread_p, XASL_N
 static int qexec_end_mainblock_iterations (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xasl_state,
 					   QFILE_TUPLE_RECORD * tplrec);
 static void qexec_clear_mainblock_iterations (THREAD_ENTRY * thread_p, XASL_NODE * xasl);
+static void qexec_set_join_filters (XASL_NODE * xasl);
+static int qexec_set_partition_wise (THREAD_ENTRY * thread_p, XASL_NODE * xasl);
+static void qexec_check_cardinality (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xasl_state);
+static unsigned int qexec_hash_subquery_memo_key (const void *key, unsigned int ht_size);
+static int qexec_subquery_memo_key_eq (const void *key1, const void *key2);
+static int qexec_free_subquery_memo_entry (const void *key, void *data, void *args);
+static void qexec_free_subquery_memo (THREAD_ENTRY * thread_p, XASL_NODE * xasl);
+static int qexec_get_subquery_memo (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xasl_state,
+				    bool * is_found);
+static int qexec_put_subquery_memo (THREAD_ENTRY * thread_p, XASL_NODE * xasl);
 static int qexec_execute_analytic (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xasl_state,
 				   ANALYTIC_EVAL_TYPE * analytic_eval, QFILE_TUPLE_RECORD * tplrec, bool is_last);
 static void qexec_update_btree_unique_stats_info (THREAD_ENTRY * thread_p, multi_index_unique_stats * info,
@@ -563,6 +615,7 @@ static int qexec_process_partition_unique_stats (THREAD_ENTRY * thread_p, PRUNIN
 static int qexec_process_unique_stats (THREAD_ENTRY * thread_p, const OID * class_oid,
 				       UPDDEL_CLASS_INFO_INTERNAL * class_);
 static SCAN_CODE qexec_init_next_partition (THREAD_ENTRY * thread_p, ACCESS_SPEC_TYPE * spec);
+static SCAN_CODE qexec_reset_following_scan (THREAD_ENTRY * thread_p, XASL_NODE * xasl);
 
 static int qexec_check_limit_clause (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xasl_state,
 				     bool * empty_result);
@@ -664,6 +717,7 @@ static int qexec_evaluate_partition_aggregates (THREAD_ENTRY * thread_p, ACCESS_
 						AGGREGATE_TYPE * agg_list, bool * is_scan_needed);
 
 static int qexec_setup_topn_proc (THREAD_ENTRY * thread_p, XASL_NODE * xasl, VAL_DESCR * vd);
+static bool qexec_is_ordered_partition_scan (XASL_NODE * xasl);
 static BH_CMP_RESULT qexec_topn_compare (const void *left, const void *right, BH_CMP_ARG arg);
 static BH_CMP_RESULT qexec_topn_cmpval (DB_VALUE * left, DB_VALUE * right, SORT_LIST * sort_spec);
 static TOPN_STATUS qexec_add_tuple_to_topn (THREAD_ENTRY * thread_p, TOPN_TUPLES * sort_stop,
@@ -702,7 +756,7 @@ static int qexec_get_attr_default (THREAD_ENTRY * thread_p, OR_ATTRIBUTE * attr,
  *   xasl(in)   :
  *   xasl_state(in)     :
  */
-static DB_LOGICAL
+DB_LOGICAL
 qexec_eval_instnum_pred (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xasl_state)
 {
   DB_LOGICAL ev_res;
@@ -728,11 +782,14 @@ qexec_eval_instnum_pred (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE *
 	      && pr->pe.m_eval_term.et.et_comp.rhs->type == TYPE_POS_VALUE)
 	  && xasl->instnum_pred->pe.m_eval_term.et.et_comp.rel_op == R_LE)
 	{
+	  /* the specialized comparison kernel is bound to the operator; rebind it whenever the operator changes */
 	  xasl->instnum_pred->pe.m_eval_term.et.et_comp.rel_op = R_LT;
+	  eval_bind_comp_eval_term (&xasl->instnum_pred->pe.m_eval_term.et.et_comp);
 	  /* evaluate predicate */
 	  ev_res = eval_pred (thread_p, xasl->instnum_pred, &xasl_state->vd, NULL);
 
 	  xasl->instnum_pred->pe.m_eval_term.et.et_comp.rel_op = R_LE;
+	  eval_bind_comp_eval_term (&xasl->instnum_pred->pe.m_eval_term.et.et_comp);
 
 	  if (ev_res != V_TRUE)
 	    {
@@ -1189,6 +1246,15 @@ qexec_end_one_iteration (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE *
 		  /* successfully added tuple */
 		  break;
 		}
+	      else if (topn_stauts == TOPN_REJECTED)
+		{
+		  if (xasl->topn_items->is_partition_ordered)
+		    {
+		      /* the rows left in the partition come after this one */
+		      xasl->topn_items->end_partition = true;
+		    }
+		  break;
+		}
 	      else if (topn_stauts == TOPN_FAILURE)
 		{
 		  /* error while adding tuple */
@@ -1811,6 +1877,7 @@ qexec_clear_access_spec_list (THREAD_ENTRY * thread_p, XASL_NODE * xasl_p, ACCES
 	  p->curent = NULL;
 	  p->pruned = false;
 	}
+      partition_clear_runtime_pruning (thread_p, p);
 
       if (XASL_IS_FLAGED (xasl_p, XASL_DECACHE_CLONE))
 	{
@@ -2301,6 +2368,11 @@ qexec_clear_xasl (THREAD_ENTRY * thread_p, xasl_node * xasl, bool is_final)
 	  db_private_free_and_init (thread_p, xasl->topn_items);
 	}
 
+      if (xasl->memo != NULL)
+	{
+	  qexec_free_subquery_memo (thread_p, xasl);
+	}
+
       // clear trace stats
       memset (&xasl->orderby_stats, 0, sizeof (ORDERBY_STATS));
       memset (&xasl->groupby_stats, 0, sizeof (GROUPBY_STATS));
@@ -3906,6 +3978,46 @@ qexec_hash_gby_agg_tuple (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE
   return NO_ERROR;
 }
 
+/*
+ * qexec_hash_gby_flush_partition () - save the groups of a finished partition to the partial list
+ *   return: error code or NO_ERROR
+ *   thread_p(in): thread
+ *   xasl(in): XASL node whose scan moved to the next partition
+ *
+ * Note: If the hash key holds the partitioning key, no row of the following partitions falls into a group of the
+ *       finished partition. Once the hash table has overflowed, groups are merged from the partial list anyway, so
+ *       the groups of the finished partition are saved at once and the whole hash table is left to the next partition
+ *       instead of evicting its entries one by one.
+ */
+static int
+qexec_hash_gby_flush_partition (THREAD_ENTRY * thread_p, XASL_NODE * xasl)
+{
+  AGGREGATE_HASH_CONTEXT *context;
+  int rc;
+
+  if (xasl->type != BUILDLIST_PROC || !xasl->proc.buildlist.g_hash_eligible)
+    {
+      return NO_ERROR;
+    }
+
+  context = xasl->proc.buildlist.agg_hash_context;
+  if (context == NULL || !context->is_partition_grouped || context->state == HS_REJECT_ALL
+      || context->part_list_id == NULL || context->part_list_id->tuple_cnt == 0)
+    {
+      return NO_ERROR;
+    }
+
+  rc = qdata_save_agg_htable_to_list (thread_p, context->hash_table, xasl->list_id, context->part_list_id,
+				      context->temp_dbval_array);
+  if (rc != NO_ERROR)
+    {
+      return rc;
+    }
+  context->hash_size = 0;
+
+  return NO_ERROR;
+}
+
 /*
  * qexec_hash_gby_get_next () - get next tuple in partial list
  *   return: sort status
@@ -6760,6 +6872,7 @@ exit_on_error:
       curr_spec->parts = NULL;
       curr_spec->curent = NULL;
       curr_spec->pruned = false;
+      partition_clear_runtime_pruning (thread_p, curr_spec);
     }
 
   ASSERT_ERROR_AND_SET (error_code);
@@ -6839,6 +6952,7 @@ qexec_close_scan (THREAD_ENTRY * thread_p, ACCESS_SPEC_TYPE * curr_spec)
       curr_spec->parts = NULL;
       curr_spec->curent = NULL;
       curr_spec->pruned = false;
+      partition_clear_runtime_pruning (thread_p, curr_spec);
 
       /* init btid */
       if (curr_spec->indexptr)
@@ -7004,6 +7118,12 @@ qexec_next_scan_block (THREAD_ENTRY * thread_p, XASL_NODE * xasl)
   do
     {
       sb_scan = scan_next_scan_block (thread_p, &xasl->curr_spec->s_id);
+      if (sb_scan == S_SUCCESS && xasl->curr_spec->join_spec != NULL && !partition_join_matches (xasl->curr_spec))
+	{
+	  /* no row of this partition is joined with a row of the current partition of the outer scan */
+	  sb_scan = S_END;
+	}
+
       if (sb_scan == S_SUCCESS)
 	{
 	  return S_SUCCESS;
@@ -7015,6 +7135,10 @@ qexec_next_scan_block (THREAD_ENTRY * thread_p, XASL_NODE * xasl)
 	  if (s_parts == S_SUCCESS)
 	    {
 	      /* successfully moved to the next partition */
+	      if (qexec_hash_gby_flush_partition (thread_p, xasl) != NO_ERROR)
+		{
+		  return S_ERROR;
+		}
 	      continue;
 	    }
 	  else if (s_parts == S_ERROR)
@@ -7397,10 +7521,16 @@ qexec_execute_scan (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xasl
 
 	      /* start following scan procedure */
 	      xasl->scan_ptr->next_scan_on = false;
-	      if (scan_reset_scan_block (thread_p, &xasl->scan_ptr->curr_spec->s_id) == S_ERROR)
+	      xs_scan = qexec_reset_following_scan (thread_p, xasl->scan_ptr);
+	      if (xs_scan == S_ERROR)
 		{
 		  return S_ERROR;
 		}
+	      else if (xs_scan == S_END)
+		{
+		  /* the following scan has no rows for this scan item */
+		  continue;
+		}
 
 	      xasl->next_scan_on = true;
 
@@ -7537,6 +7667,40 @@ qexec_reset_regu_variable (REGU_VARIABLE * var)
     }
 }
 
+/*
+ * qexec_reset_following_scan () - restart the current scan block of a following scan procedure for a new item of the
+ *				    outer scan
+ * return : S_SUCCESS, S_END if the current partition cannot hold rows for the outer item, S_ERROR on error
+ * thread_p (in) :
+ * xasl (in)	 : following scan procedure
+ */
+static SCAN_CODE
+qexec_reset_following_scan (THREAD_ENTRY * thread_p, XASL_NODE * xasl)
+{
+  ACCESS_SPEC_TYPE *spec = xasl->curr_spec;
+  bool is_pruned = false;
+
+  if (scan_reset_scan_block (thread_p, &spec->s_id) == S_ERROR)
+    {
+      return S_ERROR;
+    }
+
+  /* outer joins must still return the NULL row, so only inner scans skip partitions */
+  if (spec->runtime_pruning != NULL && spec->s_id.single_fetch == QPROC_NO_SINGLE_INNER)
+    {
+      if (partition_prune_runtime (thread_p, spec, &is_pruned) != NO_ERROR)
+	{
+	  return S_ERROR;
+	}
+      if (is_pruned)
+	{
+	  return S_END;
+	}
+    }
+
+  return S_SUCCESS;
+}
+
 /*
  * qexec_prune_spec () - perform partition pruning on an access spec
  * return : error code or NO_ERROR
@@ -7614,6 +7778,7 @@ qexec_init_next_partition (THREAD_ENTRY * thread_p, ACCESS_SPEC_TYPE * spec)
   bool iscan_oid_order = spec->s_id.s.isid.iscan_oid_order;
   INDX_INFO *idxptr = NULL;
   QUERY_ID query_id = spec->s_id.s.isid.indx_cov.query_id;
+  HASH_LIST_SCAN *join_filter = spec->s_id.join_filter;
   OID class_oid;
   HFID class_hfid;
   BTID btid;
@@ -7785,6 +7950,9 @@ qexec_init_next_partition (THREAD_ENTRY * thread_p, ACCESS_SPEC_TYPE * spec)
       return S_ERROR;
     }
 
+  /* the join filter pushed by qexec_set_join_filters () applies to all partitions */
+  spec->s_id.join_filter = join_filter;
+
   if (spec->curent == NULL)
     {
       return S_END;
@@ -8135,16 +8303,18 @@ qexec_intprt_fnc (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xasl_s
 
 			  /* handle the scan procedure */
 			  xasl->scan_ptr->next_scan_on = false;
-			  if (scan_reset_scan_block (thread_p, &xasl->scan_ptr->curr_spec->s_id) == S_ERROR)
+			  xs_scan = qexec_reset_following_scan (thread_p, xasl->scan_ptr);
+			  if (xs_scan == S_ERROR)
 			    {
 			      return S_ERROR;
 			    }
 
 			  xasl->next_scan_on = true;
 
-
-			  while ((xs_scan = (*next_scan_fnc) (thread_p, xasl->scan_ptr, xasl_state, tplrec,
-							      next_scan_fnc + 1)) == S_SUCCESS)
+			  /* S_END means the following scan has no rows for this scan item */
+			  while (xs_scan == S_SUCCESS
+				 && (xs_scan = (*next_scan_fnc) (thread_p, xasl->scan_ptr, xasl_state, tplrec,
+								 next_scan_fnc + 1)) == S_SUCCESS)
 			    {
 
 			      /* if hierarchical query do special processing */
@@ -8210,6 +8380,14 @@ qexec_intprt_fnc (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xasl_s
 	    }
 
 	  qexec_clear_all_lists (thread_p, xasl);
+
+	  if (xasl->topn_items != NULL && xasl->topn_items->end_partition)
+	    {
+	      /* no other row of the partition can be in top-n; go to the next partition */
+	      xasl->topn_items->end_partition = false;
+	      ls_scan = S_END;
+	      break;
+	    }
 	}
 
       if (max_recursive_iterations_reached)
@@ -9867,6 +10045,11 @@ qexec_execute_delete (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xa
 			  er_log_debug (ARG_FILE_LINE, "qexec_execute_delete: class OID is not correct\n");
 			  GOTO_EXIT_ON_ERROR;
 			}
+		      if (op_type == MULTI_ROW_DELETE && !internal_class->needs_pruning)
+			{
+			  /* mark deleted keys of non-unique indexes in key order */
+			  locator_start_index_delete_buffer (internal_class->scan_cache);
+			}
 
 		      if (internal_class->num_lob_attrs)
 			{
@@ -10031,6 +10214,18 @@ qexec_execute_delete (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xa
       GOTO_EXIT_ON_ERROR;
     }
 
+  for (s = 0; s < class_oid_cnt; s++)
+    {
+      if (internal_classes[s].m_inited_scancache)
+	{
+	  error = locator_flush_index_insert_buffer (thread_p, &internal_classes[s].m_scancache);
+	  if (error != NO_ERROR)
+	    {
+	      GOTO_EXIT_ON_ERROR;
+	    }
+	}
+    }
+
   /* reflect local statistical information into transaction's statistical information */
   for (s = 0; s < class_oid_cnt; s++)
     {
@@ -11339,6 +11534,12 @@ qexec_execute_insert (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xa
 	}
       scan_cache_inited = true;
 
+      if (!insert->do_replace && odku_assignments == NULL && pcontext == NULL)
+	{
+	  /* No row of this statement is looked up in its indexes; non-unique keys can be inserted after all rows. */
+	  locator_start_index_insert_buffer (&scan_cache);
+	}
+
       assert (xasl->scan_op_type == S_SELECT);
 
       /* force_select_lock = false */
@@ -11504,6 +11705,11 @@ qexec_execute_insert (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xa
 	  GOTO_EXIT_ON_ERROR;
 	}
       qexec_close_scan (thread_p, specp);
+
+      if (locator_flush_index_insert_buffer (thread_p, &scan_cache) != NO_ERROR)
+	{
+	  GOTO_EXIT_ON_ERROR;
+	}
     }
   else
     {
@@ -13470,6 +13676,177 @@ exit_on_error:
 
 }
 
+/*
+ * qexec_set_join_filters () - push the Bloom filters of inner hash list scans into the scans of their outer blocks
+ *   return:
+ *   xasl(in): XASL tree whose scans are already open
+ *
+ * Note: An item of the outer scan whose join key is not in the hash table of the inner scan cannot produce a row of
+ *       an inner join, so it is skipped before the predicates, the subqueries and the inner scan are evaluated for
+ *       it. Filters are pushed only when the outer block has no work to do for such an item.
+ */
+static void
+qexec_set_join_filters (XASL_NODE * xasl)
+{
+  XASL_NODE *xptr, *inner;
+  ACCESS_SPEC_TYPE *specp;
+
+  for (xptr = xasl; xptr != NULL && xptr->scan_ptr != NULL; xptr = xptr->scan_ptr)
+    {
+      inner = xptr->scan_ptr;
+
+      if (inner->spec_list == NULL || inner->spec_list->next != NULL || inner->merge_spec != NULL)
+	{
+	  continue;
+	}
+      if (inner->spec_list->single_fetch != QPROC_NO_SINGLE_INNER
+	  && inner->spec_list->single_fetch != QPROC_SINGLE_INNER)
+	{
+	  /* items of an outer join must be kept */
+	  continue;
+	}
+      if (xptr->dptr_list != NULL || xptr->bptr_list != NULL || xptr->fptr_list != NULL)
+	{
+	  continue;
+	}
+
+      for (specp = xptr->spec_list; specp != NULL; specp = specp->next)
+	{
+	  if (specp->single_fetch != QPROC_NO_SINGLE_INNER && specp->single_fetch != QPROC_SINGLE_INNER)
+	    {
+	      continue;
+	    }
+	  (void) scan_set_join_filter (&specp->s_id, &inner->spec_list->s_id);
+	}
+    }
+}
+
+/*
+ * qexec_set_partition_wise () - join and aggregate partitioned classes partition by partition
+ *   return: error code
+ *   thread_p(in): thread
+ *   xasl(in): XASL tree whose scans are already open
+ *
+ * Note: Each partition of a class is a scan block and the scan blocks of all classes are combined, so every partition
+ *       of an outer class is scanned again for every partition of an inner class. If both classes are partitioned the
+ *       same way on the join key, qexec_next_scan_block () skips the pairs of partitions that have no joined rows.
+ *       If the hash key of a group by holds the partitioning key of the scanned class, groups are complete at the
+ *       end of each partition and are saved by qexec_hash_gby_flush_partition ().
+ */
+static int
+qexec_set_partition_wise (THREAD_ENTRY * thread_p, XASL_NODE * xasl)
+{
+  XASL_NODE *xptr, *outer;
+  ACCESS_SPEC_TYPE *specp;
+  AGGREGATE_HASH_CONTEXT *context;
+  int error;
+
+  if (!prm_get_bool_value (PRM_ID_PARTITION_WISE_JOIN))
+    {
+      return NO_ERROR;
+    }
+
+  for (xptr = xasl->scan_ptr; xptr != NULL; xptr = xptr->scan_ptr)
+    {
+      specp = xptr->spec_list;
+      if (specp == NULL || specp->next != NULL || specp->runtime_pruning == NULL
+	  || specp->single_fetch != QPROC_NO_SINGLE_INNER)
+	{
+	  /* rows of an outer join are kept even if they have no joined rows */
+	  continue;
+	}
+
+      for (outer = xasl; outer != xptr && specp->join_spec == NULL; outer = outer->scan_ptr)
+	{
+	  if (outer->spec_list == NULL || outer->spec_list->next != NULL
+	      || outer->spec_list->single_fetch != QPROC_NO_SINGLE_INNER)
+	    {
+	      continue;
+	    }
+
+	  error = partition_prepare_join (thread_p, specp, outer->spec_list);
+	  if (error != NO_ERROR)
+	    {
+	      return error;
+	    }
+	}
+    }
+
+  if (xasl->type == BUILDLIST_PROC && xasl->proc.buildlist.g_hash_eligible
+      && xasl->proc.buildlist.agg_hash_context != NULL && xasl->spec_list != NULL && xasl->spec_list->next == NULL)
+    {
+      context = xasl->proc.buildlist.agg_hash_context;
+      error = partition_is_grouped_by_key (thread_p, xasl->spec_list, xasl->proc.buildlist.g_hk_scan_regu_list,
+					   &context->is_partition_grouped);
+      if (error != NO_ERROR)
+	{
+	  return error;
+	}
+    }
+
+  return NO_ERROR;
+}
+
+/*
+ * qexec_check_cardinality () - compare the rows of a materialized intermediate result with the estimate of the
+ *				optimizer
+ *   return:
+ *   thread_p(in): thread
+ *   xasl(in): executed XASL node
+ *   xasl_state(in): XASL state
+ *
+ * Note: The execution goes on with the chosen plan, but the rows of a result whose error is over
+ *       plan_recompile_cardinality_ratio are saved to the XASL cache entry of the query, which is then recompiled
+ *       by xcache_check_recompilation_threshold (). The optimizer recompiling the plan uses the saved rows instead
+ *       of its estimate for the same joined nodes.
+ *       Only results whose rows are the rows of the planned joins are checked: grouping, DISTINCT and row limits
+ *       make fewer rows than the optimizer estimated.
+ */
+static void
+qexec_check_cardinality (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xasl_state)
+{
+  QMGR_QUERY_ENTRY *query_p;
+  double estimate, rows, error;
+  int ratio = prm_get_integer_value (PRM_ID_PLAN_RECOMPILE_CARDINALITY_RATIO);
+
+  if (ratio <= 0 || xasl->type != BUILDLIST_PROC || xasl->cardinality <= 0 || xasl->list_id == NULL)
+    {
+      return;
+    }
+  if (xasl->proc.buildlist.groupby_list != NULL || xasl->option == Q_DISTINCT || xasl->instnum_pred != NULL
+      || xasl->ordbynum_pred != NULL || xasl->limit_row_count != NULL || xasl->is_single_tuple)
+    {
+      return;
+    }
+
+  estimate = xasl->cardinality;
+  rows = (double) xasl->list_id->tuple_cnt;
+  if (MAX (estimate, rows) < QEXEC_CARDINALITY_CHECK_MIN_ROWS)
+    {
+      /* errors on small results do not make a plan slow */
+      return;
+    }
+
+  error = MAX (rows, 1.0) / MAX (estimate, 1.0);
+  if (error < 1.0)
+    {
+      error = 1.0 / error;
+    }
+  if (error < ratio)
+    {
+      return;
+    }
+
+  query_p = qmgr_get_query_entry (thread_p, xasl_state->query_id, LOG_FIND_THREAD_TRAN_INDEX (thread_p));
+  if (query_p == NULL || query_p->xasl_ent == NULL)
+    {
+      return;
+    }
+
+  xcache_note_cardinality_error (thread_p, query_p->xasl_ent, (float) error, xasl->cardinality_key,
+				 xasl->list_id->tuple_cnt);
+}
+
 /*
  * qexec_clear_mainblock_iterations () -
  *   return:
@@ -13538,6 +13915,7 @@ qexec_execute_mainblock (THREAD_ENTRY * thread_p, xasl_node * xasl, xasl_state *
 {
   int error = NO_ERROR;
   bool on_trace;
+  bool is_memo_hit = false;
   TSC_TICKS start_tick, end_tick;
   TSCTIMEVAL tv_diff;
   UINT64 old_fetches = 0, old_ioreads = 0;
@@ -13560,7 +13938,20 @@ qexec_execute_mainblock (THREAD_ENTRY * thread_p, xasl_node * xasl, xasl_state *
       old_ioreads = perfmon_get_from_statistic (thread_p, PSTAT_PB_NUM_IOREADS);
     }
 
-  error = qexec_execute_mainblock_internal (thread_p, xasl, xstate, p_class_instance_lock_info);
+  if (xasl->memo_key_list != NULL && xasl->single_tuple != NULL && xasl->is_single_tuple
+      && XASL_IS_FLAGED (xasl, XASL_LINK_TO_REGU_VARIABLE))
+    {
+      error = qexec_get_subquery_memo (thread_p, xasl, xstate, &is_memo_hit);
+    }
+
+  if (error == NO_ERROR && !is_memo_hit)
+    {
+      error = qexec_execute_mainblock_internal (thread_p, xasl, xstate, p_class_instance_lock_info);
+      if (error == NO_ERROR && xasl->memo != NULL)
+	{
+	  error = qexec_put_subquery_memo (thread_p, xasl);
+	}
+    }
 
   if (on_trace)
     {
@@ -13578,53 +13969,369 @@ qexec_execute_mainblock (THREAD_ENTRY * thread_p, xasl_node * xasl, xasl_state *
 }
 
 /*
- * qexec_check_limit_clause () - checks validity of limit clause
- *   return: NO_ERROR, or ER_code
- *   xasl(in): XASL Tree pointer
- *   xasl_state(in): XASL state information
- *   empty_result(out): true if no result will be generated
+ * qexec_hash_subquery_memo_key () - hash function of the subquery memo
+ *   return: hash value
+ *   key(in): HASH_SCAN_KEY
+ *   ht_size(in): hash table size
+ */
+static unsigned int
+qexec_hash_subquery_memo_key (const void *key, unsigned int ht_size)
+{
+  return qdata_hash_scan_key (key, ht_size, HASH_METH_IN_MEM);
+}
+
+/*
+ * qexec_subquery_memo_key_eq () - compare function of the subquery memo
+ *   return: true if the keys are identical
+ *   key1(in): HASH_SCAN_KEY
+ *   key2(in): HASH_SCAN_KEY
  *
+ * Note: Values that are only equal by comparison are not identical. Strings of a case insensitive collation or with
+ *       trailing spaces and numerics of different scale may give different subquery results, so they must have the
+ *       same type and the same bytes to match.
  */
 static int
-qexec_check_limit_clause (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xasl_state, bool * empty_result)
+qexec_subquery_memo_key_eq (const void *key1, const void *key2)
 {
-  DB_VALUE *limit_valp;
-  DB_VALUE zero_val;
-  DB_VALUE_COMPARE_RESULT cmp_with_zero;
-
-  /* init output */
-  *empty_result = false;
+  const HASH_SCAN_KEY *ckey1 = (const HASH_SCAN_KEY *) key1;
+  const HASH_SCAN_KEY *ckey2 = (const HASH_SCAN_KEY *) key2;
+  DB_VALUE *val1, *val2;
+  DB_TYPE type;
+  int i;
 
-  db_make_int (&zero_val, 0);
+  if (ckey1->val_count != ckey2->val_count)
+    {
+      return false;
+    }
 
-  if (xasl->limit_offset != NULL)
+  for (i = 0; i < ckey1->val_count; i++)
     {
-      /* limit_offset should be greater than 0. Otherwise, raises an error. */
-      if (fetch_peek_dbval (thread_p, xasl->limit_offset, &xasl_state->vd, NULL, NULL, NULL, &limit_valp) != NO_ERROR)
+      val1 = ckey1->values[i];
+      val2 = ckey2->values[i];
+
+      if (DB_IS_NULL (val1) || DB_IS_NULL (val2))
 	{
-	  return ER_FAILED;
+	  if (DB_IS_NULL (val1) != DB_IS_NULL (val2))
+	    {
+	      return false;
+	    }
+	  continue;
 	}
 
-      cmp_with_zero = tp_value_compare (limit_valp, &zero_val, 1, 0);
-      if (cmp_with_zero != DB_GT && cmp_with_zero != DB_EQ)
+      type = DB_VALUE_DOMAIN_TYPE (val1);
+      if (type != DB_VALUE_DOMAIN_TYPE (val2))
 	{
-	  /* still want better error code */
-	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_QPROC_INVALID_PARAMETER, 0);
-	  return ER_FAILED;
+	  return false;
 	}
-    }
 
-  if (xasl->limit_row_count != NULL)
-    {
-      /* When limit_row_count is
-       *   > 0, go to execute the query.
-       *   = 0, no result will be generated. stop execution for optimization.
-       *   < 0, raise an error.
-       */
-      if (fetch_peek_dbval (thread_p, xasl->limit_row_count, &xasl_state->vd, NULL, NULL, NULL, &limit_valp) !=
-	  NO_ERROR)
+      if (TP_IS_CHAR_TYPE (type) || TP_IS_BIT_TYPE (type))
 	{
-	  return ER_FAILED;
+	  if (db_get_string_size (val1) != db_get_string_size (val2)
+	      || db_get_string_codeset (val1) != db_get_string_codeset (val2)
+	      || memcmp (db_get_string (val1), db_get_string (val2), db_get_string_size (val1)) != 0)
+	    {
+	      return false;
+	    }
+	  continue;
+	}
+
+      if (type == DB_TYPE_NUMERIC && DB_VALUE_SCALE (val1) != DB_VALUE_SCALE (val2))
+	{
+	  return false;
+	}
+
+      if (tp_value_compare (val1, val2, 0, 1) != DB_EQ)
+	{
+	  return false;
+	}
+    }
+
+  return true;
+}
+
+/*
+ * qexec_free_subquery_memo_entry () - free an entry of the subquery memo
+ *   return: NO_ERROR
+ *   key(in): HASH_SCAN_KEY
+ *   data(in): DB_VALUE array
+ *   args(in): number of values in the array
+ */
+static int
+qexec_free_subquery_memo_entry (const void *key, void *data, void *args)
+{
+  HASH_SCAN_KEY *hkey = (HASH_SCAN_KEY *) key;
+  DB_VALUE *values = (DB_VALUE *) data;
+  int val_cnt = *((int *) args);
+  int i;
+
+  qdata_free_hscan_key (NULL, hkey, hkey->val_count);
+
+  for (i = 0; i < val_cnt; i++)
+    {
+      pr_clear_value (&values[i]);
+    }
+  db_private_free (NULL, values);
+
+  return NO_ERROR;
+}
+
+/*
+ * qexec_free_subquery_memo () - free the subquery memo of an XASL node
+ *   return:
+ *   xasl(in): XASL node
+ */
+static void
+qexec_free_subquery_memo (THREAD_ENTRY * thread_p, XASL_NODE * xasl)
+{
+  SUBQUERY_MEMO *memo = xasl->memo;
+
+  if (memo == NULL)
+    {
+      return;
+    }
+
+  if (memo->hash_table != NULL)
+    {
+      (void) mht_clear (memo->hash_table, qexec_free_subquery_memo_entry, &xasl->single_tuple->val_cnt);
+      mht_destroy (memo->hash_table);
+    }
+  if (memo->temp_key != NULL)
+    {
+      qdata_free_hscan_key (thread_p, memo->temp_key, memo->temp_key->val_count);
+    }
+
+  db_private_free_and_init (thread_p, xasl->memo);
+}
+
+/*
+ * qexec_get_subquery_memo () - look for the memoized result of a correlated single tuple subquery
+ *   return: NO_ERROR, or ER_code
+ *   xasl(in): XASL node of the subquery
+ *   xasl_state(in): XASL state
+ *   is_found(out): true if the result was found and copied to the single tuple values
+ *
+ * Note: The memo is created on the first execution and lives until the XASL tree is cleared. It stops growing when
+ *       max_subquery_memo_size is reached, and it is dropped once enough lookups show that the correlated values
+ *       rarely repeat.
+ */
+static int
+qexec_get_subquery_memo (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xasl_state, bool * is_found)
+{
+  SUBQUERY_MEMO *memo = xasl->memo;
+  QPROC_DB_VALUE_LIST value_list;
+  DB_VALUE *values;
+  REGU_VARIABLE_LIST regu_list;
+  int key_cnt, i;
+
+  *is_found = false;
+
+  if (memo == NULL)
+    {
+      if (prm_get_bigint_value (PRM_ID_MAX_SUBQUERY_MEMO_SIZE) == 0)
+	{
+	  return NO_ERROR;
+	}
+
+      memo = (SUBQUERY_MEMO *) db_private_alloc (thread_p, sizeof (SUBQUERY_MEMO));
+      if (memo == NULL)
+	{
+	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, sizeof (SUBQUERY_MEMO));
+	  return ER_OUT_OF_VIRTUAL_MEMORY;
+	}
+      memset (memo, 0, sizeof (SUBQUERY_MEMO));
+      xasl->memo = memo;
+
+      for (key_cnt = 0, regu_list = xasl->memo_key_list; regu_list != NULL; regu_list = regu_list->next)
+	{
+	  key_cnt++;
+	}
+
+      memo->temp_key = qdata_alloc_hscan_key (thread_p, key_cnt, false);
+      if (memo->temp_key == NULL)
+	{
+	  return ER_OUT_OF_VIRTUAL_MEMORY;
+	}
+
+      memo->hash_table =
+	mht_create ("Subquery Memo", SUBQUERY_MEMO_DEFAULT_TABLE_SIZE, qexec_hash_subquery_memo_key,
+		    qexec_subquery_memo_key_eq);
+      if (memo->hash_table == NULL)
+	{
+	  return ER_OUT_OF_VIRTUAL_MEMORY;
+	}
+    }
+
+  if (memo->is_disabled)
+    {
+      return NO_ERROR;
+    }
+
+  if (qdata_build_hscan_key (thread_p, &xasl_state->vd, xasl->memo_key_list, memo->temp_key) != NO_ERROR)
+    {
+      ASSERT_ERROR ();
+      return er_errid ();
+    }
+
+  memo->lookups++;
+  values = (DB_VALUE *) mht_get (memo->hash_table, memo->temp_key);
+  if (values == NULL)
+    {
+      if (memo->lookups >= SUBQUERY_MEMO_HIT_RATIO_LOOKUP_THRESHOLD
+	  && (float) memo->hits / memo->lookups < SUBQUERY_MEMO_MIN_HIT_RATIO)
+	{
+	  /* correlated values rarely repeat, the memo costs more than it saves */
+	  (void) mht_clear (memo->hash_table, qexec_free_subquery_memo_entry, &xasl->single_tuple->val_cnt);
+	  memo->memory_size = 0;
+	  memo->is_disabled = true;
+	}
+      return NO_ERROR;
+    }
+
+  memo->hits++;
+
+  for (value_list = xasl->single_tuple->valp, i = 0; i < xasl->single_tuple->val_cnt;
+       value_list = value_list->next, i++)
+    {
+      pr_clear_value (value_list->val);
+      if (pr_clone_value (&values[i], value_list->val) != NO_ERROR)
+	{
+	  ASSERT_ERROR ();
+	  return er_errid ();
+	}
+    }
+
+  xasl->status = XASL_SUCCESS;
+  *is_found = true;
+
+  return NO_ERROR;
+}
+
+/*
+ * qexec_put_subquery_memo () - memoize the result of a correlated single tuple subquery
+ *   return: NO_ERROR, or ER_code
+ *   xasl(in): XASL node of the subquery, just executed for the correlated values in memo->temp_key
+ */
+static int
+qexec_put_subquery_memo (THREAD_ENTRY * thread_p, XASL_NODE * xasl)
+{
+  SUBQUERY_MEMO *memo = xasl->memo;
+  QPROC_DB_VALUE_LIST value_list;
+  HASH_SCAN_KEY *new_key;
+  DB_VALUE *values;
+  UINT64 entry_size;
+  int val_cnt = xasl->single_tuple->val_cnt;
+  int i;
+
+  if (memo->is_disabled || memo->is_full)
+    {
+      return NO_ERROR;
+    }
+
+  /* make a copy of the key; temp_key still references the correlated values used by the execution */
+  new_key = qdata_alloc_hscan_key (thread_p, memo->temp_key->val_count, true);
+  if (new_key == NULL)
+    {
+      return ER_OUT_OF_VIRTUAL_MEMORY;
+    }
+
+  entry_size = sizeof (HASH_SCAN_KEY) + sizeof (DB_VALUE *) * new_key->val_count + sizeof (DB_VALUE) * val_cnt;
+  for (i = 0; i < new_key->val_count; i++)
+    {
+      if (pr_clone_value (memo->temp_key->values[i], new_key->values[i]) != NO_ERROR)
+	{
+	  qdata_free_hscan_key (thread_p, new_key, new_key->val_count);
+	  ASSERT_ERROR ();
+	  return er_errid ();
+	}
+      entry_size += pr_value_mem_size (new_key->values[i]);
+    }
+
+  values = (DB_VALUE *) db_private_alloc (thread_p, sizeof (DB_VALUE) * val_cnt);
+  if (values == NULL)
+    {
+      qdata_free_hscan_key (thread_p, new_key, new_key->val_count);
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, sizeof (DB_VALUE) * val_cnt);
+      return ER_OUT_OF_VIRTUAL_MEMORY;
+    }
+
+  for (value_list = xasl->single_tuple->valp, i = 0; i < val_cnt; value_list = value_list->next, i++)
+    {
+      db_make_null (&values[i]);
+      if (pr_clone_value (value_list->val, &values[i]) != NO_ERROR)
+	{
+	  (void) qexec_free_subquery_memo_entry (new_key, values, &i);
+	  ASSERT_ERROR ();
+	  return er_errid ();
+	}
+      entry_size += pr_value_mem_size (&values[i]);
+    }
+
+  if (memo->memory_size + entry_size > (UINT64) prm_get_bigint_value (PRM_ID_MAX_SUBQUERY_MEMO_SIZE))
+    {
+      /* keep the entries we have; new correlated values are no longer memoized */
+      (void) qexec_free_subquery_memo_entry (new_key, values, &val_cnt);
+      memo->is_full = true;
+      return NO_ERROR;
+    }
+
+  if (mht_put (memo->hash_table, new_key, values) == NULL)
+    {
+      (void) qexec_free_subquery_memo_entry (new_key, values, &val_cnt);
+      return ER_FAILED;
+    }
+  memo->memory_size += entry_size;
+
+  return NO_ERROR;
+}
+
+/*
+ * qexec_check_limit_clause () - checks validity of limit clause
+ *   return: NO_ERROR, or ER_code
+ *   xasl(in): XASL Tree pointer
+ *   xasl_state(in): XASL state information
+ *   empty_result(out): true if no result will be generated
+ *
+ */
+static int
+qexec_check_limit_clause (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xasl_state, bool * empty_result)
+{
+  DB_VALUE *limit_valp;
+  DB_VALUE zero_val;
+  DB_VALUE_COMPARE_RESULT cmp_with_zero;
+
+  /* init output */
+  *empty_result = false;
+
+  db_make_int (&zero_val, 0);
+
+  if (xasl->limit_offset != NULL)
+    {
+      /* limit_offset should be greater than 0. Otherwise, raises an error. */
+      if (fetch_peek_dbval (thread_p, xasl->limit_offset, &xasl_state->vd, NULL, NULL, NULL, &limit_valp) != NO_ERROR)
+	{
+	  return ER_FAILED;
+	}
+
+      cmp_with_zero = tp_value_compare (limit_valp, &zero_val, 1, 0);
+      if (cmp_with_zero != DB_GT && cmp_with_zero != DB_EQ)
+	{
+	  /* still want better error code */
+	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_QPROC_INVALID_PARAMETER, 0);
+	  return ER_FAILED;
+	}
+    }
+
+  if (xasl->limit_row_count != NULL)
+    {
+      /* When limit_row_count is
+       *   > 0, go to execute the query.
+       *   = 0, no result will be generated. stop execution for optimization.
+       *   < 0, raise an error.
+       */
+      if (fetch_peek_dbval (thread_p, xasl->limit_row_count, &xasl_state->vd, NULL, NULL, NULL, &limit_valp) !=
+	  NO_ERROR)
+	{
+	  return ER_FAILED;
 	}
 
       cmp_with_zero = tp_value_compare (limit_valp, &zero_val, 1, 0);
@@ -14067,6 +14774,7 @@ qexec_execute_mainblock_internal (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XAS
 		      qexec_failure_line (__LINE__, xasl_state);
 		      GOTO_EXIT_ON_ERROR;
 		    }
+		  qexec_check_cardinality (thread_p, xptr2, xasl_state);
 		}
 	      else
 		{		/* already executed. success or failure */
@@ -14228,6 +14936,10 @@ qexec_execute_mainblock_internal (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XAS
 
 		      iscan_oid_order = xptr->iscan_oid_order;
 
+		      /* the values of outer scans are set before the rows of inner scans are fetched, so only the first
+		       * scan can prune partitions with them when it is opened */
+		      specp->is_outer_values_set = (level == 0 && spec_level == 0);
+
 		      /* open the scan for this access specification node */
 		      if (level == 0 && spec_level == 1)
 			{
@@ -14278,6 +14990,17 @@ qexec_execute_mainblock_internal (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XAS
 		}
 	    }
 
+	  if (xasl->merge_spec == NULL)
+	    {
+	      qexec_set_join_filters (xasl);
+
+	      if (qexec_set_partition_wise (thread_p, xasl) != NO_ERROR)
+		{
+		  qexec_clear_mainblock_iterations (thread_p, xasl);
+		  GOTO_EXIT_ON_ERROR;
+		}
+	    }
+
 	  /* allocate xasl scan function vector */
 	  func_vector = (XASL_SCAN_FNC_PTR) db_private_alloc (thread_p, level * sizeof (XSAL_SCAN_FUNC));
 	  if (func_vector == NULL)
@@ -15186,6 +15909,8 @@ qexec_execute_connect_by (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE
   DB_LOGICAL ev_res;
   bool parent_tuple_added;
   int cycle;
+  CONNECT_BY_ANCESTORS ancestors = { NULL, 0, 0, false };
+  unsigned int child_hash;
 
   has_order_siblings_by = xasl->orderby_list ? 1 : 0;
   connect_by = &xasl->proc.connect_by;
@@ -15347,6 +16072,7 @@ qexec_execute_connect_by (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE
 	    }
 
 	  parent_tuple_added = false;
+	  ancestors.is_built = false;
 
 	  /* reset parent tuple position pseudocolumn value */
 	  db_make_bit (parent_pos_valp, DB_DEFAULT_PRECISION, NULL, 8);
@@ -15429,13 +16155,26 @@ qexec_execute_connect_by (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE
 		}
 
 	      cycle = 0;
-	      /* we found a qualified tuple; now check for cycle */
-	      if (qexec_check_for_cycle (thread_p, xasl->outptr_list, tuple_rec.tpl, &type_list, listfile0, &cycle)
-		  != NO_ERROR)
+	      /* we found a qualified tuple; now check for cycle. The ancestors of the parent are hashed once and the
+	       * ancestor chain is compared only for tuples that hash like one of them. */
+	      if (!ancestors.is_built
+		  && qexec_build_connect_by_ancestors (thread_p, xasl->outptr_list, tuple_rec.tpl, &type_list,
+						       listfile0, &ancestors) != NO_ERROR)
 		{
 		  GOTO_EXIT_ON_ERROR;
 		}
 
+	      if (!qexec_hash_valptr_for_cycle (xasl->outptr_list, &type_list, &child_hash)
+		  || bsearch (&child_hash, ancestors.hashes, ancestors.count, sizeof (unsigned int),
+			      qexec_compare_cycle_hash) != NULL)
+		{
+		  if (qexec_check_for_cycle (thread_p, xasl->outptr_list, tuple_rec.tpl, &type_list, listfile0, &cycle)
+		      != NO_ERROR)
+		    {
+		      GOTO_EXIT_ON_ERROR;
+		    }
+		}
+
 	      if (cycle == 0)
 		{
 		  isleaf_value = 0;
@@ -15732,6 +16471,11 @@ qexec_execute_connect_by (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE
       db_private_free_and_init (thread_p, type_list.domp);
     }
 
+  if (ancestors.hashes)
+    {
+      db_private_free_and_init (thread_p, ancestors.hashes);
+    }
+
   if (qexec_end_mainblock_iterations (thread_p, xasl, xasl_state, tplrec) != NO_ERROR)
     {
       GOTO_EXIT_ON_ERROR;
@@ -15814,6 +16558,11 @@ exit_on_error:
       db_private_free_and_init (thread_p, type_list.domp);
     }
 
+  if (ancestors.hashes)
+    {
+      db_private_free_and_init (thread_p, ancestors.hashes);
+    }
+
   if (listfile1 && (listfile1 != connect_by->start_with_list_id))
     {
       if (lfscan_id.list_id.tfile_vfid == listfile1->tfile_vfid)
@@ -15910,13 +16659,8 @@ qexec_execute_cte (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xasl_
   XASL_NODE *non_recursive_part = xasl->proc.cte.non_recursive_part;
   XASL_NODE *recursive_part = xasl->proc.cte.recursive_part;
   QFILE_LIST_ID *save_recursive_list_id = NULL;
-  QFILE_LIST_ID *t_list_id = NULL;
-  int ls_flag = 0;
   bool first_iteration = true;
 
-  QFILE_SET_FLAG (ls_flag, QFILE_FLAG_UNION);
-  QFILE_SET_FLAG (ls_flag, QFILE_FLAG_ALL);
-
   if (non_recursive_part == NULL)
     {
       /* non_recursive_part may have false where, so it is null */
@@ -16007,20 +16751,12 @@ qexec_execute_cte (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xasl_
 	    }
 	  else
 	    {
-	      /* copy non_rec_part->list_id to xasl->list_id (final results) */
-	      t_list_id = qfile_combine_two_list (thread_p, xasl->list_id, non_recursive_part->list_id, ls_flag);
-	      if (t_list_id == NULL)
-		{
-		  GOTO_EXIT_ON_ERROR;
-		}
-
-	      /* what's the purpose of t_list_id?? */
-	      qfile_clear_list_id (xasl->list_id);
-	      if (qfile_copy_list_id (xasl->list_id, t_list_id, true) != NO_ERROR)
+	      /* append the tuples of the previous iteration (non_rec_part->list_id) to xasl->list_id (final results);
+	       * only this delta is read, the results of the earlier iterations are never scanned again */
+	      if (qfile_append_list (thread_p, xasl->list_id, non_recursive_part->list_id) != NO_ERROR)
 		{
 		  GOTO_EXIT_ON_ERROR;
 		}
-	      QFILE_FREE_AND_INIT_LIST_ID (t_list_id);
 	    }
 
 	  qfile_clear_list_id (non_recursive_part->list_id);
@@ -16383,28 +17119,388 @@ qexec_check_for_cycle (THREAD_ENTRY * thread_p, OUTPTR_LIST * outptr_list, QFILE
   QFILE_TUPLE_RECORD tuple_rec = { (QFILE_TUPLE) NULL, 0 };
   const QFILE_TUPLE_POSITION *bitval = NULL;
   QFILE_TUPLE_POSITION p_pos;
-  int length;
+  int length;
+
+  if (qfile_open_list_scan (list_id_p, &s_id) != NO_ERROR)
+    {
+      return ER_FAILED;
+    }
+
+  /* we start with tpl itself */
+  tuple_rec.tpl = tpl;
+
+  do
+    {
+      if (qexec_compare_valptr_with_tuple (outptr_list, tuple_rec.tpl, type_list, iscycle) != NO_ERROR)
+	{
+	  qfile_close_scan (thread_p, &s_id);
+	  return ER_FAILED;
+	}
+
+      if (*iscycle)
+	{
+	  break;
+	}
+
+      /* get the parent node */
+      if (qexec_get_tuple_column_value (tuple_rec.tpl,
+					(outptr_list->valptr_cnt - PCOL_PARENTPOS_TUPLE_OFFSET), &p_pos_dbval,
+					&tp_Bit_domain) != NO_ERROR)
+	{
+	  qfile_close_scan (thread_p, &s_id);
+	  return ER_FAILED;
+	}
+
+      bitval = REINTERPRET_CAST (const QFILE_TUPLE_POSITION *, db_get_bit (&p_pos_dbval, &length));
+
+      if (bitval)
+	{
+	  p_pos.status = s_id.status;
+	  p_pos.position = S_ON;
+	  p_pos.vpid = bitval->vpid;
+	  p_pos.offset = bitval->offset;
+	  p_pos.tpl = NULL;
+	  p_pos.tplno = bitval->tplno;
+
+	  if (qfile_jump_scan_tuple_position (thread_p, &s_id, &p_pos, &tuple_rec, PEEK) != S_SUCCESS)
+	    {
+	      qfile_close_scan (thread_p, &s_id);
+	      return ER_FAILED;
+	    }
+	}
+    }
+  while (bitval);		/* the parent tuple pos is null for the root node */
+
+  qfile_close_scan (thread_p, &s_id);
+
+  return NO_ERROR;
+
+}
+
+/*
+ * qexec_compare_valptr_with_tuple () - compare the tuple described by
+ *    outptr_list to see if it is equal to tpl; ignore pseudo-columns
+ *  return:
+ *  outptr_list(in):
+ *  tpl(in):
+ *  type_list(in):
+ *  are_equal(out):
+ */
+static int
+qexec_compare_valptr_with_tuple (OUTPTR_LIST * outptr_list, QFILE_TUPLE tpl, QFILE_TUPLE_VALUE_TYPE_LIST * type_list,
+				 int *are_equal)
+{
+  REGU_VARIABLE_LIST regulist;
+  QFILE_TUPLE tuple;
+  OR_BUF buf;
+  DB_VALUE dbval1, *dbvalp2;
+  PR_TYPE *pr_type_p;
+  DB_TYPE type;
+  TP_DOMAIN *domp;
+  int length1, length2, equal, i;
+  bool copy = false;
+
+  *are_equal = 1;
+
+  tuple = tpl + QFILE_TUPLE_LENGTH_SIZE;
+  regulist = outptr_list->valptrp;
+  i = 0;
+
+  while (regulist && i < outptr_list->valptr_cnt - PCOL_FIRST_TUPLE_OFFSET)
+    {
+      /* compare regulist->value.value.dbvalptr to the DB_VALUE from tuple */
+
+      dbvalp2 = regulist->value.value.dbvalptr;
+      length2 = (dbvalp2->domain.general_info.is_null != 0) ? 0 : -1;
+
+      domp = type_list->domp[i];
+      type = TP_DOMAIN_TYPE (domp);
+      copy = pr_is_set_type (type);
+      pr_type_p = domp->type;
+
+      length1 = QFILE_GET_TUPLE_VALUE_LENGTH (tuple);
+
+      /* zero length means NULL */
+      if (length1 == 0)
+	{
+	  db_make_null (&dbval1);
+	}
+      else
+	{
+	  or_init (&buf, (char *) tuple + QFILE_TUPLE_VALUE_HEADER_SIZE, length1);
+	  if (pr_type_p->data_readval (&buf, &dbval1, domp, -1, copy, NULL, 0) != NO_ERROR)
+	    {
+	      return ER_FAILED;
+	    }
+	}
+
+      if (length1 == 0 && length2 == 0)
+	{
+	  equal = 1;
+	}
+      else if (length1 == 0)
+	{
+	  equal = 0;
+	}
+      else if (length2 == 0)
+	{
+	  equal = 0;
+	}
+      else
+	{
+	  equal = pr_type_p->cmpval (&dbval1, dbvalp2, 0, 1, NULL, domp->collation_id) == DB_EQ;
+	}
+
+      if (copy || DB_NEED_CLEAR (&dbval1))
+	{
+	  pr_clear_value (&dbval1);
+	}
+
+      if (!equal)
+	{
+	  *are_equal = 0;
+	  break;
+	}
+
+      tuple += QFILE_TUPLE_VALUE_HEADER_SIZE + QFILE_GET_TUPLE_VALUE_LENGTH (tuple);
+      regulist = regulist->next;
+      i++;
+    }
+
+  if (i < outptr_list->valptr_cnt - PCOL_FIRST_TUPLE_OFFSET)
+    {
+      *are_equal = 0;
+    }
+
+  return NO_ERROR;
+}
+
+/*
+ * qexec_is_cycle_hashable_type () - check if values of the type hash the same
+ *    whenever they compare equal
+ *  return: true if the type can be used for hashing ancestor tuples
+ *  type(in):
+ *
+ *  Note: columns of other types are left out of the hash; they are still
+ *        compared by qexec_check_for_cycle.
+ */
+static bool
+qexec_is_cycle_hashable_type (DB_TYPE type)
+{
+  switch (type)
+    {
+    case DB_TYPE_INTEGER:
+    case DB_TYPE_SMALLINT:
+    case DB_TYPE_BIGINT:
+    case DB_TYPE_DATE:
+    case DB_TYPE_TIME:
+    case DB_TYPE_TIMESTAMP:
+    case DB_TYPE_TIMESTAMPLTZ:
+    case DB_TYPE_DATETIME:
+    case DB_TYPE_DATETIMELTZ:
+    case DB_TYPE_OID:
+    case DB_TYPE_CHAR:
+    case DB_TYPE_VARCHAR:
+    case DB_TYPE_NCHAR:
+    case DB_TYPE_VARNCHAR:
+      return true;
+
+    default:
+      return false;
+    }
+}
+
+/*
+ * qexec_hash_tuple_for_cycle () - hash the non pseudo-columns of a CONNECT BY
+ *    tuple
+ *  return: error code
+ *  outptr_list(in):
+ *  tpl(in):
+ *  type_list(in):
+ *  hash(out):
+ */
+static int
+qexec_hash_tuple_for_cycle (OUTPTR_LIST * outptr_list, QFILE_TUPLE tpl, QFILE_TUPLE_VALUE_TYPE_LIST * type_list,
+			    unsigned int *hash)
+{
+  QFILE_TUPLE tuple;
+  OR_BUF buf;
+  DB_VALUE dbval;
+  TP_DOMAIN *domp;
+  unsigned int h = 0;
+  int length, i;
+
+  tuple = tpl + QFILE_TUPLE_LENGTH_SIZE;
+
+  for (i = 0; i < outptr_list->valptr_cnt - PCOL_FIRST_TUPLE_OFFSET; i++)
+    {
+      domp = type_list->domp[i];
+      length = QFILE_GET_TUPLE_VALUE_LENGTH (tuple);
+
+      if (qexec_is_cycle_hashable_type (TP_DOMAIN_TYPE (domp)))
+	{
+	  /* zero length means NULL */
+	  h *= 31;
+	  if (length != 0)
+	    {
+	      or_init (&buf, (char *) tuple + QFILE_TUPLE_VALUE_HEADER_SIZE, length);
+	      if (domp->type->data_readval (&buf, &dbval, domp, -1, false, NULL, 0) != NO_ERROR)
+		{
+		  return ER_FAILED;
+		}
+
+	      h += mht_get_hash_number (UINT_MAX, &dbval);
+
+	      if (DB_NEED_CLEAR (&dbval))
+		{
+		  pr_clear_value (&dbval);
+		}
+	    }
+	}
+
+      tuple += QFILE_TUPLE_VALUE_HEADER_SIZE + length;
+    }
+
+  *hash = h;
+
+  return NO_ERROR;
+}
+
+/*
+ * qexec_hash_valptr_for_cycle () - hash the tuple described by outptr_list
+ *    the same way qexec_hash_tuple_for_cycle hashes list file tuples
+ *  return: false if the values do not match the list domains and cannot be
+ *          hashed
+ *  outptr_list(in):
+ *  type_list(in):
+ *  hash(out):
+ */
+static bool
+qexec_hash_valptr_for_cycle (OUTPTR_LIST * outptr_list, QFILE_TUPLE_VALUE_TYPE_LIST * type_list, unsigned int *hash)
+{
+  REGU_VARIABLE_LIST regulist;
+  DB_VALUE *dbvalp;
+  TP_DOMAIN *domp;
+  DB_TYPE type;
+  unsigned int h = 0;
+  int i;
+
+  for (regulist = outptr_list->valptrp, i = 0; i < outptr_list->valptr_cnt - PCOL_FIRST_TUPLE_OFFSET; i++)
+    {
+      if (regulist == NULL)
+	{
+	  return false;
+	}
+
+      domp = type_list->domp[i];
+      type = TP_DOMAIN_TYPE (domp);
+      dbvalp = regulist->value.value.dbvalptr;
+      regulist = regulist->next;
+
+      if (!qexec_is_cycle_hashable_type (type))
+	{
+	  continue;
+	}
+
+      h *= 31;
+      if (DB_IS_NULL (dbvalp))
+	{
+	  continue;
+	}
+
+      /* the value is compared using the list domain; it must hash like the values read with that domain */
+      if (DB_VALUE_DOMAIN_TYPE (dbvalp) != type
+	  || (TP_IS_CHAR_TYPE (type) && db_get_string_collation (dbvalp) != domp->collation_id))
+	{
+	  return false;
+	}
+
+      h += mht_get_hash_number (UINT_MAX, dbvalp);
+    }
+
+  *hash = h;
+
+  return true;
+}
+
+/*
+ * qexec_compare_cycle_hash () - qsort/bsearch compare function for ancestor
+ *    hashes
+ *  return: -1, 0 or 1
+ *  a(in):
+ *  b(in):
+ */
+static int
+qexec_compare_cycle_hash (const void *a, const void *b)
+{
+  unsigned int ha = *(const unsigned int *) a;
+  unsigned int hb = *(const unsigned int *) b;
+
+  return (ha < hb) ? -1 : ((ha > hb) ? 1 : 0);
+}
+
+/*
+ * qexec_build_connect_by_ancestors () - collect the hashes of tpl and of all
+ *    its ancestors
+ *  return: error code
+ *  outptr_list(in):
+ *  tpl(in): parent tuple
+ *  type_list(in):
+ *  list_id_p(in): output list file holding the ancestors
+ *  ancestors(in/out):
+ *
+ *  Note: The ancestor chain is walked once per parent, the same way
+ *        qexec_check_for_cycle walks it. Each child of the parent is then
+ *        checked against the sorted hashes and the chain is walked again only
+ *        for the children whose hash is found.
+ */
+static int
+qexec_build_connect_by_ancestors (THREAD_ENTRY * thread_p, OUTPTR_LIST * outptr_list, QFILE_TUPLE tpl,
+				  QFILE_TUPLE_VALUE_TYPE_LIST * type_list, QFILE_LIST_ID * list_id_p,
+				  CONNECT_BY_ANCESTORS * ancestors)
+{
+  DB_VALUE p_pos_dbval;
+  QFILE_LIST_SCAN_ID s_id;
+  QFILE_TUPLE_RECORD tuple_rec = { (QFILE_TUPLE) NULL, 0 };
+  const QFILE_TUPLE_POSITION *bitval = NULL;
+  QFILE_TUPLE_POSITION p_pos;
+  unsigned int *new_hashes;
+  int length, new_capacity;
+
+  ancestors->count = 0;
 
   if (qfile_open_list_scan (list_id_p, &s_id) != NO_ERROR)
     {
       return ER_FAILED;
     }
 
-  /* we start with tpl itself */
   tuple_rec.tpl = tpl;
 
   do
     {
-      if (qexec_compare_valptr_with_tuple (outptr_list, tuple_rec.tpl, type_list, iscycle) != NO_ERROR)
+      if (ancestors->count == ancestors->capacity)
 	{
-	  qfile_close_scan (thread_p, &s_id);
-	  return ER_FAILED;
+	  new_capacity = (ancestors->capacity == 0) ? 32 : ancestors->capacity * 2;
+	  new_hashes =
+	    (unsigned int *) db_private_realloc (thread_p, ancestors->hashes, new_capacity * sizeof (unsigned int));
+	  if (new_hashes == NULL)
+	    {
+	      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1,
+		      (size_t) (new_capacity * sizeof (unsigned int)));
+	      qfile_close_scan (thread_p, &s_id);
+	      return ER_OUT_OF_VIRTUAL_MEMORY;
+	    }
+	  ancestors->hashes = new_hashes;
+	  ancestors->capacity = new_capacity;
 	}
 
-      if (*iscycle)
+      if (qexec_hash_tuple_for_cycle (outptr_list, tuple_rec.tpl, type_list, &ancestors->hashes[ancestors->count]) !=
+	  NO_ERROR)
 	{
-	  break;
+	  qfile_close_scan (thread_p, &s_id);
+	  return ER_FAILED;
 	}
+      ancestors->count++;
 
       /* get the parent node */
       if (qexec_get_tuple_column_value (tuple_rec.tpl,
@@ -16437,104 +17533,8 @@ qexec_check_for_cycle (THREAD_ENTRY * thread_p, OUTPTR_LIST * outptr_list, QFILE
 
   qfile_close_scan (thread_p, &s_id);
 
-  return NO_ERROR;
-
-}
-
-/*
- * qexec_compare_valptr_with_tuple () - compare the tuple described by
- *    outptr_list to see if it is equal to tpl; ignore pseudo-columns
- *  return:
- *  outptr_list(in):
- *  tpl(in):
- *  type_list(in):
- *  are_equal(out):
- */
-static int
-qexec_compare_valptr_with_tuple (OUTPTR_LIST * outptr_list, QFILE_TUPLE tpl, QFILE_TUPLE_VALUE_TYPE_LIST * type_list,
-				 int *are_equal)
-{
-  REGU_VARIABLE_LIST regulist;
-  QFILE_TUPLE tuple;
-  OR_BUF buf;
-  DB_VALUE dbval1, *dbvalp2;
-  PR_TYPE *pr_type_p;
-  DB_TYPE type;
-  TP_DOMAIN *domp;
-  int length1, length2, equal, i;
-  bool copy = false;
-
-  *are_equal = 1;
-
-  tuple = tpl + QFILE_TUPLE_LENGTH_SIZE;
-  regulist = outptr_list->valptrp;
-  i = 0;
-
-  while (regulist && i < outptr_list->valptr_cnt - PCOL_FIRST_TUPLE_OFFSET)
-    {
-      /* compare regulist->value.value.dbvalptr to the DB_VALUE from tuple */
-
-      dbvalp2 = regulist->value.value.dbvalptr;
-      length2 = (dbvalp2->domain.general_info.is_null != 0) ? 0 : -1;
-
-      domp = type_list->domp[i];
-      type = TP_DOMAIN_TYPE (domp);
-      copy = pr_is_set_type (type);
-      pr_type_p = domp->type;
-
-      length1 = QFILE_GET_TUPLE_VALUE_LENGTH (tuple);
-
-      /* zero length means NULL */
-      if (length1 == 0)
-	{
-	  db_make_null (&dbval1);
-	}
-      else
-	{
-	  or_init (&buf, (char *) tuple + QFILE_TUPLE_VALUE_HEADER_SIZE, length1);
-	  if (pr_type_p->data_readval (&buf, &dbval1, domp, -1, copy, NULL, 0) != NO_ERROR)
-	    {
-	      return ER_FAILED;
-	    }
-	}
-
-      if (length1 == 0 && length2 == 0)
-	{
-	  equal = 1;
-	}
-      else if (length1 == 0)
-	{
-	  equal = 0;
-	}
-      else if (length2 == 0)
-	{
-	  equal = 0;
-	}
-      else
-	{
-	  equal = pr_type_p->cmpval (&dbval1, dbvalp2, 0, 1, NULL, domp->collation_id) == DB_EQ;
-	}
-
-      if (copy || DB_NEED_CLEAR (&dbval1))
-	{
-	  pr_clear_value (&dbval1);
-	}
-
-      if (!equal)
-	{
-	  *are_equal = 0;
-	  break;
-	}
-
-      tuple += QFILE_TUPLE_VALUE_HEADER_SIZE + QFILE_GET_TUPLE_VALUE_LENGTH (tuple);
-      regulist = regulist->next;
-      i++;
-    }
-
-  if (i < outptr_list->valptr_cnt - PCOL_FIRST_TUPLE_OFFSET)
-    {
-      *are_equal = 0;
-    }
+  qsort (ancestors->hashes, ancestors->count, sizeof (unsigned int), qexec_compare_cycle_hash);
+  ancestors->is_built = true;
 
   return NO_ERROR;
 }
@@ -19369,6 +20369,7 @@ qexec_execute_analytic (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE *
   int ls_flag = 0;
   int estimated_pages;
   bool finalized = false;
+  bool is_input_sorted = false;
   int i = 0;
   ANALYTIC_TYPE *func_p = NULL;
 
@@ -19491,9 +20492,23 @@ qexec_execute_analytic (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE *
   analytic_state.key_info.use_original = 1;
   analytic_state.cmp_fn = &qfile_compare_partial_sort_record;
 
-  if (sort_listfile (thread_p, NULL_VOLID, estimated_pages, &qexec_analytic_get_next, &analytic_state,
-		     &qexec_analytic_put_next, &analytic_state, analytic_state.cmp_fn, &analytic_state.key_info,
-		     SORT_DUP, NO_SORT_LIMIT, analytic_state.output_file->tfile_vfid->tde_encrypted) != NO_ERROR)
+  if (qexec_analytic_is_input_sorted (thread_p, &analytic_state, list_id, &is_input_sorted) != NO_ERROR)
+    {
+      GOTO_EXIT_ON_ERROR;
+    }
+
+  if (is_input_sorted)
+    {
+      /* input already arrives in PARTITION BY / ORDER BY order (e.g. from an index scan or from a previous analytic
+       * with a compatible sort); feed it to the group processing as it is */
+      if (qexec_analytic_stream_input (thread_p, &analytic_state) != NO_ERROR)
+	{
+	  GOTO_EXIT_ON_ERROR;
+	}
+    }
+  else if (sort_listfile (thread_p, NULL_VOLID, estimated_pages, &qexec_analytic_get_next, &analytic_state,
+			  &qexec_analytic_put_next, &analytic_state, analytic_state.cmp_fn, &analytic_state.key_info,
+			  SORT_DUP, NO_SORT_LIMIT, analytic_state.output_file->tfile_vfid->tde_encrypted) != NO_ERROR)
     {
       GOTO_EXIT_ON_ERROR;
     }
@@ -20072,6 +21087,200 @@ exit_on_error:
   goto wrapup;
 }
 
+/*
+ * qexec_analytic_alloc_key_recdes () - make sure a sort key record can hold
+ *                                      size bytes
+ *   return: error code or NO_ERROR
+ *   key_rec(in/out): sort key record
+ *   size(in): required size
+ */
+static int
+qexec_analytic_alloc_key_recdes (THREAD_ENTRY * thread_p, RECDES * key_rec, int size)
+{
+  char *data;
+
+  if (key_rec->area_size >= size)
+    {
+      return NO_ERROR;
+    }
+
+  data = (char *) db_private_realloc (thread_p, key_rec->data, size);
+  if (data == NULL)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, (size_t) size);
+      return ER_OUT_OF_VIRTUAL_MEMORY;
+    }
+
+  key_rec->data = data;
+  key_rec->area_size = size;
+
+  return NO_ERROR;
+}
+
+/*
+ * qexec_analytic_is_input_sorted () - check if the input list file is
+ *                                     already in the analytic sort order
+ *   return: error code or NO_ERROR
+ *   analytic_state(in): analytic state
+ *   list_id(in): input list file
+ *   is_sorted(out): true if no tuple sorts before the one preceding it
+ *
+ * Note: The input is read once, comparing the sort keys of consecutive
+ *       tuples with the sort compare function; the scan stops at the first
+ *       tuple out of order, so unordered input costs only a few tuples.
+ */
+static int
+qexec_analytic_is_input_sorted (THREAD_ENTRY * thread_p, ANALYTIC_STATE * analytic_state, QFILE_LIST_ID * list_id,
+				bool * is_sorted)
+{
+  QFILE_LIST_SCAN_ID scan_id;
+  RECDES key_recs[2];
+  SORT_REC *prev_key, *curr_key;
+  SORT_STATUS status;
+  int curr = 0, error = NO_ERROR;
+  bool has_prev = false;
+
+  *is_sorted = true;
+
+  if (analytic_state->key_info.nkeys == 0)
+    {
+      /* no ordering required */
+      return NO_ERROR;
+    }
+
+  key_recs[0].data = key_recs[1].data = NULL;
+  key_recs[0].area_size = key_recs[1].area_size = 0;
+
+  if (qexec_analytic_alloc_key_recdes (thread_p, &key_recs[0], DB_PAGESIZE) != NO_ERROR
+      || qexec_analytic_alloc_key_recdes (thread_p, &key_recs[1], DB_PAGESIZE) != NO_ERROR)
+    {
+      ASSERT_ERROR_AND_SET (error);
+      goto exit;
+    }
+
+  if (qfile_open_list_scan (list_id, &scan_id) != NO_ERROR)
+    {
+      ASSERT_ERROR_AND_SET (error);
+      goto exit;
+    }
+
+  while (true)
+    {
+      status = qfile_make_sort_key (thread_p, &analytic_state->key_info, &key_recs[curr], &scan_id,
+				    &analytic_state->input_tplrec);
+      if (status == SORT_NOMORE_RECS)
+	{
+	  break;
+	}
+      else if (status == SORT_REC_DOESNT_FIT)
+	{
+	  /* the scan was moved back; retry with a larger record */
+	  error = qexec_analytic_alloc_key_recdes (thread_p, &key_recs[curr], key_recs[curr].length);
+	  if (error != NO_ERROR)
+	    {
+	      break;
+	    }
+	  continue;
+	}
+      else if (status != SORT_SUCCESS)
+	{
+	  ASSERT_ERROR_AND_SET (error);
+	  break;
+	}
+
+      if (has_prev)
+	{
+	  prev_key = (SORT_REC *) key_recs[1 - curr].data;
+	  curr_key = (SORT_REC *) key_recs[curr].data;
+	  if ((*analytic_state->cmp_fn) (&prev_key, &curr_key, &analytic_state->key_info) > 0
+	      || analytic_state->key_info.error != NO_ERROR)
+	    {
+	      /* out of order; any compare error is raised again by the sort */
+	      analytic_state->key_info.error = NO_ERROR;
+	      *is_sorted = false;
+	      break;
+	    }
+	}
+
+      has_prev = true;
+      curr = 1 - curr;
+    }
+
+  qfile_close_scan (thread_p, &scan_id);
+
+exit:
+  if (key_recs[0].data != NULL)
+    {
+      db_private_free_and_init (thread_p, key_recs[0].data);
+    }
+  if (key_recs[1].data != NULL)
+    {
+      db_private_free_and_init (thread_p, key_recs[1].data);
+    }
+
+  return error;
+}
+
+/*
+ * qexec_analytic_stream_input () - feed an input list file that is already
+ *                                  in sort order to the group processing
+ *   return: error code or NO_ERROR
+ *   analytic_state(in): analytic state
+ *
+ * Note: This replaces sort_listfile when qexec_analytic_is_input_sorted
+ *       succeeds. The sort keys are built exactly as for sorting and are
+ *       passed one by one to qexec_analytic_put_next.
+ */
+static int
+qexec_analytic_stream_input (THREAD_ENTRY * thread_p, ANALYTIC_STATE * analytic_state)
+{
+  RECDES key_rec;
+  SORT_STATUS status;
+  int error = NO_ERROR;
+
+  key_rec.data = NULL;
+  key_rec.area_size = 0;
+
+  error = qexec_analytic_alloc_key_recdes (thread_p, &key_rec, DB_PAGESIZE);
+  if (error != NO_ERROR)
+    {
+      return error;
+    }
+
+  while (true)
+    {
+      status = qexec_analytic_get_next (thread_p, &key_rec, analytic_state);
+      if (status == SORT_NOMORE_RECS)
+	{
+	  break;
+	}
+      else if (status == SORT_REC_DOESNT_FIT)
+	{
+	  error = qexec_analytic_alloc_key_recdes (thread_p, &key_rec, key_rec.length);
+	  if (error != NO_ERROR)
+	    {
+	      break;
+	    }
+	  continue;
+	}
+      else if (status != SORT_SUCCESS)
+	{
+	  ASSERT_ERROR_AND_SET (error);
+	  break;
+	}
+
+      error = qexec_analytic_put_next (thread_p, &key_rec, analytic_state);
+      if (error != NO_ERROR)
+	{
+	  break;
+	}
+    }
+
+  db_private_free_and_init (thread_p, key_rec.data);
+
+  return error;
+}
+
 /*
  * qexec_analytic_eval_instnum_pred () - evaluate inst_num() predicate
  *   returns: error code or NO_ERROR
@@ -23510,6 +24719,11 @@ qexec_upddel_setup_current_class (THREAD_ENTRY * thread_p, UPDDEL_CLASS_INFO * q
 	      qexec_update_btree_unique_stats_info (thread_p, &internal_class->m_unique_stats,
 						    &internal_class->m_scancache);
 	    }
+	  error = locator_flush_index_insert_buffer (thread_p, &internal_class->m_scancache);
+	  if (error != NO_ERROR)
+	    {
+	      return error;
+	    }
 	  (void) locator_end_force_scan_cache (thread_p, &internal_class->m_scancache);
 	  internal_class->m_inited_scancache = false;
 	}
@@ -24070,6 +25284,8 @@ qexec_setup_topn_proc (THREAD_ENTRY * thread_p, XASL_NODE * xasl, VAL_DESCR * vd
   top_n->heap = heap;
   top_n->sort_items = xasl->orderby_list;
   top_n->values_count = count;
+  top_n->is_partition_ordered = qexec_is_ordered_partition_scan (xasl);
+  top_n->end_partition = false;
 
   xasl->topn_items = top_n;
 
@@ -24092,6 +25308,33 @@ error_return:
   return error;
 }
 
+/*
+ * qexec_is_ordered_partition_scan () - check if the partitions of the scan of a top-n XASL come in the order of its
+ *					sort items
+ * return : true/false
+ * xasl (in) : XASL with orderby_list
+ *
+ * Note: The optimizer sets XASL_ORDERED_PARTITION_SCAN when the index scan of each partition is in the order of
+ *	 ORDER BY. Only a single key range is scanned in index order; key lists and range lists are not sorted in the
+ *	 direction of the scan.
+ */
+static bool
+qexec_is_ordered_partition_scan (XASL_NODE * xasl)
+{
+  ACCESS_SPEC_TYPE *spec = xasl->spec_list;
+
+  if (!XASL_IS_FLAGED (xasl, XASL_ORDERED_PARTITION_SCAN) || xasl->scan_ptr != NULL || xasl->iscan_oid_order)
+    {
+      return false;
+    }
+  if (spec == NULL || spec->next != NULL || spec->access != ACCESS_METHOD_INDEX || spec->indexptr == NULL)
+    {
+      return false;
+    }
+
+  return (spec->indexptr->range_type == R_KEY || spec->indexptr->range_type == R_RANGE);
+}
+
 /*
  * qexec_topn_compare () - comparison function for top-n heap
  * return : comparison result
@@ -24197,8 +25440,9 @@ qexec_topn_cmpval (DB_VALUE * left, DB_VALUE * right, SORT_LIST * sort_spec)
 
 /*
  * qexec_add_tuple_to_topn () - add a new tuple to top-n tuples
- * return : TOPN_SUCCESS if tuple was successfully processed, TOPN_OVERFLOW if
- *	    the new tuple does not fit into memory or TOPN_FAILURE on error
+ * return : TOPN_SUCCESS if tuple was successfully processed, TOPN_REJECTED if
+ *	    the tuple is not in top-n, TOPN_OVERFLOW if the new tuple does not
+ *	    fit into memory or TOPN_FAILURE on error
  * thread_p (in)  :
  * topn_items (in): topn items
  * tpldescr (in)  : new tuple
@@ -24267,13 +25511,13 @@ qexec_add_tuple_to_topn (THREAD_ENTRY * thread_p, TOPN_TUPLES * topn_items, QFIL
       if (res == BH_LT)
 	{
 	  /* skip this tuple */
-	  return TOPN_SUCCESS;
+	  return TOPN_REJECTED;
 	}
       break;
     }
   if (res == BH_EQ)
     {
-      return TOPN_SUCCESS;
+      return TOPN_REJECTED;
     }
 
   /* Test if we can accommodate the new tuple */
@@ -25046,6 +26290,7 @@ qexec_alloc_agg_hash_context (THREAD_ENTRY * thread_p, BUILDLIST_PROC_NODE * pro
   proc->agg_hash_context->tuple_count = 0;
   proc->agg_hash_context->sorted_count = 0;
   proc->agg_hash_context->state = HS_ACCEPT_ALL;
+  proc->agg_hash_context->is_partition_grouped = false;
 
   /* all ok */
   return NO_ERROR;
@@ -27,6 +27,7 @@
 #error Wrong module
 #endif // not server and not SA mode
 
+#include "bloom_filter.h"
 #include "regu_var.hpp"
 
 #define MAKE_TUPLE_POSTION(tuple_pos, simple_pos, scan_id_p) \
@@ -125,6 +126,7 @@ struct hash_list_scan
   HASH_METHOD hash_list_scan_type;	/* IN_MEM, HYBRID or HASH_FILE */
   unsigned int curr_hash_key;	/* current hash key */
   bool need_coerce_type;	/* Are the types of probe and build different? */
+  BLOOM_FILTER *bloom_filter;	/* hash keys of the build side, used as a join filter by the outer scan */
 };
 
 HASH_SCAN_KEY *qdata_alloc_hscan_key (THREAD_ENTRY * thread_p, int val_cnt, bool alloc_vals);
@@ -985,6 +985,9 @@ xqmgr_prepare_query (THREAD_ENTRY * thread_p, COMPILE_CONTEXT * context, xasl_st
       return ER_FAILED;
     }
 
+  context->is_plan_variant_requested = false;
+  context->n_cardinality_feedbacks = 0;
+
   XASL_ID_SET_NULL (stream->xasl_id);
   if (!context->recompile_xasl)
     {
@@ -1004,6 +1007,7 @@ xqmgr_prepare_query (THREAD_ENTRY * thread_p, COMPILE_CONTEXT * context, xasl_st
 	      XASL_ID_COPY (stream->xasl_id, &cache_entry_p->xasl_id);
 	      xcache_unfix (thread_p, cache_entry_p);
 	      context->recompile_xasl = true;
+	      xcache_get_recompile_request (thread_p, &context->sha1, context);
 	      return NO_ERROR;
 	    }
 	  else
@@ -1027,6 +1031,7 @@ xqmgr_prepare_query (THREAD_ENTRY * thread_p, COMPILE_CONTEXT * context, xasl_st
 	      /* We need to force recompile. */
 	      assert (recompile_due_to_threshold == XASL_CACHE_RECOMPILE_PREPARE);
 	      context->recompile_xasl = true;
+	      xcache_get_recompile_request (thread_p, &context->sha1, context);
 	    }
 	  return NO_ERROR;
 	}
@@ -1334,25 +1339,51 @@ xqmgr_execute_query (THREAD_ENTRY * thread_p, const XASL_ID * xasl_id_p, QUERY_I
       thread_trace_off (thread_p);
     }
 
+#if defined (SERVER_MODE)
+  if (dbval_count)
+    {
+      char *ptr;
+
+      assert (data != NULL);
+
+      dbvals_p = (DB_VALUE *) db_private_alloc (thread_p, sizeof (DB_VALUE) * dbval_count);
+      if (dbvals_p == NULL)
+	{
+	  goto exit_on_error;
+	}
+
+      /* unpack DB_VALUEs from the received data */
+      ptr = data;
+      for (i = 0, dbval = dbvals_p; i < dbval_count; i++, dbval++)
+	{
+	  ptr = or_unpack_db_value (ptr, dbval);
+	}
+    }
+#else
+  dbvals_p = (DB_VALUE *) dbval_p;
+#endif
+
+  /* bind values may pick a variant of the plan */
   xasl_cache_entry_p = NULL;
-  if (xcache_find_xasl_id_for_execute (thread_p, xasl_id_p, &xasl_cache_entry_p, &xclone) != NO_ERROR)
+  if (xcache_find_xasl_id_for_execute (thread_p, xasl_id_p, dbval_count, dbvals_p, &xasl_cache_entry_p, &xclone)
+      != NO_ERROR)
     {
       ASSERT_ERROR ();
-      return NULL;
+      goto exit_on_error;
     }
   if (xasl_cache_entry_p == NULL)
     {
       /* XASL cache entry not found. */
       er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_QPROC_INVALID_XASLNODE, 0);
       perfmon_inc_stat (thread_p, PSTAT_PC_NUM_INVALID_XASL_ID);
-      return NULL;
+      goto exit_on_error;
     }
   if (xclone.xasl == NULL || xclone.xasl_buf == NULL)
     {
       assert (false);
       er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_QPROC_INVALID_XASLNODE, 0);
       perfmon_inc_stat (thread_p, PSTAT_PC_NUM_INVALID_XASL_ID);
-      return NULL;
+      goto exit_on_error;
     }
 
   if (ret_cache_entry_p)
@@ -1366,30 +1397,6 @@ xqmgr_execute_query (THREAD_ENTRY * thread_p, const XASL_ID * xasl_id_p, QUERY_I
       thread_p->trigger_involved = true;
     }
 
-#if defined (SERVER_MODE)
-  if (dbval_count)
-    {
-      char *ptr;
-
-      assert (data != NULL);
-
-      dbvals_p = (DB_VALUE *) db_private_alloc (thread_p, sizeof (DB_VALUE) * dbval_count);
-      if (dbvals_p == NULL)
-	{
-	  goto exit_on_error;
-	}
-
-      /* unpack DB_VALUEs from the received data */
-      ptr = data;
-      for (i = 0, dbval = dbvals_p; i < dbval_count; i++, dbval++)
-	{
-	  ptr = or_unpack_db_value (ptr, dbval);
-	}
-    }
-#else
-  dbvals_p = (DB_VALUE *) dbval_p;
-#endif
-
   /* If it is not inhibited from getting the cached result, inspect the list cache (query result cache) and get the
    * list file id(QFILE_LIST_ID) to be returned to the client if it is in there. The list cache will be searched with
    * the XASL cache entry of the target query that is obtained from the XASL_ID, because all results of the query with
@@ -1524,6 +1531,7 @@ xqmgr_execute_query (THREAD_ENTRY * thread_p, const XASL_ID * xasl_id_p, QUERY_I
 
   /* everything is ok, mark that the query is completed */
   qmgr_mark_query_as_completed (query_p);
+  xcache_note_execution (thread_p, xasl_cache_entry_p, list_id_p->tuple_cnt);
 
   /* If it is allowed to cache the query result or if it is required to cache, put the list file id(QFILE_LIST_ID) into
    * the list cache. Provided are the corresponding XASL cache entry to be linked, and the parameters (host variables -
@@ -1609,7 +1617,10 @@ xqmgr_execute_query (THREAD_ENTRY * thread_p, const XASL_ID * xasl_id_p, QUERY_I
 
 end:
 
-  xcache_retire_clone (thread_p, xasl_cache_entry_p, &xclone);
+  if (xclone.xasl != NULL)
+    {
+      xcache_retire_clone (thread_p, xasl_cache_entry_p, &xclone);
+    }
   if (ret_cache_entry_p != NULL && *ret_cache_entry_p != NULL)
     {
       /* The XASL cache entry is output. */
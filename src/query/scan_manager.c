@@ -206,6 +206,7 @@ static SCAN_CODE scan_build_hash_list_scan (THREAD_ENTRY * thread_p, SCAN_ID * s
 static SCAN_CODE scan_next_hash_list_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id);
 static SCAN_CODE scan_hash_probe_next (THREAD_ENTRY * thread_p, SCAN_ID * scan_id, QFILE_TUPLE * tuple);
 static HASH_METHOD check_hash_list_scan (LLIST_SCAN_ID * llsidp, int *val_cnt, int hash_list_scan_type);
+static DB_LOGICAL scan_eval_join_filter (THREAD_ENTRY * thread_p, SCAN_ID * scan_id);
 
 /*
  * scan_init_iss () - initialize index skip scan structure
@@ -2759,6 +2760,7 @@ scan_init_scan_id (SCAN_ID * scan_id, bool mvcc_select_lock_needed, SCAN_OPERATI
   scan_id->val_list = val_list;	/* points to the XASL tree */
   scan_id->vd = vd;		/* set value descriptor pointer */
   scan_id->scan_immediately_stop = false;
+  scan_id->join_filter = NULL;
 }
 
 /*
@@ -3703,6 +3705,20 @@ scan_open_list_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id,
       /* alloc temp key */
       llsidp->hlsid.temp_key = qdata_alloc_hscan_key (thread_p, val_cnt, false);
       llsidp->hlsid.temp_new_key = qdata_alloc_hscan_key (thread_p, val_cnt, true);
+
+      /* the hash keys of an inner join can filter the rows of the outer scan; see scan_set_join_filter () */
+      llsidp->hlsid.bloom_filter = NULL;
+      if (prm_get_bool_value (PRM_ID_JOIN_BLOOM_FILTER)
+	  && (single_fetch == QPROC_NO_SINGLE_INNER || single_fetch == QPROC_SINGLE_INNER))
+	{
+	  llsidp->hlsid.bloom_filter =
+	    bloom_create (thread_p, llsidp->list_id->tuple_cnt, BLOOM_DEFAULT_BITS_PER_ITEM);
+	  if (llsidp->hlsid.bloom_filter == NULL)
+	    {
+	      return S_ERROR;
+	    }
+	}
+
       if (scan_start_scan (thread_p, scan_id) != NO_ERROR)
 	{
 	  return S_ERROR;
@@ -3726,6 +3742,7 @@ scan_open_list_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id,
       llsidp->hlsid.memory.curr_hash_entry = NULL;
       llsidp->hlsid.temp_key = NULL;
       llsidp->hlsid.temp_new_key = NULL;
+      llsidp->hlsid.bloom_filter = NULL;
     }
 
   return NO_ERROR;
@@ -4886,6 +4903,11 @@ scan_close_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id)
 	  qdata_free_hscan_key (thread_p, llsidp->hlsid.temp_new_key, llsidp->hlsid.temp_new_key->val_count);
 	  llsidp->hlsid.temp_new_key = NULL;
 	}
+      if (llsidp->hlsid.bloom_filter != NULL)
+	{
+	  bloom_destroy (thread_p, llsidp->hlsid.bloom_filter);
+	  llsidp->hlsid.bloom_filter = NULL;
+	}
       break;
 
     case S_SHOWSTMT_SCAN:
@@ -5028,6 +5050,7 @@ static SCAN_CODE
 scan_next_scan_local (THREAD_ENTRY * thread_p, SCAN_ID * scan_id)
 {
   SCAN_CODE status;
+  DB_LOGICAL ev_res;
   bool on_trace;
   UINT64 old_fetches = 0, old_ioreads = 0;
   TSC_TICKS start_tick, end_tick;
@@ -5042,6 +5065,7 @@ scan_next_scan_local (THREAD_ENTRY * thread_p, SCAN_ID * scan_id)
       old_ioreads = perfmon_get_from_statistic (thread_p, PSTAT_PB_NUM_IOREADS);
     }
 
+next_item:
   switch (scan_id->type)
     {
     case S_HEAP_SCAN:
@@ -5109,6 +5133,21 @@ scan_next_scan_local (THREAD_ENTRY * thread_p, SCAN_ID * scan_id)
       return S_ERROR;
     }
 
+  if (status == S_SUCCESS && scan_id->join_filter != NULL)
+    {
+      ev_res = scan_eval_join_filter (thread_p, scan_id);
+      if (ev_res == V_ERROR)
+	{
+	  status = S_ERROR;
+	}
+      else if (ev_res == V_FALSE)
+	{
+	  /* the item has no join partner */
+	  scan_id->scan_stats.join_filtered_rows++;
+	  goto next_item;
+	}
+    }
+
   if (on_trace)
     {
       tsc_getticks (&end_tick);
@@ -7727,6 +7766,10 @@ scan_print_stats_json (SCAN_ID * scan_id, json_t * scan_stats)
     case S_LIST_SCAN:
       json_object_set_new (scan, "readrows", json_integer (scan_id->scan_stats.read_rows));
       json_object_set_new (scan, "rows", json_integer (scan_id->scan_stats.qualified_rows));
+      if (scan_id->join_filter != NULL)
+	{
+	  json_object_set_new (scan, "joinfilterrows", json_integer (scan_id->scan_stats.join_filtered_rows));
+	}
 
       if (scan_id->type == S_HEAP_SCAN)
 	{
@@ -7889,6 +7932,10 @@ scan_print_stats_text (FILE * fp, SCAN_ID * scan_id)
     case S_LIST_SCAN:
       fprintf (fp, ", readrows: %llu, rows: %llu)", (unsigned long long int) scan_id->scan_stats.read_rows,
 	       (unsigned long long int) scan_id->scan_stats.qualified_rows);
+      if (scan_id->join_filter != NULL)
+	{
+	  fprintf (fp, " (join filter rows: %llu)", (unsigned long long int) scan_id->scan_stats.join_filtered_rows);
+	}
       break;
 
     case S_INDX_SCAN:
@@ -7937,6 +7984,79 @@ scan_print_stats_text (FILE * fp, SCAN_ID * scan_id)
 }
 #endif
 
+/*
+ * scan_set_join_filter () - push the Bloom filter of an inner hash list scan into the scan of the outer relation
+ *   return: true if the filter was pushed
+ *   probe_scan_id(in/out): scan of the outer relation
+ *   build_scan_id(in): hash list scan of the inner relation
+ *
+ * Note: Each item of the outer scan is checked against the Bloom filter of the hash keys of the inner relation before
+ *       it is returned. Items whose probe key is certainly not in the hash table are skipped, since they cannot be
+ *       joined. The caller must make sure the join is an inner join and that the probe key of the inner scan can be
+ *       evaluated as soon as the outer scan returns an item.
+ */
+bool
+scan_set_join_filter (SCAN_ID * probe_scan_id, SCAN_ID * build_scan_id)
+{
+  HASH_LIST_SCAN *hlsidp;
+
+  if (build_scan_id->type != S_LIST_SCAN || build_scan_id->status == S_CLOSED)
+    {
+      return false;
+    }
+
+  hlsidp = &build_scan_id->s.llsid.hlsid;
+  if (hlsidp->hash_list_scan_type == HASH_METH_NOT_USE || hlsidp->bloom_filter == NULL)
+    {
+      return false;
+    }
+
+  if (probe_scan_id->scan_op_type != S_SELECT)
+    {
+      /* rows of update and delete scans are locked and reevaluated; do not skip them */
+      return false;
+    }
+
+  probe_scan_id->join_filter = hlsidp;
+  return true;
+}
+
+/*
+ * scan_eval_join_filter () - check the current item of a scan against its join filter
+ *   return: V_FALSE if the item certainly has no join partner, V_TRUE if it may have one, V_ERROR on error
+ *   scan_id(in): scan identifier
+ *
+ * Note: The probe key is built in the temporary key of the inner hash list scan. That is safe because the inner scan
+ *       rebuilds it on every probe, and the outer scan is advanced only after the inner scan ended.
+ */
+static DB_LOGICAL
+scan_eval_join_filter (THREAD_ENTRY * thread_p, SCAN_ID * scan_id)
+{
+  HASH_LIST_SCAN *hlsidp = scan_id->join_filter;
+  unsigned int hash_key;
+
+  if (scan_id->qualification != QPROC_QUALIFIED)
+    {
+      return V_TRUE;
+    }
+
+  if (hlsidp->bloom_filter == NULL || hlsidp->temp_key == NULL)
+    {
+      /* the inner hash list scan was closed, or its filter was not built; every item may have a partner */
+      return V_TRUE;
+    }
+
+  if (qdata_build_hscan_key (thread_p, scan_id->vd, hlsidp->probe_regu_list, hlsidp->temp_key) != NO_ERROR)
+    {
+      return V_ERROR;
+    }
+
+  /* same hash as the one used by scan_hash_probe_next () */
+  hash_key = qdata_hash_scan_key (hlsidp->temp_key, UINT_MAX, hlsidp->hash_list_scan_type);
+
+  return bloom_may_contain (hlsidp->bloom_filter, hash_key) ? V_TRUE : V_FALSE;
+}
+
 /*
  * scan_build_hash_list_scan () - build hash table from list
  *   return: SCAN_CODE (S_SUCCESS, S_END, S_ERROR)
@@ -7999,6 +8119,11 @@ scan_build_hash_list_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id)
       /* make hash key */
       hash_key = qdata_hash_scan_key (new_key, UINT_MAX, llsidp->hlsid.hash_list_scan_type);
 
+      if (llsidp->hlsid.bloom_filter != NULL)
+	{
+	  bloom_add (llsidp->hlsid.bloom_filter, hash_key);
+	}
+
       switch (llsidp->hlsid.hash_list_scan_type)
 	{
 	case HASH_METH_IN_MEM:
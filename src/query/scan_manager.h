@@ -327,6 +327,9 @@ struct scan_stats
 
   /* hash list scan */
   struct timeval elapsed_hash_build;
+
+  /* join filter */
+  UINT64 join_filtered_rows;	/* # of rows rejected by the join filter */
 };
 
 typedef struct scan_id_struct SCAN_ID;
@@ -368,6 +371,8 @@ struct scan_id_struct
 
   SCAN_STATS scan_stats;
   bool scan_immediately_stop;
+  HASH_LIST_SCAN *join_filter;	/* hash list scan of the inner relation whose Bloom filter rejects rows of this scan
+				 * that cannot have a join partner; see scan_set_join_filter () */
 };				/* Scan Identifier */
 
 #define SCAN_IS_INDEX_COVERED(iscan_id_p) \
@@ -476,6 +481,7 @@ extern SCAN_CODE scan_reset_scan_block (THREAD_ENTRY * thread_p, SCAN_ID * s_id)
 extern SCAN_CODE scan_next_scan_block (THREAD_ENTRY * thread_p, SCAN_ID * s_id);
 extern void scan_end_scan (THREAD_ENTRY * thread_p, SCAN_ID * s_id);
 extern void scan_close_scan (THREAD_ENTRY * thread_p, SCAN_ID * s_id);
+extern bool scan_set_join_filter (SCAN_ID * probe_scan_id, SCAN_ID * build_scan_id);
 extern SCAN_CODE scan_next_scan (THREAD_ENTRY * thread_p, SCAN_ID * s_id);
 extern SCAN_CODE scan_prev_scan (THREAD_ENTRY * thread_p, SCAN_ID * s_id);
 extern void scan_save_scan_pos (SCAN_ID * s_id, SCAN_POS * scan_pos);
@@ -36,6 +36,7 @@
 #include "dbtype.h"
 #include "error_manager.h"
 #include "query_aggregate.hpp"
+#include "query_evaluator.h"
 #include "xasl.h"
 #include "xasl_aggregate.hpp"
 #include "xasl_analytic.hpp"
@@ -62,6 +63,7 @@ static REGU_VARIABLE *stx_restore_regu_variable (THREAD_ENTRY * thread_p, char *
 static REGU_VARIABLE_LIST stx_restore_regu_variable_list (THREAD_ENTRY * thread_p, char *ptr);
 static REGU_VARLIST_LIST stx_restore_regu_varlist_list (THREAD_ENTRY * thread_p, char *ptr);
 static SORT_LIST *stx_restore_sort_list (THREAD_ENTRY * thread_p, char *ptr);
+static XASL_PLAN_PEEK *stx_restore_plan_peek (THREAD_ENTRY * thread_p, char *ptr);
 static VAL_LIST *stx_restore_val_list (THREAD_ENTRY * thread_p, char *ptr);
 static DB_VALUE *stx_restore_db_value (THREAD_ENTRY * thread_p, char *ptr);
 #if defined(ENABLE_UNUSED_FUNCTION)
@@ -134,6 +136,7 @@ static char *stx_build_analytic_type (THREAD_ENTRY * thread_p, char *tmp, ANALYT
 static char *stx_build_analytic_eval_type (THREAD_ENTRY * thread_p, char *tmp, ANALYTIC_EVAL_TYPE * ptr);
 static char *stx_build_srlist_id (THREAD_ENTRY * thread_p, char *tmp, QFILE_SORTED_LIST_ID * ptr);
 static char *stx_build_sort_list (THREAD_ENTRY * thread_p, char *tmp, SORT_LIST * ptr);
+static char *stx_build_plan_peek (THREAD_ENTRY * thread_p, char *tmp, XASL_PLAN_PEEK * ptr);
 static char *stx_build_connectby_proc (THREAD_ENTRY * thread_p, char *tmp, CONNECTBY_PROC_NODE * ptr);
 
 static REGU_VALUE_LIST *stx_regu_value_list_alloc_and_init (THREAD_ENTRY * thread_p);
@@ -773,6 +776,38 @@ stx_restore_sort_list (THREAD_ENTRY * thread_p, char *ptr)
   return sort_list;
 }
 
+static XASL_PLAN_PEEK *
+stx_restore_plan_peek (THREAD_ENTRY * thread_p, char *ptr)
+{
+  XASL_PLAN_PEEK *plan_peek;
+
+  if (ptr == NULL)
+    {
+      return NULL;
+    }
+
+  plan_peek = (XASL_PLAN_PEEK *) stx_get_struct_visited_ptr (thread_p, ptr);
+  if (plan_peek != NULL)
+    {
+      return plan_peek;
+    }
+
+  plan_peek = (XASL_PLAN_PEEK *) stx_alloc_struct (thread_p, sizeof (*plan_peek));
+  if (plan_peek == NULL)
+    {
+      stx_set_xasl_errcode (thread_p, ER_OUT_OF_VIRTUAL_MEMORY);
+      return NULL;
+    }
+
+  if (stx_mark_struct_visited (thread_p, ptr, plan_peek) == ER_FAILED
+      || stx_build_plan_peek (thread_p, ptr, plan_peek) == NULL)
+    {
+      return NULL;
+    }
+
+  return plan_peek;
+}
+
 static VAL_LIST *
 stx_restore_val_list (THREAD_ENTRY * thread_p, char *ptr)
 {
@@ -1755,6 +1790,7 @@ stx_build_xasl_node (THREAD_ENTRY * thread_p, char *ptr, XASL_NODE * xasl)
   ptr = or_unpack_int (ptr, (int *) &xasl->ordbynum_flag);
 
   xasl->topn_items = NULL;
+  xasl->memo = NULL;
 
   ptr = or_unpack_int (ptr, &offset);
   if (offset == 0)
@@ -1800,6 +1836,20 @@ stx_build_xasl_node (THREAD_ENTRY * thread_p, char *ptr, XASL_NODE * xasl)
 
   ptr = or_unpack_int (ptr, &xasl->is_single_tuple);
 
+  ptr = or_unpack_int (ptr, &offset);
+  if (offset == 0)
+    {
+      xasl->memo_key_list = NULL;
+    }
+  else
+    {
+      xasl->memo_key_list = stx_restore_regu_variable_list (thread_p, &xasl_unpack_info->packed_xasl[offset]);
+      if (xasl->memo_key_list == NULL)
+	{
+	  goto error;
+	}
+    }
+
   ptr = or_unpack_int (ptr, &tmp);
   xasl->option = (QUERY_OPTIONS) tmp;
 
@@ -2200,6 +2250,25 @@ stx_build_xasl_node (THREAD_ENTRY * thread_p, char *ptr, XASL_NODE * xasl)
   ptr = or_unpack_int (ptr, &tmp);
   xasl->iscan_oid_order = (bool) tmp;
 
+  ptr = or_unpack_int (ptr, &tmp);
+  xasl->cardinality = (double) tmp;
+
+  ptr = or_unpack_int (ptr, &xasl->cardinality_key);
+
+  ptr = or_unpack_int (ptr, &offset);
+  if (offset == 0)
+    {
+      xasl->plan_peeks = NULL;
+    }
+  else
+    {
+      xasl->plan_peeks = stx_restore_plan_peek (thread_p, &xasl_unpack_info->packed_xasl[offset]);
+      if (xasl->plan_peeks == NULL)
+	{
+	  goto error;
+	}
+    }
+
   xasl->query_alias = stx_restore_string (thread_p, ptr);
   assert (xasl->query_alias != NULL);
 
@@ -4119,6 +4188,8 @@ stx_build_comp_eval_term (THREAD_ENTRY * thread_p, char *ptr, COMP_EVAL_TERM * c
   ptr = or_unpack_int (ptr, &tmp);
   comp_eval_term->type = (DB_TYPE) tmp;
 
+  eval_bind_comp_eval_term (comp_eval_term);
+
   return ptr;
 }
 
@@ -4425,7 +4496,11 @@ stx_build_access_spec_type (THREAD_ENTRY * thread_p, char *ptr, ACCESS_SPEC_TYPE
   ptr = or_unpack_int (ptr, &access_spec->pruning_type);
   access_spec->parts = NULL;
   access_spec->curent = NULL;
+  access_spec->runtime_pruning = NULL;
+  access_spec->join_spec = NULL;
+  access_spec->join_pruning = NULL;
   access_spec->pruned = false;
+  access_spec->is_outer_values_set = false;
 
   access_spec->clear_value_at_clone_decache = xasl_unpack_info->use_xasl_clone;
   ptr = or_unpack_int (ptr, &offset);
@@ -4444,6 +4519,9 @@ stx_build_access_spec_type (THREAD_ENTRY * thread_p, char *ptr, ACCESS_SPEC_TYPE
 
   access_spec->parts = NULL;
   access_spec->curent = NULL;
+  access_spec->runtime_pruning = NULL;
+  access_spec->join_spec = NULL;
+  access_spec->join_pruning = NULL;
   access_spec->pruned = false;
 
   ptr = or_unpack_int (ptr, &val);
@@ -6095,6 +6173,49 @@ stx_build_sort_list (THREAD_ENTRY * thread_p, char *ptr, SORT_LIST * sort_list)
   return ptr;
 }
 
+static char *
+stx_build_plan_peek (THREAD_ENTRY * thread_p, char *ptr, XASL_PLAN_PEEK * plan_peek)
+{
+  int offset;
+  XASL_UNPACK_INFO *xasl_unpack_info = get_xasl_unpack_info_ptr (thread_p);
+
+  ptr = or_unpack_int (ptr, &offset);
+  if (offset == 0)
+    {
+      plan_peek->next = NULL;
+    }
+  else
+    {
+      plan_peek->next = stx_restore_plan_peek (thread_p, &xasl_unpack_info->packed_xasl[offset]);
+      if (plan_peek->next == NULL)
+	{
+	  stx_set_xasl_errcode (thread_p, ER_OUT_OF_VIRTUAL_MEMORY);
+	  return NULL;
+	}
+    }
+
+  ptr = or_unpack_int (ptr, &offset);
+  if (offset == 0)
+    {
+      plan_peek->value = NULL;
+    }
+  else
+    {
+      plan_peek->value = stx_restore_db_value (thread_p, &xasl_unpack_info->packed_xasl[offset]);
+      if (plan_peek->value == NULL)
+	{
+	  stx_set_xasl_errcode (thread_p, ER_OUT_OF_VIRTUAL_MEMORY);
+	  return NULL;
+	}
+    }
+
+  ptr = or_unpack_int (ptr, &plan_peek->host_var_index);
+  ptr = or_unpack_int (ptr, &plan_peek->position);
+  ptr = or_unpack_int (ptr, &plan_peek->range);
+
+  return ptr;
+}
+
 static char *
 stx_build_connectby_proc (THREAD_ENTRY * thread_p, char *ptr, CONNECTBY_PROC_NODE * stx_connectby_proc)
 {
@@ -31,6 +31,7 @@
 #include "access_spec.hpp"
 #include "memory_hash.h"
 #include "method_def.hpp"
+#include "porting_inline.hpp"
 #include "query_list.h"
 #include "regu_var.hpp"
 #include "storage_common.h"
@@ -67,9 +68,11 @@ typedef struct xasl_node_header XASL_NODE_HEADER;
 struct xasl_node_header
 {
   int xasl_flag;		/* query flags (e.g, multi range optimization) */
+  int plan_variant;		/* selectivity ranges of bind values the plan is compiled for; 0 for generic plan */
 };
 
-#define XASL_NODE_HEADER_SIZE OR_INT_SIZE	/* xasl_flag */
+#define XASL_NODE_HEADER_SIZE (OR_INT_SIZE	/* xasl_flag */ \
+			       + OR_INT_SIZE)	/* plan_variant */
 
 #define OR_PACK_XASL_NODE_HEADER(PTR, X) \
   do \
@@ -80,6 +83,7 @@ struct xasl_node_header
         } \
       ASSERT_ALIGN ((PTR), INT_ALIGNMENT); \
       (PTR) = or_pack_int ((PTR), (X)->xasl_flag); \
+      (PTR) = or_pack_int ((PTR), (X)->plan_variant); \
     } \
   while (0)
 
@@ -92,6 +96,7 @@ struct xasl_node_header
         } \
       ASSERT_ALIGN ((PTR), INT_ALIGNMENT); \
       (PTR) = or_unpack_int ((PTR), &(X)->xasl_flag); \
+      (PTR) = or_unpack_int ((PTR), &(X)->plan_variant); \
     } \
   while (0)
 
@@ -155,6 +160,8 @@ typedef struct xasl_stat XASL_STATS;
 typedef struct topn_tuple TOPN_TUPLE;
 typedef struct topn_tuples TOPN_TUPLES;
 
+typedef struct subquery_memo SUBQUERY_MEMO;
+
 // *INDENT-OFF*
 namespace cubquery
 {
@@ -164,6 +171,9 @@ using AGGREGATE_HASH_CONTEXT = cubquery::aggregate_hash_context;
 // *INDENT-ON*
 
 typedef struct partition_spec_node PARTITION_SPEC_TYPE;
+
+// forward definition
+struct pruning_context;
 #endif /* defined (SERVER_MODE) || defined (SA_MODE) */
 
 /************************************************************************/
@@ -225,6 +235,49 @@ struct selupd_list
   int wait_msecs;		/* lock timeout in milliseconds */
 };
 
+/* Plan peeks: most common values of an attribute compared with a bind value whose selectivity falls in another range
+ * than the selectivity of the other values of the attribute. The plan variant of a query identifies, for each peeked
+ * bind value, the range of the value it equals (or none); each variant is cached as its own XASL cache entry. */
+#define XASL_PLAN_MAX_PEEKS 3	/* bind values peeked per query */
+#define XASL_PLAN_PEEK_RANGES 4	/* selectivity ranges of peeked values */
+
+typedef struct xasl_plan_peek XASL_PLAN_PEEK;
+struct xasl_plan_peek
+{
+  XASL_PLAN_PEEK *next;		/* Next peeked value */
+  DB_VALUE *value;		/* most common value of attribute */
+  int host_var_index;		/* index of compared bind value */
+  int position;			/* position of bind value in plan variant; less than XASL_PLAN_MAX_PEEKS */
+  int range;			/* selectivity range of value; less than XASL_PLAN_PEEK_RANGES */
+};
+
+STATIC_INLINE int xasl_plan_variant_digit (int position, int range) __attribute__ ((ALWAYS_INLINE));
+
+/*
+ * xasl_plan_variant_digit () - Get the part of the plan variant for a bind value equal to a peeked value
+ *   return: digit at the position of the bind value
+ *   position(in): position of the bind value; less than XASL_PLAN_MAX_PEEKS
+ *   range(in): selectivity range of the peeked value; less than XASL_PLAN_PEEK_RANGES
+ *
+ * Note: The plan variant has one digit of base XASL_PLAN_PEEK_RANGES + 1 per peeked bind value; zero is a bind value
+ *	 equal to no peeked value. The optimizer compiling the variant and the XASL cache selecting it must agree.
+ */
+STATIC_INLINE int
+xasl_plan_variant_digit (int position, int range)
+{
+  int digit = range + 1;
+  int i;
+
+  assert (position >= 0 && position < XASL_PLAN_MAX_PEEKS);
+  assert (range >= 0 && range < XASL_PLAN_PEEK_RANGES);
+
+  for (i = 0; i < position; i++)
+    {
+      digit *= XASL_PLAN_PEEK_RANGES + 1;
+    }
+  return digit;
+}
+
 /*update/delete class info structure */
 typedef struct upddel_class_info UPDDEL_CLASS_INFO;
 struct upddel_class_info
@@ -494,6 +547,7 @@ struct cte_proc_node
 #define XASL_NO_FIXED_SCAN	      0x4000	/* disable fixed scan for this proc */
 #define XASL_NEED_SINGLE_TUPLE_SCAN   0x8000	/* for exists operation */
 #define XASL_INCLUDES_TDE_CLASS	      0x10000	/* is any tde class related */
+#define XASL_ORDERED_PARTITION_SCAN   0x20000	/* partitions are scanned in the order of orderby_list */
 
 #define XASL_IS_FLAGED(x, f)        (((x)->flag & (int) (f)) != 0)
 #define XASL_SET_FLAG(x, f)         (x)->flag |= (int) (f)
@@ -562,6 +616,11 @@ struct cte_proc_node
 
 #define XASL_ID_IS_NULL(X) (((XASL_ID *) (X) != NULL) && (X)->time_stored.sec == 0)
 
+/* plan variants are cached under the SHA-1 of query mixed with the variant; mixing again restores the SHA-1 of query,
+ * and the generic plan (variant 0) is cached under the SHA-1 of query */
+#define XASL_PLAN_VARIANT_MIX_SHA1(sha1, variant) \
+  ((sha1)->h[4] ^= (INT32) ((unsigned int) (variant) * 0x9e3779b9U))
+
 #define XASL_ID_COPY(X1, X2) \
   do \
     { \
@@ -929,6 +988,8 @@ struct topn_tuples
   int values_count;		/* number of values in a tuple */
   UINT64 total_size;		/* size in bytes of stored tuples */
   UINT64 max_size;		/* maximum size which tuples may occupy */
+  bool is_partition_ordered;	/* the rows of each scanned partition come in the order of sort_items */
+  bool end_partition;		/* the rows left in the scanned partition cannot be in top-n */
 };
 
 struct topn_tuple
@@ -942,6 +1003,7 @@ struct partition_spec_node
   OID oid;			/* class oid */
   HFID hfid;			/* class hfid */
   BTID btid;			/* index id */
+  int position;			/* position of partition in the partitions of root class */
   PARTITION_SPEC_TYPE *next;	/* next partition */
 };
 #endif /* defined (SERVER_MODE) || defined (SA_MODE) */
@@ -965,9 +1027,13 @@ struct access_spec_node
   SCAN_ID s_id;			/* scan identifier */
   PARTITION_SPEC_TYPE *parts;	/* partitions of the current spec */
   PARTITION_SPEC_TYPE *curent;	/* current partition */
+  pruning_context *runtime_pruning;	/* pruning context kept to skip partitions for values of outer scans */
+  ACCESS_SPEC_TYPE *join_spec;	/* outer spec partitioned the same way on the join key */
+  pruning_context *join_pruning;	/* pruning context of join_spec */
   bool grouped_scan;		/* grouped or regular scan? it is never true!!! */
   bool fixed_scan;		/* scan pages are kept fixed? */
   bool pruned;			/* true if partition pruning has been performed */
+  bool is_outer_values_set;	/* true if values of outer scans and subqueries are set when the scan is opened */
   bool clear_value_at_clone_decache;	/* true, if need to clear s_dbval at clone decache */
 #endif				/* #if defined (SERVER_MODE) || defined (SA_MODE) */
 };
@@ -989,6 +1055,7 @@ struct xasl_node
   VAL_LIST *single_tuple;	/* single tuple result */
 
   int is_single_tuple;		/* single tuple subquery? */
+  REGU_VARIABLE_LIST memo_key_list;	/* correlated values the result depends on; NULL if it cannot be memoized */
 
   QUERY_OPTIONS option;		/* UNIQUE option */
   OUTPTR_LIST *outptr_list;	/* output pointer list */
@@ -1056,10 +1123,12 @@ struct xasl_node
   const char *query_alias;
   int dbval_cnt;		/* number of host variables in this XASL */
   bool iscan_oid_order;
+  double cardinality;		/* estimated cardinality of result; 0 if unknown */
+  int cardinality_key;		/* joined nodes whose cardinality is estimated; see qo_get_cardinality_key () */
+  XASL_PLAN_PEEK *plan_peeks;	/* bind values whose selectivity changes the plan; top node only */
 
 #if defined (CS_MODE) || defined (SA_MODE)
   int projected_size;		/* # of bytes per result tuple */
-  double cardinality;		/* estimated cardinality of result */
 #endif
 
 #if defined (SERVER_MODE) || defined (SA_MODE)
@@ -1068,6 +1137,7 @@ struct xasl_node
   XASL_STATS xasl_stats;
 
   TOPN_TUPLES *topn_items;	/* top-n tuples for orderby limit */
+  SUBQUERY_MEMO *memo;		/* single tuple results memoized on memo_key_list */
 
   XASL_STATUS status;		/* current status */
 
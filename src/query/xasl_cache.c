@@ -25,6 +25,7 @@
 #include "xasl_cache.h"
 
 #include "binaryheap.h"
+#include "btree.h"
 #include "compile_context.h"
 #include "config.h"
 #include "system_parameter.h"
@@ -203,6 +204,9 @@ static LF_ENTRY_DESCRIPTOR xcache_Entry_descriptor = {
   (((class_pages) < 100 && (((heap_pages) * 2 < (class_pages)) || ((heap_pages) > (class_pages) * 2))) \
    || ((heap_pages) < (class_pages) * 0.8f) || ((heap_pages) > (class_pages) * 1.2f))
 
+/* Plan variants */
+#define XCACHE_VARIANT_REQUEST_TIMEDIFF_IN_SEC	10	/* longer than a client takes to recompile and retry */
+
 /* Logging macro's */
 #define xcache_check_logging() (xcache_Log = prm_get_bool_value (PRM_ID_XASL_CACHE_LOGGING))
 #define xcache_log(...) if (xcache_Log) _er_log_debug (ARG_FILE_LINE, "XASL CACHE: " __VA_ARGS__)
@@ -269,6 +273,11 @@ static void xcache_invalidate_entries (THREAD_ENTRY * thread_p,
 				       bool (*invalidate_check) (XASL_CACHE_ENTRY *, const OID *), const OID * arg);
 static bool xcache_entry_is_related_to_oid (XASL_CACHE_ENTRY * xcache_entry, const OID * related_to_oid);
 static XCACHE_CLEANUP_REASON xcache_need_cleanup (void);
+static int xcache_find_xasl_id_and_clone (THREAD_ENTRY * thread_p, const XASL_ID * xid,
+					  XASL_CACHE_ENTRY ** xcache_entry, XASL_CLONE * xclone);
+static int xcache_find_plan_variant (THREAD_ENTRY * thread_p, int dbval_count, const DB_VALUE * dbvals,
+				     XASL_CACHE_ENTRY ** xcache_entry, XASL_CLONE * xclone);
+static void xcache_note_plan_variant (THREAD_ENTRY * thread_p, XASL_CACHE_ENTRY * xcache_entry, bool is_new);
 
 /*
  * xcache_initialize () - Initialize XASL cache.
@@ -879,12 +888,47 @@ xcache_find_sha1 (THREAD_ENTRY * thread_p, const SHA1Hash * sha1, const XASL_CAC
  * return	      : NO_ERROR.
  * thread_p (in)      : Thread entry.
  * xid (in)	      : XASL_ID.
+ * dbval_count (in)   : Number of bind values.
+ * dbvals (in)	      : Bind values.
  * xcache_entry (out) : XASL cache entry if found.
  * xclone (out)	      : XASL_CLONE (obtained from cache or loaded).
+ *
+ * Note: If the plan lists bind values whose selectivity changes the plan, the entry of the plan variant for the
+ *	 selectivity ranges of the bound values is output instead; see xcache_find_plan_variant ().
  */
 int
-xcache_find_xasl_id_for_execute (THREAD_ENTRY * thread_p, const XASL_ID * xid, XASL_CACHE_ENTRY ** xcache_entry,
-				 XASL_CLONE * xclone)
+xcache_find_xasl_id_for_execute (THREAD_ENTRY * thread_p, const XASL_ID * xid, int dbval_count,
+				 const DB_VALUE * dbvals, XASL_CACHE_ENTRY ** xcache_entry, XASL_CLONE * xclone)
+{
+  int error_code = NO_ERROR;
+
+  error_code = xcache_find_xasl_id_and_clone (thread_p, xid, xcache_entry, xclone);
+  if (error_code != NO_ERROR || *xcache_entry == NULL)
+    {
+      return error_code;
+    }
+
+  if (dbval_count > 0 && xclone->xasl->plan_peeks != NULL
+      && prm_get_integer_value (PRM_ID_XASL_CACHE_MAX_VARIANTS) > 0)
+    {
+      error_code = xcache_find_plan_variant (thread_p, dbval_count, dbvals, xcache_entry, xclone);
+    }
+
+  return error_code;
+}
+
+/*
+ * xcache_find_xasl_id_and_clone () - Find XASL cache entry by XASL_ID and get a clone of its XASL.
+ *
+ * return	      : NO_ERROR.
+ * thread_p (in)      : Thread entry.
+ * xid (in)	      : XASL_ID.
+ * xcache_entry (out) : XASL cache entry if found.
+ * xclone (out)	      : XASL_CLONE (obtained from cache or loaded).
+ */
+static int
+xcache_find_xasl_id_and_clone (THREAD_ENTRY * thread_p, const XASL_ID * xid, XASL_CACHE_ENTRY ** xcache_entry,
+			       XASL_CLONE * xclone)
 {
   int error_code = NO_ERROR;
   HL_HEAPID save_heapid = 0;
@@ -1069,6 +1113,223 @@ xcache_find_xasl_id_for_execute (THREAD_ENTRY * thread_p, const XASL_ID * xid, X
   return NO_ERROR;
 }
 
+/*
+ * xcache_get_plan_variant () - Get the plan variant for the selectivity ranges of bind values.
+ *
+ * return	    : Plan variant; 0 if no bind value equals a value listed by the plan.
+ * plan_peeks (in)  : Values listed by the plan.
+ * dbval_count (in) : Number of bind values.
+ * dbvals (in)	    : Bind values.
+ */
+int
+xcache_get_plan_variant (const XASL_PLAN_PEEK * plan_peeks, int dbval_count, const DB_VALUE * dbvals)
+{
+  const XASL_PLAN_PEEK *peek;
+  bool is_matched[XASL_PLAN_MAX_PEEKS] = { false };
+  int variant = 0;
+
+  for (peek = plan_peeks; peek != NULL; peek = peek->next)
+    {
+      if (peek->position < 0 || peek->position >= XASL_PLAN_MAX_PEEKS
+	  || peek->host_var_index < 0 || peek->host_var_index >= dbval_count)
+	{
+	  assert (false);
+	  continue;
+	}
+      if (!is_matched[peek->position]
+	  && tp_value_compare (&dbvals[peek->host_var_index], peek->value, 1, 0) == DB_EQ)
+	{
+	  /* one digit for each bind value, as in the plan variant computed by the optimizer */
+	  is_matched[peek->position] = true;
+	  variant += xasl_plan_variant_digit (peek->position, peek->range);
+	}
+    }
+
+  return variant;
+}
+
+/*
+ * xcache_find_plan_variant () - Switch to the plan variant for the selectivity ranges of bind values.
+ *
+ * return		 : NO_ERROR, or ER_QPROC_XASLNODE_RECOMPILE_REQUESTED if the variant should be compiled.
+ * thread_p (in)	 : Thread entry.
+ * dbval_count (in)	 : Number of bind values.
+ * dbvals (in)		 : Bind values.
+ * xcache_entry (in/out) : Found XASL cache entry; replaced by the entry of the variant.
+ * xclone (in/out)	 : Clone of found entry; replaced by a clone of the variant.
+ *
+ * Note: Variants are cached under the SHA-1 of the query mixed with the variant, next to the generic plan. A variant
+ *	 which is not cached yet is requested through the generic plan: it is marked as "request recompile" and the
+ *	 client, which recompiles the query for the bound values, gets the variant. If the variant cannot be requested
+ *	 (too many variants, or requested just before), the found plan is used.
+ */
+static int
+xcache_find_plan_variant (THREAD_ENTRY * thread_p, int dbval_count, const DB_VALUE * dbvals,
+			  XASL_CACHE_ENTRY ** xcache_entry, XASL_CLONE * xclone)
+{
+  XASL_CACHE_ENTRY *entry = *xcache_entry;
+  XASL_CACHE_ENTRY *variant_entry = NULL;
+  XASL_CACHE_ENTRY *generic_entry = NULL;
+  XASL_CLONE variant_clone = XASL_CLONE_INITIALIZER;
+  XASL_ID variant_xid;
+  SHA1Hash sha1;
+  xasl_cache_rt_check_result recompile_due_to_threshold = XASL_CACHE_RECOMPILE_NOT_NEEDED;
+  struct timeval crt_time;
+  INT64 save_secs;
+  bool is_requested = false;
+  int variant;
+  int error_code = NO_ERROR;
+
+  variant = xcache_get_plan_variant (xclone->xasl->plan_peeks, dbval_count, dbvals);
+  if (variant == entry->plan_variant)
+    {
+      return NO_ERROR;
+    }
+
+  sha1 = entry->xasl_id.sha1;
+  XASL_PLAN_VARIANT_MIX_SHA1 (&sha1, entry->plan_variant);
+  XASL_PLAN_VARIANT_MIX_SHA1 (&sha1, variant);
+
+  error_code = xcache_find_sha1 (thread_p, &sha1, XASL_CACHE_SEARCH_FOR_EXECUTE, &variant_entry,
+				 &recompile_due_to_threshold);
+  if (error_code != NO_ERROR)
+    {
+      ASSERT_ERROR ();
+      return error_code;
+    }
+  if (variant_entry != NULL)
+    {
+      XASL_ID_COPY (&variant_xid, &variant_entry->xasl_id);
+      xcache_unfix (thread_p, variant_entry);
+      variant_entry = NULL;
+
+      error_code = xcache_find_xasl_id_and_clone (thread_p, &variant_xid, &variant_entry, &variant_clone);
+      if (error_code != NO_ERROR)
+	{
+	  ASSERT_ERROR ();
+	  return error_code;
+	}
+      if (variant_entry == NULL)
+	{
+	  /* variant was removed meanwhile */
+	  return NO_ERROR;
+	}
+
+      xcache_log ("switch to plan variant %d: \n"
+		  XCACHE_LOG_ENTRY_TEXT ("found entry")
+		  XCACHE_LOG_ENTRY_TEXT ("variant entry")
+		  XCACHE_LOG_TRAN_TEXT,
+		  variant, XCACHE_LOG_ENTRY_ARGS (entry),
+		  XCACHE_LOG_ENTRY_ARGS (variant_entry), XCACHE_LOG_TRAN_ARGS (thread_p));
+
+      xcache_retire_clone (thread_p, entry, xclone);
+      xcache_unfix (thread_p, entry);
+      *xcache_entry = variant_entry;
+      *xclone = variant_clone;
+      return NO_ERROR;
+    }
+
+  /* the variant is not cached, or it must be recompiled; the client prepares the generic plan */
+  if (entry->plan_variant == 0)
+    {
+      generic_entry = entry;
+    }
+  else
+    {
+      sha1 = entry->xasl_id.sha1;
+      XASL_PLAN_VARIANT_MIX_SHA1 (&sha1, entry->plan_variant);
+      error_code = xcache_find_sha1 (thread_p, &sha1, XASL_CACHE_SEARCH_FOR_EXECUTE, &generic_entry, NULL);
+      if (error_code != NO_ERROR)
+	{
+	  ASSERT_ERROR ();
+	  return error_code;
+	}
+      if (generic_entry == NULL)
+	{
+	  /* generic plan was removed; the variant is requested after it is compiled again */
+	  return NO_ERROR;
+	}
+    }
+
+  if (recompile_due_to_threshold == XASL_CACHE_RECOMPILE_EXECUTE
+      || generic_entry->n_plan_variants < prm_get_integer_value (PRM_ID_XASL_CACHE_MAX_VARIANTS))
+    {
+      /* the client retries only once; don't ask it again before it can compile the variant */
+      (void) gettimeofday (&crt_time, NULL);
+      save_secs = generic_entry->time_last_variant_request;
+      if ((INT64) crt_time.tv_sec - save_secs >= XCACHE_VARIANT_REQUEST_TIMEDIFF_IN_SEC
+	  && ATOMIC_CAS_64 (&generic_entry->time_last_variant_request, save_secs, (INT64) crt_time.tv_sec)
+	  && xcache_entry_set_request_recompile_flag (thread_p, generic_entry, true))
+	{
+	  /* the client peeks bind values only if it recompiles for a variant; see xcache_get_recompile_request () */
+	  generic_entry->is_plan_variant_requested = true;
+	  is_requested = true;
+	}
+    }
+
+  if (generic_entry != entry)
+    {
+      xcache_unfix (thread_p, generic_entry);
+    }
+  if (!is_requested)
+    {
+      return NO_ERROR;
+    }
+
+  xcache_log ("request plan variant %d: \n"
+	      XCACHE_LOG_ENTRY_TEXT ("found entry") XCACHE_LOG_TRAN_TEXT,
+	      variant, XCACHE_LOG_ENTRY_ARGS (entry), XCACHE_LOG_TRAN_ARGS (thread_p));
+
+  xcache_retire_clone (thread_p, entry, xclone);
+  xclone->xasl = NULL;
+  xclone->xasl_buf = NULL;
+  xcache_unfix (thread_p, entry);
+  *xcache_entry = NULL;
+
+  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_QPROC_XASLNODE_RECOMPILE_REQUESTED, 0);
+  perfmon_inc_stat (thread_p, PSTAT_PC_NUM_INVALID_XASL_ID);
+  return ER_QPROC_XASLNODE_RECOMPILE_REQUESTED;
+}
+
+/*
+ * xcache_note_plan_variant () - Note a plan variant inserted to XASL cache to its generic plan.
+ *
+ * return	     : Void.
+ * thread_p (in)     : Thread entry.
+ * xcache_entry (in) : XASL cache entry of plan variant.
+ * is_new (in)	     : True if variant was not cached before.
+ */
+static void
+xcache_note_plan_variant (THREAD_ENTRY * thread_p, XASL_CACHE_ENTRY * xcache_entry, bool is_new)
+{
+  XASL_CACHE_ENTRY *generic_entry = NULL;
+  SHA1Hash sha1;
+
+  assert (xcache_entry->plan_variant != 0);
+
+  sha1 = xcache_entry->xasl_id.sha1;
+  XASL_PLAN_VARIANT_MIX_SHA1 (&sha1, xcache_entry->plan_variant);
+  if (xcache_find_sha1 (thread_p, &sha1, XASL_CACHE_SEARCH_FOR_EXECUTE, &generic_entry, NULL) != NO_ERROR
+      || generic_entry == NULL)
+    {
+      return;
+    }
+
+  /* the variant was requested through the generic plan; a generic plan to be recompiled is kept requested */
+  if ((generic_entry->xasl_id.cache_flag & XCACHE_ENTRY_RECOMPILED_REQUESTED) != 0
+      && generic_entry->is_plan_variant_requested)
+    {
+      generic_entry->is_plan_variant_requested = false;
+      xcache_entry_set_request_recompile_flag (thread_p, generic_entry, false);
+    }
+  if (is_new)
+    {
+      ATOMIC_INC_32 (&generic_entry->n_plan_variants, 1);
+    }
+
+  xcache_unfix (thread_p, generic_entry);
+}
+
 /*
  * xcache_unfix () - Unfix XASL cache entry by decrementing fix count in cache flag. If we are last to use entry
  *		     remove it from hash.
@@ -1364,6 +1625,8 @@ xcache_insert (THREAD_ENTRY * thread_p, const compile_context * context, XASL_ST
   struct timeval time_stored;
   size_t sql_hash_text_len = 0, sql_user_text_len = 0, sql_plan_text_len = 0;
   char *strbuf = NULL;
+  XASL_NODE_HEADER xasl_header;
+  bool is_new_entry = false;
 
   assert (xcache_entry != NULL && *xcache_entry == NULL);
   assert (stream != NULL);
@@ -1440,6 +1703,9 @@ xcache_insert (THREAD_ENTRY * thread_p, const compile_context * context, XASL_ST
   (void) gettimeofday (&time_stored, NULL);
   CACHE_TIME_MAKE (&stream->xasl_id->time_stored, &time_stored);
 
+  /* plan variant is kept by XASL node header */
+  qfile_load_xasl_node_header (thread_p, stream->buffer, &xasl_header);
+
 
   /* We need to do a loop here for recompile_xasl case. It will break after the first iteration if recompile_xasl flag
    * is false.
@@ -1475,6 +1741,25 @@ xcache_insert (THREAD_ENTRY * thread_p, const compile_context * context, XASL_ST
       (*xcache_entry)->sql_info.sql_plan_text = sql_plan_text;
       (*xcache_entry)->stream = *stream;
       (*xcache_entry)->time_last_rt_check = (INT64) time_stored.tv_sec;
+      (*xcache_entry)->cardinality_error = 0;
+      if (to_be_recompiled != NULL)
+	{
+	  /* keep the rows found by executions of the recompiled plan for the next recompile */
+	  (*xcache_entry)->n_cardinality_feedbacks = to_be_recompiled->n_cardinality_feedbacks;
+	  memcpy ((*xcache_entry)->cardinality_feedbacks, to_be_recompiled->cardinality_feedbacks,
+		  sizeof ((*xcache_entry)->cardinality_feedbacks));
+	}
+      else
+	{
+	  (*xcache_entry)->n_cardinality_feedbacks = 0;
+	  memset ((*xcache_entry)->cardinality_feedbacks, 0, sizeof ((*xcache_entry)->cardinality_feedbacks));
+	}
+      (*xcache_entry)->plan_variant = xasl_header.plan_variant;
+      (*xcache_entry)->n_plan_variants = 0;
+      (*xcache_entry)->time_last_variant_request = 0;
+      (*xcache_entry)->is_plan_variant_requested = false;
+      (*xcache_entry)->n_executions = 0;
+      (*xcache_entry)->n_result_rows = 0;
       (*xcache_entry)->time_last_used = time_stored;
       (*xcache_entry)->list_ht_no = -1;
 
@@ -1535,6 +1820,7 @@ xcache_insert (THREAD_ENTRY * thread_p, const compile_context * context, XASL_ST
 	    {
 	      /* new entry added */
 	      ATOMIC_INC_32 (&xcache_Entry_count, 1);
+	      is_new_entry = true;
 	    }
 
 	  xcache_log ("successful find or insert: \n"
@@ -1621,6 +1907,11 @@ xcache_insert (THREAD_ENTRY * thread_p, const compile_context * context, XASL_ST
   /* Found or inserted entry. */
   assert (*xcache_entry != NULL);
 
+  if (inserted && (*xcache_entry)->plan_variant != 0)
+    {
+      xcache_note_plan_variant (thread_p, *xcache_entry, is_new_entry);
+    }
+
   if (!inserted)
     {
       /* Free allocated resources. */
@@ -1912,6 +2203,7 @@ xcache_dump (THREAD_ENTRY * thread_p, FILE * fp)
 {
   XASL_CACHE_ENTRY *xcache_entry = NULL;
   int oid_index;
+  int i;
   char *sql_id = NULL;
 
   assert (fp);
@@ -1959,6 +2251,28 @@ xcache_dump (THREAD_ENTRY * thread_p, FILE * fp)
       fprintf (fp, "  cache flags = %08x \n", xcache_entry->xasl_id.cache_flag & XCACHE_ENTRY_FLAGS_MASK);
       fprintf (fp, "  reference count = %lld \n", (long long) ATOMIC_INC_64 (&xcache_entry->ref_count, 0));
       fprintf (fp, "  time second last used = %lld \n", (long long) xcache_entry->time_last_used.tv_sec);
+      if (xcache_entry->cardinality_error > 0)
+	{
+	  fprintf (fp, "  cardinality error = %.0fx \n", xcache_entry->cardinality_error);
+	}
+      for (i = 0; i < MIN (xcache_entry->n_cardinality_feedbacks, COMPILE_MAX_CARDINALITY_FEEDBACKS); i++)
+	{
+	  fprintf (fp, "  cardinality feedback = { key = %d, rows = %d } \n",
+		   xcache_entry->cardinality_feedbacks[i].key, xcache_entry->cardinality_feedbacks[i].rows);
+	}
+      if (xcache_entry->plan_variant != 0)
+	{
+	  fprintf (fp, "  plan variant = %d \n", xcache_entry->plan_variant);
+	}
+      else if (xcache_entry->n_plan_variants > 0)
+	{
+	  fprintf (fp, "  plan variants = %d \n", xcache_entry->n_plan_variants);
+	}
+      if (xcache_entry->n_executions > 0)
+	{
+	  fprintf (fp, "  executions = %lld (%.1f rows on average) \n", (long long) xcache_entry->n_executions,
+		   (double) xcache_entry->n_result_rows / xcache_entry->n_executions);
+	}
       if (xcache_uses_clones ())
 	{
 	  fprintf (fp, "  clone count = %d \n", xcache_entry->n_cache_clones);
@@ -2448,9 +2762,175 @@ xcache_check_recompilation_threshold (THREAD_ENTRY * thread_p, XASL_CACHE_ENTRY
 	}
       catalog_free_class_info_and_init (cls_info_p);
     }
+
+  if (!recompile && xcache_entry->cardinality_error > 0
+      && xcache_entry->cardinality_error >= prm_get_integer_value (PRM_ID_PLAN_RECOMPILE_CARDINALITY_RATIO)
+      && prm_get_integer_value (PRM_ID_PLAN_RECOMPILE_CARDINALITY_RATIO) > 0)
+    {
+      /* the plan was chosen for an intermediate result far smaller or larger than the one found by execution; plan
+       * it again with the rows found, which are given to the optimizer by xcache_get_recompile_request () */
+      xcache_log ("request recompile for cardinality error %.0fx: \n"
+		  XCACHE_LOG_ENTRY_TEXT ("entry") XCACHE_LOG_TRAN_TEXT,
+		  xcache_entry->cardinality_error, XCACHE_LOG_ENTRY_ARGS (xcache_entry),
+		  XCACHE_LOG_TRAN_ARGS (thread_p));
+      if (xcache_entry_set_request_recompile_flag (thread_p, xcache_entry, true))
+	{
+	  recompile = true;
+	}
+    }
+
+  if (recompile)
+    {
+      /* the client recompiles the plan for current statistics, not for a plan variant */
+      xcache_entry->is_plan_variant_requested = false;
+    }
+
   return recompile;
 }
 
+/*
+ * xcache_note_cardinality_error () - Save the rows of an intermediate result whose estimate was wrong to XASL cache
+ *				      entry.
+ *
+ * return	     : Void.
+ * thread_p (in)     : Thread entry.
+ * xcache_entry (in) : XASL cache entry.
+ * error (in)	     : Ratio between rows and estimated rows (always at least 1).
+ * key (in)	     : Joined nodes of the intermediate result (cardinality_key of XASL node).
+ * rows (in)	     : Rows of the intermediate result.
+ *
+ * Note: The entry is checked by xcache_check_recompilation_threshold () and is recompiled if the error is over
+ *	 plan_recompile_cardinality_ratio. The rows are given to the optimizer recompiling the plan by
+ *	 xcache_get_recompile_request ().
+ */
+void
+xcache_note_cardinality_error (THREAD_ENTRY * thread_p, XASL_CACHE_ENTRY * xcache_entry, float error, int key,
+			       INT64 rows)
+{
+  COMPILE_CARDINALITY_FEEDBACK *feedback = NULL;
+  int n_feedbacks;
+  int i;
+
+  if (xcache_entry == NULL || key == 0)
+    {
+      return;
+    }
+
+  /* concurrent executions may overwrite each other; rows found by any of them are good enough to plan again */
+  n_feedbacks = MIN (xcache_entry->n_cardinality_feedbacks, COMPILE_MAX_CARDINALITY_FEEDBACKS);
+  for (i = 0; i < n_feedbacks; i++)
+    {
+      if (xcache_entry->cardinality_feedbacks[i].key == key)
+	{
+	  feedback = &xcache_entry->cardinality_feedbacks[i];
+	  break;
+	}
+    }
+  if (feedback == NULL)
+    {
+      i = ATOMIC_INC_32 (&xcache_entry->n_cardinality_feedbacks, 1) - 1;
+      if (i >= COMPILE_MAX_CARDINALITY_FEEDBACKS)
+	{
+	  /* keep the intermediate results found first */
+	  ATOMIC_INC_32 (&xcache_entry->n_cardinality_feedbacks, -1);
+	  return;
+	}
+      feedback = &xcache_entry->cardinality_feedbacks[i];
+    }
+
+  /* the key is set last; readers skip slots without key */
+  feedback->rows = (int) MIN (rows, (INT64) INT_MAX);
+  feedback->key = key;
+
+  if (error > xcache_entry->cardinality_error)
+    {
+      xcache_entry->cardinality_error = error;
+    }
+
+  xcache_log ("cardinality error %.0fx (key %d, %lld rows): \n"
+	      XCACHE_LOG_ENTRY_TEXT ("entry") XCACHE_LOG_TRAN_TEXT,
+	      error, key, (long long) rows, XCACHE_LOG_ENTRY_ARGS (xcache_entry), XCACHE_LOG_TRAN_ARGS (thread_p));
+}
+
+/*
+ * xcache_get_recompile_request () - Get why the XASL cache entry is recompiled.
+ *
+ * return	 : Void.
+ * thread_p (in) : Thread entry.
+ * sha1 (in)	 : Hash of the query.
+ * context (out) : Compile context.
+ *
+ * Note: The plan is recompiled either for the plan variant of bind values, which the optimizer compiles by peeking
+ *	 the values, or for the rows of intermediate results found by executions, which the optimizer uses instead of
+ *	 its estimates. The rows were found with any bind values, so they are not given for a plan variant.
+ */
+void
+xcache_get_recompile_request (THREAD_ENTRY * thread_p, const SHA1Hash * sha1, compile_context * context)
+{
+  XASL_CACHE_ENTRY *xcache_entry = NULL;
+  XASL_ID lookup_key;
+  int n_feedbacks;
+  int i;
+
+  context->is_plan_variant_requested = false;
+  context->n_cardinality_feedbacks = 0;
+
+  if (!xcache_Enabled)
+    {
+      return;
+    }
+
+  XASL_ID_SET_NULL (&lookup_key);
+  lookup_key.sha1 = *sha1;
+
+  xcache_entry = xcache_Hashmap.find (thread_p, lookup_key);
+  if (xcache_entry == NULL)
+    {
+      return;
+    }
+  xcache_Hashmap.end_tran (thread_p);
+
+  if (xcache_entry->is_plan_variant_requested)
+    {
+      context->is_plan_variant_requested = true;
+      xcache_unfix (thread_p, xcache_entry);
+      return;
+    }
+
+  n_feedbacks = MIN (xcache_entry->n_cardinality_feedbacks, COMPILE_MAX_CARDINALITY_FEEDBACKS);
+  for (i = 0; i < n_feedbacks; i++)
+    {
+      if (xcache_entry->cardinality_feedbacks[i].key != 0)
+	{
+	  context->cardinality_feedbacks[context->n_cardinality_feedbacks++] = xcache_entry->cardinality_feedbacks[i];
+	}
+    }
+
+  xcache_unfix (thread_p, xcache_entry);
+}
+
+/*
+ * xcache_note_execution () - Count an execution of the plan of XASL cache entry.
+ *
+ * return	     : Void.
+ * thread_p (in)     : Thread entry.
+ * xcache_entry (in) : XASL cache entry.
+ * rows (in)	     : Result rows of the execution.
+ *
+ * Note: Each plan variant has its own entry, so the executions are counted by variant.
+ */
+void
+xcache_note_execution (THREAD_ENTRY * thread_p, XASL_CACHE_ENTRY * xcache_entry, INT64 rows)
+{
+  if (xcache_entry == NULL)
+    {
+      return;
+    }
+
+  ATOMIC_INC_64 (&xcache_entry->n_executions, 1);
+  ATOMIC_INC_64 (&xcache_entry->n_result_rows, MAX (rows, 0));
+}
+
 /*
  * xcache_get_entry_count () - Returns the number of xasl cache entries
  *
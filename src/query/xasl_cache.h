@@ -29,10 +29,10 @@
 #error Belongs to server module
 #endif /* !defined (SERVER_MODE) && !defined (SA_MODE) */
 
+#include "compile_context.h"
 #include "xasl.h"
 
 // forward definitions
-struct compile_context;
 struct xasl_unpack_info;
 
 /* Objects related to XASL cache entries. The information includes the object OID, the lock required to use the XASL
@@ -124,6 +124,17 @@ struct xasl_cache_ent
 
   /* RT check */
   INT64 time_last_rt_check;
+  float cardinality_error;	/* largest ratio between rows and estimated rows of an intermediate result */
+  int n_cardinality_feedbacks;	/* intermediate results whose rows were far from the estimate */
+  COMPILE_CARDINALITY_FEEDBACK cardinality_feedbacks[COMPILE_MAX_CARDINALITY_FEEDBACKS];
+
+  /* Plan variants */
+  int plan_variant;		/* selectivity ranges of bind values the plan is compiled for; 0 for generic plan */
+  int n_plan_variants;		/* variants compiled since the generic plan was cached; kept by generic plan */
+  INT64 time_last_variant_request;	/* when a variant was last requested; kept by generic plan */
+  bool is_plan_variant_requested;	/* recompile is requested for a variant; kept by generic plan */
+  INT64 n_executions;		/* executions of the plan which did not reuse a cached result */
+  INT64 n_result_rows;		/* result rows of these executions */
 
   bool initialized;
 
@@ -156,8 +167,9 @@ extern void xcache_finalize (THREAD_ENTRY * thread_p);
 
 extern int xcache_find_sha1 (THREAD_ENTRY * thread_p, const SHA1Hash * sha1, const XASL_CACHE_SEARCH_MODE search_mode,
 			     XASL_CACHE_ENTRY ** xcache_entry, xasl_cache_rt_check_result * rt_check);
-extern int xcache_find_xasl_id_for_execute (THREAD_ENTRY * thread_p, const XASL_ID * xid,
-					    XASL_CACHE_ENTRY ** xcache_entry, XASL_CLONE * xclone);
+extern int xcache_find_xasl_id_for_execute (THREAD_ENTRY * thread_p, const XASL_ID * xid, int dbval_count,
+					    const DB_VALUE * dbvals, XASL_CACHE_ENTRY ** xcache_entry,
+					    XASL_CLONE * xclone);
 extern void xcache_unfix (THREAD_ENTRY * thread_p, XASL_CACHE_ENTRY * xcache_entry);
 extern int xcache_insert (THREAD_ENTRY * thread_p, const compile_context * context, XASL_STREAM * stream,
 			  int n_oid, const OID * class_oids, const int *class_locks,
@@ -173,5 +185,10 @@ extern int xcache_get_entry_count (void);
 extern bool xcache_uses_clones (void);
 
 extern int xcache_invalidate_qcaches (THREAD_ENTRY * thread_p, const OID * oid);
+extern void xcache_note_cardinality_error (THREAD_ENTRY * thread_p, XASL_CACHE_ENTRY * xcache_entry, float error,
+					   int key, INT64 rows);
+extern void xcache_get_recompile_request (THREAD_ENTRY * thread_p, const SHA1Hash * sha1, compile_context * context);
+extern void xcache_note_execution (THREAD_ENTRY * thread_p, XASL_CACHE_ENTRY * xcache_entry, INT64 rows);
+extern int xcache_get_plan_variant (const XASL_PLAN_PEEK * plan_peeks, int dbval_count, const DB_VALUE * dbvals);
 
 #endif /* _XASL_CACHE_H_ */
@@ -89,6 +89,7 @@ static int xts_save_regu_variable (const REGU_VARIABLE * ptr);
 static int xts_save_regu_variable_list (const REGU_VARIABLE_LIST ptr);
 static int xts_save_regu_varlist_list (const REGU_VARLIST_LIST ptr);
 static int xts_save_sort_list (const SORT_LIST * ptr);
+static int xts_save_plan_peek (const XASL_PLAN_PEEK * ptr);
 static int xts_save_string (const char *str);
 static int xts_save_val_list (const VAL_LIST * ptr);
 static int xts_save_db_value (const DB_VALUE * ptr);
@@ -184,6 +185,7 @@ static char *xts_process_analytic_eval_type (char *ptr, const ANALYTIC_EVAL_TYPE
 static char *xts_process_function_type (char *ptr, const FUNCTION_TYPE * function);
 static char *xts_process_srlist_id (char *ptr, const QFILE_SORTED_LIST_ID * sort_list_id);
 static char *xts_process_sort_list (char *ptr, const SORT_LIST * sort_list);
+static char *xts_process_plan_peek (char *ptr, const XASL_PLAN_PEEK * plan_peek);
 static char *xts_process_method_sig_list (char *ptr, const METHOD_SIG_LIST * method_sig_list);
 static char *xts_process_method_sig (char *ptr, const METHOD_SIG * method_sig, int size);
 static char *xts_process_connectby_proc (char *ptr, const CONNECTBY_PROC_NODE * connectby_proc);
@@ -242,6 +244,7 @@ static int xts_sizeof_analytic_type (const ANALYTIC_TYPE * ptr);
 static int xts_sizeof_analytic_eval_type (const ANALYTIC_EVAL_TYPE * ptr);
 static int xts_sizeof_srlist_id (const QFILE_SORTED_LIST_ID * ptr);
 static int xts_sizeof_sort_list (const SORT_LIST * ptr);
+static int xts_sizeof_plan_peek (const XASL_PLAN_PEEK * ptr);
 static int xts_sizeof_method_sig_list (const METHOD_SIG_LIST * ptr);
 static int xts_sizeof_method_sig (const METHOD_SIG * ptr);
 static int xts_sizeof_connectby_proc (const CONNECTBY_PROC_NODE * ptr);
@@ -1386,6 +1389,74 @@ end:
   return offset;
 }
 
+static int
+xts_save_plan_peek (const XASL_PLAN_PEEK * plan_peek)
+{
+  int offset;
+  int size;
+  OR_ALIGNED_BUF (sizeof (*plan_peek) * 2) a_buf;
+  char *buf = OR_ALIGNED_BUF_START (a_buf);
+  char *buf_p = NULL;
+  bool is_buf_alloced = false;
+
+  if (plan_peek == NULL)
+    {
+      return NO_ERROR;
+    }
+
+  offset = xts_get_offset_visited_ptr (plan_peek);
+  if (offset != ER_FAILED)
+    {
+      return offset;
+    }
+
+  size = xts_sizeof_plan_peek (plan_peek);
+  if (size == ER_FAILED)
+    {
+      return ER_FAILED;
+    }
+
+  offset = xts_reserve_location_in_stream (size);
+  if (offset == ER_FAILED || xts_mark_ptr_visited (plan_peek, offset) == ER_FAILED)
+    {
+      return ER_FAILED;
+    }
+
+  if (size <= (int) OR_ALIGNED_BUF_SIZE (a_buf))
+    {
+      buf_p = buf;
+    }
+  else
+    {
+      buf_p = (char *) malloc (size);
+      if (buf_p == NULL)
+	{
+	  xts_Xasl_errcode = ER_OUT_OF_VIRTUAL_MEMORY;
+	  return ER_FAILED;
+	}
+
+      is_buf_alloced = true;
+    }
+
+  buf = xts_process_plan_peek (buf_p, plan_peek);
+  if (buf == NULL)
+    {
+      offset = ER_FAILED;
+      goto end;
+    }
+  assert (buf <= buf_p + size);
+
+  memcpy (&xts_Stream_buffer[offset], buf_p, size);
+
+end:
+  if (is_buf_alloced)
+    {
+      free_and_init (buf_p);
+    }
+
+  return offset;
+}
+
 static int
 xts_save_val_list (const VAL_LIST * val_list)
 {
@@ -2850,6 +2921,13 @@ xts_process_xasl_node (char *ptr, const XASL_NODE * xasl)
 
   ptr = or_pack_int (ptr, xasl->is_single_tuple);
 
+  offset = xts_save_regu_variable_list (xasl->memo_key_list);
+  if (offset == ER_FAILED)
+    {
+      return NULL;
+    }
+  ptr = or_pack_int (ptr, offset);
+
   ptr = or_pack_int (ptr, xasl->option);
 
   offset = xts_save_outptr_list (xasl->outptr_list);
@@ -3108,6 +3186,28 @@ xts_process_xasl_node (char *ptr, const XASL_NODE * xasl)
 
   ptr = or_pack_int (ptr, (int) xasl->iscan_oid_order);
 
+  /* estimates below one row are sent as one row, so zero stays unknown */
+  if (xasl->cardinality <= 0)
+    {
+      ptr = or_pack_int (ptr, 0);
+    }
+  else if (xasl->cardinality < (double) INT_MAX)
+    {
+      ptr = or_pack_int (ptr, MAX ((int) xasl->cardinality, 1));
+    }
+  else
+    {
+      ptr = or_pack_int (ptr, INT_MAX);
+    }
+  ptr = or_pack_int (ptr, xasl->cardinality_key);
+
+  offset = xts_save_plan_peek (xasl->plan_peeks);
+  if (offset == ER_FAILED)
+    {
+      return NULL;
+    }
+  ptr = or_pack_int (ptr, offset);
+
   if (xasl->query_alias)
     {
       offset = xts_save_string (xasl->query_alias);
@@ -5575,6 +5675,32 @@ xts_process_sort_list (char *ptr, const SORT_LIST * sort_list)
   return ptr;
 }
 
+static char *
+xts_process_plan_peek (char *ptr, const XASL_PLAN_PEEK * plan_peek)
+{
+  int offset;
+
+  offset = xts_save_plan_peek (plan_peek->next);
+  if (offset == ER_FAILED)
+    {
+      return NULL;
+    }
+  ptr = or_pack_int (ptr, offset);
+
+  offset = xts_save_db_value (plan_peek->value);
+  if (offset == ER_FAILED)
+    {
+      return NULL;
+    }
+  ptr = or_pack_int (ptr, offset);
+
+  ptr = or_pack_int (ptr, plan_peek->host_var_index);
+  ptr = or_pack_int (ptr, plan_peek->position);
+  ptr = or_pack_int (ptr, plan_peek->range);
+
+  return ptr;
+}
+
 /*
  * xts_process_method_sig_list ( ) -
  *
@@ -5819,6 +5945,7 @@ xts_sizeof_xasl_node (const XASL_NODE * xasl)
 	   + OR_INT_SIZE	/* ordbynum_flag */
 	   + PTR_SIZE		/* single_tuple */
 	   + OR_INT_SIZE	/* is_single_tuple */
+	   + PTR_SIZE		/* memo_key_list */
 	   + OR_INT_SIZE	/* option */
 	   + PTR_SIZE		/* outptr_list */
 	   + PTR_SIZE		/* selected_upd_list */
@@ -5974,6 +6101,9 @@ xts_sizeof_xasl_node (const XASL_NODE * xasl)
     }
 
   size += (OR_INT_SIZE		/* iscan_oid_order */
+	   + OR_INT_SIZE	/* cardinality */
+	   + OR_INT_SIZE	/* cardinality_key */
+	   + PTR_SIZE		/* plan_peeks */
 	   + PTR_SIZE		/* query_alias */
 	   + PTR_SIZE);		/* next */
 
@@ -7358,6 +7488,25 @@ xts_sizeof_sort_list (const SORT_LIST * sort_lis)
   return size;
 }
 
+/*
+ * xts_sizeof_plan_peek () -
+ *   return:
+ *   plan_peek(in):
+ */
+static int
+xts_sizeof_plan_peek (const XASL_PLAN_PEEK * plan_peek)
+{
+  int size = 0;
+
+  size += (PTR_SIZE		/* next */
+	   + PTR_SIZE		/* value */
+	   + OR_INT_SIZE	/* host_var_index */
+	   + OR_INT_SIZE	/* position */
+	   + OR_INT_SIZE);	/* range */
+
+  return size;
+}
+
 /*
  * xts_sizeof_method_sig_list () -
  *   return:
@@ -26,6 +26,7 @@
 
 #include "btree_load.h"
 #include "config.h"
+#include "consistency_check_pool.hpp"
 #include "db_value_printer.hpp"
 #include "file_manager.h"
 #include "slotted_page.h"
@@ -49,11 +50,21 @@
 #include "regu_var.hpp"
 #include "fault_injection.h"
 #include "dbtype.h"
+#include "memory_hash.h"
+#include "bloom_filter.h"
+#include "statistics_sr.h"
 #include "thread_manager.hpp"
+#include "thread_lockfree_hash_map.hpp"
+#if defined (SERVER_MODE)
+#include "boot_sr.h"
+#include "thread_daemon.hpp"
+#include "thread_entry_task.hpp"
+#endif /* SERVER_MODE */
 
 #include <assert.h>
 #include <algorithm>
 #include <cinttypes>
+#include <math.h>
 #include <stdlib.h>
 #include <string.h>
 
@@ -1178,6 +1189,274 @@ struct btree_helper
   BTREE_DELETE_HELPER delete_helper;
 };
 
+/*
+ * Leaf key prefix directory
+ *
+ * Order preserving 8-byte prefixes of the keys of a leaf page, kept with the page buffer. Binary search in a leaf
+ * compares the prefix of the searched key with the prefixes of the page keys and reads a key only when the prefixes
+ * are equal. The directory is built only for pages that are searched several times without being changed.
+ */
+
+/* minimum number of keys in a leaf page to build a key prefix directory */
+#define BTREE_LEAF_PREFIX_DIR_MIN_KEYS 16
+/* number of searches in an unchanged leaf page before its key prefix directory is built */
+#define BTREE_LEAF_PREFIX_DIR_SEARCH_THRESHOLD 4
+
+typedef struct btree_leaf_prefix_dir BTREE_LEAF_PREFIX_DIR;
+struct btree_leaf_prefix_dir
+{
+  PGBUF_PAGE_AUX aux;		/* page buffer auxiliary data header; must be first */
+  LOG_LSA page_lsa;		/* page LSA when the directory was created */
+  TP_DOMAIN *key_type;		/* key domain of the index */
+  int key_cnt;			/* number of keys in page */
+  volatile int search_cnt;	/* number of searches before the prefixes are built */
+  UINT64 *volatile prefixes;	/* prefixes of keys in slots 1 to key_cnt; NULL until built */
+};
+
+/*
+ * Adaptive hash index
+ *
+ * Maps hashes of keys that are looked up repeatedly by unique key searches to the leaf page and slot where the key was
+ * found. A search that hits the map latches the leaf directly instead of descending from root. The mapping is used
+ * only if the leaf LSA did not change since the mapping was learned and the key in slot is equal to searched key;
+ * otherwise the regular traversal is done and stale mappings are removed.
+ *
+ * Entries age like pages in a clock: a hit sets the reference flag of the entry, and when the map is full a sweep
+ * clears the flags and removes entries that were not hit since the previous sweep. Mappings to leaves no longer in
+ * page buffer are removed when found, and all mappings of an index are removed when the index is dropped.
+ */
+
+/* number of remembered key hashes; a key is added to adaptive hash index the second time it is looked up */
+#define BTREE_AHI_CANDIDATE_COUNT 4096
+/* maximum number of entries removed by one sweep */
+#define BTREE_AHI_SWEEP_COUNT 64
+
+typedef struct btree_ahi_key BTREE_AHI_KEY;
+struct btree_ahi_key
+{
+  BTID btid;			/* b-tree identifier */
+  unsigned int key_hash;	/* hash of key value */
+};
+
+typedef struct btree_ahi_entry BTREE_AHI_ENTRY;
+struct btree_ahi_entry
+{
+  BTREE_AHI_KEY key;		/* entry key */
+
+  /* latch-free hash table fields */
+  BTREE_AHI_ENTRY *stack;	/* used in freelist */
+  BTREE_AHI_ENTRY *next;	/* used in hash table */
+  pthread_mutex_t mutex;	/* mutex */
+  UINT64 del_id;		/* delete transaction ID (for lock free) */
+
+  BTID_INT btid_int;		/* b-tree info (without sys_btid) */
+  VPID leaf_vpid;		/* leaf page where key was found */
+  PGSLOTID slotid;		/* slot of key in leaf page */
+  LOG_LSA leaf_lsa;		/* leaf page LSA when the mapping was learned */
+  bool is_referenced;		/* set by hits, cleared by sweeps */
+};
+
+// *INDENT-OFF*
+using btree_ahi_hashmap_type = cubthread::lockfree_hashmap<BTREE_AHI_KEY, BTREE_AHI_ENTRY>;
+using btree_ahi_hashmap_iterator = btree_ahi_hashmap_type::iterator;
+// *INDENT-ON*
+
+static bool btree_ahi_Enabled = false;
+static INT32 btree_ahi_Max_entries = 0;
+static volatile INT32 btree_ahi_Entry_count = 0;
+static volatile INT32 btree_ahi_Is_sweeping = 0;
+static btree_ahi_hashmap_type btree_ahi_Hashmap;
+static unsigned int btree_ahi_Candidates[BTREE_AHI_CANDIDATE_COUNT];
+
+/* btree_ahi_Entry_descriptor - used for latch-free hash table.
+ * we have to declare member functions before instantiating btree_ahi_Entry_descriptor.
+ */
+static void *btree_ahi_entry_alloc (void);
+static int btree_ahi_entry_free (void *entry);
+static int btree_ahi_copy_key (void *src, void *dest);
+static int btree_ahi_compare_key (void *key1, void *key2);
+static unsigned int btree_ahi_hash_key (void *key, int hash_size);
+
+static LF_ENTRY_DESCRIPTOR btree_ahi_Entry_descriptor = {
+  offsetof (BTREE_AHI_ENTRY, stack),
+  offsetof (BTREE_AHI_ENTRY, next),
+  offsetof (BTREE_AHI_ENTRY, del_id),
+  offsetof (BTREE_AHI_ENTRY, key),
+  offsetof (BTREE_AHI_ENTRY, mutex),
+
+  /* using mutex */
+  LF_EM_USING_MUTEX,
+
+  btree_ahi_entry_alloc,
+  btree_ahi_entry_free,
+  NULL,
+  NULL,
+  btree_ahi_copy_key,
+  btree_ahi_compare_key,
+  btree_ahi_hash_key,
+  NULL,				/* duplicates not accepted. */
+};
+
+/*
+ * Unique index Bloom filters
+ *
+ * A Bloom filter over all keys of a unique index lets unique key lookups answer "key not found" without descending
+ * the b-tree. The first lookup requests the filter, which is then built by a background daemon scanning the index
+ * leaves; lookups do not use it until the scan is complete. Inserted keys are added to the filter while their leaf
+ * page is latched, so a concurrent scan either sees the key in the leaf or the key is already in the filter. Deleted
+ * keys are never removed and only make the filter less selective. A filter that received too many keys or whose
+ * index is dropped is discarded and built again when needed. Filters are only used by the server; stand-alone mode
+ * has no daemon to build them.
+ */
+
+/* number of key hashes collected by the filter builder before they are added to the filter */
+#define BTREE_BLOOM_BUILD_BATCH 4096
+/* minimum number of keys a filter is sized for */
+#define BTREE_BLOOM_MIN_KEYS 1024
+/* period of the filter builder daemon; it is also woken up by lookups requesting a filter */
+#define BTREE_BLOOM_BUILD_PERIOD_IN_SEC 10
+
+typedef struct btree_bloom_entry BTREE_BLOOM_ENTRY;
+struct btree_bloom_entry
+{
+  BTID btid;			/* b-tree identifier */
+
+  /* latch-free hash table fields */
+  BTREE_BLOOM_ENTRY *stack;	/* used in freelist */
+  BTREE_BLOOM_ENTRY *next;	/* used in hash table */
+  pthread_mutex_t mutex;	/* mutex */
+  UINT64 del_id;		/* delete transaction ID (for lock free) */
+
+  BLOOM_FILTER *filter;		/* filter of all keys in index */
+  TP_DOMAIN *key_type;		/* key domain of the index */
+  int capacity;			/* number of keys the filter was sized for */
+  OID class_oid;		/* class locked while the filter is built */
+  bool is_build_requested;	/* true until the builder daemon registers the filter */
+  bool is_ready;		/* false while the filter is built */
+};
+
+// *INDENT-OFF*
+using btree_bloom_hashmap_type = cubthread::lockfree_hashmap<BTID, BTREE_BLOOM_ENTRY>;
+using btree_bloom_hashmap_iterator = btree_bloom_hashmap_type::iterator;
+// *INDENT-ON*
+
+static bool btree_bloom_Enabled = false;
+static btree_bloom_hashmap_type btree_bloom_Hashmap;
+#if defined (SERVER_MODE)
+static cubthread::daemon *btree_bloom_Build_daemon = NULL;
+#endif /* SERVER_MODE */
+
+/* btree_bloom_Entry_descriptor - used for latch-free hash table.
+ * we have to declare member functions before instantiating btree_bloom_Entry_descriptor.
+ */
+static void *btree_bloom_entry_alloc (void);
+static int btree_bloom_entry_free (void *entry);
+static int btree_bloom_entry_init (void *entry);
+static int btree_bloom_copy_key (void *src, void *dest);
+
+static LF_ENTRY_DESCRIPTOR btree_bloom_Entry_descriptor = {
+  offsetof (BTREE_BLOOM_ENTRY, stack),
+  offsetof (BTREE_BLOOM_ENTRY, next),
+  offsetof (BTREE_BLOOM_ENTRY, del_id),
+  offsetof (BTREE_BLOOM_ENTRY, btid),
+  offsetof (BTREE_BLOOM_ENTRY, mutex),
+
+  /* using mutex */
+  LF_EM_USING_MUTEX,
+
+  btree_bloom_entry_alloc,
+  btree_bloom_entry_free,
+  btree_bloom_entry_init,
+  NULL,
+  btree_bloom_copy_key,
+  btree_compare_btids,
+  btree_hash_btid,
+  NULL,				/* duplicates not accepted. */
+};
+
+/*
+ * Statistics deltas
+ *
+ * Objects inserted in and deleted from an index since its statistics were gathered are counted in memory. Key prefixes
+ * of inserted objects are also added to HyperLogLog sketches, one for each prefix in pkeys[] of BTREE_STATS, which
+ * estimate how many distinct prefixes were inserted. Statistics sent to clients are adjusted by these deltas, so the
+ * optimizer sees bulk loads and deletes without another UPDATE STATISTICS. Deltas are kept only in memory: they are lost
+ * on restart, and changes that are rolled back are not subtracted.
+ */
+/* clients are asked to refresh cached statistics after this many changes, and no less than a fraction of objects */
+#define BTREE_DELTA_REFRESH_MIN_CHANGES 1000
+#define BTREE_DELTA_REFRESH_RATIO 0.1
+/* changes are counted in shards picked by thread index, so that concurrent changes of an index do not contend on the
+ * same counters; a shard is checked for refresh after this many of its changes */
+#define BTREE_DELTA_SHARDS 16
+#define BTREE_DELTA_SHARD_SIZE 64
+#define BTREE_DELTA_REFRESH_CHECK_CHANGES 64
+
+typedef struct btree_delta_shard BTREE_DELTA_SHARD;
+struct btree_delta_shard
+{
+  volatile INT64 inserts;	/* objects inserted since statistics were gathered */
+  volatile INT64 deletes;	/* objects deleted since statistics were gathered */
+  char padding[BTREE_DELTA_SHARD_SIZE - 2 * sizeof (INT64)];	/* keep shards in different cache lines */
+};
+
+typedef struct btree_delta_entry BTREE_DELTA_ENTRY;
+struct btree_delta_entry
+{
+  BTID btid;			/* b-tree identifier */
+
+  /* latch-free hash table fields */
+  BTREE_DELTA_ENTRY *stack;	/* used in freelist */
+  BTREE_DELTA_ENTRY *next;	/* used in hash table */
+  UINT64 del_id;		/* delete transaction ID (for lock free) */
+
+  BTREE_DELTA_SHARD shards[BTREE_DELTA_SHARDS];	/* counted changes; summed when the delta is read */
+  volatile INT64 refresh_changes;	/* inserts + deletes when clients were last asked to refresh statistics */
+  volatile INT64 class_objects;	/* objects of class in statistics last sent to clients */
+  volatile unsigned int time_stamp;	/* time when clients were last asked to refresh statistics */
+  int n_columns;		/* number of key columns; 0 until first insert */
+  int n_sketches;		/* number of key prefixes with a sketch */
+  unsigned char *volatile registers;	/* n_sketches sketches of BTREE_DELTA_HLL_REGISTERS registers */
+};
+
+// *INDENT-OFF*
+using btree_delta_hashmap_type = cubthread::lockfree_hashmap<BTID, BTREE_DELTA_ENTRY>;
+using btree_delta_hashmap_iterator = btree_delta_hashmap_type::iterator;
+// *INDENT-ON*
+
+static bool btree_delta_Enabled = false;
+static btree_delta_hashmap_type btree_delta_Hashmap;
+/* latest time stamp of any statistics delta; no cached statistics are stale by deltas older than it */
+static volatile unsigned int btree_delta_Last_time_stamp = 0;
+
+/* btree_delta_Entry_descriptor - used for latch-free hash table.
+ * we have to declare member functions before instantiating btree_delta_Entry_descriptor.
+ */
+static void *btree_delta_entry_alloc (void);
+static int btree_delta_entry_free (void *entry);
+static int btree_delta_entry_init (void *entry);
+static int btree_delta_entry_uninit (void *entry);
+
+static LF_ENTRY_DESCRIPTOR btree_delta_Entry_descriptor = {
+  offsetof (BTREE_DELTA_ENTRY, stack),
+  offsetof (BTREE_DELTA_ENTRY, next),
+  offsetof (BTREE_DELTA_ENTRY, del_id),
+  offsetof (BTREE_DELTA_ENTRY, btid),
+  0,				/* No mutex. */
+
+  /* using mutex? */
+  LF_EM_NOT_USING_MUTEX,
+
+  btree_delta_entry_alloc,
+  btree_delta_entry_free,
+  btree_delta_entry_init,
+  btree_delta_entry_uninit,
+  btree_bloom_copy_key,
+  btree_compare_btids,
+  btree_hash_btid,
+  NULL,				/* duplicates not accepted. */
+};
+
 /*
  * Static functions
  */
@@ -1226,6 +1505,9 @@ static int btree_search_nonleaf_page (THREAD_ENTRY * thread_p, BTID_INT * btid,
 				      INT16 * slot_id, VPID * child_vpid, page_key_boundary * page_bounds);
 static int btree_search_leaf_page (THREAD_ENTRY * thread_p, BTID_INT * btid, PAGE_PTR page_ptr, DB_VALUE * key,
 				   BTREE_SEARCH_KEY_HELPER * search_key);
+static bool btree_get_key_prefix (TP_DOMAIN * key_type, DB_VALUE * key, UINT64 * prefix);
+static void btree_free_leaf_prefix_dir (PGBUF_PAGE_AUX * aux);
+static UINT64 *btree_get_leaf_prefixes (THREAD_ENTRY * thread_p, BTID_INT * btid, PAGE_PTR page_ptr, int key_cnt);
 static int btree_leaf_is_key_between_min_max (THREAD_ENTRY * thread_p, BTID_INT * btid_int, PAGE_PTR leaf,
 					      DB_VALUE * key, BTREE_SEARCH_KEY_HELPER * search_key);
 static int xbtree_test_unique (THREAD_ENTRY * thread_p, BTID * btid);
@@ -1434,6 +1716,42 @@ static int btree_search_key_and_apply_functions (THREAD_ENTRY * thread_p, BTID *
 						 void *advance_args, BTREE_PROCESS_KEY_FUNCTION * leaf_fnct,
 						 void *process_key_args, BTREE_SEARCH_KEY_HELPER * search_key,
 						 PAGE_PTR * leaf_page_ptr);
+static int btree_fix_leaf_optimistic (THREAD_ENTRY * thread_p, BTID * btid, BTID_INT * btid_int, bool reuse_btid_int,
+				      DB_VALUE * key, PAGE_PTR * leaf_page);
+static bool btree_ahi_make_key (BTID * btid, DB_VALUE * key, BTREE_AHI_KEY * ahi_key);
+static void btree_ahi_remove (THREAD_ENTRY * thread_p, BTREE_AHI_KEY * ahi_key);
+static int btree_ahi_collect (THREAD_ENTRY * thread_p, BTID * btid, BTREE_AHI_KEY * ahi_keys);
+static void btree_ahi_sweep (THREAD_ENTRY * thread_p);
+static void btree_ahi_remove_btid (THREAD_ENTRY * thread_p, BTID * btid);
+static bool btree_ahi_is_whole_key (BTID_INT * btid_int, DB_VALUE * key);
+static int btree_ahi_fix_leaf (THREAD_ENTRY * thread_p, BTID * btid, BTID_INT * btid_int, bool reuse_btid_int,
+			       DB_VALUE * key, PAGE_PTR * leaf_page, BTREE_SEARCH_KEY_HELPER * search_key);
+static void btree_ahi_learn (THREAD_ENTRY * thread_p, BTID * btid, BTID_INT * btid_int, DB_VALUE * key,
+			     PAGE_PTR leaf_page, PGSLOTID slotid);
+static bool btree_bloom_is_hashable_type (DB_TYPE type);
+static bool btree_bloom_is_hashable_domain (TP_DOMAIN * key_type);
+static unsigned int btree_bloom_hash_value (DB_VALUE * value);
+static bool btree_bloom_hash_key (TP_DOMAIN * key_type, DB_VALUE * key, unsigned int *hash);
+static void btree_bloom_invalidate (THREAD_ENTRY * thread_p, BTID * btid);
+static bool btree_bloom_add_key (THREAD_ENTRY * thread_p, BTID * btid, DB_VALUE * key);
+static void btree_bloom_note_leaf_merge (THREAD_ENTRY * thread_p, BTID * btid);
+#if defined (SERVER_MODE)
+static void btree_bloom_build (THREAD_ENTRY * thread_p, BTID * btid);
+static void btree_bloom_build_daemon_execute (cubthread::entry & thread_ref);
+#endif /* SERVER_MODE */
+static bool btree_bloom_may_contain_key (THREAD_ENTRY * thread_p, BTID * btid, OID * class_oid, DB_VALUE * key);
+static BTREE_DELTA_ENTRY *btree_delta_find_or_insert (THREAD_ENTRY * thread_p, BTID * btid, TP_DOMAIN * key_type);
+static unsigned char btree_delta_hll_rank (UINT64 hash, int *index);
+static void btree_delta_hll_add_atomic (unsigned char *registers, UINT64 hash);
+static void btree_delta_sketch_key (BTREE_DELTA_ENTRY * entry, TP_DOMAIN * key_type, DB_VALUE * key);
+static void btree_delta_sum_changes (BTREE_DELTA_ENTRY * entry, INT64 * inserts, INT64 * deletes);
+static void btree_delta_release (THREAD_ENTRY * thread_p, BTREE_DELTA_ENTRY * entry, bool check_refresh);
+static void btree_delta_add_object (THREAD_ENTRY * thread_p, BTID * btid, TP_DOMAIN * key_type, DB_VALUE * key,
+				    bool is_insert);
+static void btree_delta_add_object_list (THREAD_ENTRY * thread_p, BTID * btid, TP_DOMAIN * key_type,
+					 btree_insert_list * insert_list, bool is_insert);
+static void btree_delta_reset (THREAD_ENTRY * thread_p, BTID * btid);
+static void btree_delta_remove (THREAD_ENTRY * thread_p, BTID * btid);
 static int btree_get_root_with_key (THREAD_ENTRY * thread_p, BTID * btid, BTID_INT * btid_int, DB_VALUE * key,
 				    PAGE_PTR * root_page, bool * is_leaf, BTREE_SEARCH_KEY_HELPER * search_key,
 				    bool * stop, bool * restart, void *other_args);
@@ -1506,6 +1824,12 @@ static int btree_get_max_new_data_size (THREAD_ENTRY * thread_p, BTID_INT * btid
 static int btree_key_insert_new_object (THREAD_ENTRY * thread_p, BTID_INT * btid_int, DB_VALUE * key,
 					PAGE_PTR * leaf_page, BTREE_SEARCH_KEY_HELPER * search_key, bool * restart,
 					void *other_args);
+static int btree_key_insert_object_list (THREAD_ENTRY * thread_p, BTID_INT * btid_int, DB_VALUE * key,
+					 PAGE_PTR * leaf_page, BTREE_SEARCH_KEY_HELPER * search_key, bool * restart,
+					 void *other_args);
+static int btree_insert_object_list (THREAD_ENTRY * thread_p, BTID * btid, OID * class_oid,
+				     btree_insert_list * insert_list, BTREE_MVCC_INFO * mvcc_info,
+				     BTREE_OP_PURPOSE purpose);
 static int btree_key_online_index_IB_insert_list (THREAD_ENTRY * thread_p, BTID_INT * btid_int, DB_VALUE * key,
 						  PAGE_PTR * leaf_page, BTREE_SEARCH_KEY_HELPER * search_key,
 						  bool * restart, void *other_args);
@@ -5292,6 +5616,197 @@ btree_leaf_is_key_between_min_max (THREAD_ENTRY * thread_p, BTID_INT * btid_int,
   return NO_ERROR;
 }
 
+/*
+ * btree_get_key_prefix () - Get the order preserving 8-byte prefix of a key.
+ *   return	     : True if a prefix could be computed, false otherwise.
+ *   key_type (in)   : Key domain of the index.
+ *   key (in)	     : Key value.
+ *   prefix (out)    : Key prefix. When the prefixes of two keys are different, their unsigned comparison gives the
+ *		       ascending order of the keys.
+ */
+static bool
+btree_get_key_prefix (TP_DOMAIN * key_type, DB_VALUE * key, UINT64 * prefix)
+{
+  DB_TYPE type = TP_DOMAIN_TYPE (key_type);
+  LANG_COLLATION *lang_coll;
+  bool ti;
+
+  if (DB_IS_NULL (key) || DB_VALUE_DOMAIN_TYPE (key) != type)
+    {
+      return false;
+    }
+
+  switch (type)
+    {
+    case DB_TYPE_SHORT:
+      *prefix = ((UINT64) (INT64) db_get_short (key)) ^ ((UINT64) 1 << 63);
+      return true;
+
+    case DB_TYPE_INTEGER:
+      *prefix = ((UINT64) (INT64) db_get_int (key)) ^ ((UINT64) 1 << 63);
+      return true;
+
+    case DB_TYPE_BIGINT:
+      *prefix = ((UINT64) db_get_bigint (key)) ^ ((UINT64) 1 << 63);
+      return true;
+
+    case DB_TYPE_CHAR:
+    case DB_TYPE_STRING:
+      if (key->data.ch.info.is_max_string || db_get_string_collation (key) != key_type->collation_id)
+	{
+	  return false;
+	}
+      lang_coll = lang_get_collation (key_type->collation_id);
+      if (lang_coll == NULL)
+	{
+	  return false;
+	}
+      /* same trailing space rule as the string compare of the key domain */
+      ti = prm_get_bool_value (PRM_ID_IGNORE_TRAILING_SPACE) || TP_IS_FIXED_LEN_CHAR_TYPE (type);
+      return lang_get_key_prefix (lang_coll, REINTERPRET_CAST (const unsigned char *, db_get_string (key)),
+				  db_get_string_size (key), ti, prefix);
+
+    default:
+      return false;
+    }
+}
+
+/*
+ * btree_free_leaf_prefix_dir () - Free a leaf key prefix directory dropped by page buffer.
+ *   return	     : Void.
+ *   aux (in)	     : Key prefix directory.
+ */
+static void
+btree_free_leaf_prefix_dir (PGBUF_PAGE_AUX * aux)
+{
+  BTREE_LEAF_PREFIX_DIR *dir = (BTREE_LEAF_PREFIX_DIR *) aux;
+
+  if (dir->prefixes != NULL)
+    {
+      free (dir->prefixes);
+    }
+  free (dir);
+}
+
+/*
+ * btree_get_leaf_prefixes () - Get the key prefixes of a leaf page if its prefix directory is built.
+ *   return	     : Array of key_cnt prefixes (prefix of slot i at index i - 1) or NULL.
+ *   thread_p (in)   : Thread entry.
+ *   btid (in)	     : B-tree info.
+ *   page_ptr (in)   : Leaf node page pointer.
+ *   key_cnt (in)    : Number of keys in page.
+ *
+ * Note: The first call for a page attaches an empty directory to the page buffer. The prefixes are built when the
+ *	 page is searched BTREE_LEAF_PREFIX_DIR_SEARCH_THRESHOLD times. Page buffer drops the directory when the page is
+ *	 changed.
+ */
+static UINT64 *
+btree_get_leaf_prefixes (THREAD_ENTRY * thread_p, BTID_INT * btid, PAGE_PTR page_ptr, int key_cnt)
+{
+  PGBUF_PAGE_AUX *aux;
+  BTREE_LEAF_PREFIX_DIR *dir;
+  UINT64 *prefixes;
+  RECDES rec;
+  LEAF_REC leaf_rec;
+  DB_VALUE key;
+  bool clear_key = false;
+  int offset = 0;
+  int slotid;
+  bool success = true;
+
+  if (key_cnt < BTREE_LEAF_PREFIX_DIR_MIN_KEYS)
+    {
+      return NULL;
+    }
+
+  aux = pgbuf_get_page_aux (page_ptr);
+  if (aux == NULL)
+    {
+      dir = (BTREE_LEAF_PREFIX_DIR *) malloc (sizeof (BTREE_LEAF_PREFIX_DIR));
+      if (dir == NULL)
+	{
+	  return NULL;
+	}
+      dir->aux.size = sizeof (BTREE_LEAF_PREFIX_DIR) + key_cnt * sizeof (UINT64);
+      dir->aux.ptype = PAGE_BTREE;
+      dir->aux.free_func = btree_free_leaf_prefix_dir;
+      LSA_COPY (&dir->page_lsa, pgbuf_get_lsa (page_ptr));
+      dir->key_type = btid->key_type;
+      dir->key_cnt = key_cnt;
+      dir->search_cnt = 1;
+      dir->prefixes = NULL;
+      if (!pgbuf_attach_page_aux (page_ptr, &dir->aux))
+	{
+	  free (dir);
+	}
+      return NULL;
+    }
+
+  if (aux->ptype != PAGE_BTREE)
+    {
+      return NULL;
+    }
+  dir = (BTREE_LEAF_PREFIX_DIR *) aux;
+  if (dir->key_type != btid->key_type || dir->key_cnt != key_cnt || !LSA_EQ (&dir->page_lsa, pgbuf_get_lsa (page_ptr)))
+    {
+      /* Page is being changed by the latch holder and was not yet set dirty. */
+      return NULL;
+    }
+
+  prefixes = dir->prefixes;
+  if (prefixes != NULL)
+    {
+      return prefixes;
+    }
+  if (ATOMIC_INC_32 (&dir->search_cnt, 1) != BTREE_LEAF_PREFIX_DIR_SEARCH_THRESHOLD)
+    {
+      /* Not searched enough yet, or another thread builds the prefixes. */
+      return NULL;
+    }
+
+  prefixes = (UINT64 *) malloc (key_cnt * sizeof (UINT64));
+  if (prefixes == NULL)
+    {
+      return NULL;
+    }
+
+  btree_init_temp_key_value (&clear_key, &key);
+  for (slotid = 1; slotid <= key_cnt && success; slotid++)
+    {
+      if (spage_get_record (thread_p, page_ptr, slotid, &rec, PEEK) != S_SUCCESS
+	  || btree_leaf_is_flaged (&rec, BTREE_LEAF_RECORD_OVERFLOW_KEY))
+	{
+	  success = false;
+	  break;
+	}
+      if (btree_read_record_without_decompression (thread_p, btid, &rec, &key, &leaf_rec, BTREE_LEAF_NODE,
+						   &clear_key, &offset, PEEK_KEY_VALUE) != NO_ERROR)
+	{
+	  er_clear ();
+	  success = false;
+	  break;
+	}
+      success = btree_get_key_prefix (btid->key_type, &key, &prefixes[slotid - 1]);
+      btree_clear_key_value (&clear_key, &key);
+    }
+
+  if (!success)
+    {
+      /* Search count is past the threshold, page is not tried again. */
+      free (prefixes);
+      return NULL;
+    }
+
+  if (!ATOMIC_CAS_ADDR (&dir->prefixes, (UINT64 *) NULL, prefixes))
+    {
+      /* Not expected, only one thread builds the prefixes. */
+      assert (false);
+      free (prefixes);
+      return dir->prefixes;
+    }
+  return prefixes;
+}
+
 /*
  * btree_search_leaf_page () - Search key in page and return result.
  *   return	      : Error code.
@@ -5331,6 +5846,8 @@ btree_search_leaf_page (THREAD_ENTRY * thread_p, BTID_INT * btid, PAGE_PTR page_
   bool is_record_read = false;
   LEAF_REC leaf_pnt;
   int error = NO_ERROR;
+  UINT64 *prefixes = NULL;
+  UINT64 key_prefix = 0;
 
   /* Assert expected arguments. */
   assert (btid != NULL);
@@ -5388,6 +5905,12 @@ btree_search_leaf_page (THREAD_ENTRY * thread_p, BTID_INT * btid, PAGE_PTR page_
    * located to preserve the order of keys
    */
 
+  /* Use key prefix directory of the page, if any, for single column keys. */
+  if (key_cnt > 0 && btree_get_key_prefix (btid->key_type, key, &key_prefix))
+    {
+      prefixes = btree_get_leaf_prefixes (thread_p, btid, page_ptr, key_cnt);
+    }
+
   /* Initialize binary search range to first and last key in page. */
   left = 1;
   right = key_cnt;
@@ -5400,6 +5923,27 @@ btree_search_leaf_page (THREAD_ENTRY * thread_p, BTID_INT * btid, PAGE_PTR page_
       /* Safe guard. */
       assert (middle > 0);
 
+      if (prefixes != NULL && middle > 1 && middle < key_cnt && prefixes[middle - 1] != key_prefix)
+	{
+	  /* Different prefixes give the compare result without reading the key. Fence keys can only be first or last
+	   * key, those are always read. */
+	  c = (key_prefix < prefixes[middle - 1]) ? DB_LT : DB_GT;
+	  if (btid->key_type->is_desc)
+	    {
+	      c = -c;
+	    }
+	  is_record_read = false;
+	  if (c < 0)
+	    {
+	      right = middle - 1;
+	    }
+	  else
+	    {
+	      left = middle + 1;
+	    }
+	  continue;
+	}
+
       /* Get current middle key. */
       if (spage_get_record (thread_p, page_ptr, middle, &rec, PEEK) != S_SUCCESS)
 	{
@@ -5699,6 +6243,10 @@ xbtree_delete_index (THREAD_ENTRY * thread_p, BTID * btid)
   unique_pk = root_header->unique_pk;
   pgbuf_unfix_and_init (thread_p, P);
 
+  btree_bloom_invalidate (thread_p, btid);
+  btree_delta_remove (thread_p, btid);
+  btree_ahi_remove_btid (thread_p, btid);
+
   vacuum_log_add_dropped_file (thread_p, &btid->vfid, NULL, VACUUM_LOG_ADD_DROPPED_FILE_POSTPONE);
   if (unique_pk)
     {
@@ -6981,6 +7529,9 @@ btree_get_stats (THREAD_ENTRY * thread_p, BTREE_STATS * stat_info_p, bool with_f
 	}
     }
 
+  /* changes counted so far are included by the new statistics */
+  btree_delta_reset (thread_p, &stat_info_p->btid);
+
   /* set environment variable */
   env = &stat_env;
   BTREE_INIT_SCAN (&(env->btree_scan));
@@ -8266,23 +8817,25 @@ btree_repair_prev_link (THREAD_ENTRY * thread_p, OID * oid, BTID * index_btid, b
 DISK_ISVALID
 btree_check_all (THREAD_ENTRY * thread_p)
 {
-  DISK_ISVALID valid, allvalid;	/* Validation return code */
+  DISK_ISVALID allvalid;	/* Validation return code */
   BTID btid;
 
   OID class_oid = OID_INITIALIZER;
 
   int error_code = NO_ERROR;
 
-  allvalid = DISK_VALID;
+  /* *INDENT-OFF* */
+  consistency_check_pool check_pool (thread_p, "index");
+  /* *INDENT-ON* */
+
   /* Go to each file, check only the btree files */
   VFID_SET_NULL (&btid.vfid);
-  while (true)
+  while (!check_pool.has_error ())
     {
       error_code = file_tracker_interruptable_iterate (thread_p, FILE_BTREE, &btid.vfid, &class_oid);
       if (error_code != NO_ERROR)
 	{
 	  ASSERT_ERROR ();
-	  allvalid = (allvalid == DISK_VALID) ? DISK_ERROR : allvalid;
 	  break;
 	}
       if (VFID_ISNULL (&btid.vfid))
@@ -8292,25 +8845,42 @@ btree_check_all (THREAD_ENTRY * thread_p)
 	}
       assert (!OID_ISNULL (&class_oid));
 
-      /* Check BTree file */
-      valid = btree_check_by_btid (thread_p, &btid);
-      if (valid == DISK_ERROR)
+      /* Check BTree file; b-trees are checked in parallel */
+      /* *INDENT-OFF* */
+      error_code =
+	check_pool.push_check (thread_p, class_oid, IX_LOCK, [btid] (cubthread::entry &thread_ref, int &checked_pages)
+	  {
+	    BTID check_btid = btid;
+	    DISK_ISVALID valid = btree_check_by_btid (&thread_ref, &check_btid);
+
+	    if (valid != DISK_ERROR)
+	      {
+		(void) file_get_num_user_pages (&thread_ref, &check_btid.vfid, &checked_pages);
+	      }
+	    return valid;
+	  });
+      /* *INDENT-ON* */
+      if (error_code != NO_ERROR)
 	{
 	  ASSERT_ERROR ();
-	  allvalid = (allvalid == DISK_VALID) ? DISK_ERROR : allvalid;
 	  break;
 	}
-      if (valid == DISK_INVALID)
-	{
-	  assert_release (false);
-	  allvalid = valid;
-	}
     }
 
   if (!OID_ISNULL (&class_oid))
     {
       lock_unlock_object (thread_p, &class_oid, oid_Root_class_oid, IX_LOCK, true);
     }
+
+  allvalid = check_pool.wait_all (thread_p);
+  if (error_code != NO_ERROR)
+    {
+      allvalid = (allvalid == DISK_VALID) ? DISK_ERROR : allvalid;
+    }
+  if (allvalid == DISK_INVALID)
+    {
+      assert_release (false);
+    }
   return allvalid;
 }
 
@@ -10165,6 +10735,12 @@ btree_merge_node (THREAD_ENTRY * thread_p, BTID_INT * btid, PAGE_PTR P, PAGE_PTR
   right_header = btree_get_node_header (thread_p, right_pg);
   assert (left_header != NULL && right_header != NULL);
 
+  if (left_header->node_level == 1)
+    {
+      /* keys of the right leaf move to the left leaf, which a Bloom filter builder may have scanned already */
+      btree_bloom_note_leaf_merge (thread_p, btid->sys_btid);
+    }
+
   btree_init_temp_key_value (&left_fence_key_clear, &left_fence_key);
   btree_init_temp_key_value (&right_fence_key_clear, &right_fence_key);
 
@@ -22411,6 +22987,8 @@ btree_search_key_and_apply_functions (THREAD_ENTRY * thread_p, BTID * btid, BTID
   bool is_leaf = false;		/* Set to true if crt_page is a leaf node. */
   bool stop = false;		/* Set to true to stop advancing in b-tree. */
   bool restart = false;		/* Set to true to restart b-tree traversal from root. */
+  bool use_ahi = false;		/* Set to true if adaptive hash index is used for the search. */
+  bool is_ahi_hit = false;	/* Set to true if leaf page was found by adaptive hash index. */
   BTREE_SEARCH_KEY_HELPER local_search_key;	/* Store search key result if search key pointer argument is NULL. */
 
   /* Assert expected arguments. */
@@ -22435,6 +23013,19 @@ btree_search_key_and_apply_functions (THREAD_ENTRY * thread_p, BTID * btid, BTID
       search_key = &local_search_key;
     }
 
+  /* Unique key lookups and index scans that start from a whole key (equality lookups on any index) can go directly
+   * to leaf using adaptive hash index. */
+  use_ahi = (root_function == NULL && advance_function == btree_advance_and_find_key
+	     && (key_function == btree_key_find_unique_version_oid || key_function == btree_key_find_and_lock_unique
+		 || (key_function == NULL && leaf_page_ptr != NULL && root_args != NULL && *(bool *) root_args
+		     && btree_ahi_is_whole_key (btid_int, key))));
+#if defined (SA_MODE)
+  if (use_ahi && thread_p == NULL)
+    {
+      thread_p = thread_get_thread_entry_info ();
+    }
+#endif /* SA_MODE */
+
 start_btree_traversal:
   /* Traversal starting point. The function will try to locate key while calling 3 types of manipulation functions: 1.
    * Root function: It may be used to fix and modify root page. If no such function is provided,
@@ -22446,6 +23037,7 @@ start_btree_traversal:
   /* Reset restart flag. */
   restart = false;
   is_leaf = false;
+  is_ahi_hit = false;
   search_key->result = BTREE_KEY_NOTFOUND;
   search_key->slotid = NULL_SLOTID;
 
@@ -22455,6 +23047,43 @@ start_btree_traversal:
       pgbuf_unfix_and_init (thread_p, crt_page);
     }
 
+  if (use_ahi)
+    {
+      error_code =
+	btree_ahi_fix_leaf (thread_p, btid, btid_int, root_args != NULL && *(bool *) root_args, key, &crt_page,
+			    search_key);
+      if (error_code != NO_ERROR)
+	{
+	  ASSERT_ERROR ();
+	  goto error;
+	}
+      if (crt_page != NULL)
+	{
+	  /* Key was found in leaf page. */
+	  is_leaf = true;
+	  is_ahi_hit = true;
+	  goto leaf_reached;
+	}
+    }
+
+  if ((root_function == NULL || root_function == btree_get_root_with_key)
+      && advance_function == btree_advance_and_find_key)
+    {
+      /* Read-only traversal. Try to reach leaf without latching non-leaf nodes. */
+      error_code = btree_fix_leaf_optimistic (thread_p, btid, btid_int, root_args != NULL && *(bool *) root_args, key,
+					      &crt_page);
+      if (error_code != NO_ERROR)
+	{
+	  ASSERT_ERROR ();
+	  goto error;
+	}
+      if (crt_page != NULL)
+	{
+	  /* Leaf page is fixed. Advance function will search key in it. */
+	  goto advance_to_leaf;
+	}
+    }
+
   /* Fix b-tree root page. */
   if (root_function == NULL)
     {
@@ -22483,6 +23112,7 @@ start_btree_traversal:
   /* Root page must be fixed. */
   assert (crt_page != NULL);
 
+advance_to_leaf:
   /* Advance until leaf page is found. */
   while (!is_leaf)
     {
@@ -22527,11 +23157,17 @@ start_btree_traversal:
 
   /* Leaf page is reached. */
 
+leaf_reached:
   assert (is_leaf && !stop && !restart);
   assert (crt_page != NULL);
   assert (btree_get_node_header (thread_p, crt_page) != NULL
 	  && btree_get_node_header (thread_p, crt_page)->node_level == 1);
 
+  if (use_ahi && !is_ahi_hit && search_key->result == BTREE_KEY_FOUND)
+    {
+      btree_ahi_learn (thread_p, btid, btid_int, key, crt_page, search_key->slotid);
+    }
+
   if (key_function != NULL)
     {
       /* Call key_function. */
@@ -22585,6 +23221,2124 @@ error:
   return error_code;
 }
 
+/*
+ * btree_fix_leaf_optimistic () - Find and fix the leaf node of key without latching the non-leaf nodes on the way.
+ *
+ * return	       : Error code.
+ * thread_p (in)       : Thread entry.
+ * btid (in)	       : B-tree identifier.
+ * btid_int (out)      : BTID_INT (B-tree data).
+ * reuse_btid_int (in) : True if btid_int is already filled.
+ * key (in)	       : Search key value.
+ * leaf_page (out)     : Read latched leaf node or NULL if the regular traversal must be used.
+ *
+ * Note: Each non-leaf node is copied from page buffer without a latch and searched in the copy. The copy of the node
+ *	 is kept in the page copy buffer of the thread, and each child is copied over its parent. After its child is
+ *	 copied (or, for the last non-leaf node, latched), the version of the node is checked again; a node whose
+ *	 version did not change still leads to the child, so the path to leaf is valid without ever holding two latches.
+ *	 Any change detected on the way gives up the optimistic traversal, which is then done with latch coupling.
+ */
+static int
+btree_fix_leaf_optimistic (THREAD_ENTRY * thread_p, BTID * btid, BTID_INT * btid_int, bool reuse_btid_int,
+			   DB_VALUE * key, PAGE_PTR * leaf_page)
+{
+#if defined (SERVER_MODE)
+  PAGE_PTR node_copy = NULL;
+  BTREE_ROOT_HEADER *root_header = NULL;
+  BTREE_NODE_HEADER *node_header = NULL;
+  VPID node_vpid, child_vpid;
+  int node_version, child_version;
+  INT16 slotid;
+  int error_code = NO_ERROR;
+
+  assert (leaf_page != NULL && *leaf_page == NULL);
+
+  if (!prm_get_bool_value (PRM_ID_BTREE_OPTIMISTIC_DESCENT))
+    {
+      return NO_ERROR;
+    }
+
+  node_vpid.volid = btid->vfid.volid;
+  node_vpid.pageid = btid->root_pageid;
+  node_copy = pgbuf_copy_page_optimistic (thread_p, &node_vpid, PAGE_BTREE, &node_version);
+  if (node_copy == NULL)
+    {
+      return NO_ERROR;
+    }
+
+  root_header = btree_get_root_header (thread_p, node_copy);
+  if (root_header == NULL || root_header->node.node_level <= 1)
+    {
+      /* Root is leaf. */
+      return NO_ERROR;
+    }
+  if (!reuse_btid_int)
+    {
+      btid_int->sys_btid = btid;
+      if (btree_glean_root_header_info (thread_p, root_header, btid_int, true) != NO_ERROR)
+	{
+	  er_clear ();
+	  return NO_ERROR;
+	}
+    }
+  if (!VFID_ISNULL (&btid_int->ovfid))
+    {
+      /* Reading overflow keys of a copied node could fix pages that are no longer part of the b-tree. */
+      return NO_ERROR;
+    }
+  if (DB_VALUE_TYPE (key) == DB_TYPE_MIDXKEY && key->data.midxkey.domain == NULL)
+    {
+      /* Use domain from b-tree info. */
+      key->data.midxkey.domain = btid_int->key_type;
+    }
+
+  while (true)
+    {
+      node_header = btree_get_node_header (thread_p, node_copy);
+      if (node_header == NULL || node_header->node_level <= 1)
+	{
+	  /* Safe guard. */
+	  return NO_ERROR;
+	}
+      if (btree_search_nonleaf_page (thread_p, btid_int, node_copy, key, &slotid, &child_vpid, NULL) != NO_ERROR)
+	{
+	  er_clear ();
+	  return NO_ERROR;
+	}
+      if (node_header->node_level == 2)
+	{
+	  /* Child is leaf. */
+	  break;
+	}
+
+      /* Copy child over current node. */
+      node_copy = pgbuf_copy_page_optimistic (thread_p, &child_vpid, PAGE_BTREE, &child_version);
+      if (node_copy == NULL || !pgbuf_check_page_version (thread_p, &node_vpid, node_version))
+	{
+	  return NO_ERROR;
+	}
+      node_vpid = child_vpid;
+      node_version = child_version;
+    }
+
+  *leaf_page = pgbuf_fix (thread_p, &child_vpid, OLD_PAGE, PGBUF_LATCH_READ, PGBUF_UNCONDITIONAL_LATCH);
+  if (*leaf_page == NULL)
+    {
+      ASSERT_ERROR_AND_SET (error_code);
+      return error_code;
+    }
+  if (!pgbuf_check_page_version (thread_p, &node_vpid, node_version))
+    {
+      /* Parent changed, leaf may no longer cover key. */
+      pgbuf_unfix_and_init (thread_p, *leaf_page);
+      return NO_ERROR;
+    }
+  assert (btree_get_node_header (thread_p, *leaf_page) != NULL
+	  && btree_get_node_header (thread_p, *leaf_page)->node_level == 1);
+#endif /* SERVER_MODE */
+
+  return NO_ERROR;
+}
+
+/*
+ * btree_ahi_entry_alloc () - Allocate an adaptive hash index entry.
+ *
+ * return : Allocated entry or NULL.
+ */
+static void *
+btree_ahi_entry_alloc (void)
+{
+  BTREE_AHI_ENTRY *entry = (BTREE_AHI_ENTRY *) malloc (sizeof (BTREE_AHI_ENTRY));
+  if (entry == NULL)
+    {
+      return NULL;
+    }
+  pthread_mutex_init (&entry->mutex, NULL);
+  return entry;
+}
+
+/*
+ * btree_ahi_entry_free () - Free an adaptive hash index entry.
+ *
+ * return     : NO_ERROR.
+ * entry (in) : Adaptive hash index entry.
+ */
+static int
+btree_ahi_entry_free (void *entry)
+{
+  pthread_mutex_destroy (&((BTREE_AHI_ENTRY *) entry)->mutex);
+  free (entry);
+  return NO_ERROR;
+}
+
+/*
+ * btree_ahi_copy_key () - Copy adaptive hash index key.
+ *
+ * return     : NO_ERROR.
+ * src (in)   : Source key.
+ * dest (out) : Destination key.
+ */
+static int
+btree_ahi_copy_key (void *src, void *dest)
+{
+  *(BTREE_AHI_KEY *) dest = *(BTREE_AHI_KEY *) src;
+  return NO_ERROR;
+}
+
+/*
+ * btree_ahi_compare_key () - Compare adaptive hash index keys.
+ *
+ * return    : 0 if keys are equal, non-zero otherwise.
+ * key1 (in) : First key.
+ * key2 (in) : Second key.
+ */
+static int
+btree_ahi_compare_key (void *key1, void *key2)
+{
+  BTREE_AHI_KEY *ahi_key1 = (BTREE_AHI_KEY *) key1;
+  BTREE_AHI_KEY *ahi_key2 = (BTREE_AHI_KEY *) key2;
+
+  if (ahi_key1->key_hash != ahi_key2->key_hash)
+    {
+      return 1;
+    }
+  return btree_compare_btids (&ahi_key1->btid, &ahi_key2->btid);
+}
+
+/*
+ * btree_ahi_hash_key () - Hash adaptive hash index key.
+ *
+ * return	  : Hash value.
+ * key (in)	  : Adaptive hash index key.
+ * hash_size (in) : Hash table size.
+ */
+static unsigned int
+btree_ahi_hash_key (void *key, int hash_size)
+{
+  BTREE_AHI_KEY *ahi_key = (BTREE_AHI_KEY *) key;
+
+  return (ahi_key->key_hash ^ btree_hash_btid (&ahi_key->btid, INT_MAX)) % hash_size;
+}
+
+/*
+ * btree_ahi_make_key () - Make adaptive hash index key for b-tree key value.
+ *
+ * return	 : True if key value can be hashed, false otherwise.
+ * btid (in)	 : B-tree identifier.
+ * key (in)	 : Key value.
+ * ahi_key (out) : Adaptive hash index key.
+ */
+static bool
+btree_ahi_make_key (BTID * btid, DB_VALUE * key, BTREE_AHI_KEY * ahi_key)
+{
+  if (DB_IS_NULL (key))
+    {
+      return false;
+    }
+
+  switch (DB_VALUE_TYPE (key))
+    {
+    case DB_TYPE_MIDXKEY:
+      if (key->data.midxkey.buf == NULL || key->data.midxkey.size <= 0)
+	{
+	  return false;
+	}
+      ahi_key->key_hash = mht_2str_pseudo_key (key->data.midxkey.buf, key->data.midxkey.size);
+      break;
+
+    case DB_TYPE_INTEGER:
+    case DB_TYPE_SHORT:
+    case DB_TYPE_BIGINT:
+    case DB_TYPE_FLOAT:
+    case DB_TYPE_DOUBLE:
+    case DB_TYPE_NUMERIC:
+    case DB_TYPE_MONETARY:
+    case DB_TYPE_CHAR:
+    case DB_TYPE_NCHAR:
+    case DB_TYPE_VARCHAR:
+    case DB_TYPE_VARNCHAR:
+    case DB_TYPE_DATE:
+    case DB_TYPE_TIME:
+    case DB_TYPE_TIMESTAMP:
+    case DB_TYPE_DATETIME:
+      ahi_key->key_hash = mht_valhash (key, UINT_MAX);
+      break;
+
+    default:
+      /* Other types are not hashed by value. */
+      return false;
+    }
+
+  BTID_COPY (&ahi_key->btid, btid);
+  return true;
+}
+
+/*
+ * btree_ahi_initialize () - Initialize adaptive hash index.
+ *
+ * return	 : Error code.
+ * thread_p (in) : Thread entry.
+ */
+int
+btree_ahi_initialize (THREAD_ENTRY * thread_p)
+{
+  btree_ahi_Enabled = false;
+
+  btree_ahi_Max_entries = prm_get_integer_value (PRM_ID_BTREE_ADAPTIVE_HASH_ENTRIES);
+  if (btree_ahi_Max_entries <= 0)
+    {
+      /* Adaptive hash index disabled. */
+      return NO_ERROR;
+    }
+
+  /* Initialize free list */
+  const int freelist_block_count = 2;
+  const int freelist_block_size = std::max (1, btree_ahi_Max_entries / freelist_block_count);
+  btree_ahi_Hashmap.init (btree_ahi_Ts, THREAD_TS_BTREE_AHI, btree_ahi_Max_entries, freelist_block_size,
+			  freelist_block_count, btree_ahi_Entry_descriptor);
+  btree_ahi_Entry_count = 0;
+  btree_ahi_Is_sweeping = 0;
+  memset (btree_ahi_Candidates, 0, sizeof (btree_ahi_Candidates));
+
+  btree_ahi_Enabled = true;
+  return NO_ERROR;
+}
+
+/*
+ * btree_ahi_finalize () - Finalize adaptive hash index.
+ *
+ * return	 : Void.
+ * thread_p (in) : Thread entry.
+ */
+void
+btree_ahi_finalize (THREAD_ENTRY * thread_p)
+{
+  if (!btree_ahi_Enabled)
+    {
+      return;
+    }
+
+  btree_ahi_Hashmap.destroy ();
+  btree_ahi_Entry_count = 0;
+
+  btree_ahi_Enabled = false;
+}
+
+/*
+ * btree_ahi_remove () - Remove a stale mapping from adaptive hash index.
+ *
+ * return	 : Void.
+ * thread_p (in) : Thread entry.
+ * ahi_key (in)	 : Adaptive hash index key.
+ */
+static void
+btree_ahi_remove (THREAD_ENTRY * thread_p, BTREE_AHI_KEY * ahi_key)
+{
+  if (btree_ahi_Hashmap.erase (thread_p, *ahi_key))
+    {
+      ATOMIC_INC_32 (&btree_ahi_Entry_count, -1);
+    }
+}
+
+/*
+ * btree_ahi_collect () - Collect keys of adaptive hash index entries to remove.
+ *
+ * return	  : Number of collected keys, at most BTREE_AHI_SWEEP_COUNT.
+ * thread_p (in)  : Thread entry.
+ * btid (in)	  : Collect all entries of this b-tree; NULL to collect entries not hit since the previous sweep.
+ * ahi_keys (out) : Collected keys.
+ *
+ * Note: Entries cannot be removed while iterating, because the iteration holds the latch-free transaction.
+ */
+static int
+btree_ahi_collect (THREAD_ENTRY * thread_p, BTID * btid, BTREE_AHI_KEY * ahi_keys)
+{
+  BTREE_AHI_ENTRY *entry;
+  int n_keys = 0;
+  // *INDENT-OFF*
+  btree_ahi_hashmap_iterator iter { thread_p, btree_ahi_Hashmap };
+  // *INDENT-ON*
+
+  for (entry = iter.iterate (); entry != NULL; entry = iter.iterate ())
+    {
+      if (btid != NULL)
+	{
+	  if (!BTID_IS_EQUAL (&entry->key.btid, btid))
+	    {
+	      continue;
+	    }
+	}
+      else if (entry->is_referenced)
+	{
+	  /* Second chance. */
+	  entry->is_referenced = false;
+	  continue;
+	}
+
+      ahi_keys[n_keys++] = entry->key;
+      if (n_keys == BTREE_AHI_SWEEP_COUNT)
+	{
+	  /* Interrupt iteration. */
+	  btree_ahi_Hashmap.unlock (thread_p, entry);
+	  iter.restart ();
+	  break;
+	}
+    }
+
+  return n_keys;
+}
+
+/*
+ * btree_ahi_sweep () - Make room in a full adaptive hash index.
+ *
+ * return	 : Void.
+ * thread_p (in) : Thread entry.
+ *
+ * Note: Removes up to BTREE_AHI_SWEEP_COUNT entries that were not hit since the previous sweep, clearing the
+ *	 reference flags of the entries it passes. Only one thread sweeps at a time; the others go on without adding
+ *	 their keys.
+ */
+static void
+btree_ahi_sweep (THREAD_ENTRY * thread_p)
+{
+  BTREE_AHI_KEY ahi_keys[BTREE_AHI_SWEEP_COUNT];
+  int n_keys, i;
+
+  if (!ATOMIC_CAS_32 (&btree_ahi_Is_sweeping, 0, 1))
+    {
+      return;
+    }
+
+  n_keys = btree_ahi_collect (thread_p, NULL, ahi_keys);
+  for (i = 0; i < n_keys; i++)
+    {
+      btree_ahi_remove (thread_p, &ahi_keys[i]);
+    }
+
+  ATOMIC_TAS_32 (&btree_ahi_Is_sweeping, 0);
+}
+
+/*
+ * btree_ahi_remove_btid () - Remove all adaptive hash index entries of a b-tree.
+ *
+ * return	 : Void.
+ * thread_p (in) : Thread entry.
+ * btid (in)	 : B-tree identifier.
+ */
+static void
+btree_ahi_remove_btid (THREAD_ENTRY * thread_p, BTID * btid)
+{
+  BTREE_AHI_KEY ahi_keys[BTREE_AHI_SWEEP_COUNT];
+  int n_keys, i;
+
+  if (!btree_ahi_Enabled)
+    {
+      return;
+    }
+
+  do
+    {
+      n_keys = btree_ahi_collect (thread_p, btid, ahi_keys);
+      for (i = 0; i < n_keys; i++)
+	{
+	  btree_ahi_remove (thread_p, &ahi_keys[i]);
+	}
+    }
+  while (n_keys == BTREE_AHI_SWEEP_COUNT);
+}
+
+/*
+ * btree_ahi_is_whole_key () - Is key value a whole key of b-tree (and not just a prefix of a multi-column key)?
+ *
+ * return	 : True if key has a value for each b-tree column.
+ * btid_int (in) : B-tree info.
+ * key (in)	 : Key value.
+ *
+ * Note: Only a whole key is found in a b-tree slot. A scan starting from a key prefix must go to the first key having
+ *	 that prefix, which is known only by traversal.
+ */
+static bool
+btree_ahi_is_whole_key (BTID_INT * btid_int, DB_VALUE * key)
+{
+  if (DB_IS_NULL (key) || btid_int->key_type == NULL)
+    {
+      return false;
+    }
+  if (DB_VALUE_TYPE (key) != DB_TYPE_MIDXKEY)
+    {
+      return true;
+    }
+  return (TP_DOMAIN_TYPE (btid_int->key_type) == DB_TYPE_MIDXKEY
+	  && key->data.midxkey.ncolumns == tp_domain_size (btid_int->key_type->setdomain));
+}
+
+/*
+ * btree_ahi_fix_leaf () - Fix the leaf page of key learned by adaptive hash index.
+ *
+ * return	       : Error code.
+ * thread_p (in)       : Thread entry.
+ * btid (in)	       : B-tree identifier.
+ * btid_int (out)      : BTID_INT (B-tree data).
+ * reuse_btid_int (in) : True if btid_int is already filled; it is not overwritten then.
+ * key (in)	       : Search key value.
+ * leaf_page (out)     : Read latched leaf page where key was found or NULL if the regular traversal must be used.
+ * search_key (out)    : Search key result.
+ */
+static int
+btree_ahi_fix_leaf (THREAD_ENTRY * thread_p, BTID * btid, BTID_INT * btid_int, bool reuse_btid_int, DB_VALUE * key,
+		    PAGE_PTR * leaf_page, BTREE_SEARCH_KEY_HELPER * search_key)
+{
+  BTREE_AHI_KEY ahi_key;
+  BTREE_AHI_ENTRY *entry = NULL;
+  BTID_INT entry_btid_int;
+  VPID leaf_vpid;
+  PGSLOTID slotid;
+  LOG_LSA leaf_lsa;
+  RECDES record;
+  LEAF_REC leaf_info;
+  DB_VALUE slot_key;
+  bool clear_key = false;
+  int offset;
+  bool is_equal;
+
+  assert (leaf_page != NULL && *leaf_page == NULL);
+
+  if (!btree_ahi_Enabled || !btree_ahi_make_key (btid, key, &ahi_key))
+    {
+      return NO_ERROR;
+    }
+
+  entry = btree_ahi_Hashmap.find (thread_p, ahi_key);
+  if (entry == NULL)
+    {
+      return NO_ERROR;
+    }
+  entry_btid_int = entry->btid_int;
+  leaf_vpid = entry->leaf_vpid;
+  slotid = entry->slotid;
+  LSA_COPY (&leaf_lsa, &entry->leaf_lsa);
+  entry->is_referenced = true;
+  btree_ahi_Hashmap.unlock (thread_p, entry);
+
+  *leaf_page = pgbuf_fix (thread_p, &leaf_vpid, OLD_PAGE_IF_IN_BUFFER, PGBUF_LATCH_READ, PGBUF_UNCONDITIONAL_LATCH);
+  if (*leaf_page == NULL)
+    {
+      /* Page is not in buffer or it was deallocated. */
+      if (er_errid () == ER_INTERRUPTED)
+	{
+	  return ER_INTERRUPTED;
+	}
+      er_clear ();
+      btree_ahi_remove (thread_p, &ahi_key);
+      return NO_ERROR;
+    }
+  if (!LSA_EQ (pgbuf_get_lsa (*leaf_page), &leaf_lsa))
+    {
+      /* Leaf page changed since the mapping was learned. */
+      pgbuf_unfix_and_init (thread_p, *leaf_page);
+      btree_ahi_remove (thread_p, &ahi_key);
+      return NO_ERROR;
+    }
+
+  /* Page is unchanged and it is the leaf of this b-tree. Make sure the key in slot is the searched key and not just
+   * a key with the same hash. */
+  entry_btid_int.sys_btid = btid;
+  if (DB_VALUE_TYPE (key) == DB_TYPE_MIDXKEY && key->data.midxkey.domain == NULL)
+    {
+      /* Use domain from b-tree info. */
+      key->data.midxkey.domain = entry_btid_int.key_type;
+    }
+  if (spage_get_record (thread_p, *leaf_page, slotid, &record, PEEK) != S_SUCCESS
+      || btree_read_record (thread_p, &entry_btid_int, *leaf_page, &record, &slot_key, &leaf_info, BTREE_LEAF_NODE,
+			    &clear_key, &offset, PEEK_KEY_VALUE, NULL) != NO_ERROR)
+    {
+      er_clear ();
+      pgbuf_unfix_and_init (thread_p, *leaf_page);
+      return NO_ERROR;
+    }
+  is_equal = btree_compare_key (key, &slot_key, entry_btid_int.key_type, 1, 1, NULL) == DB_EQ;
+  btree_clear_key_value (&clear_key, &slot_key);
+  if (!is_equal)
+    {
+      /* Hash collision. */
+      pgbuf_unfix_and_init (thread_p, *leaf_page);
+      return NO_ERROR;
+    }
+
+  if (!reuse_btid_int)
+    {
+      *btid_int = entry_btid_int;
+    }
+  search_key->result = BTREE_KEY_FOUND;
+  search_key->slotid = slotid;
+  return NO_ERROR;
+}
+
+/*
+ * btree_ahi_learn () - Add the leaf page and slot of a found key to adaptive hash index.
+ *
+ * return	 : Void.
+ * thread_p (in) : Thread entry.
+ * btid (in)	 : B-tree identifier.
+ * btid_int (in) : BTID_INT (B-tree data).
+ * key (in)	 : Key value.
+ * leaf_page (in): Leaf page where key was found.
+ * slotid (in)	 : Slot of key in leaf page.
+ *
+ * Note: Only keys looked up again while their hash is still remembered as candidate are added. Once the maximum
+ *	 number of entries is reached, a sweep removes entries that were not hit recently before the key is added.
+ */
+static void
+btree_ahi_learn (THREAD_ENTRY * thread_p, BTID * btid, BTID_INT * btid_int, DB_VALUE * key, PAGE_PTR leaf_page,
+		 PGSLOTID slotid)
+{
+  BTREE_AHI_KEY ahi_key;
+  BTREE_AHI_ENTRY *entry = NULL;
+  unsigned int candidate_hash;
+  unsigned int *candidate;
+
+  if (!btree_ahi_Enabled || !btree_ahi_make_key (btid, key, &ahi_key))
+    {
+      return;
+    }
+
+  candidate_hash = btree_ahi_hash_key (&ahi_key, INT_MAX) | 1;
+  candidate = &btree_ahi_Candidates[candidate_hash % BTREE_AHI_CANDIDATE_COUNT];
+  if (*candidate != candidate_hash)
+    {
+      /* First lookup. Remember it. */
+      *candidate = candidate_hash;
+      return;
+    }
+  if (btree_ahi_Entry_count >= btree_ahi_Max_entries)
+    {
+      /* Full. */
+      btree_ahi_sweep (thread_p);
+      if (btree_ahi_Entry_count >= btree_ahi_Max_entries)
+	{
+	  return;
+	}
+    }
+
+  if (btree_ahi_Hashmap.find_or_insert (thread_p, ahi_key, entry))
+    {
+      ATOMIC_INC_32 (&btree_ahi_Entry_count, 1);
+    }
+  if (entry == NULL)
+    {
+      er_clear ();
+      return;
+    }
+  entry->btid_int = *btid_int;
+  entry->btid_int.sys_btid = NULL;
+  entry->btid_int.copy_buf = NULL;
+  entry->btid_int.copy_buf_len = 0;
+  pgbuf_get_vpid (leaf_page, &entry->leaf_vpid);
+  entry->slotid = slotid;
+  LSA_COPY (&entry->leaf_lsa, pgbuf_get_lsa (leaf_page));
+  entry->is_referenced = true;
+  btree_ahi_Hashmap.unlock (thread_p, entry);
+}
+
+/*
+ * btree_bloom_entry_alloc () - Allocate a unique index Bloom filter entry.
+ *
+ * return : Allocated entry or NULL.
+ */
+static void *
+btree_bloom_entry_alloc (void)
+{
+  BTREE_BLOOM_ENTRY *entry = (BTREE_BLOOM_ENTRY *) malloc (sizeof (BTREE_BLOOM_ENTRY));
+  if (entry == NULL)
+    {
+      return NULL;
+    }
+  pthread_mutex_init (&entry->mutex, NULL);
+  return entry;
+}
+
+/*
+ * btree_bloom_entry_free () - Free a unique index Bloom filter entry.
+ *
+ * return     : NO_ERROR.
+ * entry (in) : Bloom filter entry.
+ */
+static int
+btree_bloom_entry_free (void *entry)
+{
+  pthread_mutex_destroy (&((BTREE_BLOOM_ENTRY *) entry)->mutex);
+  free (entry);
+  return NO_ERROR;
+}
+
+/*
+ * btree_bloom_entry_init () - Initialize a unique index Bloom filter entry.
+ *
+ * return     : NO_ERROR.
+ * entry (in) : Bloom filter entry.
+ */
+static int
+btree_bloom_entry_init (void *entry)
+{
+  BTREE_BLOOM_ENTRY *bloom_entry = (BTREE_BLOOM_ENTRY *) entry;
+
+  bloom_entry->filter = NULL;
+  bloom_entry->key_type = NULL;
+  bloom_entry->capacity = 0;
+  OID_SET_NULL (&bloom_entry->class_oid);
+  bloom_entry->is_build_requested = false;
+  bloom_entry->is_ready = false;
+  return NO_ERROR;
+}
+
+/*
+ * btree_bloom_copy_key () - Copy unique index Bloom filter entry key (b-tree identifier).
+ *
+ * return     : NO_ERROR.
+ * src (in)   : Source key.
+ * dest (out) : Destination key.
+ */
+static int
+btree_bloom_copy_key (void *src, void *dest)
+{
+  BTID_COPY ((BTID *) dest, (BTID *) src);
+  return NO_ERROR;
+}
+
+/*
+ * btree_delta_entry_alloc () - Allocate a statistics delta entry.
+ *
+ * return : Allocated entry or NULL.
+ */
+static void *
+btree_delta_entry_alloc (void)
+{
+  return malloc (sizeof (BTREE_DELTA_ENTRY));
+}
+
+/*
+ * btree_delta_entry_free () - Free a statistics delta entry.
+ *
+ * return     : NO_ERROR.
+ * entry (in) : Statistics delta entry.
+ */
+static int
+btree_delta_entry_free (void *entry)
+{
+  free (entry);
+  return NO_ERROR;
+}
+
+/*
+ * btree_delta_entry_init () - Initialize a statistics delta entry.
+ *
+ * return     : NO_ERROR.
+ * entry (in) : Statistics delta entry.
+ */
+static int
+btree_delta_entry_init (void *entry)
+{
+  BTREE_DELTA_ENTRY *delta_entry = (BTREE_DELTA_ENTRY *) entry;
+  int i;
+
+  for (i = 0; i < BTREE_DELTA_SHARDS; i++)
+    {
+      delta_entry->shards[i].inserts = 0;
+      delta_entry->shards[i].deletes = 0;
+    }
+  delta_entry->refresh_changes = 0;
+  delta_entry->class_objects = 0;
+  delta_entry->time_stamp = 0;
+  delta_entry->n_columns = 0;
+  delta_entry->n_sketches = 0;
+  delta_entry->registers = NULL;
+  return NO_ERROR;
+}
+
+/*
+ * btree_delta_entry_uninit () - Free the sketches of a statistics delta entry when it is reclaimed.
+ *
+ * return     : NO_ERROR.
+ * entry (in) : Statistics delta entry.
+ *
+ * Note: Sketches are not freed when the entry is removed, because other threads may still update them.
+ */
+static int
+btree_delta_entry_uninit (void *entry)
+{
+  BTREE_DELTA_ENTRY *delta_entry = (BTREE_DELTA_ENTRY *) entry;
+
+  if (delta_entry->registers != NULL)
+    {
+      free (delta_entry->registers);
+      delta_entry->registers = NULL;
+    }
+  delta_entry->n_sketches = 0;
+  return NO_ERROR;
+}
+
+/*
+ * btree_bloom_is_hashable_type () - Can values of this type be hashed consistently with key comparison?
+ *
+ * return    : True if values of type are hashed by btree_bloom_hash_value.
+ * type (in) : Value type.
+ */
+static bool
+btree_bloom_is_hashable_type (DB_TYPE type)
+{
+  switch (type)
+    {
+    case DB_TYPE_INTEGER:
+    case DB_TYPE_SHORT:
+    case DB_TYPE_BIGINT:
+    case DB_TYPE_DATE:
+    case DB_TYPE_TIME:
+    case DB_TYPE_TIMESTAMP:
+    case DB_TYPE_DATETIME:
+    case DB_TYPE_CHAR:
+    case DB_TYPE_NCHAR:
+    case DB_TYPE_VARCHAR:
+    case DB_TYPE_VARNCHAR:
+      return true;
+    default:
+      /* Equal values of other types may have different representations. */
+      return false;
+    }
+}
+
+/*
+ * btree_bloom_is_hashable_domain () - Can keys of this index domain be added to a Bloom filter?
+ *
+ * return	 : True if all key columns can be hashed.
+ * key_type (in) : Key domain.
+ */
+static bool
+btree_bloom_is_hashable_domain (TP_DOMAIN * key_type)
+{
+  TP_DOMAIN *dom;
+
+  if (TP_DOMAIN_TYPE (key_type) != DB_TYPE_MIDXKEY)
+    {
+      return btree_bloom_is_hashable_type (TP_DOMAIN_TYPE (key_type));
+    }
+
+  for (dom = key_type->setdomain; dom != NULL; dom = dom->next)
+    {
+      if (!btree_bloom_is_hashable_type (TP_DOMAIN_TYPE (dom)))
+	{
+	  return false;
+	}
+    }
+  return true;
+}
+
+/*
+ * btree_bloom_hash_value () - Hash a key column value so that values equal by comparison have the same hash.
+ *
+ * return	     : Hash value.
+ * value (in)	     : Key column value of a hashable type.
+ */
+static unsigned int
+btree_bloom_hash_value (DB_VALUE * value)
+{
+  const char *str;
+  int size;
+  DB_BIGINT bigint;
+
+  if (DB_IS_NULL (value))
+    {
+      return 0;
+    }
+
+  switch (DB_VALUE_TYPE (value))
+    {
+    case DB_TYPE_INTEGER:
+      return (unsigned int) db_get_int (value);
+    case DB_TYPE_SHORT:
+      return (unsigned int) db_get_short (value);
+    case DB_TYPE_BIGINT:
+      bigint = db_get_bigint (value);
+      return (unsigned int) (bigint >> 32) ^ (unsigned int) bigint;
+    case DB_TYPE_DATE:
+      return (unsigned int) *db_get_date (value);
+    case DB_TYPE_TIME:
+      return (unsigned int) *db_get_time (value);
+    case DB_TYPE_TIMESTAMP:
+      return (unsigned int) *db_get_timestamp (value);
+    case DB_TYPE_DATETIME:
+      return db_get_datetime (value)->date * 31 + db_get_datetime (value)->time;
+    case DB_TYPE_CHAR:
+    case DB_TYPE_NCHAR:
+    case DB_TYPE_VARCHAR:
+    case DB_TYPE_VARNCHAR:
+      str = db_get_string (value);
+      size = db_get_string_size (value);
+      if (str == NULL || size <= 0)
+	{
+	  return 0;
+	}
+      /* trailing spaces are ignored by comparison; other characters are hashed by collation */
+      while (size > 0 && str[size - 1] == ' ')
+	{
+	  size--;
+	}
+      return size > 0 ? MHT2STR_COLL (db_get_string_collation (value), (unsigned char *) str, size) : 0;
+    default:
+      assert (false);
+      return 0;
+    }
+}
+
+/*
+ * btree_bloom_hash_key () - Hash a key of unique index for its Bloom filter.
+ *
+ * return	 : True if key was hashed, false if it cannot be checked against the filter.
+ * key_type (in) : Key domain of the index.
+ * key (in)	 : Key value.
+ * hash (out)	 : Key hash.
+ */
+static bool
+btree_bloom_hash_key (TP_DOMAIN * key_type, DB_VALUE * key, unsigned int *hash)
+{
+  DB_MIDXKEY midxkey;
+  DB_VALUE elem;
+  TP_DOMAIN *dom;
+  int ncolumns, i;
+
+  if (TP_DOMAIN_TYPE (key_type) != DB_TYPE_MIDXKEY)
+    {
+      if (DB_VALUE_TYPE (key) != TP_DOMAIN_TYPE (key_type))
+	{
+	  return false;
+	}
+      if (TP_IS_CHAR_TYPE (DB_VALUE_TYPE (key)) && db_get_string_collation (key) != key_type->collation_id)
+	{
+	  /* Must be hashed with index collation. */
+	  return false;
+	}
+      *hash = btree_bloom_hash_value (key);
+      return true;
+    }
+
+  if (DB_VALUE_TYPE (key) != DB_TYPE_MIDXKEY)
+    {
+      return false;
+    }
+  midxkey = key->data.midxkey;
+  if (midxkey.domain == NULL)
+    {
+      midxkey.domain = key_type;
+    }
+  else if (midxkey.domain != key_type && !tp_domain_match (midxkey.domain, key_type, TP_EXACT_MATCH))
+    {
+      return false;
+    }
+  for (ncolumns = 0, dom = key_type->setdomain; dom != NULL; dom = dom->next)
+    {
+      ncolumns++;
+    }
+  if (midxkey.ncolumns != ncolumns)
+    {
+      /* Partial key. */
+      return false;
+    }
+
+  *hash = 0;
+  for (i = 0; i < ncolumns; i++)
+    {
+      if (pr_midxkey_get_element_nocopy (&midxkey, i, &elem, NULL, NULL) != NO_ERROR)
+	{
+	  er_clear ();
+	  return false;
+	}
+      *hash = *hash * 31 + btree_bloom_hash_value (&elem);
+    }
+  return true;
+}
+
+/*
+ * btree_bloom_initialize () - Initialize unique index Bloom filters.
+ *
+ * return	 : Error code.
+ * thread_p (in) : Thread entry.
+ */
+int
+btree_bloom_initialize (THREAD_ENTRY * thread_p)
+{
+  btree_bloom_Enabled = false;
+
+#if defined (SERVER_MODE)
+  if (!prm_get_bool_value (PRM_ID_BTREE_UNIQUE_BLOOM_FILTER))
+    {
+      /* Unique index Bloom filters disabled. */
+      return NO_ERROR;
+    }
+
+  /* Initialize free list */
+  const int hash_size = 1024;
+  const int freelist_block_count = 2;
+  const int freelist_block_size = hash_size / freelist_block_count;
+  btree_bloom_Hashmap.init (btree_bloom_Ts, THREAD_TS_BTREE_BLOOM, hash_size, freelist_block_size,
+			    freelist_block_count, btree_bloom_Entry_descriptor);
+
+  // *INDENT-OFF*
+  cubthread::looper looper = cubthread::looper (std::chrono::seconds (BTREE_BLOOM_BUILD_PERIOD_IN_SEC));
+  cubthread::entry_callable_task *daemon_task =
+    new cubthread::entry_callable_task (std::bind (btree_bloom_build_daemon_execute, std::placeholders::_1));
+  // *INDENT-ON*
+  btree_bloom_Build_daemon = cubthread::get_manager ()->create_daemon (looper, daemon_task, "btree_bloom_build");
+
+  btree_bloom_Enabled = true;
+#endif /* SERVER_MODE */
+  return NO_ERROR;
+}
+
+/*
+ * btree_bloom_finalize () - Finalize unique index Bloom filters.
+ *
+ * return	 : Void.
+ * thread_p (in) : Thread entry.
+ */
+void
+btree_bloom_finalize (THREAD_ENTRY * thread_p)
+{
+  BTREE_BLOOM_ENTRY *entry;
+  HL_HEAPID save_heapid;
+
+  if (!btree_bloom_Enabled)
+    {
+      return;
+    }
+
+#if defined (SERVER_MODE)
+  cubthread::get_manager ()->destroy_daemon (btree_bloom_Build_daemon);
+#endif /* SERVER_MODE */
+
+  /* Filters are allocated in global heap. */
+  save_heapid = db_change_private_heap (thread_p, 0);
+  {
+    // *INDENT-OFF*
+    btree_bloom_hashmap_iterator iter { thread_p, btree_bloom_Hashmap };
+    // *INDENT-ON*
+    for (entry = iter.iterate (); entry != NULL; entry = iter.iterate ())
+      {
+	bloom_destroy (thread_p, entry->filter);
+	entry->filter = NULL;
+      }
+  }
+  (void) db_change_private_heap (thread_p, save_heapid);
+
+  btree_bloom_Hashmap.destroy ();
+
+  btree_bloom_Enabled = false;
+}
+
+/*
+ * btree_bloom_invalidate () - Discard the Bloom filter of unique index.
+ *
+ * return	 : Void.
+ * thread_p (in) : Thread entry.
+ * btid (in)	 : B-tree identifier.
+ */
+static void
+btree_bloom_invalidate (THREAD_ENTRY * thread_p, BTID * btid)
+{
+  BTREE_BLOOM_ENTRY *entry;
+  BLOOM_FILTER *filter;
+  HL_HEAPID save_heapid;
+  BTID key = *btid;
+
+  if (!btree_bloom_Enabled)
+    {
+      return;
+    }
+
+  entry = btree_bloom_Hashmap.find (thread_p, key);
+  if (entry == NULL)
+    {
+      return;
+    }
+  filter = entry->filter;
+  entry->filter = NULL;
+  entry->is_build_requested = false;
+  entry->is_ready = false;
+  if (!btree_bloom_Hashmap.erase_locked (thread_p, key, entry))
+    {
+      assert (false);
+    }
+
+  save_heapid = db_change_private_heap (thread_p, 0);
+  bloom_destroy (thread_p, filter);
+  (void) db_change_private_heap (thread_p, save_heapid);
+}
+
+/*
+ * btree_bloom_add_key () - Add key inserted in unique index to its Bloom filter.
+ *
+ * return	 : True if the filter of index is ready and did not contain the key before, i.e. key is new to index.
+ * thread_p (in) : Thread entry.
+ * btid (in)	 : B-tree identifier.
+ * key (in)	 : Key value.
+ *
+ * Note: Must be called while the leaf page where key is inserted is latched for write, before the key is written.
+ *	 A filter builder registers its filter before it scans the leaves, so either the key is added here or the
+ *	 builder finds it in the leaf.
+ */
+static bool
+btree_bloom_add_key (THREAD_ENTRY * thread_p, BTID * btid, DB_VALUE * key)
+{
+  BTREE_BLOOM_ENTRY *entry;
+  unsigned int hash;
+  bool is_full = false;
+  bool is_new_key = false;
+
+  if (!btree_bloom_Enabled)
+    {
+      return false;
+    }
+
+  entry = btree_bloom_Hashmap.find (thread_p, *btid);
+  if (entry == NULL)
+    {
+      return false;
+    }
+  if (entry->filter != NULL)
+    {
+      if (btree_bloom_hash_key (entry->key_type, key, &hash))
+	{
+	  is_new_key = entry->is_ready && !bloom_may_contain (entry->filter, hash);
+	  bloom_add (entry->filter, hash);
+	}
+      else
+	{
+	  /* Key cannot be hashed; filter can no longer be trusted. */
+	  is_full = true;
+	}
+      is_full = is_full || entry->filter->nitems > entry->capacity;
+    }
+  btree_bloom_Hashmap.unlock (thread_p, entry);
+
+  if (is_full)
+    {
+      /* Too many false positives. Build a bigger filter when needed. */
+      btree_bloom_invalidate (thread_p, btid);
+    }
+  return is_new_key;
+}
+
+/*
+ * btree_bloom_note_leaf_merge () - Discard the Bloom filter of unique index if it is being built when two of its
+ *				     leaves are merged.
+ *
+ * return	 : Void.
+ * thread_p (in) : Thread entry.
+ * btid (in)	 : B-tree identifier.
+ *
+ * Note: Must be called while both leaves are latched for write. A merge moves the keys of the right leaf to the left
+ *	 leaf. If the builder has already scanned the left leaf and not yet the right one, it would miss these keys, so
+ *	 the filter is discarded and built again on a later lookup. Ready filters hold all keys and are kept.
+ */
+static void
+btree_bloom_note_leaf_merge (THREAD_ENTRY * thread_p, BTID * btid)
+{
+  BTREE_BLOOM_ENTRY *entry;
+  bool is_building;
+
+  if (!btree_bloom_Enabled)
+    {
+      return;
+    }
+
+  entry = btree_bloom_Hashmap.find (thread_p, *btid);
+  if (entry == NULL)
+    {
+      return;
+    }
+  is_building = entry->filter != NULL && !entry->is_ready;
+  btree_bloom_Hashmap.unlock (thread_p, entry);
+
+  if (is_building)
+    {
+      btree_bloom_invalidate (thread_p, btid);
+    }
+}
+
+#if defined (SERVER_MODE)
+/*
+ * btree_bloom_build () - Build the requested Bloom filter of unique index from the keys in its leaves.
+ *
+ * return	 : Void. The filter is not built on error.
+ * thread_p (in) : Thread entry.
+ * btid (in)	 : B-tree identifier.
+ *
+ * Note: The caller holds a lock on the class of index, so the index cannot be dropped during the scan. The filter is
+ *	 registered before the leaves are scanned; keys inserted meanwhile are added by the inserters. A leaf merge
+ *	 during the scan discards the filter (see btree_bloom_note_leaf_merge), which the scan notices before the filter
+ *	 is made ready. The filter is used by lookups only after the scan is complete.
+ */
+static void
+btree_bloom_build (THREAD_ENTRY * thread_p, BTID * btid)
+{
+  BTREE_SCAN bts;
+  BTREE_BLOOM_ENTRY *entry = NULL;
+  BTREE_ROOT_HEADER *root_header = NULL;
+  BLOOM_FILTER *filter = NULL;
+  PAGE_PTR root_page = NULL;
+  VPID root_vpid;
+  RECDES record;
+  LEAF_REC leaf_info;
+  DB_VALUE key;
+  bool clear_key = false;
+  int offset;
+  int capacity;
+  unsigned int hashes[BTREE_BLOOM_BUILD_BATCH];
+  int n_hashes = 0, i;
+  HL_HEAPID save_heapid;
+  int error_code = NO_ERROR;
+
+  BTREE_INIT_SCAN (&bts);
+  bts.btid_int.sys_btid = btid;
+
+  root_vpid.volid = btid->vfid.volid;
+  root_vpid.pageid = btid->root_pageid;
+  root_page = pgbuf_fix (thread_p, &root_vpid, OLD_PAGE, PGBUF_LATCH_READ, PGBUF_UNCONDITIONAL_LATCH);
+  if (root_page == NULL)
+    {
+      ASSERT_ERROR ();
+      er_clear ();
+      btree_bloom_invalidate (thread_p, btid);
+      return;
+    }
+  root_header = btree_get_root_header (thread_p, root_page);
+  if (root_header == NULL || btree_glean_root_header_info (thread_p, root_header, &bts.btid_int, true) != NO_ERROR)
+    {
+      pgbuf_unfix_and_init (thread_p, root_page);
+      er_clear ();
+      btree_bloom_invalidate (thread_p, btid);
+      return;
+    }
+  capacity = MAX (root_header->num_keys, 0) * 2 + BTREE_BLOOM_MIN_KEYS;
+  pgbuf_unfix_and_init (thread_p, root_page);
+
+  if (!BTREE_IS_UNIQUE (bts.btid_int.unique_pk) || !btree_bloom_is_hashable_domain (bts.btid_int.key_type))
+    {
+      /* Filter is not used for this index. Keep the entry without filter to remember it. */
+      entry = btree_bloom_Hashmap.find (thread_p, *btid);
+      if (entry != NULL)
+	{
+	  entry->is_build_requested = false;
+	  btree_bloom_Hashmap.unlock (thread_p, entry);
+	}
+      er_clear ();
+      return;
+    }
+
+  save_heapid = db_change_private_heap (thread_p, 0);
+  filter = bloom_create (thread_p, capacity, BLOOM_DEFAULT_BITS_PER_ITEM);
+  (void) db_change_private_heap (thread_p, save_heapid);
+  if (filter == NULL)
+    {
+      er_clear ();
+      return;
+    }
+
+  entry = btree_bloom_Hashmap.find (thread_p, *btid);
+  if (entry == NULL || !entry->is_build_requested)
+    {
+      /* Request was withdrawn. */
+      if (entry != NULL)
+	{
+	  btree_bloom_Hashmap.unlock (thread_p, entry);
+	}
+      save_heapid = db_change_private_heap (thread_p, 0);
+      bloom_destroy (thread_p, filter);
+      (void) db_change_private_heap (thread_p, save_heapid);
+      return;
+    }
+  entry->filter = filter;
+  entry->key_type = bts.btid_int.key_type;
+  entry->capacity = capacity;
+  entry->is_build_requested = false;
+  entry->is_ready = false;
+  btree_bloom_Hashmap.unlock (thread_p, entry);
+
+  /* Scan all keys. */
+  error_code = btree_find_lower_bound_leaf (thread_p, &bts, NULL);
+  while (error_code == NO_ERROR && !BTREE_END_OF_SCAN (&bts))
+    {
+      if (spage_get_record (thread_p, bts.C_page, bts.slot_id, &record, PEEK) != S_SUCCESS)
+	{
+	  error_code = ER_FAILED;
+	  break;
+	}
+      if (!btree_leaf_is_flaged (&record, BTREE_LEAF_RECORD_FENCE))
+	{
+	  error_code =
+	    btree_read_record (thread_p, &bts.btid_int, bts.C_page, &record, &key, &leaf_info, BTREE_LEAF_NODE,
+			       &clear_key, &offset, PEEK_KEY_VALUE, NULL);
+	  if (error_code != NO_ERROR)
+	    {
+	      break;
+	    }
+	  if (!btree_bloom_hash_key (bts.btid_int.key_type, &key, &hashes[n_hashes++]))
+	    {
+	      btree_clear_key_value (&clear_key, &key);
+	      error_code = ER_FAILED;
+	      break;
+	    }
+	  btree_clear_key_value (&clear_key, &key);
+	}
+
+      if (n_hashes == BTREE_BLOOM_BUILD_BATCH)
+	{
+	  entry = btree_bloom_Hashmap.find (thread_p, *btid);
+	  if (entry == NULL || entry->filter != filter)
+	    {
+	      /* Filter was discarded. */
+	      if (entry != NULL)
+		{
+		  btree_bloom_Hashmap.unlock (thread_p, entry);
+		}
+	      filter = NULL;
+	      break;
+	    }
+	  for (i = 0; i < n_hashes; i++)
+	    {
+	      bloom_add (filter, hashes[i]);
+	    }
+	  btree_bloom_Hashmap.unlock (thread_p, entry);
+	  n_hashes = 0;
+	}
+
+      error_code = btree_find_next_index_record (thread_p, &bts);
+    }
+
+  if (bts.P_page != NULL)
+    {
+      pgbuf_unfix_and_init (thread_p, bts.P_page);
+    }
+  if (bts.C_page != NULL)
+    {
+      pgbuf_unfix_and_init (thread_p, bts.C_page);
+    }
+  if (bts.O_page != NULL)
+    {
+      pgbuf_unfix_and_init (thread_p, bts.O_page);
+    }
+
+  if (filter == NULL)
+    {
+      /* Discarded meanwhile. */
+      return;
+    }
+  if (error_code != NO_ERROR)
+    {
+      er_clear ();
+      btree_bloom_invalidate (thread_p, btid);
+      return;
+    }
+
+  /* Add last hashes and let lookups use the filter. */
+  entry = btree_bloom_Hashmap.find (thread_p, *btid);
+  if (entry == NULL)
+    {
+      return;
+    }
+  if (entry->filter == filter)
+    {
+      for (i = 0; i < n_hashes; i++)
+	{
+	  bloom_add (filter, hashes[i]);
+	}
+      entry->is_ready = true;
+    }
+  btree_bloom_Hashmap.unlock (thread_p, entry);
+}
+
+// *INDENT-OFF*
+/*
+ * btree_bloom_build_daemon_execute () - Build the Bloom filters requested by unique key lookups.
+ *
+ * return	   : Void.
+ * thread_ref (in) : Daemon thread entry.
+ *
+ * Note: Each filter is built under an intention lock on its class, taken conditionally; a class that cannot be locked
+ *	 keeps its request for the next run.
+ */
+static void
+btree_bloom_build_daemon_execute (cubthread::entry & thread_ref)
+{
+  THREAD_ENTRY *thread_p = &thread_ref;
+  BTREE_BLOOM_ENTRY *entry;
+  std::vector<std::pair<BTID, OID>> requests;
+  int tran_index;
+
+  if (!BO_IS_SERVER_RESTARTED ())
+    {
+      // wait for boot to finish
+      return;
+    }
+
+  {
+    btree_bloom_hashmap_iterator iter { thread_p, btree_bloom_Hashmap };
+    for (entry = iter.iterate (); entry != NULL; entry = iter.iterate ())
+      {
+	if (entry->is_build_requested)
+	  {
+	    requests.emplace_back (entry->btid, entry->class_oid);
+	  }
+      }
+  }
+  if (requests.empty ())
+    {
+      return;
+    }
+
+  if (logtb_assign_tran_index (thread_p, NULL_TRANID, TRAN_ACTIVE, NULL, NULL, TRAN_LOCK_INFINITE_WAIT,
+			       TRAN_DEFAULT_ISOLATION_LEVEL ()) == NULL_TRAN_INDEX)
+    {
+      er_clear ();
+      return;
+    }
+  tran_index = thread_p->tran_index;
+
+  for (auto &request : requests)
+    {
+      if (lock_object (thread_p, &request.second, oid_Root_class_oid, IS_LOCK, LK_COND_LOCK) != LK_GRANTED)
+	{
+	  er_clear ();
+	  continue;
+	}
+
+      /* Index may have been dropped before the lock was granted, withdrawing the request. */
+      btree_bloom_build (thread_p, &request.first);
+
+      lock_unlock_object (thread_p, &request.second, oid_Root_class_oid, IS_LOCK, true);
+    }
+
+  (void) xtran_server_commit (thread_p, false);
+  logtb_free_tran_index (thread_p, tran_index);
+}
+// *INDENT-ON*
+#endif /* SERVER_MODE */
+
+/*
+ * btree_bloom_may_contain_key () - Check the Bloom filter of unique index for key.
+ *
+ * return	  : False if key is certainly not in index, true otherwise.
+ * thread_p (in)  : Thread entry.
+ * btid (in)	  : B-tree identifier.
+ * class_oid (in) : Class of index, locked by caller.
+ * key (in)	  : Key value.
+ *
+ * Note: The first lookup of an index requests its filter from the builder daemon and does not wait for it.
+ */
+static bool
+btree_bloom_may_contain_key (THREAD_ENTRY * thread_p, BTID * btid, OID * class_oid, DB_VALUE * key)
+{
+  BTREE_BLOOM_ENTRY *entry;
+  unsigned int hash;
+  bool may_contain = true;
+
+  if (!btree_bloom_Enabled)
+    {
+      return true;
+    }
+
+  entry = btree_bloom_Hashmap.find (thread_p, *btid);
+  if (entry == NULL)
+    {
+#if defined (SERVER_MODE)
+      if (class_oid == NULL || OID_ISNULL (class_oid))
+	{
+	  return true;
+	}
+      /* Request filter for next lookups. */
+      if (btree_bloom_Hashmap.find_or_insert (thread_p, *btid, entry) && entry != NULL)
+	{
+	  COPY_OID (&entry->class_oid, class_oid);
+	  entry->is_build_requested = true;
+	  btree_bloom_Hashmap.unlock (thread_p, entry);
+	  btree_bloom_Build_daemon->wakeup ();
+	}
+      else if (entry != NULL)
+	{
+	  btree_bloom_Hashmap.unlock (thread_p, entry);
+	}
+#endif /* SERVER_MODE */
+      return true;
+    }
+  if (entry->is_ready && entry->filter != NULL && btree_bloom_hash_key (entry->key_type, key, &hash))
+    {
+      may_contain = bloom_may_contain (entry->filter, hash);
+    }
+  btree_bloom_Hashmap.unlock (thread_p, entry);
+
+  return may_contain;
+}
+
+/*
+ * btree_delta_initialize () - Initialize index statistics deltas.
+ *
+ * return	 : Error code.
+ * thread_p (in) : Thread entry.
+ */
+int
+btree_delta_initialize (THREAD_ENTRY * thread_p)
+{
+  btree_delta_Enabled = false;
+
+  if (!prm_get_bool_value (PRM_ID_STATS_DML_DELTA))
+    {
+      /* Statistics deltas disabled. */
+      return NO_ERROR;
+    }
+
+  /* Initialize free list */
+  const int hash_size = 1024;
+  const int freelist_block_count = 2;
+  const int freelist_block_size = hash_size / freelist_block_count;
+  btree_delta_Hashmap.init (btree_delta_Ts, THREAD_TS_BTREE_DELTA, hash_size, freelist_block_size,
+			    freelist_block_count, btree_delta_Entry_descriptor);
+
+  btree_delta_Enabled = true;
+  return NO_ERROR;
+}
+
+/*
+ * btree_delta_finalize () - Finalize index statistics deltas.
+ *
+ * return	 : Void.
+ * thread_p (in) : Thread entry.
+ */
+void
+btree_delta_finalize (THREAD_ENTRY * thread_p)
+{
+  BTREE_DELTA_ENTRY *entry;
+
+  if (!btree_delta_Enabled)
+    {
+      return;
+    }
+
+  {
+    // *INDENT-OFF*
+    btree_delta_hashmap_iterator iter { thread_p, btree_delta_Hashmap };
+    // *INDENT-ON*
+    for (entry = iter.iterate (); entry != NULL; entry = iter.iterate ())
+      {
+	(void) btree_delta_entry_uninit (entry);
+      }
+  }
+
+  btree_delta_Hashmap.destroy ();
+
+  btree_delta_Enabled = false;
+}
+
+/*
+ * btree_delta_is_hashable_type () - Can key column values of this type be added to a sketch?
+ *
+ * return    : True if values equal by comparison are hashed equally by btree_delta_hash_value.
+ * type (in) : Value type.
+ */
+bool
+btree_delta_is_hashable_type (DB_TYPE type)
+{
+  switch (type)
+    {
+    case DB_TYPE_FLOAT:
+    case DB_TYPE_DOUBLE:
+    case DB_TYPE_MONETARY:
+    case DB_TYPE_NUMERIC:
+      return true;
+    default:
+      return btree_bloom_is_hashable_type (type);
+    }
+}
+
+/*
+ * btree_delta_hash_value () - Hash a key column value for statistics sketches.
+ *
+ * return     : Well mixed 64-bit hash.
+ * value (in) : Key column value of a hashable type.
+ */
+UINT64
+btree_delta_hash_value (DB_VALUE * value)
+{
+  UINT64 hash = 0;
+  double number;
+  const unsigned char *numeric;
+  int i;
+
+  if (DB_IS_NULL (value))
+    {
+      hash = 0;
+    }
+  else
+    {
+      switch (DB_VALUE_TYPE (value))
+	{
+	case DB_TYPE_FLOAT:
+	case DB_TYPE_DOUBLE:
+	case DB_TYPE_MONETARY:
+	  number = (DB_VALUE_TYPE (value) == DB_TYPE_FLOAT) ? db_get_float (value)
+	    : (DB_VALUE_TYPE (value) == DB_TYPE_DOUBLE) ? db_get_double (value) : db_get_monetary (value)->amount;
+	  if (number == 0)
+	    {
+	      /* -0 is equal to 0 */
+	      number = 0;
+	    }
+	  memcpy (&hash, &number, sizeof (hash));
+	  break;
+	case DB_TYPE_NUMERIC:
+	  /* keys of a column have the same scale; equal values have the same representation */
+	  numeric = (const unsigned char *) db_get_numeric (value);
+	  for (i = 0; i < DB_NUMERIC_BUF_SIZE; i++)
+	    {
+	      hash = hash * 31 + numeric[i];
+	    }
+	  break;
+	default:
+	  hash = btree_bloom_hash_value (value);
+	  break;
+	}
+    }
+
+  /* 64-bit finalizer of MurmurHash3 */
+  hash ^= hash >> 33;
+  hash *= 0xff51afd7ed558ccdULL;
+  hash ^= hash >> 33;
+  hash *= 0xc4ceb9fe1a85ec53ULL;
+  hash ^= hash >> 33;
+  return hash;
+}
+
+/*
+ * btree_delta_hll_add () - Add a hash to a HyperLogLog sketch.
+ *
+ * return	  : Void.
+ * registers (in) : Sketch registers.
+ * hash (in)	  : Hash of added value.
+ */
+void
+btree_delta_hll_add (unsigned char *registers, UINT64 hash)
+{
+  int index;
+  unsigned char rank = btree_delta_hll_rank (hash, &index);
+
+  if (registers[index] < rank)
+    {
+      registers[index] = rank;
+    }
+}
+
+/*
+ * btree_delta_hll_rank () - Get the register of a HyperLogLog sketch and the rank of a hash.
+ *
+ * return      : Rank of hash.
+ * hash (in)   : Hash of added value.
+ * index (out) : Register index.
+ */
+static unsigned char
+btree_delta_hll_rank (UINT64 hash, int *index)
+{
+  UINT64 rest = hash << BTREE_DELTA_HLL_BITS;
+  unsigned char rank = 1;
+
+  *index = (int) (hash >> (64 - BTREE_DELTA_HLL_BITS));
+
+  /* position of first set bit in the rest of hash */
+  while (rank <= 64 - BTREE_DELTA_HLL_BITS && (rest & ((UINT64) 1 << 63)) == 0)
+    {
+      rank++;
+      rest <<= 1;
+    }
+  return rank;
+}
+
+/*
+ * btree_delta_hll_add_atomic () - Add a hash to a HyperLogLog sketch shared by concurrent threads.
+ *
+ * return	  : Void.
+ * registers (in) : Sketch registers. Must be aligned to four bytes.
+ * hash (in)	  : Hash of added value.
+ *
+ * Note: Registers only grow; the word holding the register is swapped so that concurrent updates of neighbouring
+ *	 registers are not lost.
+ */
+static void
+btree_delta_hll_add_atomic (unsigned char *registers, UINT64 hash)
+{
+  int index;
+  unsigned char rank = btree_delta_hll_rank (hash, &index);
+  volatile UINT32 *word = (volatile UINT32 *) (registers + (index & ~3));
+  UINT32 old_word, new_word;
+
+  do
+    {
+      old_word = *word;
+      new_word = old_word;
+      if (((unsigned char *) &new_word)[index & 3] >= rank)
+	{
+	  return;
+	}
+      ((unsigned char *) &new_word)[index & 3] = rank;
+    }
+  while (!ATOMIC_CAS_32 (word, old_word, new_word));
+}
+
+/*
+ * btree_delta_hll_estimate () - Estimate the number of distinct values added to a HyperLogLog sketch.
+ *
+ * return	  : Estimated number of distinct values.
+ * registers (in) : Sketch registers.
+ */
+double
+btree_delta_hll_estimate (const unsigned char *registers)
+{
+  const double m = BTREE_DELTA_HLL_REGISTERS;
+  double sum = 0;
+  double estimate;
+  int zeros = 0;
+  int i;
+
+  for (i = 0; i < BTREE_DELTA_HLL_REGISTERS; i++)
+    {
+      sum += ldexp (1.0, -registers[i]);
+      if (registers[i] == 0)
+	{
+	  zeros++;
+	}
+    }
+
+  estimate = (0.7213 / (1 + 1.079 / m)) * m * m / sum;
+  if (estimate <= 2.5 * m && zeros > 0)
+    {
+      /* small range correction */
+      estimate = m * log (m / zeros);
+    }
+  return estimate;
+}
+
+/*
+ * btree_delta_find_or_insert () - Find the statistics delta entry of index or add a new one.
+ *
+ * return	 : Entry or NULL. The entry is protected by a latch-free transaction until btree_delta_release.
+ * thread_p (in) : Thread entry.
+ * btid (in)	 : B-tree identifier.
+ * key_type (in) : Key domain of the index, or NULL if unknown.
+ */
+static BTREE_DELTA_ENTRY *
+btree_delta_find_or_insert (THREAD_ENTRY * thread_p, BTID * btid, TP_DOMAIN * key_type)
+{
+  BTREE_DELTA_ENTRY *entry = NULL;
+  TP_DOMAIN *dom;
+  unsigned char *registers;
+  int n_columns, n_sketches;
+
+  (void) btree_delta_Hashmap.find_or_insert (thread_p, *btid, entry);
+  if (entry == NULL)
+    {
+      er_clear ();
+      return NULL;
+    }
+
+  if (entry->n_columns == 0 && key_type != NULL)
+    {
+      /* Sketch the leading key prefixes that can be hashed. Concurrent first inserts compute the same sketches and
+       * only one allocation is kept. */
+      if (TP_DOMAIN_TYPE (key_type) != DB_TYPE_MIDXKEY)
+	{
+	  n_columns = 1;
+	  n_sketches = btree_delta_is_hashable_type (TP_DOMAIN_TYPE (key_type)) ? 1 : 0;
+	}
+      else
+	{
+	  n_columns = 0;
+	  n_sketches = 0;
+	  for (dom = key_type->setdomain; dom != NULL; dom = dom->next)
+	    {
+	      if (n_sketches == n_columns && n_sketches < BTREE_STATS_PKEYS_NUM
+		  && btree_delta_is_hashable_type (TP_DOMAIN_TYPE (dom)))
+		{
+		  n_sketches++;
+		}
+	      n_columns++;
+	    }
+	}
+
+      if (n_sketches > 0 && entry->registers == NULL)
+	{
+	  registers = (unsigned char *) calloc (n_sketches, BTREE_DELTA_HLL_REGISTERS);
+	  if (registers != NULL)
+	    {
+	      entry->n_sketches = n_sketches;
+	      if (!ATOMIC_CAS_ADDR (&entry->registers, (unsigned char *) NULL, registers))
+		{
+		  free (registers);
+		}
+	    }
+	}
+      entry->n_columns = n_columns;
+    }
+
+  return entry;
+}
+
+/*
+ * btree_delta_sketch_key () - Add the key prefixes of an inserted object to the sketches of index.
+ *
+ * return	 : Void.
+ * entry (in)	 : Statistics delta entry.
+ * key_type (in) : Key domain of the index.
+ * key (in)	 : Key of inserted object.
+ */
+static void
+btree_delta_sketch_key (BTREE_DELTA_ENTRY * entry, TP_DOMAIN * key_type, DB_VALUE * key)
+{
+  unsigned char *registers = entry->registers;
+  DB_MIDXKEY midxkey;
+  DB_VALUE elem;
+  UINT64 hash = 0;
+  int i;
+
+  if (registers == NULL)
+    {
+      return;
+    }
+
+  if (DB_VALUE_TYPE (key) != DB_TYPE_MIDXKEY)
+    {
+      btree_delta_hll_add_atomic (registers, btree_delta_hash_value (key));
+      return;
+    }
+
+  midxkey = key->data.midxkey;
+  if (midxkey.domain == NULL)
+    {
+      midxkey.domain = key_type;
+    }
+  for (i = 0; i < entry->n_sketches && i < midxkey.ncolumns; i++)
+    {
+      if (pr_midxkey_get_element_nocopy (&midxkey, i, &elem, NULL, NULL) != NO_ERROR)
+	{
+	  er_clear ();
+	  return;
+	}
+      /* hash of prefix i includes hashes of all its columns */
+      hash = btree_delta_hash_value (&elem) ^ (hash * 31);
+      btree_delta_hll_add_atomic (registers + i * BTREE_DELTA_HLL_REGISTERS, hash);
+    }
+}
+
+/*
+ * btree_delta_sum_changes () - Sum the changes counted by all shards of a statistics delta.
+ *
+ * return	 : Void.
+ * entry (in)	 : Statistics delta entry.
+ * inserts (out) : Inserted objects.
+ * deletes (out) : Deleted objects.
+ */
+static void
+btree_delta_sum_changes (BTREE_DELTA_ENTRY * entry, INT64 * inserts, INT64 * deletes)
+{
+  int i;
+
+  *inserts = 0;
+  *deletes = 0;
+  for (i = 0; i < BTREE_DELTA_SHARDS; i++)
+    {
+      *inserts += ATOMIC_LOAD_64 (&entry->shards[i].inserts);
+      *deletes += ATOMIC_LOAD_64 (&entry->shards[i].deletes);
+    }
+}
+
+/*
+ * btree_delta_release () - Ask clients to refresh cached statistics if index changed enough and end the latch-free
+ *			    transaction protecting its statistics delta entry.
+ *
+ * return	      : Void.
+ * thread_p (in)      : Thread entry.
+ * entry (in)	      : Statistics delta entry.
+ * check_refresh (in) : True if a shard counted another BTREE_DELTA_REFRESH_CHECK_CHANGES changes.
+ */
+static void
+btree_delta_release (THREAD_ENTRY * thread_p, BTREE_DELTA_ENTRY * entry, bool check_refresh)
+{
+  INT64 inserts, deletes, changes;
+  INT64 refresh_changes;
+  unsigned int time_stamp, last_time_stamp;
+
+  if (check_refresh)
+    {
+      btree_delta_sum_changes (entry, &inserts, &deletes);
+      changes = inserts + deletes;
+      refresh_changes = entry->refresh_changes;
+      if (changes - refresh_changes >= BTREE_DELTA_REFRESH_MIN_CHANGES
+	  && changes - refresh_changes >= BTREE_DELTA_REFRESH_RATIO * (entry->class_objects + refresh_changes)
+	  && ATOMIC_CAS_64 (&entry->refresh_changes, refresh_changes, changes))
+	{
+	  time_stamp = stats_get_time_stamp ();
+	  entry->time_stamp = time_stamp;
+	  do
+	    {
+	      last_time_stamp = btree_delta_Last_time_stamp;
+	    }
+	  while (last_time_stamp < time_stamp && !ATOMIC_CAS_32 (&btree_delta_Last_time_stamp, last_time_stamp,
+								   time_stamp));
+	}
+    }
+
+  btree_delta_Hashmap.end_tran (thread_p);
+}
+
+/*
+ * btree_delta_add_object () - Count an object inserted in or deleted from index in its statistics delta.
+ *
+ * return	  : Void.
+ * thread_p (in)  : Thread entry.
+ * btid (in)	  : B-tree identifier.
+ * key_type (in)  : Key domain of the index, or NULL if unknown.
+ * key (in)	  : Key of inserted object; NULL if key is null or for deleted object.
+ * is_insert (in) : True if object was inserted, false if it was deleted.
+ */
+static void
+btree_delta_add_object (THREAD_ENTRY * thread_p, BTID * btid, TP_DOMAIN * key_type, DB_VALUE * key, bool is_insert)
+{
+  BTREE_DELTA_ENTRY *entry;
+  BTREE_DELTA_SHARD *shard;
+  INT64 count;
+
+  if (!btree_delta_Enabled)
+    {
+      return;
+    }
+
+#if defined (SA_MODE)
+  if (thread_p == NULL)
+    {
+      thread_p = thread_get_thread_entry_info ();
+    }
+#endif /* SA_MODE */
+
+  entry = btree_delta_find_or_insert (thread_p, btid, key_type);
+  if (entry == NULL)
+    {
+      return;
+    }
+  shard = &entry->shards[thread_p->index % BTREE_DELTA_SHARDS];
+  if (is_insert)
+    {
+      count = ATOMIC_INC_64 (&shard->inserts, 1);
+      if (key != NULL)
+	{
+	  btree_delta_sketch_key (entry, key_type, key);
+	}
+    }
+  else
+    {
+      count = ATOMIC_INC_64 (&shard->deletes, 1);
+    }
+  btree_delta_release (thread_p, entry, count % BTREE_DELTA_REFRESH_CHECK_CHANGES == 0);
+}
+
+/*
+ * btree_delta_add_object_list () - Count objects of a list inserted in or deleted from index in its statistics delta.
+ *
+ * return	    : Void.
+ * thread_p (in)    : Thread entry.
+ * btid (in)	    : B-tree identifier.
+ * key_type (in)    : Key domain of the index.
+ * insert_list (in) : List of keys and objects. No key is NULL.
+ * is_insert (in)   : True if objects were inserted, false if they were deleted.
+ */
+static void
+btree_delta_add_object_list (THREAD_ENTRY * thread_p, BTID * btid, TP_DOMAIN * key_type,
+			     btree_insert_list * insert_list, bool is_insert)
+{
+  BTREE_DELTA_ENTRY *entry;
+  BTREE_DELTA_SHARD *shard;
+  INT64 n_objects = (INT64) insert_list->m_keys_oids.size ();
+  INT64 count;
+
+  if (!btree_delta_Enabled || n_objects == 0)
+    {
+      return;
+    }
+
+#if defined (SA_MODE)
+  if (thread_p == NULL)
+    {
+      thread_p = thread_get_thread_entry_info ();
+    }
+#endif /* SA_MODE */
+
+  entry = btree_delta_find_or_insert (thread_p, btid, key_type);
+  if (entry == NULL)
+    {
+      return;
+    }
+  shard = &entry->shards[thread_p->index % BTREE_DELTA_SHARDS];
+  if (is_insert)
+    {
+      // *INDENT-OFF*
+      for (key_oid &object : insert_list->m_keys_oids)
+	{
+	  btree_delta_sketch_key (entry, key_type, &object.m_key);
+	}
+      // *INDENT-ON*
+      count = ATOMIC_INC_64 (&shard->inserts, n_objects);
+    }
+  else
+    {
+      count = ATOMIC_INC_64 (&shard->deletes, n_objects);
+    }
+  btree_delta_release (thread_p, entry,
+		       count / BTREE_DELTA_REFRESH_CHECK_CHANGES
+		       != (count - n_objects) / BTREE_DELTA_REFRESH_CHECK_CHANGES);
+}
+
+/*
+ * btree_delta_reset () - Forget changes of index when its statistics are gathered.
+ *
+ * return	 : Void.
+ * thread_p (in) : Thread entry.
+ * btid (in)	 : B-tree identifier.
+ */
+static void
+btree_delta_reset (THREAD_ENTRY * thread_p, BTID * btid)
+{
+  BTREE_DELTA_ENTRY *entry;
+  unsigned char *registers;
+  int i;
+
+  if (!btree_delta_Enabled)
+    {
+      return;
+    }
+
+  entry = btree_delta_Hashmap.find (thread_p, *btid);
+  if (entry == NULL)
+    {
+      return;
+    }
+  for (i = 0; i < BTREE_DELTA_SHARDS; i++)
+    {
+      ATOMIC_STORE_64 (&entry->shards[i].inserts, 0);
+      ATOMIC_STORE_64 (&entry->shards[i].deletes, 0);
+    }
+  entry->refresh_changes = 0;
+  entry->time_stamp = 0;
+  registers = entry->registers;
+  if (registers != NULL)
+    {
+      memset (registers, 0, (size_t) entry->n_sketches * BTREE_DELTA_HLL_REGISTERS);
+    }
+  btree_delta_Hashmap.end_tran (thread_p);
+}
+
+/*
+ * btree_delta_remove () - Remove statistics delta of dropped index.
+ *
+ * return	 : Void.
+ * thread_p (in) : Thread entry.
+ * btid (in)	 : B-tree identifier.
+ */
+static void
+btree_delta_remove (THREAD_ENTRY * thread_p, BTID * btid)
+{
+  BTID key = *btid;
+
+  if (!btree_delta_Enabled)
+    {
+      return;
+    }
+
+#if defined (SA_MODE)
+  if (thread_p == NULL)
+    {
+      thread_p = thread_get_thread_entry_info ();
+    }
+#endif /* SA_MODE */
+
+  /* Sketches are freed when the entry is reclaimed. */
+  (void) btree_delta_Hashmap.erase (thread_p, key);
+}
+
+/*
+ * btree_delta_get () - Get changes of index since its statistics were gathered.
+ *
+ * return	      : False if no changes were counted.
+ * thread_p (in)      : Thread entry.
+ * btid (in)	      : B-tree identifier.
+ * class_objects (in) : Objects of class in gathered statistics; the next refresh of cached statistics is requested
+ *			after a fraction of them changed.
+ * delta (out)	      : Changes of index.
+ */
+bool
+btree_delta_get (THREAD_ENTRY * thread_p, BTID * btid, int class_objects, BTREE_STATS_DELTA * delta)
+{
+  BTREE_DELTA_ENTRY *entry;
+  unsigned char *registers;
+  int n_sketches;
+  int i;
+
+  if (!btree_delta_Enabled)
+    {
+      return false;
+    }
+
+  entry = btree_delta_Hashmap.find (thread_p, *btid);
+  if (entry == NULL)
+    {
+      return false;
+    }
+
+  entry->class_objects = class_objects;
+
+  btree_delta_sum_changes (entry, &delta->inserts, &delta->deletes);
+  delta->time_stamp = entry->time_stamp;
+  registers = entry->registers;
+  n_sketches = (registers != NULL) ? entry->n_sketches : 0;
+  delta->pkeys_sketched = n_sketches;
+  delta->keys_sketched = (n_sketches > 0 && n_sketches == entry->n_columns);
+  for (i = 0; i < BTREE_STATS_PKEYS_NUM; i++)
+    {
+      /* prefixes without sketch are assumed to be all distinct */
+      delta->pkeys_inserted[i] = (double) delta->inserts;
+      if (i < n_sketches)
+	{
+	  delta->pkeys_inserted[i] =
+	    MIN (delta->pkeys_inserted[i], btree_delta_hll_estimate (registers + i * BTREE_DELTA_HLL_REGISTERS));
+	}
+    }
+  if (delta->keys_sketched)
+    {
+      delta->keys_inserted = delta->pkeys_inserted[n_sketches - 1];
+    }
+  else
+    {
+      delta->keys_inserted = (double) delta->inserts;
+    }
+
+  btree_delta_Hashmap.end_tran (thread_p);
+
+  return delta->inserts > 0 || delta->deletes > 0;
+}
+
+/*
+ * btree_delta_get_last_time_stamp () - Get the latest time when changes of any index were big enough to refresh
+ *					statistics cached by clients.
+ *
+ * return : Time stamp, or 0 if no index changed enough.
+ */
+unsigned int
+btree_delta_get_last_time_stamp (void)
+{
+  return btree_delta_Last_time_stamp;
+}
+
 /*
  * btree_get_root_with_key () - BTREE_ROOT_WITH_KEY_FUNCTION used by default to read root page header and get b-tree
  * 				data from header.
@@ -24013,6 +26767,12 @@ xbtree_find_unique (THREAD_ENTRY * thread_p, BTID * btid, SCAN_OPERATION_TYPE sc
 	}
     }
 
+  if (!btree_bloom_may_contain_key (thread_p, btid, class_oid, key))
+    {
+      /* Key is certainly not in index. */
+      return BTREE_KEY_NOTFOUND;
+    }
+
   /* Find unique key and object. */
   error_code =
     btree_search_key_and_apply_functions (thread_p, btid, NULL, key, NULL, NULL, advance_function, NULL, key_function,
@@ -25929,6 +28689,83 @@ btree_insert (THREAD_ENTRY * thread_p, BTID * btid, DB_VALUE * key, OID * cls_oi
 				BTREE_OP_INSERT_NEW_OBJECT);
 }
 
+/*
+ * btree_insert_object_list () - Insert a list of new objects in a non-unique b-tree, or add delete MVCCID to a list of
+ *				 existing objects. The list is sorted and merged into b-tree leaf by leaf; each
+ *				 traversal handles as many objects as belong to the leaf it reached.
+ *
+ * return	    : Error code.
+ * thread_p (in)    : Thread entry.
+ * btid (in)	    : B-tree identifier.
+ * class_oid (in)   : Class OID of all objects.
+ * insert_list (in) : List of keys and objects. No key may be NULL.
+ * mvcc_info (in)   : MVCC info of all objects.
+ * purpose (in)	    : BTREE_OP_INSERT_NEW_OBJECT or BTREE_OP_INSERT_MVCC_DELID.
+ */
+static int
+btree_insert_object_list (THREAD_ENTRY * thread_p, BTID * btid, OID * class_oid, btree_insert_list * insert_list,
+			  BTREE_MVCC_INFO * mvcc_info, BTREE_OP_PURPOSE purpose)
+{
+  BTID_INT btid_int;
+  BTREE_INSERT_HELPER insert_helper;
+  int error_code = NO_ERROR;
+
+  assert (btid != NULL && class_oid != NULL && !OID_ISNULL (class_oid));
+  assert ((purpose == BTREE_OP_INSERT_NEW_OBJECT && !BTREE_MVCC_INFO_IS_DELID_VALID (mvcc_info))
+	  || (purpose == BTREE_OP_INSERT_MVCC_DELID && BTREE_MVCC_INFO_IS_DELID_VALID (mvcc_info)));
+
+  if (insert_list->m_keys_oids.empty ())
+    {
+      return NO_ERROR;
+    }
+
+  insert_list->prepare_list ();
+
+  COPY_OID (BTREE_INSERT_CLASS_OID (&insert_helper), class_oid);
+  *BTREE_INSERT_MVCC_INFO (&insert_helper) = *mvcc_info;
+  insert_helper.is_null = false;
+  insert_helper.purpose = purpose;
+  insert_helper.op_type = (purpose == BTREE_OP_INSERT_NEW_OBJECT) ? MULTI_ROW_INSERT : MULTI_ROW_DELETE;
+  insert_helper.unique_stats_info = NULL;
+  insert_helper.log_operations = prm_get_bool_value (PRM_ID_LOG_BTREE_OPS);
+  insert_helper.is_unique_multi_update = false;
+  insert_helper.is_ha_enabled = !HA_DISABLED ();
+  insert_helper.insert_list = insert_list;
+
+  while (insert_list->m_curr_pos < (int) insert_list->m_sorted_keys_oids.size ())
+    {
+      BTREE_SEARCH_KEY_HELPER search_key = BTREE_SEARCH_KEY_HELPER_INITIALIZER;
+
+      PERF_UTIME_TRACKER_START (thread_p, &insert_helper.time_track);
+      COPY_OID (BTREE_INSERT_OID (&insert_helper), insert_list->get_oid ());
+      *BTREE_INSERT_MVCC_INFO (&insert_helper) = *mvcc_info;
+
+      error_code =
+	btree_search_key_and_apply_functions (thread_p, btid, &btid_int, insert_list->get_key (),
+					      btree_fix_root_for_insert, &insert_helper, btree_split_node_and_advance,
+					      &insert_helper, btree_key_insert_object_list, &insert_helper,
+					      &search_key, NULL);
+      if (error_code != NO_ERROR)
+	{
+	  ASSERT_ERROR ();
+	  break;
+	}
+    }
+
+  if (error_code == NO_ERROR)
+    {
+      btree_delta_add_object_list (thread_p, btid, btid_int.key_type, insert_list,
+				   purpose == BTREE_OP_INSERT_NEW_OBJECT);
+    }
+
+  if (insert_helper.printed_key != NULL)
+    {
+      db_private_free (thread_p, insert_helper.printed_key);
+    }
+
+  return error_code;
+}
+
 /*
  * btree_mvcc_delete () - MVCC logical delete. Adds delete MVCCID to an existing object.
  *
@@ -26098,6 +28935,12 @@ btree_insert_internal (THREAD_ENTRY * thread_p, BTID * btid, DB_VALUE * key, OID
       return error_code;
     }
 
+  if (purpose == BTREE_OP_INSERT_NEW_OBJECT || purpose == BTREE_OP_INSERT_MVCC_DELID)
+    {
+      btree_delta_add_object (thread_p, btid, btid_int.key_type, insert_helper.is_null ? NULL : key,
+			      purpose == BTREE_OP_INSERT_NEW_OBJECT);
+    }
+
   perfmon_inc_stat (thread_p, PSTAT_BT_NUM_INSERTS);
 
   if (unique != NULL)
@@ -27147,6 +29990,7 @@ btree_key_insert_new_object (THREAD_ENTRY * thread_p, BTID_INT * btid_int, DB_VA
   LEAF_REC leaf_info;		/* Leaf record info. */
   int offset_after_key;		/* Offset in record data where packed key is ended. */
   bool dummy_clear_key;		/* Dummy field used as argument for btree_read_record. */
+  bool is_new_unique_key = false;	/* True if the ready Bloom filter of unique index did not contain key. */
 
   /* Recovery structures. */
   char rv_undo_data_buffer[IO_MAX_PAGE_SIZE + BTREE_MAX_ALIGN];
@@ -27171,6 +30015,20 @@ btree_key_insert_new_object (THREAD_ENTRY * thread_p, BTID_INT * btid_int, DB_VA
    * delete MVCCID). - Vacuum (deleted object). However, vacuum is not rollbacked. */
   assert (!BTREE_MVCC_INFO_IS_DELID_VALID (BTREE_INSERT_MVCC_INFO (insert_helper)));
 
+  /* Consult the Bloom filter of unique index before the key is checked for uniqueness. The key is added to the filter
+   * while its leaf is latched, so that lookups trusting the filter never miss it. */
+  if (BTREE_IS_UNIQUE (btid_int->unique_pk))
+    {
+      is_new_unique_key = btree_bloom_add_key (thread_p, btid_int->sys_btid, key);
+      if (is_new_unique_key && search_key->result == BTREE_KEY_FOUND)
+	{
+	  /* A key the ready filter did not contain must not be in the leaf. */
+	  assert (false);
+	  btree_bloom_invalidate (thread_p, btid_int->sys_btid);
+	  is_new_unique_key = false;
+	}
+    }
+
   btree_perf_track_traverse_time (thread_p, insert_helper);
 
   /* Prepare log data */
@@ -27206,8 +30064,8 @@ btree_key_insert_new_object (THREAD_ENTRY * thread_p, BTID_INT * btid_int, DB_VA
   insert_helper->rv_redo_data = PTR_ALIGN (rv_redo_data_buffer, BTREE_MAX_ALIGN);
   insert_helper->rv_redo_data_ptr = insert_helper->rv_redo_data;
 
-  /* Does key already exist? */
-  if (search_key->result != BTREE_KEY_FOUND)
+  /* Does key already exist? A new unique key has no objects to lock or check for uniqueness. */
+  if (is_new_unique_key || search_key->result != BTREE_KEY_FOUND)
     {
       /* Key doesn't exist. Insert new key. */
       error_code = btree_key_insert_new_key (thread_p, btid_int, key, *leaf_page, insert_helper, search_key);
@@ -27306,6 +30164,175 @@ error:
   goto exit;
 }
 
+/*
+ * btree_key_insert_object_list () - BTREE_PROCESS_KEY_FUNCTION used for inserting a sorted list of new objects or
+ *				      adding delete MVCCID to a sorted list of objects. Objects are handled in the
+ *				      leaf that was reached as long as their keys belong to it, then b-tree is
+ *				      traversed again for the remaining objects.
+ *
+ * return	   : Error code.
+ * thread_p (in)   : Thread entry.
+ * btid_int (in)   : B-tree info.
+ * key (in)	   : Key of first object in list.
+ * leaf_page (in)  : Leaf node page (must be fixed for write).
+ * search_key (in) : Search key result.
+ * restart (out)   : Output true if b-tree traversal must be restarted.
+ * other_args (in) : BTREE_INSERT_HELPER *.
+ */
+static int
+btree_key_insert_object_list (THREAD_ENTRY * thread_p, BTID_INT * btid_int, DB_VALUE * key, PAGE_PTR * leaf_page,
+			      BTREE_SEARCH_KEY_HELPER * search_key, bool * restart, void *other_args)
+{
+  BTREE_INSERT_HELPER *insert_helper = (BTREE_INSERT_HELPER *) other_args;
+  btree_insert_list *insert_list = insert_helper->insert_list;
+  BTREE_NODE_HEADER *node_header = NULL;
+  DB_VALUE *curr_key = key;
+  DB_VALUE_COMPARE_RESULT c;
+  BTREE_MVCC_INFO mvcc_info;
+  int key_len;
+  int new_ent_size;
+  int error_code = NO_ERROR;
+
+  assert (insert_list != NULL && insert_list->m_use_sorted_bulk_insert);
+  assert (insert_helper->purpose == BTREE_OP_INSERT_NEW_OBJECT
+	  || insert_helper->purpose == BTREE_OP_INSERT_MVCC_DELID);
+  assert (!BTREE_IS_UNIQUE (btid_int->unique_pk));
+
+  /* Insert MVCCID is read from b-tree for each deleted object; start from the shared MVCC info of list. */
+  mvcc_info = *BTREE_INSERT_MVCC_INFO (insert_helper);
+
+  insert_list->m_keep_page_iterations = 0;
+  insert_list->m_ovf_appends = 0;
+  insert_list->m_ovf_appends_new_page = 0;
+
+  while (true)
+    {
+      if (insert_helper->purpose == BTREE_OP_INSERT_NEW_OBJECT)
+	{
+	  error_code =
+	    btree_key_insert_new_object (thread_p, btid_int, curr_key, leaf_page, search_key, restart, insert_helper);
+	}
+      else
+	{
+	  *BTREE_INSERT_MVCC_INFO (insert_helper) = mvcc_info;
+	  error_code =
+	    btree_key_find_and_insert_delete_mvccid (thread_p, btid_int, curr_key, leaf_page, search_key, restart,
+						     insert_helper);
+	}
+      if (error_code != NO_ERROR)
+	{
+	  ASSERT_ERROR ();
+	  break;
+	}
+      /* Only the lock of an unique key can ask for restart. */
+      assert (!*restart);
+
+      perfmon_inc_stat (thread_p, PSTAT_BT_NUM_INSERTS);
+
+      if (insert_list->next_key () != btree_insert_list::KEY_AVAILABLE)
+	{
+	  /* All objects were handled. */
+	  break;
+	}
+
+      /* Prepare next object. */
+      COPY_OID (BTREE_INSERT_OID (insert_helper), insert_list->get_oid ());
+      curr_key = insert_list->get_key ();
+
+      key_len = btree_get_disk_size_of_key (curr_key);
+      node_header = btree_get_node_header (thread_p, *leaf_page);
+      if (node_header == NULL)
+	{
+	  assert_release (false);
+	  error_code = ER_FAILED;
+	  break;
+	}
+      if (key_len > node_header->max_key_len)
+	{
+	  /* Let the split algorithm handle it. */
+	  break;
+	}
+
+      new_ent_size =
+	btree_get_max_new_data_size (thread_p, btid_int, *leaf_page, BTREE_LEAF_NODE, key_len, insert_helper, false);
+      if (new_ent_size > spage_get_free_space_without_saving (thread_p, *leaf_page, NULL))
+	{
+	  /* Leaf is full. */
+	  break;
+	}
+
+      /* Key must be inside the boundaries of the leaf found by traversal. */
+      if (!insert_list->m_boundaries.m_is_inf_left_key)
+	{
+	  c = btree_compare_key (&insert_list->m_boundaries.m_left_key, curr_key, btid_int->key_type, 1, 1, NULL);
+	  if (c != DB_LT && c != DB_EQ)
+	    {
+	      break;
+	    }
+	}
+      if (!insert_list->m_boundaries.m_is_inf_right_key)
+	{
+	  c = btree_compare_key (curr_key, &insert_list->m_boundaries.m_right_key, btid_int->key_type, 1, 1, NULL);
+	  if (c != DB_LT)
+	    {
+	      break;
+	    }
+	}
+
+      if (DB_VALUE_DOMAIN_TYPE (curr_key) == DB_TYPE_MIDXKEY)
+	{
+	  error_code = btree_leaf_is_key_between_min_max (thread_p, btid_int, *leaf_page, curr_key, search_key);
+	  if (error_code != NO_ERROR)
+	    {
+	      ASSERT_ERROR ();
+	      break;
+	    }
+	  if ((search_key->result == BTREE_KEY_SMALLER && !VPID_ISNULL (&node_header->prev_vpid))
+	      || (search_key->result == BTREE_KEY_BIGGER && !VPID_ISNULL (&node_header->next_vpid))
+	      || search_key->result == BTREE_ERROR_OCCURRED)
+	    {
+	      /* Key may belong to a neighbour leaf. */
+	      break;
+	    }
+	}
+
+      error_code = btree_search_leaf_page (thread_p, btid_int, *leaf_page, curr_key, search_key);
+      if (error_code != NO_ERROR)
+	{
+	  ASSERT_ERROR ();
+	  break;
+	}
+      if ((search_key->result == BTREE_KEY_BIGGER || search_key->result == BTREE_KEY_SMALLER)
+	  && search_key->has_fence_key == btree_search_key_helper::HAS_FENCE_KEY)
+	{
+	  /* Key belongs to a neighbour leaf. */
+	  break;
+	}
+      else if (search_key->result != BTREE_KEY_BETWEEN && search_key->result != BTREE_KEY_FOUND
+	       && search_key->result != BTREE_KEY_BIGGER && search_key->result != BTREE_KEY_SMALLER)
+	{
+	  assert (false);
+	  break;
+	}
+      if (insert_helper->purpose == BTREE_OP_INSERT_MVCC_DELID && search_key->result != BTREE_KEY_FOUND)
+	{
+	  /* Deleted object must be found; let the traversal find the leaf of its key. */
+	  break;
+	}
+
+      insert_list->m_keep_page_iterations++;
+      if (insert_list->check_release_latch (thread_p, insert_helper, *leaf_page))
+	{
+	  /* Give others a chance to use the leaf. */
+	  break;
+	}
+    }
+
+  insert_list->reset_boundary_keys ();
+
+  return error_code;
+}
+
 /*
  * btree_key_insert_new_key () - Insert new key in b-tree.
  *
@@ -29267,6 +32294,7 @@ btree_physical_delete (THREAD_ENTRY * thread_p, BTID * btid, DB_VALUE * key, OID
 		       int op_type, btree_unique_stats * unique_stat_info)
 {
   BTREE_MVCC_INFO mvcc_info = BTREE_MVCC_INFO_INITIALIZER;
+  int error_code = NO_ERROR;
 
   if (prm_get_bool_value (PRM_ID_LOG_BTREE_OPS))
     {
@@ -29298,14 +32326,22 @@ btree_physical_delete (THREAD_ENTRY * thread_p, BTID * btid, DB_VALUE * key, OID
 
       BTREE_MVCC_INFO_SET_DELID (&mvcc_info, tran_mvccid);
 
-      return btree_insert_internal (thread_p, btid, key, class_oid, oid, op_type, unique_stat_info, unique, &mvcc_info,
-				    NULL, BTREE_OP_INSERT_MARK_DELETED);
+      error_code =
+	btree_insert_internal (thread_p, btid, key, class_oid, oid, op_type, unique_stat_info, unique, &mvcc_info, NULL,
+			       BTREE_OP_INSERT_MARK_DELETED);
     }
   else
     {
-      return btree_delete_internal (thread_p, btid, oid, class_oid, &mvcc_info, key, NULL, unique, op_type,
-				    unique_stat_info, NULL, NULL, NULL, BTREE_OP_DELETE_OBJECT_PHYSICAL);
+      error_code =
+	btree_delete_internal (thread_p, btid, oid, class_oid, &mvcc_info, key, NULL, unique, op_type,
+			       unique_stat_info, NULL, NULL, NULL, BTREE_OP_DELETE_OBJECT_PHYSICAL);
+    }
+
+  if (error_code == NO_ERROR)
+    {
+      btree_delta_add_object (thread_p, btid, NULL, NULL, false);
     }
+  return error_code;
 }
 
 /*
@@ -32880,6 +35916,11 @@ btree_create_file (THREAD_ENTRY * thread_p, const OID * class_oid, int attrid, B
   btid->root_pageid = vpid_root.pageid;
 
   log_sysop_commit (thread_p);
+
+  /* A dropped index may have had the same identifier. */
+  btree_bloom_invalidate (thread_p, btid);
+  btree_delta_remove (thread_p, btid);
+  btree_ahi_remove_btid (thread_p, btid);
   return NO_ERROR;
 }
 
@@ -33240,6 +36281,9 @@ btree_online_index_list_dispatcher (THREAD_ENTRY * thread_p, BTID * btid, OID *
 
   helper.insert_helper.insert_list = insert_list;
 
+  /* Index is loaded online; its keys are not added to a Bloom filter, so do not keep one until the load is done. */
+  btree_bloom_invalidate (thread_p, btid);
+
   /* Safe guards */
   assert (oid != NULL);
   assert (class_oid != NULL);
@@ -33371,6 +36415,8 @@ end:
       db_private_free (thread_p, helper.delete_helper.printed_key);
     }
 
+  btree_bloom_invalidate (thread_p, btid);
+
   return error_code;
 }
 
@@ -35690,4 +38736,126 @@ bool btree_insert_list::check_release_latch (THREAD_ENTRY * thread_p, void *arg,
 
   return false;
 }
+
+multi_index_insert_buffer::multi_index_insert_buffer (size_t max_size, BTREE_OP_PURPOSE purpose)
+  : m_indexes ()
+  , m_mvcc_info BTREE_MVCC_INFO_INITIALIZER
+  , m_size (0)
+  , m_max_size (max_size)
+  , m_purpose (purpose)
+{
+  assert (purpose == BTREE_OP_INSERT_NEW_OBJECT || purpose == BTREE_OP_INSERT_MVCC_DELID);
+}
+
+multi_index_insert_buffer::~multi_index_insert_buffer ()
+{
+  clear ();
+}
+
+int
+multi_index_insert_buffer::add_key (THREAD_ENTRY * thread_p, const BTID &btid, const OID &class_oid,
+                                    const DB_VALUE *key, const OID &oid, MVCC_REC_HEADER * mvcc_header)
+{
+  BTREE_MVCC_INFO mvcc_info = BTREE_MVCC_INFO_INITIALIZER;
+  int error_code = NO_ERROR;
+
+  assert (key != NULL && !DB_IS_NULL (key));
+
+  if (m_purpose == BTREE_OP_INSERT_MVCC_DELID)
+    {
+      /* only delete MVCCID is shared; insert MVCCID of each object is read from b-tree */
+      assert (mvcc_header != NULL && MVCC_IS_FLAG_SET (mvcc_header, OR_MVCC_FLAG_VALID_DELID));
+      mvcc_info.flags = 0;
+      BTREE_MVCC_INFO_SET_DELID (&mvcc_info, MVCC_GET_DELID (mvcc_header));
+    }
+  else if (mvcc_header != NULL)
+    {
+      btree_mvcc_info_from_heap_mvcc_header (mvcc_header, &mvcc_info);
+    }
+
+  if (!empty () && (mvcc_info.flags != m_mvcc_info.flags || mvcc_info.insert_mvccid != m_mvcc_info.insert_mvccid
+		    || mvcc_info.delete_mvccid != m_mvcc_info.delete_mvccid))
+    {
+      /* all buffered objects are handled with the same MVCC info; flush those before switching to new info */
+      error_code = flush (thread_p);
+      if (error_code != NO_ERROR)
+        {
+          ASSERT_ERROR ();
+          return error_code;
+        }
+    }
+  m_mvcc_info = mvcc_info;
+
+  auto it = m_indexes.find (btid);
+  if (it == m_indexes.end ())
+    {
+      const TP_DOMAIN *key_type = btree_read_key_type (thread_p, const_cast<BTID *> (&btid));
+      if (key_type == NULL)
+        {
+          ASSERT_ERROR_AND_SET (error_code);
+          return error_code;
+        }
+
+      index_keys keys;
+      keys.m_class_oid = class_oid;
+      keys.m_list = new btree_insert_list (key_type);
+      it = m_indexes.emplace (btid, keys).first;
+    }
+
+  m_size += it->second.m_list->add_key (key, oid);
+
+  return NO_ERROR;
+}
+
+int
+multi_index_insert_buffer::flush (THREAD_ENTRY * thread_p)
+{
+  int error_code = NO_ERROR;
+
+  for (auto &it : m_indexes)
+    {
+      BTID btid = it.first;
+
+      error_code = btree_insert_object_list (thread_p, &btid, &it.second.m_class_oid, it.second.m_list, &m_mvcc_info,
+                                             m_purpose);
+      if (error_code != NO_ERROR)
+        {
+          ASSERT_ERROR ();
+          break;
+        }
+    }
+
+  clear ();
+
+  return error_code;
+}
+
+void
+multi_index_insert_buffer::clear ()
+{
+  for (auto &it : m_indexes)
+    {
+      delete it.second.m_list;
+    }
+  m_indexes.clear ();
+  m_size = 0;
+}
+
+bool
+multi_index_insert_buffer::is_full () const
+{
+  return m_size >= m_max_size;
+}
+
+bool
+multi_index_insert_buffer::empty () const
+{
+  return m_indexes.empty ();
+}
+
+BTREE_OP_PURPOSE
+multi_index_insert_buffer::get_purpose () const
+{
+  return m_purpose;
+}
 // *INDENT-ON*
@@ -43,6 +43,8 @@
 #include "statistics.h"
 #include "storage_common.h"
 
+#include <map>
+
 // forward definition
 class btree_unique_stats;
 struct key_val_range;
@@ -644,6 +646,52 @@ struct btree_insert_list
 
   bool check_release_latch (THREAD_ENTRY * thread_p, void *arg, PAGE_PTR leaf_page);
 };
+
+//
+// multi_index_insert_buffer - keys of objects collected per index during a multi-row insert or delete. Instead of
+//                             changing the index as each row is inserted/deleted, the keys of an index are sorted and
+//                             merged into its b-tree leaf by leaf when the buffer is flushed.
+//
+// The buffer either inserts new objects (BTREE_OP_INSERT_NEW_OBJECT) or adds the delete MVCCID of deleted objects
+// (BTREE_OP_INSERT_MVCC_DELID). Only keys of non-unique indexes may be buffered: unique indexes must check (and lock)
+// each key when its row is changed.
+//
+class multi_index_insert_buffer
+{
+  public:
+    multi_index_insert_buffer (size_t max_size, BTREE_OP_PURPOSE purpose);
+    ~multi_index_insert_buffer ();
+
+    int add_key (THREAD_ENTRY * thread_p, const BTID &btid, const OID &class_oid, const DB_VALUE *key, const OID &oid,
+		 MVCC_REC_HEADER * mvcc_header);
+    int flush (THREAD_ENTRY * thread_p);
+    void clear ();
+
+    bool is_full () const;
+    bool empty () const;
+    BTREE_OP_PURPOSE get_purpose () const;
+
+  private:
+    struct btid_comparator
+    {
+      bool operator() (const BTID &a, const BTID &b) const
+      {
+	return a.root_pageid < b.root_pageid || (a.root_pageid == b.root_pageid && a.vfid.volid < b.vfid.volid);
+      }
+    };
+
+    struct index_keys
+    {
+      OID m_class_oid;
+      btree_insert_list *m_list;
+    };
+
+    std::map<BTID, index_keys, btid_comparator> m_indexes;
+    BTREE_MVCC_INFO m_mvcc_info;	/* MVCC info shared by all buffered objects */
+    size_t m_size;
+    size_t m_max_size;
+    BTREE_OP_PURPOSE m_purpose;
+};
 // *INDENT-ON*
 
 /* BTREE_RANGE_SCAN_PROCESS_KEY_FUNC -
@@ -655,6 +703,23 @@ struct btree_insert_list
  */
 typedef int BTREE_RANGE_SCAN_PROCESS_KEY_FUNC (THREAD_ENTRY * thread_p, BTREE_SCAN * bts);
 
+/* number of hash bits that select the register of a HyperLogLog sketch of statistics */
+#define BTREE_DELTA_HLL_BITS 9
+#define BTREE_DELTA_HLL_REGISTERS (1 << BTREE_DELTA_HLL_BITS)
+
+/* Changes of an index since its statistics were gathered. */
+typedef struct btree_stats_delta BTREE_STATS_DELTA;
+struct btree_stats_delta
+{
+  INT64 inserts;		/* number of objects inserted */
+  INT64 deletes;		/* number of objects deleted */
+  double pkeys_inserted[BTREE_STATS_PKEYS_NUM];	/* estimated distinct key prefixes of inserted objects */
+  double keys_inserted;		/* estimated distinct keys of inserted objects */
+  int pkeys_sketched;		/* leading prefixes whose distinct inserted values are estimated by a sketch */
+  bool keys_sketched;		/* true if distinct inserted keys are estimated by a sketch */
+  unsigned int time_stamp;	/* time when changes were last big enough to refresh statistics cached by clients */
+};
+
 extern int btree_find_foreign_key (THREAD_ENTRY * thread_p, BTID * btid, DB_VALUE * key, OID * class_oid,
 				   OID * found_oid);
 
@@ -826,6 +891,19 @@ extern unsigned int btree_hash_btid (void *btid, int hash_size);
 extern int btree_create_file (THREAD_ENTRY * thread_p, const OID * class_oid, int attrid, BTID * btid);
 extern int btree_initialize_new_page (THREAD_ENTRY * thread_p, PAGE_PTR page, void *args);
 
+extern int btree_ahi_initialize (THREAD_ENTRY * thread_p);
+extern void btree_ahi_finalize (THREAD_ENTRY * thread_p);
+extern int btree_bloom_initialize (THREAD_ENTRY * thread_p);
+extern void btree_bloom_finalize (THREAD_ENTRY * thread_p);
+extern int btree_delta_initialize (THREAD_ENTRY * thread_p);
+extern void btree_delta_finalize (THREAD_ENTRY * thread_p);
+extern bool btree_delta_get (THREAD_ENTRY * thread_p, BTID * btid, int class_objects, BTREE_STATS_DELTA * delta);
+extern unsigned int btree_delta_get_last_time_stamp (void);
+extern bool btree_delta_is_hashable_type (DB_TYPE type);
+extern UINT64 btree_delta_hash_value (DB_VALUE * value);
+extern void btree_delta_hll_add (unsigned char *registers, UINT64 hash);
+extern double btree_delta_hll_estimate (const unsigned char *registers);
+
 extern int btree_locate_key (THREAD_ENTRY * thread_p, BTID_INT * btid_int, DB_VALUE * key, VPID * pg_vpid,
 			     INT16 * slot_id, PAGE_PTR * leaf_page_out, bool * found_p);
 extern int btree_get_num_visible_from_leaf_and_ovf (THREAD_ENTRY * thread_p, BTID_INT * btid_int, RECDES * leaf_record,
@@ -0,0 +1,298 @@
+/*
+ * Copyright 2008 Search Solution Corporation
+ * Copyright 2016 CUBRID Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+//
+// Run consistency checks of database files on a worker pool
+//
+
+#include "consistency_check_pool.hpp"
+
+#include "error_manager.h"
+#include "lock_manager.h"
+#include "log_impl.h"
+#include "network_interface_sr.h"	/* xcallback_console_print */
+#include "oid.h"
+#include "system_parameter.h"
+#include "thread_entry.hpp"
+
+#include <cinttypes>
+#include <climits>
+#include <cstdio>
+
+// *INDENT-OFF*
+using check_clock = std::chrono::steady_clock;
+
+static const std::chrono::seconds CHECK_PROGRESS_INTERVAL (10);
+
+consistency_check_pool::consistency_check_pool (THREAD_ENTRY * thread_p, const char *file_kind)
+  : m_workpool (NULL)
+  , m_max_running (0)
+  , m_conn (thread_p->conn_entry)
+  , m_file_kind (file_kind)
+  , m_checks_started (0)
+  , m_checks_done { 0 }
+  , m_checked_pages { 0 }
+  , m_has_error { false }
+  , m_is_invalid { false }
+  , m_locked_classes ()
+  , m_done_mutex ()
+  , m_done_checks ()
+  , m_error_msg ()
+  , m_start_time (check_clock::now ())
+  , m_last_report_time (m_start_time)
+{
+  int thread_count = prm_get_integer_value (PRM_ID_CHECKDB_THREAD_COUNT);
+
+  if (thread_count > 0)
+    {
+      // no pool is created in stand-alone mode
+      m_workpool =
+	cubthread::get_manager ()->create_worker_pool (thread_count, 2 * thread_count, "checkdb workers", this, 1,
+						       cubthread::is_logging_configured (cubthread::LOG_WORKER_POOL_CHECKDB));
+      m_max_running = 2 * thread_count;
+    }
+}
+
+consistency_check_pool::~consistency_check_pool ()
+{
+  // wait_all must be called before destroying the pool
+  assert (m_checks_done == m_checks_started);
+  assert (m_locked_classes.empty ());
+
+  cubthread::get_manager ()->destroy_worker_pool (m_workpool);
+}
+
+//
+// push_check () - check a file on a worker, or on this thread if there are no workers
+//
+// return          : error code
+// thread_p (in)   : thread entry
+// class_oid (in)  : class of checked file; the file iterator must hold the lock of the class
+// class_lock (in) : lock mode of class held by file iterator
+// check (in)      : check of file
+//
+int
+consistency_check_pool::push_check (THREAD_ENTRY * thread_p, const OID &class_oid, LOCK class_lock, check_func &&check)
+{
+  size_t check_index;
+  int error_code = NO_ERROR;
+
+  assert (!has_error ());
+
+  // file is protected by its class lock only until file iterator moves to next file; keep it until check is done
+  if (lock_object (thread_p, &class_oid, oid_Root_class_oid, class_lock, LK_UNCOND_LOCK) != LK_GRANTED)
+    {
+      ASSERT_ERROR_AND_SET (error_code);
+      return error_code;
+    }
+  check_index = m_locked_classes.size ();
+  m_locked_classes.push_back ({ class_oid, class_lock });
+  m_checks_started++;
+
+  cubthread::entry_callable_task *task =
+    new cubthread::entry_callable_task ([this, check_index, check = std::move (check)] (cubthread::entry &thread_ref)
+  {
+    execute_check (thread_ref, check_index, check);
+  });
+  cubthread::get_manager ()->push_task (m_workpool, task);
+
+  // don't let checks pile up in pool queue
+  error_code = wait_checks (thread_p, m_max_running);
+  if (error_code != NO_ERROR)
+    {
+      ASSERT_ERROR ();
+      return error_code;
+    }
+
+  return NO_ERROR;
+}
+
+//
+// wait_all () - wait for all pushed checks to finish
+//
+// return        : DISK_VALID if all files are valid, DISK_INVALID if a file is not valid, DISK_ERROR on error
+// thread_p (in) : thread entry
+//
+DISK_ISVALID
+consistency_check_pool::wait_all (THREAD_ENTRY * thread_p)
+{
+  int error_code = wait_checks (thread_p, 0);
+
+  assert (m_checks_done == m_checks_started);
+  unlock_checked_classes (thread_p);
+  assert (m_locked_classes.empty ());
+
+  report_progress (thread_p, true);
+
+  if (error_code != NO_ERROR || has_error ())
+    {
+      if (er_errid () == NO_ERROR)
+	{
+	  // error was set on a worker thread
+	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_UNEXPECTED, 1, m_error_msg.c_str ());
+	}
+      return DISK_ERROR;
+    }
+  return m_is_invalid ? DISK_INVALID : DISK_VALID;
+}
+
+bool
+consistency_check_pool::has_error () const
+{
+  return m_has_error;
+}
+
+void
+consistency_check_pool::execute_check (cubthread::entry &thread_ref, size_t check_index, const check_func &check)
+{
+  DISK_ISVALID valid;
+  int checked_pages = 0;
+
+  if (!m_has_error)
+    {
+      valid = check (thread_ref, checked_pages);
+      if (valid == DISK_ERROR)
+	{
+	  std::unique_lock<std::mutex> ulock (m_done_mutex);
+	  if (!m_has_error.exchange (true) && m_workpool != NULL)
+	    {
+	      const char *msg = er_msg ();
+	      m_error_msg = (msg != NULL) ? msg : "";
+	    }
+	}
+      else if (valid == DISK_INVALID)
+	{
+	  m_is_invalid = true;
+	}
+      m_checked_pages += checked_pages;
+    }
+
+  std::unique_lock<std::mutex> ulock (m_done_mutex);
+  m_done_checks.push_back (check_index);
+  // must be last; pool may be destroyed after all checks are done
+  ++m_checks_done;
+}
+
+//
+// wait_checks () - wait until no more than max_running checks are running
+//
+// return          : error code
+// thread_p (in)   : thread entry
+// max_running (in): maximum number of running checks
+//
+int
+consistency_check_pool::wait_checks (THREAD_ENTRY * thread_p, std::uint64_t max_running)
+{
+  bool dummy_continue_checking = true;
+  int error_code = NO_ERROR;
+
+  while (true)
+    {
+      unlock_checked_classes (thread_p);
+      report_progress (thread_p, false);
+
+      if (m_checks_started - m_checks_done <= max_running)
+	{
+	  break;
+	}
+
+      if (error_code == NO_ERROR && logtb_is_interrupted (thread_p, true, &dummy_continue_checking))
+	{
+	  // let workers skip remaining checks; running checks must still be waited
+	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_INTERRUPTED, 0);
+	  error_code = ER_INTERRUPTED;
+	  m_has_error = true;
+	}
+
+      thread_sleep (10);
+    }
+
+  return error_code;
+}
+
+void
+consistency_check_pool::unlock_checked_classes (THREAD_ENTRY * thread_p)
+{
+  std::vector<size_t> done_checks;
+  bool all_done;
+
+  {
+    std::unique_lock<std::mutex> ulock (m_done_mutex);
+    done_checks.swap (m_done_checks);
+    all_done = (m_checks_done == m_checks_started);
+  }
+
+  for (size_t check_index : done_checks)
+    {
+      locked_class &locked = m_locked_classes[check_index];
+      lock_unlock_object (thread_p, &locked.m_class_oid, oid_Root_class_oid, locked.m_lock, true);
+      OID_SET_NULL (&locked.m_class_oid);
+    }
+
+  if (all_done)
+    {
+      // all classes were unlocked
+      m_locked_classes.clear ();
+    }
+}
+
+void
+consistency_check_pool::report_progress (THREAD_ENTRY * thread_p, bool is_final)
+{
+  check_clock::time_point now = check_clock::now ();
+  char output[LINE_MAX];
+
+  if (!is_final && now - m_last_report_time < CHECK_PROGRESS_INTERVAL)
+    {
+      return;
+    }
+  if (is_final && m_checks_started == 0)
+    {
+      return;
+    }
+  m_last_report_time = now;
+
+  double seconds = std::chrono::duration_cast<std::chrono::duration<double>> (now - m_start_time).count ();
+  std::uint64_t pages = m_checked_pages;
+
+  snprintf (output, LINE_MAX, "%s %" PRIu64 " of %" PRIu64 " %s files, %" PRIu64 " pages (%.0f pages/sec)\n",
+	    is_final ? "checked" : "checking", (std::uint64_t) m_checks_done, m_checks_started, m_file_kind, pages,
+	    seconds > 0 ? pages / seconds : 0.0);
+  xcallback_console_print (thread_p, output);
+}
+
+void
+consistency_check_pool::on_create (context_type &context)
+{
+  context.claim_system_worker ();
+  context.conn_entry = m_conn;
+}
+
+void
+consistency_check_pool::on_retire (context_type &context)
+{
+  context.retire_system_worker ();
+  context.conn_entry = NULL;
+}
+
+void
+consistency_check_pool::on_recycle (context_type &context)
+{
+  context.tran_index = LOG_SYSTEM_TRAN_INDEX;
+}
+// *INDENT-ON*
@@ -0,0 +1,108 @@
+/*
+ * Copyright 2008 Search Solution Corporation
+ * Copyright 2016 CUBRID Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+//
+// Run consistency checks of database files on a worker pool
+//
+
+#ifndef _CONSISTENCY_CHECK_POOL_HPP_
+#define _CONSISTENCY_CHECK_POOL_HPP_
+
+#if !defined (SERVER_MODE) && !defined (SA_MODE)
+#error Belongs to server module
+#endif /* !defined (SERVER_MODE) && !defined (SA_MODE) */
+
+#include "disk_manager.h"
+#include "storage_common.h"
+#include "thread_entry_task.hpp"
+#include "thread_manager.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// forward definitions
+struct css_conn_entry;
+
+//
+// consistency_check_pool - checks of files (b-trees, heaps) are independent of each other, so they are spread over
+//                          checkdb_thread_count workers. The class of each checked file stays locked until the check
+//                          of the file is done. Progress (files and pages checked per second) is printed to checkdb
+//                          console.
+//
+// Checks are executed by the calling thread if there are no workers (checkdb_thread_count is 0 or stand-alone mode).
+// Callers stop pushing checks when has_error () is true and must always call wait_all ().
+//
+// *INDENT-OFF*
+class consistency_check_pool : public cubthread::entry_manager
+{
+  public:
+    // check of a file; outputs the number of pages it verified
+    using check_func = std::function<DISK_ISVALID (cubthread::entry &, int &)>;
+
+    consistency_check_pool (THREAD_ENTRY * thread_p, const char *file_kind);
+    ~consistency_check_pool ();
+
+    int push_check (THREAD_ENTRY * thread_p, const OID &class_oid, LOCK class_lock, check_func &&check);
+    DISK_ISVALID wait_all (THREAD_ENTRY * thread_p);
+
+    bool has_error () const;
+
+  protected:
+    void on_create (context_type &context) override;
+    void on_retire (context_type &context) override;
+    void on_recycle (context_type &context) override;
+
+  private:
+    struct locked_class
+    {
+      OID m_class_oid;
+      LOCK m_lock;
+    };
+
+    void execute_check (cubthread::entry &thread_ref, size_t check_index, const check_func &check);
+    int wait_checks (THREAD_ENTRY * thread_p, std::uint64_t max_running);
+    void unlock_checked_classes (THREAD_ENTRY * thread_p);
+    void report_progress (THREAD_ENTRY * thread_p, bool is_final);
+
+    cubthread::entry_workpool *m_workpool;
+    size_t m_max_running;
+    css_conn_entry *m_conn;
+    const char *m_file_kind;
+
+    std::uint64_t m_checks_started;
+    std::atomic<std::uint64_t> m_checks_done;
+    std::atomic<std::uint64_t> m_checked_pages;
+    std::atomic<bool> m_has_error;
+    std::atomic<bool> m_is_invalid;
+
+    std::vector<locked_class> m_locked_classes;	// indexed by check; accessed only by pushing thread
+    std::mutex m_done_mutex;
+    std::vector<size_t> m_done_checks;		// checks whose class may be unlocked
+    std::string m_error_msg;			// error of first check that failed on a worker
+
+    std::chrono::steady_clock::time_point m_start_time;
+    std::chrono::steady_clock::time_point m_last_report_time;
+};
+// *INDENT-ON*
+
+#endif /* _CONSISTENCY_CHECK_POOL_HPP_ */
@@ -44,6 +44,7 @@
 #include "locator_sr.h"
 #include "btree.h"
 #include "btree_unique.hpp"
+#include "consistency_check_pool.hpp"
 #include "transform.h"		/* for CT_SERIAL_NAME */
 #include "serial.h"
 #include "object_primitive.h"
@@ -6820,6 +6821,7 @@ heap_scancache_start_internal (THREAD_ENTRY * thread_p, HEAP_SCANCACHE * scan_ca
   scan_cache->start_area ();
   scan_cache->num_btids = 0;
   scan_cache->m_index_stats = NULL;
+  scan_cache->m_index_insert_buffer = NULL;
   scan_cache->debug_initpattern = HEAP_DEBUG_SCANCACHE_INITPATTERN;
   scan_cache->mvcc_snapshot = mvcc_snapshot;
   scan_cache->partition_list = NULL;
@@ -6837,6 +6839,7 @@ exit_on_error:
   PGBUF_INIT_WATCHER (&(scan_cache->page_watcher), PGBUF_ORDERED_RANK_UNDEFINED, PGBUF_ORDERED_NULL_HFID);
   scan_cache->num_btids = 0;
   scan_cache->m_index_stats = NULL;
+  scan_cache->m_index_insert_buffer = NULL;
   scan_cache->file_type = FILE_UNKNOWN_TYPE;
   scan_cache->debug_initpattern = 0;
   scan_cache->mvcc_snapshot = NULL;
@@ -7119,6 +7122,7 @@ heap_scancache_quick_start_internal (HEAP_SCANCACHE * scan_cache, const HFID * h
   scan_cache->start_area ();
   scan_cache->num_btids = 0;
   scan_cache->m_index_stats = NULL;
+  scan_cache->m_index_insert_buffer = NULL;
   scan_cache->file_type = FILE_UNKNOWN_TYPE;
   scan_cache->debug_initpattern = HEAP_DEBUG_SCANCACHE_INITPATTERN;
   scan_cache->mvcc_snapshot = NULL;
@@ -7151,6 +7155,9 @@ heap_scancache_quick_end (THREAD_ENTRY * thread_p, HEAP_SCANCACHE * scan_cache)
     {
       delete scan_cache->m_index_stats;
       scan_cache->m_index_stats = NULL;
+      /* keys still buffered here belong to a statement that failed */
+      delete scan_cache->m_index_insert_buffer;
+      scan_cache->m_index_insert_buffer = NULL;
       scan_cache->num_btids = 0;
 
       if (scan_cache->cache_last_fix_page == true)
@@ -13951,11 +13958,14 @@ heap_check_all_heaps (THREAD_ENTRY * thread_p)
   int error_code = NO_ERROR;
   HFID hfid;
   DISK_ISVALID allvalid = DISK_VALID;
-  DISK_ISVALID valid = DISK_VALID;
   VFID vfid = VFID_INITIALIZER;
   OID class_oid = OID_INITIALIZER;
 
-  while (true)
+  /* *INDENT-OFF* */
+  consistency_check_pool check_pool (thread_p, "heap");
+  /* *INDENT-ON* */
+
+  while (!check_pool.has_error ())
     {
       /* Go to each file, check only the heap files */
       error_code = file_tracker_interruptable_iterate (thread_p, FILE_HEAP, &vfid, &class_oid);
@@ -13970,20 +13980,36 @@ heap_check_all_heaps (THREAD_ENTRY * thread_p)
 	  break;
 	}
 
+      /* heap files are checked in parallel */
       hfid.vfid = vfid;
-      valid = heap_check_heap_file (thread_p, &hfid);
-      if (valid == DISK_ERROR)
+      /* *INDENT-OFF* */
+      error_code =
+	check_pool.push_check (thread_p, class_oid, SCH_S_LOCK, [hfid] (cubthread::entry &thread_ref, int &checked_pages)
+	  {
+	    HFID check_hfid = hfid;
+	    DISK_ISVALID valid = heap_check_heap_file (&thread_ref, &check_hfid);
+
+	    if (valid != DISK_ERROR)
+	      {
+		(void) file_get_num_user_pages (&thread_ref, &check_hfid.vfid, &checked_pages);
+	      }
+	    return valid;
+	  });
+      /* *INDENT-ON* */
+      if (error_code != NO_ERROR)
 	{
+	  ASSERT_ERROR ();
 	  goto exit_on_error;
 	}
-      if (valid != DISK_VALID)
-	{
-	  allvalid = valid;
-	}
     }
-  assert (OID_ISNULL (&class_oid));
 
-  return allvalid;
+  if (!OID_ISNULL (&class_oid))
+    {
+      /* stopped because a check failed */
+      lock_unlock_object (thread_p, &class_oid, oid_Root_class_oid, SCH_S_LOCK, true);
+    }
+
+  return check_pool.wait_all (thread_p);
 
 exit_on_error:
   if (!OID_ISNULL (&class_oid))
@@ -13991,6 +14017,7 @@ exit_on_error:
       lock_unlock_object (thread_p, &class_oid, oid_Root_class_oid, SCH_S_LOCK, true);
     }
 
+  allvalid = check_pool.wait_all (thread_p);
   return ((allvalid == DISK_VALID) ? DISK_ERROR : allvalid);
 }
 
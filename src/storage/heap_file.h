@@ -43,6 +43,7 @@
 
 // forward declarations
 class multi_index_unique_stats;
+class multi_index_insert_buffer;
 class record_descriptor;
 
 #define HFID_EQ(hfid_ptr1, hfid_ptr2) \
@@ -152,6 +153,7 @@ struct heap_scancache
     PGBUF_WATCHER page_watcher;
     int num_btids;		/* Total number of indexes defined on the scanning class */
     multi_index_unique_stats *m_index_stats;	// does this really belong to scan cache??
+    multi_index_insert_buffer *m_index_insert_buffer;	/* keys of non-unique indexes inserted at end of statement */
     FILE_TYPE file_type;		/* The file type of the heap file being scanned. Can be FILE_HEAP or
 				         * FILE_HEAP_REUSE_SLOTS */
     MVCC_SNAPSHOT *mvcc_snapshot;	/* mvcc snapshot */
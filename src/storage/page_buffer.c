@@ -99,6 +99,9 @@ static int rv;
 #define PGBUF_TIMEOUT                      300	/* timeout seconds */
 #define PGBUF_FIX_COUNT_THRESHOLD           64	/* fix count threshold. used as indicator for hot pages. */
 
+/* auxiliary data cached with pages may use at most 1/PGBUF_PAGE_AUX_MAX_RATIO of the buffer pool size */
+#define PGBUF_PAGE_AUX_MAX_RATIO            16
+
 /* size of io page */
 #if defined(CUBRID_DEBUG)
 #define SIZEOF_IOPAGE_PAGESIZE_AND_GUARD() (IO_PAGESIZE + sizeof (pgbuf_Guard))
@@ -498,6 +501,9 @@ struct pgbuf_bcb
 
   LOG_LSA oldest_unflush_lsa;	/* The oldest LSA record of the page that has not been written to disk */
   PGBUF_IOPAGE_BUFFER *iopage_buffer;	/* pointer to iopage buffer structure */
+  PGBUF_PAGE_AUX *volatile page_aux;	/* auxiliary data cached with the page; see pgbuf_attach_page_aux () */
+  volatile int page_version;	/* changed whenever the page content may have changed; odd while the BCB is being
+				 * claimed for another page. See pgbuf_copy_page_optimistic (). */
 };
 
 /* iopage buffer structure */
@@ -780,6 +786,8 @@ struct pgbuf_buffer_pool
   lockfree::circular_queue<int> *shared_lrus_with_victims;
   /* *INDENT-ON* */
 
+  volatile INT64 page_aux_size;	/* memory held by the auxiliary data of all pages */
+
   PGBUF_STATUS *show_status;
   PGBUF_STATUS_OLD show_status_old;
   PGBUF_STATUS_SNAPSHOT show_status_snapshot;
@@ -1077,6 +1085,8 @@ STATIC_INLINE void pgbuf_wakeup_reader_writer (THREAD_ENTRY * thread_p, PGBUF_BC
 
 STATIC_INLINE bool pgbuf_get_check_page_validation_level (int page_validation_level) __attribute__ ((ALWAYS_INLINE));
 static bool pgbuf_is_valid_page_ptr (const PAGE_PTR pgptr);
+static PGBUF_BCB *pgbuf_find_page_version (const VPID * vpid, int *version);
+static bool pgbuf_is_page_copy (THREAD_ENTRY * thread_p, const PAGE_PTR pgptr);
 STATIC_INLINE void pgbuf_set_bcb_page_vpid (PGBUF_BCB * bufptr) __attribute__ ((ALWAYS_INLINE));
 STATIC_INLINE bool pgbuf_check_bcb_page_vpid (PGBUF_BCB * bufptr, bool maybe_deallocated)
   __attribute__ ((ALWAYS_INLINE));
@@ -1100,7 +1110,8 @@ STATIC_INLINE void pgbuf_set_dirty_buffer_ptr (THREAD_ENTRY * thread_p, PGBUF_BC
   __attribute__ ((ALWAYS_INLINE));
 static int pgbuf_compare_victim_list (const void *p1, const void *p2);
 static void pgbuf_wakeup_page_flush_daemon (THREAD_ENTRY * thread_p);
-STATIC_INLINE bool pgbuf_check_page_ptype_internal (PAGE_PTR pgptr, PAGE_TYPE ptype, bool no_error)
+STATIC_INLINE bool pgbuf_check_page_ptype_internal (THREAD_ENTRY * thread_p, PAGE_PTR pgptr, PAGE_TYPE ptype,
+						    bool no_error)
   __attribute__ ((ALWAYS_INLINE));
 #if defined (SERVER_MODE)
 static bool pgbuf_is_thread_high_priority (THREAD_ENTRY * thread_p);
@@ -1177,6 +1188,8 @@ STATIC_INLINE bool pgbuf_bcb_should_be_moved_to_bottom_lru (const PGBUF_BCB * bc
 STATIC_INLINE bool pgbuf_bcb_avoid_victim (const PGBUF_BCB * bcb) __attribute__ ((ALWAYS_INLINE));
 STATIC_INLINE void pgbuf_bcb_set_dirty (THREAD_ENTRY * thread_p, PGBUF_BCB * bcb) __attribute__ ((ALWAYS_INLINE));
 STATIC_INLINE void pgbuf_bcb_clear_dirty (THREAD_ENTRY * thread_p, PGBUF_BCB * bcb) __attribute__ ((ALWAYS_INLINE));
+STATIC_INLINE void pgbuf_bcb_drop_page_aux (PGBUF_BCB * bufptr) __attribute__ ((ALWAYS_INLINE));
+STATIC_INLINE void pgbuf_bcb_change_page_version (PGBUF_BCB * bufptr, bool is_stable) __attribute__ ((ALWAYS_INLINE));
 STATIC_INLINE void pgbuf_bcb_mark_was_flushed (THREAD_ENTRY * thread_p, PGBUF_BCB * bcb)
   __attribute__ ((ALWAYS_INLINE));
 STATIC_INLINE void pgbuf_bcb_mark_was_not_flushed (THREAD_ENTRY * thread_p, PGBUF_BCB * bcb, bool mark_dirty)
@@ -1560,6 +1573,7 @@ pgbuf_finalize (void)
 	{
 	  bufptr = PGBUF_FIND_BCB_PTR (i);
 	  pthread_mutex_destroy (&bufptr->mutex);
+	  pgbuf_bcb_drop_page_aux (bufptr);
 	}
       free_and_init (pgbuf_Pool.BCB_table);
       pgbuf_Pool.num_buffers = 0;
@@ -2038,6 +2052,8 @@ try_again:
   /* Hash Chain Connection Pass */
   if (buf_lock_acquired)
     {
+      /* page is loaded, optimistic readers may use it */
+      pgbuf_bcb_change_page_version (bufptr, true);
       pgbuf_insert_into_hash_chain (thread_p, hash_anchor, bufptr);
 
       /*
@@ -4314,6 +4330,241 @@ pgbuf_set_dirty (THREAD_ENTRY * thread_p, PAGE_PTR pgptr, bool free_page)
     }
 }
 
+/*
+ * pgbuf_get_page_aux () - Get the auxiliary data cached with a page
+ *   return: auxiliary data or NULL
+ *   pgptr(in): Pointer to page
+ *
+ * Note: The caller must keep the page fixed while using the auxiliary data.
+ */
+PGBUF_PAGE_AUX *
+pgbuf_get_page_aux (PAGE_PTR pgptr)
+{
+  PGBUF_BCB *bufptr;
+
+  CAST_PGPTR_TO_BFPTR (bufptr, pgptr);
+
+  return bufptr->page_aux;
+}
+
+/*
+ * pgbuf_attach_page_aux () - Cache auxiliary data with a page
+ *   return: true if aux was attached, false if the page already has auxiliary
+ *	     data or the memory limit is reached; the caller keeps aux then
+ *   pgptr(in): Pointer to fixed page
+ *   aux(in): auxiliary data built from the current page content
+ *
+ * Note: Readers holding a read latch may attach concurrently; only the first
+ *	 one succeeds. The data is dropped when the page is set dirty or when its
+ *	 buffer is reused for another page.
+ */
+bool
+pgbuf_attach_page_aux (PAGE_PTR pgptr, PGBUF_PAGE_AUX * aux)
+{
+  PGBUF_BCB *bufptr;
+  INT64 max_size;
+
+  assert (aux != NULL && aux->free_func != NULL);
+
+  CAST_PGPTR_TO_BFPTR (bufptr, pgptr);
+
+  max_size = (INT64) pgbuf_Pool.num_buffers * DB_PAGESIZE / PGBUF_PAGE_AUX_MAX_RATIO;
+  if (ATOMIC_INC_64 (&pgbuf_Pool.page_aux_size, (INT64) aux->size) > max_size)
+    {
+      ATOMIC_INC_64 (&pgbuf_Pool.page_aux_size, -((INT64) aux->size));
+      return false;
+    }
+
+  if (!ATOMIC_CAS_ADDR (&bufptr->page_aux, (PGBUF_PAGE_AUX *) NULL, aux))
+    {
+      ATOMIC_INC_64 (&pgbuf_Pool.page_aux_size, -((INT64) aux->size));
+      return false;
+    }
+
+  return true;
+}
+
+/*
+ * pgbuf_bcb_drop_page_aux () - Free the auxiliary data cached with a page
+ *   return: void
+ *   bufptr(in): BCB, either write latched or not fixed
+ */
+STATIC_INLINE void
+pgbuf_bcb_drop_page_aux (PGBUF_BCB * bufptr)
+{
+  PGBUF_PAGE_AUX *aux = bufptr->page_aux;
+
+  if (aux != NULL)
+    {
+      bufptr->page_aux = NULL;
+      ATOMIC_INC_64 (&pgbuf_Pool.page_aux_size, -((INT64) aux->size));
+      aux->free_func (aux);
+    }
+}
+
+/*
+ * pgbuf_bcb_change_page_version () - Change the page version of a BCB
+ *   return: void
+ *   bufptr(in): BCB, latched or claimed by the caller
+ *   is_stable(in): false if page content is about to be replaced; the version
+ *		    stays odd until it is changed again with is_stable true
+ *
+ * Note: The version must be changed before the latch mode, so an optimistic
+ *	 reader that does not see the write latch sees the new version.
+ */
+STATIC_INLINE void
+pgbuf_bcb_change_page_version (PGBUF_BCB * bufptr, bool is_stable)
+{
+  int version = bufptr->page_version;
+
+  (void) ATOMIC_TAS_32 (&bufptr->page_version, (version | 1) + (is_stable ? 1 : 2));
+}
+
+/*
+ * pgbuf_find_page_version () - Find the BCB of a page and read its version
+ *   return: BCB of the page, or NULL if the page is not in the buffer pool, is
+ *	     write latched or is being replaced
+ *   vpid(in): page identifier
+ *   version(out): version of the page
+ *
+ * Note: The hash chain is searched while holding its mutex, so the BCB cannot
+ *	 be removed from the chain and claimed for another page meanwhile. The
+ *	 BCB itself is not locked; its version tells if the page changed after
+ *	 the mutex is released.
+ */
+static PGBUF_BCB *
+pgbuf_find_page_version (const VPID * vpid, int *version)
+{
+  PGBUF_BUFFER_HASH *hash_anchor;
+  PGBUF_BCB *bufptr;
+
+  hash_anchor = &pgbuf_Pool.buf_hash_table[PGBUF_HASH_VALUE (vpid)];
+  pthread_mutex_lock (&hash_anchor->hash_mutex);
+  for (bufptr = hash_anchor->hash_next; bufptr != NULL; bufptr = bufptr->hash_next)
+    {
+      if (VPID_EQ (&bufptr->vpid, vpid))
+	{
+	  break;
+	}
+    }
+  if (bufptr != NULL)
+    {
+      *version = bufptr->page_version;
+      MEMORY_BARRIER ();
+      if ((*version & 1) != 0 || bufptr->latch_mode == PGBUF_LATCH_WRITE
+	  || bufptr->latch_mode == PGBUF_LATCH_INVALID)
+	{
+	  bufptr = NULL;
+	}
+    }
+  pthread_mutex_unlock (&hash_anchor->hash_mutex);
+
+  return bufptr;
+}
+
+/*
+ * pgbuf_is_page_copy () - Check if a page pointer points to the page copied by pgbuf_copy_page_optimistic ()
+ *   return: true if pgptr is the page copy of the thread
+ *   thread_p(in):
+ *   pgptr(in): page pointer
+ */
+static bool
+pgbuf_is_page_copy (THREAD_ENTRY * thread_p, const PAGE_PTR pgptr)
+{
+  if (thread_p == NULL)
+    {
+      thread_p = thread_get_thread_entry_info ();
+    }
+
+  return (thread_p->page_copy_buffer != NULL
+	  && pgptr == (PAGE_PTR) ((FILEIO_PAGE *) thread_p->page_copy_buffer)->page);
+}
+
+/*
+ * pgbuf_copy_page_optimistic () - Copy a page from the buffer pool without
+ *				   fixing it
+ *   return: pointer to the page in the copy, or NULL if the page is not in
+ *	     the buffer pool or could not be copied consistently
+ *   thread_p(in):
+ *   vpid(in): page identifier
+ *   ptype(in): expected page type
+ *   version(out): version of the copied page
+ *
+ * Note: The page is copied without latching it. The copy is used only if the
+ *	 page was not write latched and its version did not change while it
+ *	 was copied. Since the page may change right after, the caller should
+ *	 check the version again with pgbuf_check_page_version () before
+ *	 trusting what it derived from the copy. No error is set.
+ *
+ *	 The copy goes to a buffer of the thread, so only the last copied page
+ *	 of a thread is valid. It has no BCB; only read-only functions that
+ *	 look at the page itself may be used on it, and it must not be unfixed.
+ */
+PAGE_PTR
+pgbuf_copy_page_optimistic (THREAD_ENTRY * thread_p, const VPID * vpid, PAGE_TYPE ptype, int *version)
+{
+  PGBUF_BCB *bufptr;
+  FILEIO_PAGE *copy_iopage;
+  PAGE_PTR pgptr;
+  int page_version;
+
+  assert (vpid != NULL && version != NULL);
+
+  if (thread_p == NULL)
+    {
+      thread_p = thread_get_thread_entry_info ();
+    }
+  if (thread_p->page_copy_buffer == NULL)
+    {
+      thread_p->page_copy_buffer = (char *) malloc (IO_MAX_PAGE_SIZE);
+      if (thread_p->page_copy_buffer == NULL)
+	{
+	  return NULL;
+	}
+    }
+  copy_iopage = (FILEIO_PAGE *) thread_p->page_copy_buffer;
+
+  bufptr = pgbuf_find_page_version (vpid, &page_version);
+  if (bufptr == NULL)
+    {
+      return NULL;
+    }
+
+  memcpy (copy_iopage, &bufptr->iopage_buffer->iopage, IO_PAGESIZE);
+
+  MEMORY_BARRIER ();
+  if (bufptr->latch_mode == PGBUF_LATCH_WRITE || bufptr->page_version != page_version
+      || !VPID_EQ (&bufptr->vpid, vpid))
+    {
+      return NULL;
+    }
+  if (copy_iopage->prv.ptype != ptype)
+    {
+      return NULL;
+    }
+
+  *version = page_version;
+  CAST_IOPGPTR_TO_PGPTR (pgptr, copy_iopage);
+  return pgptr;
+}
+
+/*
+ * pgbuf_check_page_version () - Check that a page copied with
+ *				 pgbuf_copy_page_optimistic () did not change
+ *   return: true if the page is in the buffer pool, is not write latched and
+ *	     still has the given version
+ *   thread_p(in):
+ *   vpid(in): page identifier
+ *   version(in): version of the copied page
+ */
+bool
+pgbuf_check_page_version (THREAD_ENTRY * thread_p, const VPID * vpid, int version)
+{
+  int page_version;
+
+  return pgbuf_find_page_version (vpid, &page_version) != NULL && page_version == version;
+}
+
 /*
  * pgbuf_get_lsa () - Find the log sequence address of the given page
  *   return: page lsa
@@ -4324,7 +4575,7 @@ pgbuf_get_lsa (PAGE_PTR pgptr)
 {
   FILEIO_PAGE *io_pgptr;
 
-  if (pgbuf_get_check_page_validation_level (PGBUF_DEBUG_PAGE_VALIDATION_ALL))
+  if (pgbuf_get_check_page_validation_level (PGBUF_DEBUG_PAGE_VALIDATION_ALL) && !pgbuf_is_page_copy (NULL, pgptr))
     {
       if (pgbuf_is_valid_page_ptr (pgptr) == false)
 	{
@@ -4982,6 +5233,8 @@ pgbuf_initialize_bcb_table (void)
       VPID_SET_NULL (&bufptr->vpid);
       bufptr->fcnt = 0;
       bufptr->latch_mode = PGBUF_LATCH_INVALID;
+      bufptr->page_aux = NULL;
+      bufptr->page_version = 0;
 
 #if defined(SERVER_MODE)
       bufptr->next_wait_thrd = NULL;
@@ -6220,6 +6473,11 @@ pgbuf_unlatch_bcb_upon_unfix (THREAD_ENTRY * thread_p, PGBUF_BCB * bufptr, int h
 	    }
 	}
 
+      if (bufptr->latch_mode == PGBUF_LATCH_WRITE)
+	{
+	  /* page may have been changed by the writer */
+	  pgbuf_bcb_change_page_version (bufptr, true);
+	}
       bufptr->latch_mode = PGBUF_NO_LATCH;
 #if defined(SERVER_MODE)
       pgbuf_wakeup_reader_writer (thread_p, bufptr);
@@ -7694,6 +7952,8 @@ pgbuf_claim_bcb_for_fix (THREAD_ENTRY * thread_p, const VPID * vpid, PAGE_FETCH_
   /* Currently, caller has one allocated BCB and is holding mutex */
 
   /* initialize the BCB */
+  pgbuf_bcb_drop_page_aux (bufptr);
+  pgbuf_bcb_change_page_version (bufptr, false);
   bufptr->vpid = *vpid;
   assert (!pgbuf_bcb_avoid_victim (bufptr));
   bufptr->latch_mode = PGBUF_NO_LATCH;
@@ -8147,6 +8407,7 @@ pgbuf_put_bcb_into_invalid_list (THREAD_ENTRY * thread_p, PGBUF_BCB * bufptr)
 #endif /* SERVER_MODE */
 
   /* the caller is holding bufptr->mutex */
+  pgbuf_bcb_drop_page_aux (bufptr);
   VPID_SET_NULL (&bufptr->vpid);
   bufptr->latch_mode = PGBUF_LATCH_INVALID;
   assert ((bufptr->flags & PGBUF_BCB_FLAGS_MASK) == 0);
@@ -10332,7 +10593,7 @@ pgbuf_is_valid_page_ptr (const PAGE_PTR pgptr)
 bool
 pgbuf_check_page_ptype (THREAD_ENTRY * thread_p, PAGE_PTR pgptr, PAGE_TYPE ptype)
 {
-  return pgbuf_check_page_ptype_internal (pgptr, ptype, false);
+  return pgbuf_check_page_ptype_internal (thread_p, pgptr, ptype, false);
 }
 
 /*
@@ -10347,12 +10608,13 @@ pgbuf_check_page_ptype (THREAD_ENTRY * thread_p, PAGE_PTR pgptr, PAGE_TYPE ptype
 bool
 pgbuf_check_page_type_no_error (THREAD_ENTRY * thread_p, PAGE_PTR pgptr, PAGE_TYPE ptype)
 {
-  return pgbuf_check_page_ptype_internal (pgptr, ptype, true);
+  return pgbuf_check_page_ptype_internal (thread_p, pgptr, ptype, true);
 }
 
 /*
  * pgbuf_check_page_ptype_internal () -
  *   return: true/false
+ *   thread_p(in):
  *   bufptr(in): pointer to buffer page
  *   ptype(in): page type
  *
@@ -10360,9 +10622,10 @@ pgbuf_check_page_type_no_error (THREAD_ENTRY * thread_p, PAGE_PTR pgptr, PAGE_TY
  *       This function is used for debugging purposes.
  */
 STATIC_INLINE bool
-pgbuf_check_page_ptype_internal (PAGE_PTR pgptr, PAGE_TYPE ptype, bool no_error)
+pgbuf_check_page_ptype_internal (THREAD_ENTRY * thread_p, PAGE_PTR pgptr, PAGE_TYPE ptype, bool no_error)
 {
   PGBUF_BCB *bufptr;
+  FILEIO_PAGE *io_pgptr;
 
   if (pgptr == NULL)
     {
@@ -10378,6 +10641,18 @@ pgbuf_check_page_ptype_internal (PAGE_PTR pgptr, PAGE_TYPE ptype, bool no_error)
     }
 #endif
 
+  if (pgbuf_is_page_copy (thread_p, pgptr))
+    {
+      /* Page copy has no BCB. */
+      CAST_PGPTR_TO_IOPGPTR (io_pgptr, pgptr);
+      if (io_pgptr->prv.ptype != PAGE_UNKNOWN && io_pgptr->prv.ptype != ptype)
+	{
+	  assert_release (no_error);
+	  return false;
+	}
+      return true;
+    }
+
   if (pgbuf_get_check_page_validation_level (PGBUF_DEBUG_PAGE_VALIDATION_ALL))
     {
       if (pgbuf_is_valid_page_ptr (pgptr) == false)
@@ -10830,6 +11105,9 @@ pgbuf_set_dirty_buffer_ptr (THREAD_ENTRY * thread_p, PGBUF_BCB * bufptr)
 
   pgbuf_bcb_set_dirty (thread_p, bufptr);
 
+  /* the page content changed; no reader can see the auxiliary data while we hold the write latch */
+  pgbuf_bcb_drop_page_aux (bufptr);
+
   holder = pgbuf_find_thrd_holder (thread_p, bufptr);
   assert (bufptr->latch_mode == PGBUF_LATCH_WRITE);
   assert (holder != NULL);
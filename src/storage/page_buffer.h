@@ -246,6 +246,17 @@ struct pgbuf_watcher
 #endif
 };
 
+/* Auxiliary data that the owner of a page caches with the resident page (e.g. a search directory). It is dropped and
+ * freed with free_func as soon as the page is set dirty or its buffer is reused, so it always describes the page
+ * content it was built from. The owner allocates the whole structure; this header must come first. */
+typedef struct pgbuf_page_aux PGBUF_PAGE_AUX;
+struct pgbuf_page_aux
+{
+  size_t size;			/* memory held by the auxiliary data */
+  PAGE_TYPE ptype;		/* type of the page it was built for */
+  void (*free_func) (PGBUF_PAGE_AUX * aux);
+};
+
 // *INDENT-OFF*
 using pgbuf_aligned_buffer = cubmem::stack_block<(size_t) IO_MAX_PAGE_SIZE>;
 using pgbuf_resizable_buffer = cubmem::extensible_stack_block<(size_t) IO_MAX_PAGE_SIZE>;
@@ -363,6 +374,11 @@ extern void pgbuf_set_dirty (THREAD_ENTRY * thread_p, PAGE_PTR pgptr, bool free_
 #define pgbuf_set_dirty_and_free(thread_p, pgptr) pgbuf_set_dirty (thread_p, pgptr, FREE); pgptr = NULL
 
 extern LOG_LSA *pgbuf_get_lsa (PAGE_PTR pgptr);
+extern PGBUF_PAGE_AUX *pgbuf_get_page_aux (PAGE_PTR pgptr);
+extern bool pgbuf_attach_page_aux (PAGE_PTR pgptr, PGBUF_PAGE_AUX * aux);
+extern PAGE_PTR pgbuf_copy_page_optimistic (THREAD_ENTRY * thread_p, const VPID * vpid, PAGE_TYPE ptype,
+					    int *version);
+extern bool pgbuf_check_page_version (THREAD_ENTRY * thread_p, const VPID * vpid, int version);
 extern int pgbuf_page_has_changed (PAGE_PTR pgptr, LOG_LSA * ref_lsa);
 extern const LOG_LSA *pgbuf_set_lsa (THREAD_ENTRY * thread_p, PAGE_PTR pgptr, const LOG_LSA * lsa_ptr);
 extern void pgbuf_reset_temp_lsa (PAGE_PTR pgptr);
@@ -34,6 +34,8 @@
 #define STATS_WITH_FULLSCAN  true
 #define STATS_WITH_SAMPLING  false
 
+#define STATS_SAMPLE_ROWS_DEFAULT 0	/* objects sampled for histograms are given by stats_sample_rows */
+
 #define STATS_SAMPLING_THRESHOLD 50	/* sampling trial count */
 #define STATS_SAMPLING_LEAFS_MAX   8	/* sampling leaf pages */
 
@@ -43,6 +45,18 @@
 
 #define STATS_MIN_MAX_SIZE    sizeof(DB_DATA)
 
+/* column histograms */
+#define STATS_HISTOGRAM_VERSION       1	/* format of packed histogram */
+#define STATS_HISTOGRAM_SAMPLE_SIZE   10000	/* sampled values of a column */
+#define STATS_HISTOGRAM_MCVS_MAX      20	/* most common values kept */
+#define STATS_HISTOGRAM_BUCKETS_MAX   32	/* equi-depth buckets kept */
+#define STATS_HISTOGRAM_VALUE_SIZE_MAX 256	/* longer values are not sampled */
+
+/* column groups */
+#define STATS_COLUMN_GROUPS_VERSION   1	/* format of packed column groups */
+#define STATS_COLUMN_GROUP_ATTRS_MAX  8	/* attributes of a column group */
+#define STATS_COLUMN_GROUPS_MAX       16	/* column groups declared on a class */
+
 /* free_and_init routine */
 #define stats_free_statistics_and_init(stats) \
   do \
@@ -71,6 +85,31 @@ struct btree_stats
 #endif
 };
 
+/* Distribution of the values of an attribute; gathered by UPDATE STATISTICS WITH FULLSCAN */
+typedef struct stats_histogram STATS_HISTOGRAM;
+struct stats_histogram
+{
+  double null_frac;		/* fraction of objects having NULL */
+  double ndv;			/* estimated number of distinct non-NULL values */
+  int n_mcvs;			/* number of most common values */
+  DB_VALUE *mcvs;		/* most common values, ascending */
+  double *mcv_freqs;		/* fraction of objects having each of mcvs[] */
+  int n_bounds;			/* number of bucket bounds; there are n_bounds - 1 buckets */
+  DB_VALUE *bounds;		/* ascending bounds of equi-depth buckets of values other than mcvs[]; each bucket holds
+				 * the same fraction of the remaining objects */
+};
+
+/* Correlation of a group of attributes; declared by CREATE STATISTICS and gathered with histograms */
+typedef struct stats_column_group STATS_COLUMN_GROUP;
+struct stats_column_group
+{
+  int n_attrs;			/* number of attributes of group */
+  int attr_ids[STATS_COLUMN_GROUP_ATTRS_MAX];	/* attributes as declared; the group is kept by attr_ids[0] */
+  double ndv;			/* estimated number of distinct combinations of non-NULL values; 0 if not gathered */
+  double degrees[STATS_COLUMN_GROUP_ATTRS_MAX];	/* degrees[i] is the fraction of objects whose value of attr_ids[i]
+						 * determines the values of the other attributes */
+};
+
 /* Statistical Information about the attribute */
 typedef struct attr_stats ATTR_STATS;
 struct attr_stats
@@ -79,6 +118,9 @@ struct attr_stats
   DB_TYPE type;
   int n_btstats;		/* number of B+tree statistics information */
   BTREE_STATS *bt_stats;	/* pointer to array of BTREE_STATS[n_btstats] */
+  STATS_HISTOGRAM *histogram;	/* value distribution; NULL if not gathered */
+  int n_column_groups;		/* number of column_groups[] */
+  STATS_COLUMN_GROUP *column_groups;	/* column groups led by the attribute */
 };
 
 /* Statistical Information about the class */
@@ -95,6 +137,8 @@ struct class_stats
 #if !defined(SERVER_MODE)
 extern int stats_get_statistics (OID * classoid, unsigned int timestamp, CLASS_STATS ** stats_p);
 extern void stats_free_statistics (CLASS_STATS * stats);
+extern STATS_HISTOGRAM *stats_client_unpack_histogram (char *buffer, int length);
+extern void stats_free_histogram (STATS_HISTOGRAM * histogram);
 extern void stats_dump (const char *classname, FILE * fp);
 #endif /* !SERVER_MODE */
 
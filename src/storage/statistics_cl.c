@@ -28,6 +28,7 @@
 
 #include "object_representation.h"
 #include "statistics.h"
+#include "dbtype.h"
 #include "object_primitive.h"
 #include "memory_alloc.h"
 #include "work_space.h"
@@ -37,6 +38,9 @@
 #include "db_date.h"
 
 static CLASS_STATS *stats_client_unpack_statistics (char *buffer);
+static void stats_dump_histogram (STATS_HISTOGRAM * histogram, FILE * file_p);
+static int stats_client_unpack_column_groups (char *buffer, int length, ATTR_STATS * attr_stats);
+static void stats_dump_column_groups (MOP class_mop, ATTR_STATS * attr_stats, FILE * file_p);
 
 /*
  * stats_get_statistics () - Get class statistics
@@ -86,6 +90,7 @@ stats_client_unpack_statistics (char *buf_p)
   ATTR_STATS *attr_stats_p;
   BTREE_STATS *btree_stats_p;
   int max_unique_keys;
+  int histogram_length, column_groups_length;
   int i, j, k;
 
   if (buf_p == NULL)
@@ -138,6 +143,7 @@ stats_client_unpack_statistics (char *buf_p)
       db_ws_free (class_stats_p);
       return NULL;
     }
+  memset (class_stats_p->attr_stats, 0, class_stats_p->n_attrs * sizeof (ATTR_STATS));
 
   for (i = 0, attr_stats_p = class_stats_p->attr_stats; i < class_stats_p->n_attrs; i++, attr_stats_p++)
     {
@@ -147,6 +153,29 @@ stats_client_unpack_statistics (char *buf_p)
       attr_stats_p->type = (DB_TYPE) OR_GET_INT (buf_p);
       buf_p += OR_INT_SIZE;
 
+      histogram_length = OR_GET_INT (buf_p);
+      buf_p += OR_INT_SIZE;
+
+      if (histogram_length > 0)
+	{
+	  /* statistics are usable without histogram */
+	  attr_stats_p->histogram = stats_client_unpack_histogram (buf_p, histogram_length);
+	  buf_p += DB_ALIGN (histogram_length, INT_ALIGNMENT);
+	}
+
+      column_groups_length = OR_GET_INT (buf_p);
+      buf_p += OR_INT_SIZE;
+
+      if (column_groups_length > 0)
+	{
+	  if (stats_client_unpack_column_groups (buf_p, column_groups_length, attr_stats_p) != NO_ERROR)
+	    {
+	      stats_free_statistics (class_stats_p);
+	      return NULL;
+	    }
+	  buf_p += DB_ALIGN (column_groups_length, INT_ALIGNMENT);
+	}
+
       attr_stats_p->n_btstats = OR_GET_INT (buf_p);
       buf_p += OR_INT_SIZE;
 
@@ -244,6 +273,204 @@ stats_client_unpack_statistics (char *buf_p)
   return class_stats_p;
 }
 
+/*
+ * stats_client_unpack_histogram () - Unpack the histogram of an attribute
+ *   return: STATS_HISTOGRAM or NULL if it cannot be unpacked
+ *   buf_p(in): packed histogram; see stats_build_histogram ()
+ *   length(in): length of packed histogram
+ */
+STATS_HISTOGRAM *
+stats_client_unpack_histogram (char *buf_p, int length)
+{
+  STATS_HISTOGRAM *histogram_p;
+  OR_BUF buf;
+  int i, error = NO_ERROR;
+
+  or_init (&buf, buf_p, length);
+
+  if (or_get_int (&buf, &error) != STATS_HISTOGRAM_VERSION || error != NO_ERROR)
+    {
+      /* packed by another version */
+      return NULL;
+    }
+
+  histogram_p = (STATS_HISTOGRAM *) db_ws_alloc (sizeof (STATS_HISTOGRAM));
+  if (histogram_p == NULL)
+    {
+      return NULL;
+    }
+  memset (histogram_p, 0, sizeof (STATS_HISTOGRAM));
+
+  histogram_p->null_frac = or_get_double (&buf, &error);
+  histogram_p->ndv = (error == NO_ERROR) ? or_get_double (&buf, &error) : 0;
+  histogram_p->n_mcvs = (error == NO_ERROR) ? or_get_int (&buf, &error) : 0;
+  if (error != NO_ERROR || histogram_p->n_mcvs < 0 || histogram_p->n_mcvs > STATS_HISTOGRAM_MCVS_MAX)
+    {
+      histogram_p->n_mcvs = 0;
+      goto error;
+    }
+
+  if (histogram_p->n_mcvs > 0)
+    {
+      histogram_p->mcvs = (DB_VALUE *) db_ws_alloc (histogram_p->n_mcvs * sizeof (DB_VALUE));
+      histogram_p->mcv_freqs = (double *) db_ws_alloc (histogram_p->n_mcvs * sizeof (double));
+      if (histogram_p->mcvs == NULL || histogram_p->mcv_freqs == NULL)
+	{
+	  histogram_p->n_mcvs = 0;
+	  goto error;
+	}
+      for (i = 0; i < histogram_p->n_mcvs; i++)
+	{
+	  db_make_null (&histogram_p->mcvs[i]);
+	}
+
+      for (i = 0; i < histogram_p->n_mcvs; i++)
+	{
+	  histogram_p->mcv_freqs[i] = or_get_double (&buf, &error);
+	  if (error != NO_ERROR || or_get_value (&buf, &histogram_p->mcvs[i], NULL, -1, true) != NO_ERROR)
+	    {
+	      goto error;
+	    }
+	}
+    }
+
+  histogram_p->n_bounds = or_get_int (&buf, &error);
+  if (error != NO_ERROR || histogram_p->n_bounds < 0 || histogram_p->n_bounds > STATS_HISTOGRAM_BUCKETS_MAX + 1)
+    {
+      histogram_p->n_bounds = 0;
+      goto error;
+    }
+
+  if (histogram_p->n_bounds > 0)
+    {
+      histogram_p->bounds = (DB_VALUE *) db_ws_alloc (histogram_p->n_bounds * sizeof (DB_VALUE));
+      if (histogram_p->bounds == NULL)
+	{
+	  histogram_p->n_bounds = 0;
+	  goto error;
+	}
+      for (i = 0; i < histogram_p->n_bounds; i++)
+	{
+	  db_make_null (&histogram_p->bounds[i]);
+	}
+
+      for (i = 0; i < histogram_p->n_bounds; i++)
+	{
+	  if (or_get_value (&buf, &histogram_p->bounds[i], NULL, -1, true) != NO_ERROR)
+	    {
+	      goto error;
+	    }
+	}
+    }
+
+  return histogram_p;
+
+error:
+  stats_free_histogram (histogram_p);
+  return NULL;
+}
+
+/*
+ * stats_client_unpack_column_groups () - Unpack the column groups led by an attribute
+ *   return: error code
+ *   buf_p(in): packed column groups; see stats_pack_column_groups ()
+ *   length(in): length of packed column groups
+ *   attr_stats_p(out): statistics of attribute
+ *
+ *   Note: Groups packed by another version are left out.
+ */
+static int
+stats_client_unpack_column_groups (char *buf_p, int length, ATTR_STATS * attr_stats_p)
+{
+  STATS_COLUMN_GROUP *group_p;
+  OR_BUF buf;
+  int n_groups, i, j, error = NO_ERROR;
+
+  or_init (&buf, buf_p, length);
+
+  if (or_get_int (&buf, &error) != STATS_COLUMN_GROUPS_VERSION || error != NO_ERROR)
+    {
+      return NO_ERROR;
+    }
+  n_groups = or_get_int (&buf, &error);
+  if (error != NO_ERROR || n_groups <= 0 || n_groups > STATS_COLUMN_GROUPS_MAX)
+    {
+      return NO_ERROR;
+    }
+
+  attr_stats_p->column_groups = (STATS_COLUMN_GROUP *) db_ws_alloc (n_groups * sizeof (STATS_COLUMN_GROUP));
+  if (attr_stats_p->column_groups == NULL)
+    {
+      return ER_OUT_OF_VIRTUAL_MEMORY;
+    }
+  memset (attr_stats_p->column_groups, 0, n_groups * sizeof (STATS_COLUMN_GROUP));
+
+  for (i = 0; i < n_groups && error == NO_ERROR; i++)
+    {
+      group_p = &attr_stats_p->column_groups[i];
+
+      group_p->n_attrs = or_get_int (&buf, &error);
+      if (error != NO_ERROR || group_p->n_attrs < 2 || group_p->n_attrs > STATS_COLUMN_GROUP_ATTRS_MAX)
+	{
+	  break;
+	}
+      for (j = 0; j < group_p->n_attrs && error == NO_ERROR; j++)
+	{
+	  group_p->attr_ids[j] = or_get_int (&buf, &error);
+	}
+      group_p->ndv = (error == NO_ERROR) ? or_get_double (&buf, &error) : 0;
+      for (j = 0; j < group_p->n_attrs && error == NO_ERROR; j++)
+	{
+	  group_p->degrees[j] = or_get_double (&buf, &error);
+	}
+    }
+
+  if (i < n_groups)
+    {
+      /* statistics are usable without column groups */
+      db_ws_free (attr_stats_p->column_groups);
+      attr_stats_p->column_groups = NULL;
+      return NO_ERROR;
+    }
+
+  attr_stats_p->n_column_groups = n_groups;
+  return NO_ERROR;
+}
+
+/*
+ * stats_free_histogram () - Frees the histogram of an attribute
+ *   return: void
+ *   histogram_p(in): histogram to be freed
+ */
+void
+stats_free_histogram (STATS_HISTOGRAM * histogram_p)
+{
+  int i;
+
+  if (histogram_p->mcvs)
+    {
+      for (i = 0; i < histogram_p->n_mcvs; i++)
+	{
+	  pr_clear_value (&histogram_p->mcvs[i]);
+	}
+      db_ws_free (histogram_p->mcvs);
+    }
+  if (histogram_p->mcv_freqs)
+    {
+      db_ws_free (histogram_p->mcv_freqs);
+    }
+  if (histogram_p->bounds)
+    {
+      for (i = 0; i < histogram_p->n_bounds; i++)
+	{
+	  pr_clear_value (&histogram_p->bounds[i]);
+	}
+      db_ws_free (histogram_p->bounds);
+    }
+
+  db_ws_free (histogram_p);
+}
+
 /*
  * stats_free_statistics () - Frees the given CLASS_STAT structure
  *   return: void
@@ -261,6 +488,19 @@ stats_free_statistics (CLASS_STATS * class_statsp)
 	{
 	  for (i = 0, attr_statsp = class_statsp->attr_stats; i < class_statsp->n_attrs; i++, attr_statsp++)
 	    {
+	      if (attr_statsp->histogram)
+		{
+		  stats_free_histogram (attr_statsp->histogram);
+		  attr_statsp->histogram = NULL;
+		}
+
+	      if (attr_statsp->column_groups)
+		{
+		  db_ws_free (attr_statsp->column_groups);
+		  attr_statsp->column_groups = NULL;
+		  attr_statsp->n_column_groups = 0;
+		}
+
 	      if (attr_statsp->bt_stats)
 		{
 		  for (j = 0; j < attr_statsp->n_btstats; j++)
@@ -503,8 +743,86 @@ stats_dump (const char *class_name_p, FILE * file_p)
 		       bt_stats_p->leafs, bt_stats_p->height);
 	    }
 	}
+
+      if (attr_stats_p->histogram != NULL)
+	{
+	  stats_dump_histogram (attr_stats_p->histogram, file_p);
+	}
+
+      if (attr_stats_p->n_column_groups > 0)
+	{
+	  stats_dump_column_groups (class_mop, attr_stats_p, file_p);
+	}
       fprintf (file_p, "\n");
     }
 
   fprintf (file_p, "\n\n");
 }
+
+/*
+ * stats_dump_histogram () - Dumps the histogram of an attribute
+ *   return: void
+ *   histogram_p(in): histogram
+ *   file_p(in):
+ */
+static void
+stats_dump_histogram (STATS_HISTOGRAM * histogram_p, FILE * file_p)
+{
+  int i;
+
+  fprintf (file_p, "    Histogram:\n");
+  fprintf (file_p, "        Null fraction: %g , Distinct values: %.0f\n", histogram_p->null_frac, histogram_p->ndv);
+
+  for (i = 0; i < histogram_p->n_mcvs; i++)
+    {
+      fprintf (file_p, "        Common value: ");
+      db_value_fprint (file_p, &histogram_p->mcvs[i]);
+      fprintf (file_p, " , Fraction: %g\n", histogram_p->mcv_freqs[i]);
+    }
+
+  if (histogram_p->n_bounds > 0)
+    {
+      fprintf (file_p, "        Bucket bounds: ");
+      for (i = 0; i < histogram_p->n_bounds; i++)
+	{
+	  fprintf (file_p, "%s", (i > 0) ? " , " : "");
+	  db_value_fprint (file_p, &histogram_p->bounds[i]);
+	}
+      fprintf (file_p, "\n");
+    }
+}
+
+/*
+ * stats_dump_column_groups () - Dumps the column groups led by an attribute
+ *   return: void
+ *   class_mop(in): class of attribute
+ *   attr_stats_p(in): statistics of attribute
+ *   file_p(in):
+ */
+static void
+stats_dump_column_groups (MOP class_mop, ATTR_STATS * attr_stats_p, FILE * file_p)
+{
+  STATS_COLUMN_GROUP *group_p;
+  const char *name_p;
+  int i, j;
+
+  for (i = 0; i < attr_stats_p->n_column_groups; i++)
+    {
+      group_p = &attr_stats_p->column_groups[i];
+
+      fprintf (file_p, "    Column group: (");
+      for (j = 0; j < group_p->n_attrs; j++)
+	{
+	  name_p = sm_get_att_name (class_mop, group_p->attr_ids[j]);
+	  fprintf (file_p, "%s%s", (j > 0) ? ", " : "", (name_p ? name_p : "not found"));
+	}
+      fprintf (file_p, ")\n");
+
+      fprintf (file_p, "        Distinct values: %.0f , Dependency degrees: ", group_p->ndv);
+      for (j = 0; j < group_p->n_attrs; j++)
+	{
+	  fprintf (file_p, "%s%g", (j > 0) ? " , " : "", group_p->degrees[j]);
+	}
+      fprintf (file_p, "\n");
+    }
+}
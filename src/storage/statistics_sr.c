@@ -27,6 +27,7 @@
 #include <stdio.h>
 #include <string.h>
 #include <math.h>
+#include <limits.h>
 
 #include "statistics_sr.h"
 
@@ -34,10 +35,18 @@
 #include "heap_file.h"
 #include "boot_sr.h"
 #include "partition_sr.h"
+#include "dbtype.h"
 #include "object_primitive.h"
 #include "object_representation.h"
 #include "thread_entry.hpp"
+#include "thread_entry_task.hpp"
+#include "thread_manager.hpp"
 #include "system_parameter.h"
+#include "page_buffer.h"
+#include "slotted_page.h"
+#include "file_manager.h"
+
+#include <atomic>
 
 #define SQUARE(n) ((n)*(n))
 
@@ -62,6 +71,52 @@ struct partition_stats_acumulator
 				 * # of {a, b} ... pkeys[pkeys_size-1] -> # of {a, b, ..., x} */
 };
 
+/* Values of an attribute sampled to build its histogram */
+typedef struct stats_histogram_sample STATS_HISTOGRAM_SAMPLE;
+struct stats_histogram_sample
+{
+  DISK_ATTR *disk_attr;		/* attribute of the class representation */
+  INT64 n_objects;		/* objects scanned */
+  INT64 n_nulls;		/* objects having NULL */
+  INT64 n_unsampled;		/* non-NULL values too long to be sampled */
+  INT64 n_seen;			/* values offered to the sample */
+  double scale;			/* objects of class per scanned object; above 1 when heap pages are sampled */
+  int n_values;			/* number of values[] */
+  DB_VALUE *values;		/* reservoir of STATS_HISTOGRAM_SAMPLE_SIZE values */
+  unsigned char *sketch;	/* HyperLogLog sketch of all values of a full scan, or NULL */
+  char *histogram;		/* packed histogram built from sample, allocated with malloc */
+  int histogram_length;		/* length of histogram */
+};
+
+/* Rows of a column group sampled to estimate the correlation of its attributes */
+typedef struct stats_column_group_sample STATS_COLUMN_GROUP_SAMPLE;
+struct stats_column_group_sample
+{
+  STATS_COLUMN_GROUP group;	/* declared group; gets the estimated statistics */
+  DISK_ATTR *disk_attr;		/* attribute leading the group */
+  INT64 n_seen;			/* rows having no NULL offered to the sample */
+  double scale;			/* objects of class per scanned object */
+  int n_rows;			/* number of rows in hashes */
+  UINT64 *hashes;		/* reservoir of STATS_HISTOGRAM_SAMPLE_SIZE rows of group.n_attrs value hashes */
+  unsigned char *sketch;	/* HyperLogLog sketch of all rows of a full scan, or NULL */
+};
+
+/* Hash of a value of an attribute and combined hash of the other values of its row */
+typedef struct stats_hash_pair STATS_HASH_PAIR;
+struct stats_hash_pair
+{
+  UINT64 hash;
+  UINT64 rest;
+};
+
+/* Run of equal values in a sorted sample */
+typedef struct stats_value_run STATS_VALUE_RUN;
+struct stats_value_run
+{
+  int start;			/* index of first value */
+  int count;			/* number of equal values */
+};
+
 #if defined(ENABLE_UNUSED_FUNCTION)
 static int stats_compare_data (DB_DATA * data1, DB_DATA * data2, DB_TYPE type);
 static int stats_compare_date (DB_DATE * date1, DB_DATE * date2);
@@ -71,7 +126,47 @@ static int stats_compare_datetime (DB_DATETIME * datetime1_p, DB_DATETIME * date
 static int stats_compare_money (DB_MONETARY * mn1, DB_MONETARY * mn2);
 #endif
 static int stats_update_partitioned_statistics (THREAD_ENTRY * thread_p, OID * class_oid, OID * partitions, int count,
-						bool with_fullscan);
+						bool with_fullscan, int sample_rows);
+static int stats_adjust_distinct_values (int distinct, double inserted, bool is_sketched, INT64 deletes,
+					 int tot_objects);
+static void stats_apply_btree_delta (BTREE_STATS * btree_stats_p, const BTREE_STATS_DELTA * delta_p, int tot_objects);
+static bool stats_is_histogram_type (DB_TYPE type);
+static int stats_gather_histograms (THREAD_ENTRY * thread_p, OID * class_id_p, HFID * hfid_p, DISK_REPR * disk_repr_p,
+				    bool with_fullscan, int sample_rows, int npages, int nobjs);
+static int stats_sample_heap_page (THREAD_ENTRY * thread_p, OID * class_id_p, const VPID * vpid_p,
+				   HEAP_SCANCACHE * scan_cache, HEAP_CACHE_ATTRINFO * attr_info, ATTR_ID * attr_ids,
+				   STATS_HISTOGRAM_SAMPLE * samples_p, int n_samples,
+				   STATS_COLUMN_GROUP_SAMPLE * groups_p, int n_groups);
+static int stats_sample_object (THREAD_ENTRY * thread_p, OID * oid_p, RECDES * recdes_p, HEAP_CACHE_ATTRINFO * attr_info,
+				ATTR_ID * attr_ids, STATS_HISTOGRAM_SAMPLE * samples_p, int n_samples,
+				STATS_COLUMN_GROUP_SAMPLE * groups_p, int n_groups);
+static int stats_sample_column_group (THREAD_ENTRY * thread_p, STATS_COLUMN_GROUP_SAMPLE * group_sample_p,
+				      HEAP_CACHE_ATTRINFO * attr_info);
+static int stats_sample_histogram_value (THREAD_ENTRY * thread_p, STATS_HISTOGRAM_SAMPLE * sample_p, DB_VALUE * value);
+static int stats_build_histograms (THREAD_ENTRY * thread_p, STATS_HISTOGRAM_SAMPLE * samples_p, int n_samples);
+static int stats_build_histogram (THREAD_ENTRY * thread_p, STATS_HISTOGRAM_SAMPLE * sample_p);
+static double stats_estimate_distinct_values (int n, int n_runs, int n_singles, double n_values,
+					     const unsigned char *sketch);
+static int stats_compare_histogram_values (const void *value1, const void *value2);
+static int stats_compare_value_runs_by_count (const void *run1, const void *run2);
+static int stats_compare_value_runs_by_start (const void *run1, const void *run2);
+static int stats_prepare_column_groups (THREAD_ENTRY * thread_p, DISK_REPR * disk_repr_p, double scale,
+				       bool with_fullscan, STATS_COLUMN_GROUP_SAMPLE ** groups_p, int *n_groups,
+				       ATTR_ID * attr_ids, int *n_read_attrs);
+static int stats_build_column_group (THREAD_ENTRY * thread_p, STATS_COLUMN_GROUP_SAMPLE * group_sample_p);
+static int stats_store_column_groups (THREAD_ENTRY * thread_p, DISK_REPR * disk_repr_p,
+				      STATS_COLUMN_GROUP_SAMPLE * groups_p, int n_groups);
+static int stats_compare_hash_pairs (const void *pair1, const void *pair2);
+static int stats_unpack_column_groups (const char *buf_p, int length, STATS_COLUMN_GROUP * groups_p);
+static int stats_pack_column_groups (THREAD_ENTRY * thread_p, STATS_COLUMN_GROUP * groups_p, int n_groups,
+				     DISK_ATTR * disk_attr_p);
+static DISK_ATTR *stats_find_disk_attr (DISK_REPR * disk_repr_p, int attr_id);
+static int stats_find_column_group (STATS_COLUMN_GROUP * groups_p, int n_groups, int n_attrs, const int *attr_ids);
+static int stats_get_declared_column_groups (THREAD_ENTRY * thread_p, OID * class_id_p, STATS_COLUMN_GROUP * groups_p,
+					     int *n_groups);
+static int stats_declare_column_groups (THREAD_ENTRY * thread_p, OID * class_id_p, DISK_REPR * disk_repr_p);
+static void stats_combine_partition_column_groups (STATS_COLUMN_GROUP * groups_p, int n_groups,
+						   DISK_ATTR * subcls_attr_p, double weight);
 
 /*
  * xstats_update_statistics () -  Updates the statistics for the objects
@@ -79,6 +174,7 @@ static int stats_update_partitioned_statistics (THREAD_ENTRY * thread_p, OID * c
  *   return:
  *   class_id(in): Identifier of the class
  *   with_fullscan(in): true iff WITH FULLSCAN
+ *   sample_rows(in): objects of WITH SAMPLE, or STATS_SAMPLE_ROWS_DEFAULT
  *
  * Note: It first retrieves the whole catalog information about this class,
  *       including all possible forms of disk representations for the instance
@@ -102,7 +198,7 @@ static int stats_update_partitioned_statistics (THREAD_ENTRY * thread_p, OID * c
  *       for the last class representation.
  */
 int
-xstats_update_statistics (THREAD_ENTRY * thread_p, OID * class_id_p, bool with_fullscan)
+xstats_update_statistics (THREAD_ENTRY * thread_p, OID * class_id_p, bool with_fullscan, int sample_rows)
 {
   CLS_INFO *cls_info_p = NULL;
   REPR_ID repr_id;
@@ -201,7 +297,8 @@ xstats_update_statistics (THREAD_ENTRY * thread_p, OID * class_id_p, bool with_f
       /* Update statistics for all partitions and the partitioned class */
       assert (partitions != NULL);
       catalog_free_class_info_and_init (cls_info_p);
-      error_code = stats_update_partitioned_statistics (thread_p, class_id_p, partitions, count, with_fullscan);
+      error_code =
+	stats_update_partitioned_statistics (thread_p, class_id_p, partitions, count, with_fullscan, sample_rows);
       db_private_free (thread_p, partitions);
       if (error_code != NO_ERROR)
 	{
@@ -278,6 +375,29 @@ xstats_update_statistics (THREAD_ENTRY * thread_p, OID * class_id_p, bool with_f
 	}			/* for (j = 0; ...) */
     }				/* for (i = 0; ...) */
 
+  /* column groups are declared with the schema; they are gathered with the histograms */
+  error_code = stats_declare_column_groups (thread_p, class_id_p, disk_repr_p);
+  if (error_code != NO_ERROR)
+    {
+      goto error;
+    }
+
+  /* histograms need a scan of the heap, or of a sample of its pages */
+  if (!with_fullscan && sample_rows == STATS_SAMPLE_ROWS_DEFAULT)
+    {
+      sample_rows = prm_get_integer_value (PRM_ID_STATS_SAMPLE_ROWS);
+    }
+  if (with_fullscan || sample_rows > 0)
+    {
+      error_code =
+	stats_gather_histograms (thread_p, class_id_p, &cls_info_p->ci_hfid, disk_repr_p, with_fullscan, sample_rows,
+				 cls_info_p->ci_tot_pages, cls_info_p->ci_tot_objects);
+      if (error_code != NO_ERROR)
+	{
+	  goto error;
+	}
+    }
+
   error_code = catalog_start_access_with_dir_oid (thread_p, &catalog_access_info, X_LOCK);
   if (error_code != NO_ERROR)
     {
@@ -345,6 +465,7 @@ error:
  *                                   for all the classes of the database
  *   return:
  *   with_fullscan(in): true iff WITH FULLSCAN
+ *   sample_rows(in): objects of WITH SAMPLE, or STATS_SAMPLE_ROWS_DEFAULT
  *
  * Note: It performs this by getting the list of all classes existing in the
  *       database and their OID's from the catalog's class collection
@@ -353,7 +474,7 @@ error:
  *       of this list one by one.
  */
 int
-xstats_update_all_statistics (THREAD_ENTRY * thread_p, bool with_fullscan)
+xstats_update_all_statistics (THREAD_ENTRY * thread_p, bool with_fullscan, int sample_rows)
 {
   int error = NO_ERROR;
   RECDES recdes = RECDES_INITIALIZER;	/* Record descriptor for peeking object */
@@ -397,7 +518,7 @@ xstats_update_all_statistics (THREAD_ENTRY * thread_p, bool with_fullscan)
       assert (strlen (classname) < DB_MAX_IDENTIFIER_LENGTH);
 #endif
 
-      error = xstats_update_statistics (thread_p, &class_oid, with_fullscan);
+      error = xstats_update_statistics (thread_p, &class_oid, with_fullscan, sample_rows);
       if (error == ER_UPDATE_STAT_CANNOT_GET_LOCK || error == ER_SP_UNKNOWN_SLOTID)
 	{
 	  /* continue with other classes */
@@ -447,18 +568,24 @@ xstats_get_statistics_from_server (THREAD_ENTRY * thread_p, OID * class_id_p, un
   DISK_REPR *disk_repr_p;
   DISK_ATTR *disk_attr_p;
   BTREE_STATS *btree_stats_p;
+  BTREE_STATS_DELTA *deltas_p, *delta_p;
   OID dir_oid;
   int npages, estimated_nobjs, max_unique_keys;
-  int i, j, k, size, n_attrs, tot_n_btstats, tot_key_info_size;
+  int i, j, k, size, n_attrs, tot_n_btstats, tot_key_info_size, tot_histogram_size, n_deltas;
+  int tot_column_groups_size;
+  INT64 max_changes, objects_delta;
+  unsigned int class_time_stamp;
   char *buf_p, *start_p;
   int key_size;
   int lk_grant_code;
   CATALOG_ACCESS_INFO catalog_access_info = CATALOG_ACCESS_INFO_INITIALIZER;
   bool use_stat_estimation = prm_get_bool_value (PRM_ID_USE_STAT_ESTIMATION);
+  bool use_dml_delta = prm_get_bool_value (PRM_ID_STATS_DML_DELTA);
 
   /* init */
   cls_info_p = NULL;
   disk_repr_p = NULL;
+  deltas_p = NULL;
 
   thread_p->push_resource_tracks ();
 
@@ -504,7 +631,9 @@ xstats_get_statistics_from_server (THREAD_ENTRY * thread_p, OID * class_id_p, un
       goto exit_on_error;
     }
 
-  if (time_stamp > 0 && time_stamp >= cls_info_p->ci_time_stamp)
+  /* statistics cached by client are up to date unless they were gathered again or some index changed enough since */
+  if (time_stamp > 0 && time_stamp >= cls_info_p->ci_time_stamp
+      && (!use_dml_delta || time_stamp >= btree_delta_get_last_time_stamp ()))
     {
       *length_p = 0;
       goto exit_on_error;
@@ -527,7 +656,7 @@ xstats_get_statistics_from_server (THREAD_ENTRY * thread_p, OID * class_id_p, un
 
   n_attrs = disk_repr_p->n_fixed + disk_repr_p->n_variable;
 
-  tot_n_btstats = tot_key_info_size = 0;
+  tot_n_btstats = tot_key_info_size = tot_histogram_size = tot_column_groups_size = 0;
   for (i = 0; i < n_attrs; i++)
     {
       if (i < disk_repr_p->n_fixed)
@@ -539,6 +668,8 @@ xstats_get_statistics_from_server (THREAD_ENTRY * thread_p, OID * class_id_p, un
 	  disk_attr_p = disk_repr_p->variable + (i - disk_repr_p->n_fixed);
 	}
 
+      tot_histogram_size += DB_ALIGN (disk_attr_p->histogram_length, INT_ALIGNMENT);
+      tot_column_groups_size += DB_ALIGN (disk_attr_p->column_groups_length, INT_ALIGNMENT);
       tot_n_btstats += disk_attr_p->n_btstats;
       for (j = 0, btree_stats_p = disk_attr_p->bt_stats; j < disk_attr_p->n_btstats; j++, btree_stats_p++)
 	{
@@ -548,6 +679,59 @@ xstats_get_statistics_from_server (THREAD_ENTRY * thread_p, OID * class_id_p, un
 	}
     }
 
+  /* Get changes of indexes since statistics were gathered. If enough objects changed, statistics cached by client are
+   * stale even if statistics were not gathered again. */
+  class_time_stamp = cls_info_p->ci_time_stamp;
+  objects_delta = 0;
+  if (use_dml_delta && tot_n_btstats > 0)
+    {
+      deltas_p = (BTREE_STATS_DELTA *) malloc (tot_n_btstats * sizeof (BTREE_STATS_DELTA));
+      if (deltas_p == NULL)
+	{
+	  goto exit_on_error;
+	}
+
+      n_deltas = 0;
+      max_changes = 0;
+      for (i = 0; i < n_attrs; i++)
+	{
+	  if (i < disk_repr_p->n_fixed)
+	    {
+	      disk_attr_p = disk_repr_p->fixed + i;
+	    }
+	  else
+	    {
+	      disk_attr_p = disk_repr_p->variable + (i - disk_repr_p->n_fixed);
+	    }
+
+	  for (j = 0, btree_stats_p = disk_attr_p->bt_stats; j < disk_attr_p->n_btstats; j++, btree_stats_p++)
+	    {
+	      delta_p = &deltas_p[n_deltas++];
+	      if (!btree_delta_get (thread_p, &btree_stats_p->btid, cls_info_p->ci_tot_objects, delta_p))
+		{
+		  memset (delta_p, 0, sizeof (BTREE_STATS_DELTA));
+		  continue;
+		}
+
+	      class_time_stamp = MAX (class_time_stamp, delta_p->time_stamp);
+
+	      /* filtered indexes miss some objects; the most changed index has seen the most of them */
+	      if (delta_p->inserts + delta_p->deletes > max_changes)
+		{
+		  max_changes = delta_p->inserts + delta_p->deletes;
+		  objects_delta = delta_p->inserts - delta_p->deletes;
+		}
+	    }
+	}
+      assert (n_deltas == tot_n_btstats);
+    }
+
+  if (time_stamp > 0 && time_stamp >= class_time_stamp)
+    {
+      *length_p = 0;
+      goto exit_on_error;
+    }
+
   size = (OR_INT_SIZE		/* time_stamp of CLS_INFO */
 	  + OR_INT_SIZE		/* tot_objects of CLS_INFO */
 	  + OR_INT_SIZE		/* tot_pages of CLS_INFO */
@@ -555,8 +739,13 @@ xstats_get_statistics_from_server (THREAD_ENTRY * thread_p, OID * class_id_p, un
 	  + (OR_INT_SIZE	/* id of DISK_ATTR */
 	     + OR_INT_SIZE	/* type of DISK_ATTR */
 	     + OR_INT_SIZE	/* n_btstats of DISK_ATTR */
+	     + OR_INT_SIZE	/* histogram_length of DISK_ATTR */
+	     + OR_INT_SIZE	/* column_groups_length of DISK_ATTR */
 	  ) * n_attrs);		/* number of attributes */
 
+  size += tot_histogram_size;	/* histogram of DISK_ATTR */
+  size += tot_column_groups_size;	/* column_groups of DISK_ATTR */
+
   size += ((OR_BTID_ALIGNED_SIZE	/* btid of BTREE_STATS */
 	    + OR_INT_SIZE	/* leafs of BTREE_STATS */
 	    + OR_INT_SIZE	/* pages of BTREE_STATS */
@@ -576,7 +765,7 @@ xstats_get_statistics_from_server (THREAD_ENTRY * thread_p, OID * class_id_p, un
     }
   memset (start_p, 0, size);
 
-  OR_PUT_INT (buf_p, cls_info_p->ci_time_stamp);
+  OR_PUT_INT (buf_p, class_time_stamp);
   buf_p += OR_INT_SIZE;
 
   npages = estimated_nobjs = max_unique_keys = -1;
@@ -594,56 +783,1913 @@ xstats_get_statistics_from_server (THREAD_ENTRY * thread_p, OID * class_id_p, un
       OR_PUT_INT (buf_p, cls_info_p->ci_tot_pages);	/* #pages */
       buf_p += OR_INT_SIZE;
     }
-  else if (!use_stat_estimation)
+  else if (!use_stat_estimation)
+    {
+      /* use statistics info, adjusted by objects changed since */
+      OR_PUT_INT (buf_p, (int) MIN (MAX (cls_info_p->ci_tot_objects + objects_delta, 0), INT_MAX));	/* #objects */
+      buf_p += OR_INT_SIZE;
+
+      OR_PUT_INT (buf_p, MAX (cls_info_p->ci_tot_pages, 1));	/* #pages */
+      buf_p += OR_INT_SIZE;
+    }
+  else
+    {
+      /* use estimates from the heap since it is likely that its estimates are more accurate than the ones gathered at
+       * update statistics time */
+      estimated_nobjs = heap_estimate_num_objects (thread_p, &(cls_info_p->ci_hfid));
+      if (estimated_nobjs < 0)
+	{
+	  /* cannot get estimates from the heap, use ones from the catalog */
+	  estimated_nobjs = cls_info_p->ci_tot_objects;
+	}
+      else
+	{
+	  /* heuristic is that big nobjs is better than small */
+	  estimated_nobjs = MAX (estimated_nobjs, cls_info_p->ci_tot_objects);
+	}
+
+      OR_PUT_INT (buf_p, estimated_nobjs);	/* #objects */
+      buf_p += OR_INT_SIZE;
+
+      /* do not use estimated npages, get correct info */
+      assert (!VFID_ISNULL (&cls_info_p->ci_hfid.vfid));
+      if (file_get_num_user_pages (thread_p, &cls_info_p->ci_hfid.vfid, &npages) != NO_ERROR)
+	{
+	  int err;
+
+	  ASSERT_ERROR_AND_SET (err);
+	  /* cannot get #pages from the heap, use ones from the catalog */
+	  npages = cls_info_p->ci_tot_pages;
+	  assert (0 < npages || err == ER_INTERRUPTED);
+	  npages = MAX (npages, 1);	/* safe-guard */
+	}
+      assert (npages > 0);
+
+      OR_PUT_INT (buf_p, npages);	/* #pages */
+      buf_p += OR_INT_SIZE;
+    }
+
+  OR_PUT_INT (buf_p, n_attrs);
+  buf_p += OR_INT_SIZE;
+
+  /* put the statistics information of each attribute to the buffer */
+  n_deltas = 0;
+  for (i = 0; i < n_attrs; i++)
+    {
+      if (i < disk_repr_p->n_fixed)
+	{
+	  disk_attr_p = disk_repr_p->fixed + i;
+	}
+      else
+	{
+	  disk_attr_p = disk_repr_p->variable + (i - disk_repr_p->n_fixed);
+	}
+
+      OR_PUT_INT (buf_p, disk_attr_p->id);
+      buf_p += OR_INT_SIZE;
+
+      OR_PUT_INT (buf_p, disk_attr_p->type);
+      buf_p += OR_INT_SIZE;
+
+      OR_PUT_INT (buf_p, disk_attr_p->histogram_length);
+      buf_p += OR_INT_SIZE;
+
+      if (disk_attr_p->histogram_length > 0)
+	{
+	  memcpy (buf_p, disk_attr_p->histogram, disk_attr_p->histogram_length);
+	  buf_p += DB_ALIGN (disk_attr_p->histogram_length, INT_ALIGNMENT);
+	}
+
+      OR_PUT_INT (buf_p, disk_attr_p->column_groups_length);
+      buf_p += OR_INT_SIZE;
+
+      if (disk_attr_p->column_groups_length > 0)
+	{
+	  memcpy (buf_p, disk_attr_p->column_groups, disk_attr_p->column_groups_length);
+	  buf_p += DB_ALIGN (disk_attr_p->column_groups_length, INT_ALIGNMENT);
+	}
+
+      OR_PUT_INT (buf_p, disk_attr_p->n_btstats);
+      buf_p += OR_INT_SIZE;
+
+      for (j = 0, btree_stats_p = disk_attr_p->bt_stats; j < disk_attr_p->n_btstats; j++, btree_stats_p++)
+	{
+	  delta_p = (deltas_p != NULL) ? &deltas_p[n_deltas++] : NULL;
+	  if (delta_p != NULL && (delta_p->inserts > 0 || delta_p->deletes > 0))
+	    {
+	      stats_apply_btree_delta (btree_stats_p, delta_p, cls_info_p->ci_tot_objects);
+	    }
+	  else
+	    {
+	      delta_p = NULL;
+	    }
+
+	  /* collect maximum unique keys info */
+	  if (xbtree_get_unique_pk (thread_p, &btree_stats_p->btid))
+	    {
+	      max_unique_keys = MAX (max_unique_keys, btree_stats_p->keys);
+	    }
+
+	  OR_PUT_BTID (buf_p, &btree_stats_p->btid);
+	  buf_p += OR_BTID_ALIGNED_SIZE;
+
+	  /* defense for not gathered statistics */
+	  btree_stats_p->leafs = MAX (1, btree_stats_p->leafs);
+	  btree_stats_p->pages = MAX (1, btree_stats_p->pages);
+	  btree_stats_p->height = MAX (1, btree_stats_p->height);
+
+	  /* If the btree file has currently more pages than when we gathered statistics, assume that all growth happen
+	   * at the leaf level. If the btree is smaller, we use the gathered statistics since the btree may have an
+	   * external file (unknown at this level) to keep overflow keys. */
+	  if (file_get_num_user_pages (thread_p, &btree_stats_p->btid.vfid, &npages) != NO_ERROR)
+	    {
+	      int err;
+
+	      /* what to do here? */
+	      ASSERT_ERROR_AND_SET (err);
+	      npages = btree_stats_p->pages;
+	      assert (0 < npages || err == ER_INTERRUPTED);
+	      npages = MAX (npages, 1);	/* safe-guard */
+	    }
+	  assert (npages > 0);
+	  if (npages > btree_stats_p->pages && use_stat_estimation)
+	    {
+	      OR_PUT_INT (buf_p, (btree_stats_p->leafs + (npages - btree_stats_p->pages)));
+	      buf_p += OR_INT_SIZE;
+
+	      OR_PUT_INT (buf_p, npages);
+	      buf_p += OR_INT_SIZE;
+	    }
+	  else
+	    {
+	      OR_PUT_INT (buf_p, btree_stats_p->leafs);
+	      buf_p += OR_INT_SIZE;
+
+	      OR_PUT_INT (buf_p, btree_stats_p->pages);
+	      buf_p += OR_INT_SIZE;
+	    }
+
+	  OR_PUT_INT (buf_p, btree_stats_p->height);
+	  buf_p += OR_INT_SIZE;
+
+	  OR_PUT_INT (buf_p, btree_stats_p->has_function);
+	  buf_p += OR_INT_SIZE;
+
+	  /* check and handle with estimation, since pkeys[] is not gathered before update stats */
+	  if (estimated_nobjs > 0 && use_stat_estimation)
+	    {
+	      /* is non-empty index */
+	      btree_stats_p->keys = MAX (btree_stats_p->keys, 1);
+
+	      /* If the estimated objects from heap manager is greater than the estimate when the statistics were
+	       * gathered, assume that the difference is in distinct keys. Changes counted by the index already
+	       * adjusted its keys. */
+	      if (cls_info_p->ci_tot_objects > 0 && estimated_nobjs > cls_info_p->ci_tot_objects && delta_p == NULL)
+		{
+		  btree_stats_p->keys += (estimated_nobjs - cls_info_p->ci_tot_objects);
+		}
+	    }
+
+	  OR_PUT_INT (buf_p, btree_stats_p->keys);
+	  buf_p += OR_INT_SIZE;
+
+	  assert_release (btree_stats_p->leafs >= 1);
+	  assert_release (btree_stats_p->pages >= 1);
+	  assert_release (btree_stats_p->height >= 1);
+	  assert_release (btree_stats_p->keys >= 0);
+
+	  buf_p = or_pack_domain (buf_p, btree_stats_p->key_type, 0, 0);
+
+	  /* get full key size */
+	  if (TP_DOMAIN_TYPE (btree_stats_p->key_type) == DB_TYPE_MIDXKEY)
+	    {
+	      key_size = tp_domain_size (btree_stats_p->key_type->setdomain);
+	    }
+	  else
+	    {
+	      key_size = 1;
+	    }
+	  assert (key_size >= btree_stats_p->pkeys_size);
+
+	  assert (btree_stats_p->pkeys_size <= BTREE_STATS_PKEYS_NUM);
+	  for (k = 0; k < btree_stats_p->pkeys_size; k++)
+	    {
+	      /* check and handle with estimation, since pkeys[] is not gathered before update stats */
+	      if (estimated_nobjs > 0 && use_stat_estimation)
+		{
+		  /* is non-empty index */
+		  btree_stats_p->pkeys[k] = MAX (btree_stats_p->pkeys[k], 1);
+		}
+
+	      if (k + 1 == key_size)
+		{
+		  /* this last pkeys must be equal to keys */
+		  btree_stats_p->pkeys[k] = btree_stats_p->keys;
+		}
+
+	      OR_PUT_INT (buf_p, btree_stats_p->pkeys[k]);
+	      buf_p += OR_INT_SIZE;
+	    }
+	}			/* for (j = 0, ...) */
+    }
+
+  OR_PUT_INT (buf_p, max_unique_keys);
+  buf_p += OR_INT_SIZE;
+
+  if (deltas_p != NULL)
+    {
+      free_and_init (deltas_p);
+    }
+  catalog_free_representation_and_init (disk_repr_p);
+  catalog_free_class_info_and_init (cls_info_p);
+
+  *length_p = CAST_STRLEN (buf_p - start_p);
+
+  thread_p->pop_resource_tracks ();
+
+  return start_p;
+
+exit_on_error:
+
+  if (catalog_access_info.access_started)
+    {
+      (void) catalog_end_access_with_dir_oid (thread_p, &catalog_access_info, ER_FAILED);
+    }
+
+  if (deltas_p != NULL)
+    {
+      free_and_init (deltas_p);
+    }
+  if (disk_repr_p)
+    {
+      catalog_free_representation_and_init (disk_repr_p);
+    }
+  if (cls_info_p)
+    {
+      catalog_free_class_info_and_init (cls_info_p);
+    }
+
+  thread_p->pop_resource_tracks ();
+
+  return NULL;
+}
+
+/*
+ * stats_adjust_distinct_values () - Estimate distinct values of an index key (prefix) after objects changed
+ *   return: estimated number of distinct values
+ *   distinct(in): distinct values in gathered statistics
+ *   inserted(in): estimated distinct values of inserted objects
+ *   is_sketched(in): true if inserted is estimated by a sketch, false if it is the number of inserted objects
+ *   deletes(in): number of deleted objects
+ *   tot_objects(in): objects of class in gathered statistics
+ *
+ *   Note: A deleted value is assumed to be the last of its kind with probability distinct/tot_objects of the
+ *         gathered statistics. Distinct values estimated by a sketch are counted as new; otherwise an inserted
+ *         value is assumed to be new with the same probability. Values inserted in an empty class are all new.
+ */
+static int
+stats_adjust_distinct_values (int distinct, double inserted, bool is_sketched, INT64 deletes, int tot_objects)
+{
+  double new_ratio = 1.0;
+  double estimate;
+
+  if (tot_objects > 0)
+    {
+      new_ratio = MIN ((double) distinct / tot_objects, 1.0);
+    }
+
+  if (!is_sketched)
+    {
+      inserted *= new_ratio;
+    }
+  estimate = distinct + inserted - (double) deletes * new_ratio;
+
+  return (int) MIN (MAX (estimate, 0.0), (double) INT_MAX);
+}
+
+/*
+ * stats_apply_btree_delta () - Adjust gathered statistics of an index by its changes since then
+ *   return: void
+ *   btree_stats_p(in/out): statistics of index
+ *   delta_p(in): changes of index
+ *   tot_objects(in): objects of class in gathered statistics
+ */
+static void
+stats_apply_btree_delta (BTREE_STATS * btree_stats_p, const BTREE_STATS_DELTA * delta_p, int tot_objects)
+{
+  int k;
+
+  btree_stats_p->keys =
+    stats_adjust_distinct_values (btree_stats_p->keys, delta_p->keys_inserted, delta_p->keys_sketched,
+				  delta_p->deletes, tot_objects);
+
+  assert (btree_stats_p->pkeys_size <= BTREE_STATS_PKEYS_NUM);
+  for (k = 0; k < btree_stats_p->pkeys_size; k++)
+    {
+      btree_stats_p->pkeys[k] =
+	stats_adjust_distinct_values (btree_stats_p->pkeys[k], delta_p->pkeys_inserted[k], k < delta_p->pkeys_sketched,
+				      delta_p->deletes, tot_objects);
+    }
+}
+
+/*
+ * stats_is_histogram_type () - Can a histogram be gathered for values of type?
+ *   return: true if values of type are ordered and small enough to be kept in catalog
+ *   type(in): type of attribute
+ */
+static bool
+stats_is_histogram_type (DB_TYPE type)
+{
+  switch (type)
+    {
+    case DB_TYPE_SHORT:
+    case DB_TYPE_INTEGER:
+    case DB_TYPE_BIGINT:
+    case DB_TYPE_FLOAT:
+    case DB_TYPE_DOUBLE:
+    case DB_TYPE_NUMERIC:
+    case DB_TYPE_MONETARY:
+    case DB_TYPE_DATE:
+    case DB_TYPE_TIME:
+    case DB_TYPE_TIMESTAMP:
+    case DB_TYPE_DATETIME:
+    case DB_TYPE_CHAR:
+    case DB_TYPE_VARCHAR:
+    case DB_TYPE_NCHAR:
+    case DB_TYPE_VARNCHAR:
+      return true;
+
+    default:
+      return false;
+    }
+}
+
+/*
+ * stats_gather_histograms () - Build histograms of the attributes of a class by a scan of its heap, or of a sample of
+ *                              its heap pages
+ *   return: error code
+ *   class_id_p(in): class
+ *   hfid_p(in): heap of class
+ *   disk_repr_p(in/out): last representation of class; gets the packed histograms of its attributes
+ *   with_fullscan(in): true to scan all objects
+ *   sample_rows(in): number of objects to read from a random sample of heap pages, without full scan
+ *   npages(in): number of heap pages
+ *   nobjs(in): estimated number of objects
+ *
+ *   Note: Each attribute keeps a reservoir sample of STATS_HISTOGRAM_SAMPLE_SIZE values; its histogram is built from
+ *         the sample once all objects are seen. A full scan also adds all values to a HyperLogLog sketch, which
+ *         estimates the number of distinct values.
+ *
+ *         Column groups declared on the attributes (CREATE STATISTICS) sample rows of value hashes the same way and
+ *         get their distinct values and dependency degrees.
+ */
+static int
+stats_gather_histograms (THREAD_ENTRY * thread_p, OID * class_id_p, HFID * hfid_p, DISK_REPR * disk_repr_p,
+			 bool with_fullscan, int sample_rows, int npages, int nobjs)
+{
+  STATS_HISTOGRAM_SAMPLE *samples_p = NULL, *sample_p;
+  STATS_COLUMN_GROUP_SAMPLE *groups_p = NULL;
+  ATTR_ID *attr_ids = NULL;
+  DISK_ATTR *disk_attr_p;
+  HEAP_CACHE_ATTRINFO attr_info;
+  HEAP_SCANCACHE scan_cache;
+  MVCC_SNAPSHOT *mvcc_snapshot;
+  RECDES recdes = RECDES_INITIALIZER;
+  OID oid;
+  VPID *vpids = NULL;
+  SCAN_CODE scan_code;
+  INT64 n_scanned = 0;
+  double scale = 1.0;
+  bool attr_info_started = false, scan_started = false;
+  bool continue_checking = true;
+  int n_attrs, n_samples, n_groups, n_read_attrs, n_sample_pages, n_sampled_pages, i, j;
+  int error_code = NO_ERROR;
+
+  n_samples = n_groups = 0;
+  n_attrs = disk_repr_p->n_fixed + disk_repr_p->n_variable;
+  if (n_attrs <= 0)
+    {
+      return NO_ERROR;
+    }
+
+  samples_p = (STATS_HISTOGRAM_SAMPLE *) db_private_alloc (thread_p, n_attrs * sizeof (STATS_HISTOGRAM_SAMPLE));
+  attr_ids = (ATTR_ID *) db_private_alloc (thread_p, n_attrs * sizeof (ATTR_ID));
+  if (samples_p == NULL || attr_ids == NULL)
+    {
+      ASSERT_ERROR_AND_SET (error_code);
+      goto end;
+    }
+
+  n_sample_pages = n_sampled_pages = 0;
+  if (!with_fullscan)
+    {
+      /* enough pages to read about sample_rows objects */
+      assert (sample_rows > 0);
+      n_sample_pages = (int) MIN ((INT64) npages, 1 + (INT64) sample_rows * MAX (npages, 1) / MAX (nobjs, 1));
+
+      vpids = (VPID *) db_private_alloc (thread_p, MAX (n_sample_pages, 1) * sizeof (VPID));
+      if (vpids == NULL)
+	{
+	  ASSERT_ERROR_AND_SET (error_code);
+	  goto end;
+	}
+
+      error_code =
+	file_sample_user_pages (thread_p, &hfid_p->vfid, MAX (n_sample_pages, 1), &thread_p->rand_seed, vpids,
+				&n_sampled_pages);
+      if (error_code != NO_ERROR)
+	{
+	  goto end;
+	}
+      if (n_sampled_pages > 0)
+	{
+	  scale = MAX ((double) npages / n_sampled_pages, 1.0);
+	}
+    }
+
+  for (i = 0; i < n_attrs; i++)
+    {
+      if (i < disk_repr_p->n_fixed)
+	{
+	  disk_attr_p = disk_repr_p->fixed + i;
+	}
+      else
+	{
+	  disk_attr_p = disk_repr_p->variable + (i - disk_repr_p->n_fixed);
+	}
+
+      if (!stats_is_histogram_type (disk_attr_p->type))
+	{
+	  continue;
+	}
+
+      sample_p = &samples_p[n_samples];
+      memset (sample_p, 0, sizeof (STATS_HISTOGRAM_SAMPLE));
+      sample_p->disk_attr = disk_attr_p;
+      sample_p->scale = scale;
+      attr_ids[n_samples] = disk_attr_p->id;
+      n_samples++;
+    }
+
+  /* attributes of column groups are read along with the sampled ones */
+  n_read_attrs = n_samples;
+  error_code =
+    stats_prepare_column_groups (thread_p, disk_repr_p, scale, with_fullscan, &groups_p, &n_groups, attr_ids,
+				 &n_read_attrs);
+  if (error_code != NO_ERROR)
+    {
+      goto end;
+    }
+
+  if (n_samples == 0 && n_groups == 0)
+    {
+      goto end;
+    }
+
+  for (i = 0; i < n_samples; i++)
+    {
+      samples_p[i].values = (DB_VALUE *) db_private_alloc (thread_p, STATS_HISTOGRAM_SAMPLE_SIZE * sizeof (DB_VALUE));
+      if (samples_p[i].values == NULL)
+	{
+	  ASSERT_ERROR_AND_SET (error_code);
+	  goto end;
+	}
+
+      if (with_fullscan && btree_delta_is_hashable_type (samples_p[i].disk_attr->type))
+	{
+	  samples_p[i].sketch = (unsigned char *) db_private_alloc (thread_p, BTREE_DELTA_HLL_REGISTERS);
+	  if (samples_p[i].sketch == NULL)
+	    {
+	      ASSERT_ERROR_AND_SET (error_code);
+	      goto end;
+	    }
+	  memset (samples_p[i].sketch, 0, BTREE_DELTA_HLL_REGISTERS);
+	}
+    }
+
+  mvcc_snapshot = logtb_get_mvcc_snapshot (thread_p);
+  if (mvcc_snapshot == NULL)
+    {
+      ASSERT_ERROR_AND_SET (error_code);
+      goto end;
+    }
+
+  error_code = heap_attrinfo_start (thread_p, class_id_p, n_read_attrs, attr_ids, &attr_info);
+  if (error_code != NO_ERROR)
+    {
+      goto end;
+    }
+  attr_info_started = true;
+
+  /* sampled pages are fixed one at a time and their records are copied; the scan cache must not keep a page fixed */
+  error_code = heap_scancache_start (thread_p, &scan_cache, hfid_p, class_id_p, with_fullscan, false, mvcc_snapshot);
+  if (error_code != NO_ERROR)
+    {
+      goto end;
+    }
+  scan_started = true;
+
+  if (with_fullscan)
+    {
+      OID_SET_NULL (&oid);
+      while ((scan_code = heap_next (thread_p, hfid_p, class_id_p, &oid, &recdes, &scan_cache, PEEK)) == S_SUCCESS)
+	{
+	  error_code =
+	    stats_sample_object (thread_p, &oid, &recdes, &attr_info, attr_ids, samples_p, n_samples, groups_p,
+				 n_groups);
+	  if (error_code != NO_ERROR)
+	    {
+	      goto end;
+	    }
+
+	  if ((++n_scanned % 1000) == 0 && logtb_is_interrupted (thread_p, true, &continue_checking))
+	    {
+	      error_code = ER_INTERRUPTED;
+	      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, error_code, 0);
+	      goto end;
+	    }
+	}
+
+      if (scan_code == S_ERROR)
+	{
+	  ASSERT_ERROR_AND_SET (error_code);
+	  goto end;
+	}
+    }
+  else
+    {
+      for (i = 0; i < n_sampled_pages; i++)
+	{
+	  error_code =
+	    stats_sample_heap_page (thread_p, class_id_p, &vpids[i], &scan_cache, &attr_info, attr_ids, samples_p,
+				    n_samples, groups_p, n_groups);
+	  if (error_code != NO_ERROR)
+	    {
+	      goto end;
+	    }
+
+	  if (logtb_is_interrupted (thread_p, true, &continue_checking))
+	    {
+	      error_code = ER_INTERRUPTED;
+	      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, error_code, 0);
+	      goto end;
+	    }
+	}
+    }
+
+  if (n_samples > 0)
+    {
+      error_code = stats_build_histograms (thread_p, samples_p, n_samples);
+      if (error_code != NO_ERROR)
+	{
+	  goto end;
+	}
+    }
+
+  for (i = 0; i < n_groups; i++)
+    {
+      error_code = stats_build_column_group (thread_p, &groups_p[i]);
+      if (error_code != NO_ERROR)
+	{
+	  goto end;
+	}
+    }
+  error_code = stats_store_column_groups (thread_p, disk_repr_p, groups_p, n_groups);
+
+end:
+  if (scan_started)
+    {
+      (void) heap_scancache_end (thread_p, &scan_cache);
+    }
+  if (attr_info_started)
+    {
+      heap_attrinfo_end (thread_p, &attr_info);
+    }
+
+  if (samples_p != NULL)
+    {
+      for (i = 0; i < n_samples; i++)
+	{
+	  if (samples_p[i].sketch != NULL)
+	    {
+	      db_private_free_and_init (thread_p, samples_p[i].sketch);
+	    }
+	  if (samples_p[i].histogram != NULL)
+	    {
+	      free_and_init (samples_p[i].histogram);
+	    }
+	  if (samples_p[i].values == NULL)
+	    {
+	      continue;
+	    }
+	  for (j = 0; j < samples_p[i].n_values; j++)
+	    {
+	      pr_clear_value (&samples_p[i].values[j]);
+	    }
+	  db_private_free_and_init (thread_p, samples_p[i].values);
+	}
+      db_private_free_and_init (thread_p, samples_p);
+    }
+  if (groups_p != NULL)
+    {
+      for (i = 0; i < n_groups; i++)
+	{
+	  if (groups_p[i].hashes != NULL)
+	    {
+	      db_private_free_and_init (thread_p, groups_p[i].hashes);
+	    }
+	  if (groups_p[i].sketch != NULL)
+	    {
+	      db_private_free_and_init (thread_p, groups_p[i].sketch);
+	    }
+	}
+      db_private_free_and_init (thread_p, groups_p);
+    }
+  if (attr_ids != NULL)
+    {
+      db_private_free_and_init (thread_p, attr_ids);
+    }
+  if (vpids != NULL)
+    {
+      db_private_free_and_init (thread_p, vpids);
+    }
+
+  return error_code;
+}
+
+/*
+ * stats_sample_heap_page () - Offer the values of the objects of a heap page to the samples of their attributes
+ *   return: error code
+ *   class_id_p(in): class
+ *   vpid_p(in): sampled heap page
+ *   scan_cache(in): scan cache of heap
+ *   attr_info(in): attribute information cache of sampled attributes
+ *   attr_ids(in): sampled attributes
+ *   samples_p(in/out): samples of attributes
+ *   n_samples(in): number of sampled attributes
+ *   groups_p(in/out): samples of column groups
+ *   n_groups(in): number of column groups
+ */
+static int
+stats_sample_heap_page (THREAD_ENTRY * thread_p, OID * class_id_p, const VPID * vpid_p, HEAP_SCANCACHE * scan_cache,
+			HEAP_CACHE_ATTRINFO * attr_info, ATTR_ID * attr_ids, STATS_HISTOGRAM_SAMPLE * samples_p,
+			int n_samples, STATS_COLUMN_GROUP_SAMPLE * groups_p, int n_groups)
+{
+  PAGE_PTR page = NULL;
+  RECDES recdes = RECDES_INITIALIZER;
+  OID *oids = NULL;
+  INT16 record_type;
+  SCAN_CODE scan_code;
+  PGNSLOTS n_slots;
+  PGSLOTID slotid;
+  int n_oids = 0, i;
+  int error_code = NO_ERROR;
+
+  error_code = pgbuf_fix_if_not_deallocated (thread_p, vpid_p, PGBUF_LATCH_READ, PGBUF_UNCONDITIONAL_LATCH, &page);
+  if (error_code != NO_ERROR)
+    {
+      ASSERT_ERROR ();
+      return error_code;
+    }
+  if (page == NULL)
+    {
+      /* deallocated since it was sampled */
+      return NO_ERROR;
+    }
+  if (pgbuf_get_page_ptype (thread_p, page) != PAGE_HEAP)
+    {
+      pgbuf_unfix_and_init (thread_p, page);
+      return NO_ERROR;
+    }
+
+  /* collect the objects stored in page, then read their visible versions as a heap scan would */
+  n_slots = spage_number_of_slots (page);
+  if (n_slots > 1)
+    {
+      oids = (OID *) db_private_alloc (thread_p, n_slots * sizeof (OID));
+      if (oids == NULL)
+	{
+	  pgbuf_unfix_and_init (thread_p, page);
+	  ASSERT_ERROR_AND_SET (error_code);
+	  return error_code;
+	}
+
+      for (slotid = HEAP_HEADER_AND_CHAIN_SLOTID + 1; slotid < n_slots; slotid++)
+	{
+	  record_type = spage_get_record_type (page, slotid);
+	  if (record_type == REC_HOME || record_type == REC_RELOCATION || record_type == REC_BIGONE)
+	    {
+	      oids[n_oids].volid = vpid_p->volid;
+	      oids[n_oids].pageid = vpid_p->pageid;
+	      oids[n_oids].slotid = slotid;
+	      n_oids++;
+	    }
+	}
+    }
+  pgbuf_unfix_and_init (thread_p, page);
+
+  for (i = 0; i < n_oids; i++)
+    {
+      recdes.data = NULL;
+      scan_code = heap_get_visible_version (thread_p, &oids[i], class_id_p, &recdes, scan_cache, COPY, NULL_CHN);
+      if (scan_code == S_SNAPSHOT_NOT_SATISFIED || scan_code == S_DOESNT_EXIST)
+	{
+	  continue;
+	}
+      if (scan_code != S_SUCCESS)
+	{
+	  ASSERT_ERROR_AND_SET (error_code);
+	  break;
+	}
+
+      error_code =
+	stats_sample_object (thread_p, &oids[i], &recdes, attr_info, attr_ids, samples_p, n_samples, groups_p,
+			     n_groups);
+      if (error_code != NO_ERROR)
+	{
+	  break;
+	}
+    }
+
+  if (oids != NULL)
+    {
+      db_private_free_and_init (thread_p, oids);
+    }
+
+  return error_code;
+}
+
+/*
+ * stats_sample_object () - Offer the values of an object to the samples of their attributes
+ *   return: error code
+ *   oid_p(in): object
+ *   recdes_p(in): record of object
+ *   attr_info(in): attribute information cache of sampled attributes
+ *   attr_ids(in): sampled attributes
+ *   samples_p(in/out): samples of attributes
+ *   n_samples(in): number of sampled attributes
+ *   groups_p(in/out): samples of column groups
+ *   n_groups(in): number of column groups
+ */
+static int
+stats_sample_object (THREAD_ENTRY * thread_p, OID * oid_p, RECDES * recdes_p, HEAP_CACHE_ATTRINFO * attr_info,
+		     ATTR_ID * attr_ids, STATS_HISTOGRAM_SAMPLE * samples_p, int n_samples,
+		     STATS_COLUMN_GROUP_SAMPLE * groups_p, int n_groups)
+{
+  DB_VALUE *value;
+  int error_code;
+  int i;
+
+  error_code = heap_attrinfo_read_dbvalues (thread_p, oid_p, recdes_p, attr_info);
+  if (error_code != NO_ERROR)
+    {
+      return error_code;
+    }
+
+  for (i = 0; i < n_samples; i++)
+    {
+      value = heap_attrinfo_access (attr_ids[i], attr_info);
+      if (value == NULL)
+	{
+	  ASSERT_ERROR_AND_SET (error_code);
+	  return error_code;
+	}
+
+      error_code = stats_sample_histogram_value (thread_p, &samples_p[i], value);
+      if (error_code != NO_ERROR)
+	{
+	  return error_code;
+	}
+    }
+
+  for (i = 0; i < n_groups; i++)
+    {
+      error_code = stats_sample_column_group (thread_p, &groups_p[i], attr_info);
+      if (error_code != NO_ERROR)
+	{
+	  return error_code;
+	}
+    }
+
+  return NO_ERROR;
+}
+
+/*
+ * stats_sample_column_group () - Offer the values of an object to the sample of a column group
+ *   return: error code
+ *   group_sample_p(in/out): sample of column group
+ *   attr_info(in): attribute information cache holding the values of object
+ *
+ *   Note: Rows having a NULL are left out; dependencies are among non-NULL values.
+ */
+static int
+stats_sample_column_group (THREAD_ENTRY * thread_p, STATS_COLUMN_GROUP_SAMPLE * group_sample_p,
+			   HEAP_CACHE_ATTRINFO * attr_info)
+{
+  STATS_COLUMN_GROUP *group_p = &group_sample_p->group;
+  UINT64 hashes[STATS_COLUMN_GROUP_ATTRS_MAX];
+  UINT64 hash = 0;
+  DB_VALUE *value;
+  INT64 slot;
+  int error_code = NO_ERROR;
+  int i;
+
+  for (i = 0; i < group_p->n_attrs; i++)
+    {
+      value = heap_attrinfo_access (group_p->attr_ids[i], attr_info);
+      if (value == NULL)
+	{
+	  ASSERT_ERROR_AND_SET (error_code);
+	  return error_code;
+	}
+      if (DB_IS_NULL (value))
+	{
+	  return NO_ERROR;
+	}
+
+      hashes[i] = btree_delta_hash_value (value);
+      hash = hashes[i] ^ (hash * 31);
+    }
+
+  if (group_sample_p->sketch != NULL)
+    {
+      btree_delta_hll_add (group_sample_p->sketch, hash);
+    }
+
+  group_sample_p->n_seen++;
+  if (group_sample_p->n_rows < STATS_HISTOGRAM_SAMPLE_SIZE)
+    {
+      slot = group_sample_p->n_rows++;
+    }
+  else
+    {
+      /* replace a sampled row with probability STATS_HISTOGRAM_SAMPLE_SIZE / n_seen */
+      slot = (INT64) (((double) rand_r (&thread_p->rand_seed) / ((double) RAND_MAX + 1.0)) * group_sample_p->n_seen);
+      if (slot >= STATS_HISTOGRAM_SAMPLE_SIZE)
+	{
+	  return NO_ERROR;
+	}
+    }
+
+  memcpy (&group_sample_p->hashes[slot * group_p->n_attrs], hashes, group_p->n_attrs * sizeof (UINT64));
+
+  return NO_ERROR;
+}
+
+/*
+ * stats_sample_histogram_value () - Offer a value of an object to the sample of its attribute
+ *   return: error code
+ *   sample_p(in/out): sample of attribute
+ *   value(in): value of attribute; may point into a peeked record
+ */
+static int
+stats_sample_histogram_value (THREAD_ENTRY * thread_p, STATS_HISTOGRAM_SAMPLE * sample_p, DB_VALUE * value)
+{
+  INT64 slot;
+
+  sample_p->n_objects++;
+
+  if (DB_IS_NULL (value))
+    {
+      sample_p->n_nulls++;
+      return NO_ERROR;
+    }
+
+  if (sample_p->sketch != NULL)
+    {
+      btree_delta_hll_add (sample_p->sketch, btree_delta_hash_value (value));
+    }
+
+  if (TP_IS_CHAR_TYPE (DB_VALUE_DOMAIN_TYPE (value)) && db_get_string_size (value) > STATS_HISTOGRAM_VALUE_SIZE_MAX)
+    {
+      sample_p->n_unsampled++;
+      return NO_ERROR;
+    }
+
+  sample_p->n_seen++;
+  if (sample_p->n_values < STATS_HISTOGRAM_SAMPLE_SIZE)
+    {
+      slot = sample_p->n_values++;
+    }
+  else
+    {
+      /* replace a sampled value with probability STATS_HISTOGRAM_SAMPLE_SIZE / n_seen */
+      slot = (INT64) (((double) rand_r (&thread_p->rand_seed) / ((double) RAND_MAX + 1.0)) * sample_p->n_seen);
+      if (slot >= STATS_HISTOGRAM_SAMPLE_SIZE)
+	{
+	  return NO_ERROR;
+	}
+      pr_clear_value (&sample_p->values[slot]);
+    }
+
+  if (pr_clone_value (value, &sample_p->values[slot]) != NO_ERROR)
+    {
+      /* keep the sample consistent */
+      db_make_null (&sample_p->values[slot]);
+      return ER_FAILED;
+    }
+
+  return NO_ERROR;
+}
+
+/*
+ * stats_build_histograms () - Build the histograms of attributes from their samples and pack them to the attributes
+ *   return: error code
+ *   samples_p(in/out): samples of attributes
+ *   n_samples(in): number of samples
+ *
+ *   Note: Histograms are built on a pool of stats_thread_count workers; attributes having no histogram built keep
+ *         none.
+ */
+static int
+stats_build_histograms (THREAD_ENTRY * thread_p, STATS_HISTOGRAM_SAMPLE * samples_p, int n_samples)
+{
+  // *INDENT-OFF*
+  cubthread::entry_workpool *workpool = NULL;
+  std::atomic<int> n_built (0);
+  // *INDENT-ON*
+  DISK_ATTR *disk_attr_p;
+  int thread_count;
+  int i;
+
+  thread_count = MIN (prm_get_integer_value (PRM_ID_STATS_THREAD_COUNT), n_samples);
+  if (thread_count > 1)
+    {
+      /* no pool is created in stand-alone mode */
+      workpool =
+	cubthread::get_manager ()->create_worker_pool (thread_count, n_samples, "stats workers", NULL, 1,
+						       cubthread::is_logging_configured (cubthread::LOG_WORKER_POOL_STATS));
+    }
+
+  for (i = 0; i < n_samples; i++)
+    {
+      STATS_HISTOGRAM_SAMPLE *sample_p = &samples_p[i];
+
+      // *INDENT-OFF*
+      cubthread::entry_callable_task *task =
+        new cubthread::entry_callable_task ([sample_p, &n_built] (cubthread::entry &thread_ref)
+      {
+        /* the histogram is left out if it cannot be built */
+        (void) stats_build_histogram (&thread_ref, sample_p);
+        ++n_built;
+      });
+      // *INDENT-ON*
+      cubthread::get_manager ()->push_task (workpool, task);
+    }
+
+  while (n_built < n_samples)
+    {
+      thread_sleep (1);
+    }
+  cubthread::get_manager ()->destroy_worker_pool (workpool);
+
+  /* histograms were allocated by workers; copy them to the heap of this thread */
+  for (i = 0; i < n_samples; i++)
+    {
+      disk_attr_p = samples_p[i].disk_attr;
+      if (disk_attr_p->histogram != NULL)
+	{
+	  db_private_free_and_init (thread_p, disk_attr_p->histogram);
+	}
+      disk_attr_p->histogram_length = 0;
+
+      if (samples_p[i].histogram == NULL)
+	{
+	  continue;
+	}
+
+      disk_attr_p->histogram = (char *) db_private_alloc (thread_p, samples_p[i].histogram_length);
+      if (disk_attr_p->histogram == NULL)
+	{
+	  return er_errid ();
+	}
+      memcpy (disk_attr_p->histogram, samples_p[i].histogram, samples_p[i].histogram_length);
+      disk_attr_p->histogram_length = samples_p[i].histogram_length;
+    }
+
+  return NO_ERROR;
+}
+
+/*
+ * stats_build_histogram () - Build the histogram of an attribute from its sample and pack it to the sample
+ *   return: error code
+ *   sample_p(in/out): sample of attribute; its values are sorted
+ *
+ *   Note: The number of distinct values is counted by the sketch of a full scan, or estimated from the sample by
+ *         the Duj1 estimator of Haas and Stokes. Values a quarter more frequent than the average value are the most
+ *         common values; all values are when the sample has no value seen once. The equi-depth buckets hold the other
+ *         values.
+ *
+ *         This runs on a worker thread; the packed histogram is allocated with malloc.
+ */
+static int
+stats_build_histogram (THREAD_ENTRY * thread_p, STATS_HISTOGRAM_SAMPLE * sample_p)
+{
+  STATS_VALUE_RUN *runs_p = NULL;
+  DB_VALUE **rest_p = NULL;
+  DB_VALUE *values = sample_p->values;
+  STATS_HISTOGRAM histogram;
+  double value_frac, avg_count;
+  int n = sample_p->n_values;
+  int n_runs, n_singles, n_rest, n_buckets;
+  int i, k;
+  int error_code = NO_ERROR;
+
+  assert (sample_p->histogram == NULL);
+
+  if (sample_p->n_objects == 0)
+    {
+      /* nothing to describe */
+      return NO_ERROR;
+    }
+
+  memset (&histogram, 0, sizeof (STATS_HISTOGRAM));
+  histogram.null_frac = (double) sample_p->n_nulls / sample_p->n_objects;
+  /* fraction of objects a sampled value stands for */
+  value_frac = (n > 0) ? ((double) sample_p->n_seen / sample_p->n_objects) / n : 0.0;
+
+  n_runs = n_singles = 0;
+  if (n > 0)
+    {
+      runs_p = (STATS_VALUE_RUN *) db_private_alloc (thread_p, n * sizeof (STATS_VALUE_RUN));
+      rest_p = (DB_VALUE **) db_private_alloc (thread_p, n * sizeof (DB_VALUE *));
+      if (runs_p == NULL || rest_p == NULL)
+	{
+	  ASSERT_ERROR_AND_SET (error_code);
+	  goto end;
+	}
+
+      qsort (values, n, sizeof (DB_VALUE), stats_compare_histogram_values);
+
+      for (i = 0; i < n; i++)
+	{
+	  if (n_runs > 0 && stats_compare_histogram_values (&values[runs_p[n_runs - 1].start], &values[i]) == 0)
+	    {
+	      runs_p[n_runs - 1].count++;
+	      continue;
+	    }
+	  runs_p[n_runs].start = i;
+	  runs_p[n_runs].count = 1;
+	  n_runs++;
+	}
+
+      for (i = 0; i < n_runs; i++)
+	{
+	  if (runs_p[i].count == 1)
+	    {
+	      n_singles++;
+	    }
+	}
+    }
+
+  histogram.ndv =
+    stats_estimate_distinct_values (n, n_runs, n_singles, sample_p->n_seen * sample_p->scale, sample_p->sketch);
+
+  /* choose the most common values; runs_p[0 .. n_mcvs - 1] */
+  if (n_runs > 0)
+    {
+      if (n_singles == 0 && n_runs <= STATS_HISTOGRAM_MCVS_MAX)
+	{
+	  /* every value of the column is likely in the sample */
+	  histogram.n_mcvs = n_runs;
+	}
+      else
+	{
+	  qsort (runs_p, n_runs, sizeof (STATS_VALUE_RUN), stats_compare_value_runs_by_count);
+
+	  avg_count = (double) n / n_runs;
+	  while (histogram.n_mcvs < n_runs && histogram.n_mcvs < STATS_HISTOGRAM_MCVS_MAX
+		 && runs_p[histogram.n_mcvs].count > 1 && runs_p[histogram.n_mcvs].count >= 1.25 * avg_count)
+	    {
+	      histogram.n_mcvs++;
+	    }
+	}
+      qsort (runs_p, histogram.n_mcvs, sizeof (STATS_VALUE_RUN), stats_compare_value_runs_by_start);
+    }
+
+  /* values other than most common ones, ascending */
+  n_rest = 0;
+  for (i = 0, k = 0; i < n; i++)
+    {
+      if (k < histogram.n_mcvs && i >= runs_p[k].start + runs_p[k].count)
+	{
+	  k++;
+	}
+      if (k < histogram.n_mcvs && i >= runs_p[k].start)
+	{
+	  continue;
+	}
+      rest_p[n_rest++] = &values[i];
+    }
+
+  n_buckets = (n_rest >= 2) ? MIN (STATS_HISTOGRAM_BUCKETS_MAX, n_rest - 1) : 0;
+  histogram.n_bounds = (n_buckets > 0) ? n_buckets + 1 : 0;
+
+  /* the histogram refers to the sampled values; they are not copied */
+  if (histogram.n_mcvs > 0)
+    {
+      histogram.mcvs = (DB_VALUE *) db_private_alloc (thread_p, histogram.n_mcvs * sizeof (DB_VALUE));
+      histogram.mcv_freqs = (double *) db_private_alloc (thread_p, histogram.n_mcvs * sizeof (double));
+      if (histogram.mcvs == NULL || histogram.mcv_freqs == NULL)
+	{
+	  ASSERT_ERROR_AND_SET (error_code);
+	  goto end;
+	}
+      for (k = 0; k < histogram.n_mcvs; k++)
+	{
+	  histogram.mcvs[k] = values[runs_p[k].start];
+	  histogram.mcv_freqs[k] = runs_p[k].count * value_frac;
+	}
+    }
+  if (histogram.n_bounds > 0)
+    {
+      histogram.bounds = (DB_VALUE *) db_private_alloc (thread_p, histogram.n_bounds * sizeof (DB_VALUE));
+      if (histogram.bounds == NULL)
+	{
+	  ASSERT_ERROR_AND_SET (error_code);
+	  goto end;
+	}
+      for (k = 0; k < histogram.n_bounds; k++)
+	{
+	  histogram.bounds[k] = *rest_p[(INT64) k * (n_rest - 1) / n_buckets];
+	}
+    }
+
+  sample_p->histogram = stats_pack_histogram (&histogram, &sample_p->histogram_length);
+  if (sample_p->histogram == NULL)
+    {
+      ASSERT_ERROR_AND_SET (error_code);
+    }
+
+end:
+  if (histogram.mcvs != NULL)
+    {
+      db_private_free_and_init (thread_p, histogram.mcvs);
+    }
+  if (histogram.mcv_freqs != NULL)
+    {
+      db_private_free_and_init (thread_p, histogram.mcv_freqs);
+    }
+  if (histogram.bounds != NULL)
+    {
+      db_private_free_and_init (thread_p, histogram.bounds);
+    }
+  if (runs_p != NULL)
+    {
+      db_private_free_and_init (thread_p, runs_p);
+    }
+  if (rest_p != NULL)
+    {
+      db_private_free_and_init (thread_p, rest_p);
+    }
+
+  return error_code;
+}
+
+/*
+ * stats_pack_histogram () - Pack the histogram of an attribute
+ *   return: packed histogram allocated with malloc, or NULL on error
+ *   histogram_p(in): histogram
+ *   length_p(out): length of packed histogram
+ *
+ *   Note: The packed histogram is:
+ *           version, null_frac, ndv, n_mcvs, n_mcvs * { mcv_freq, mcv }, n_bounds, n_bounds * { bound }
+ *         Values are packed with their domains. It is unpacked by stats_client_unpack_histogram ().
+ */
+char *
+stats_pack_histogram (STATS_HISTOGRAM * histogram_p, int *length_p)
+{
+  OR_BUF buf;
+  char *packed_p;
+  int k, size;
+  int error_code;
+
+  size = OR_INT_SIZE + OR_DOUBLE_SIZE + OR_DOUBLE_SIZE + OR_INT_SIZE + OR_INT_SIZE;
+  for (k = 0; k < histogram_p->n_mcvs; k++)
+    {
+      size += OR_DOUBLE_SIZE + or_packed_value_size (&histogram_p->mcvs[k], 0, 1, 0);
+    }
+  for (k = 0; k < histogram_p->n_bounds; k++)
+    {
+      size += or_packed_value_size (&histogram_p->bounds[k], 0, 1, 0);
+    }
+
+  packed_p = (char *) malloc (size);
+  if (packed_p == NULL)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, (size_t) size);
+      return NULL;
+    }
+
+  or_init (&buf, packed_p, size);
+  error_code = or_put_int (&buf, STATS_HISTOGRAM_VERSION);
+  error_code = (error_code == NO_ERROR) ? or_put_double (&buf, histogram_p->null_frac) : error_code;
+  error_code = (error_code == NO_ERROR) ? or_put_double (&buf, histogram_p->ndv) : error_code;
+  error_code = (error_code == NO_ERROR) ? or_put_int (&buf, histogram_p->n_mcvs) : error_code;
+  for (k = 0; k < histogram_p->n_mcvs && error_code == NO_ERROR; k++)
+    {
+      error_code = or_put_double (&buf, histogram_p->mcv_freqs[k]);
+      error_code = (error_code == NO_ERROR) ? or_put_value (&buf, &histogram_p->mcvs[k], 0, 1, 0) : error_code;
+    }
+  error_code = (error_code == NO_ERROR) ? or_put_int (&buf, histogram_p->n_bounds) : error_code;
+  for (k = 0; k < histogram_p->n_bounds && error_code == NO_ERROR; k++)
+    {
+      error_code = or_put_value (&buf, &histogram_p->bounds[k], 0, 1, 0);
+    }
+  if (error_code != NO_ERROR)
+    {
+      assert (false);
+      free_and_init (packed_p);
+      return NULL;
+    }
+  assert (buf.ptr == packed_p + size);
+
+  *length_p = size;
+  return packed_p;
+}
+
+/*
+ * stats_estimate_distinct_values () - Estimate the number of distinct values of a column from its sample
+ *   return: number of distinct values
+ *   n(in): number of sampled values
+ *   n_runs(in): distinct values of sample
+ *   n_singles(in): values seen once in sample
+ *   n_values(in): non-NULL values of the class
+ *   sketch(in): HyperLogLog sketch of all values of a full scan, or NULL
+ *
+ *   Note: The sample is estimated by Duj1: n * d / (n - f1 + f1 * n / N), N being the number of values of the class.
+ */
+static double
+stats_estimate_distinct_values (int n, int n_runs, int n_singles, double n_values, const unsigned char *sketch)
+{
+  double ndv;
+
+  if (n == 0)
+    {
+      return 0;
+    }
+  if (n_values <= n)
+    {
+      return n_runs;
+    }
+
+  if (sketch != NULL)
+    {
+      ndv = btree_delta_hll_estimate (sketch);
+    }
+  else if (n_singles == 0)
+    {
+      return n_runs;
+    }
+  else
+    {
+      ndv = (double) n * n_runs / (n - n_singles + (double) n_singles * n / n_values);
+    }
+  ndv = MAX (ndv, (double) n_runs);
+  ndv = MIN (ndv, n_values);
+
+  return ndv;
+}
+
+static int
+stats_compare_histogram_values (const void *value1, const void *value2)
+{
+  return tp_value_compare ((const DB_VALUE *) value1, (const DB_VALUE *) value2, 1, 1);
+}
+
+/* descending count, then ascending value */
+static int
+stats_compare_value_runs_by_count (const void *run1, const void *run2)
+{
+  const STATS_VALUE_RUN *r1 = (const STATS_VALUE_RUN *) run1;
+  const STATS_VALUE_RUN *r2 = (const STATS_VALUE_RUN *) run2;
+
+  if (r1->count != r2->count)
+    {
+      return (r1->count > r2->count) ? -1 : 1;
+    }
+  return (r1->start < r2->start) ? -1 : (r1->start > r2->start);
+}
+
+static int
+stats_compare_value_runs_by_start (const void *run1, const void *run2)
+{
+  const STATS_VALUE_RUN *r1 = (const STATS_VALUE_RUN *) run1;
+  const STATS_VALUE_RUN *r2 = (const STATS_VALUE_RUN *) run2;
+
+  return (r1->start < r2->start) ? -1 : (r1->start > r2->start);
+}
+
+/*
+ * stats_prepare_column_groups () - Prepare the samples of the column groups declared on the attributes of a class
+ *   return: error code
+ *   disk_repr_p(in): last representation of class
+ *   scale(in): objects of class per scanned object
+ *   with_fullscan(in): true to sketch all rows of a full scan
+ *   groups_p(out): samples of column groups, or NULL
+ *   n_groups(out): number of column groups
+ *   attr_ids(in/out): read attributes; gets the attributes of column groups not read yet
+ *   n_read_attrs(in/out): number of read attributes
+ *
+ *   Note: Groups having an attribute that was dropped or that cannot be hashed are left out; they are removed from
+ *         the attributes leading them when the gathered groups are stored.
+ */
+static int
+stats_prepare_column_groups (THREAD_ENTRY * thread_p, DISK_REPR * disk_repr_p, double scale, bool with_fullscan,
+			     STATS_COLUMN_GROUP_SAMPLE ** groups_p, int *n_groups, ATTR_ID * attr_ids, int *n_read_attrs)
+{
+  STATS_COLUMN_GROUP groups[STATS_COLUMN_GROUPS_MAX];
+  STATS_COLUMN_GROUP_SAMPLE *group_sample_p;
+  DISK_ATTR *disk_attr_p, *group_attr_p;
+  int n_attrs, n_leaders, n_attr_groups, i, j, k, m;
+  int error_code = NO_ERROR;
+
+  *groups_p = NULL;
+  *n_groups = 0;
+
+  n_attrs = disk_repr_p->n_fixed + disk_repr_p->n_variable;
+  n_leaders = 0;
+  for (i = 0; i < n_attrs; i++)
+    {
+      if (i < disk_repr_p->n_fixed)
+	{
+	  disk_attr_p = disk_repr_p->fixed + i;
+	}
+      else
+	{
+	  disk_attr_p = disk_repr_p->variable + (i - disk_repr_p->n_fixed);
+	}
+      if (disk_attr_p->column_groups_length > 0)
+	{
+	  n_leaders++;
+	}
+    }
+  if (n_leaders == 0)
+    {
+      return NO_ERROR;
+    }
+
+  *groups_p =
+    (STATS_COLUMN_GROUP_SAMPLE *) db_private_alloc (thread_p,
+						    n_leaders * STATS_COLUMN_GROUPS_MAX *
+						    sizeof (STATS_COLUMN_GROUP_SAMPLE));
+  if (*groups_p == NULL)
+    {
+      ASSERT_ERROR_AND_SET (error_code);
+      return error_code;
+    }
+
+  for (i = 0; i < n_attrs; i++)
+    {
+      if (i < disk_repr_p->n_fixed)
+	{
+	  disk_attr_p = disk_repr_p->fixed + i;
+	}
+      else
+	{
+	  disk_attr_p = disk_repr_p->variable + (i - disk_repr_p->n_fixed);
+	}
+      if (disk_attr_p->column_groups_length <= 0)
+	{
+	  continue;
+	}
+
+      n_attr_groups =
+	stats_unpack_column_groups (disk_attr_p->column_groups, disk_attr_p->column_groups_length, groups);
+      for (j = 0; j < n_attr_groups; j++)
+	{
+	  for (k = 0; k < groups[j].n_attrs; k++)
+	    {
+	      group_attr_p = stats_find_disk_attr (disk_repr_p, groups[j].attr_ids[k]);
+	      if (group_attr_p == NULL || !btree_delta_is_hashable_type (group_attr_p->type))
+		{
+		  break;
+		}
+	    }
+	  if (k < groups[j].n_attrs)
+	    {
+	      continue;
+	    }
+
+	  /* count the group first; it is freed with the others on error */
+	  group_sample_p = &(*groups_p)[(*n_groups)++];
+	  memset (group_sample_p, 0, sizeof (STATS_COLUMN_GROUP_SAMPLE));
+	  group_sample_p->group = groups[j];
+	  group_sample_p->disk_attr = disk_attr_p;
+	  group_sample_p->scale = scale;
+
+	  group_sample_p->hashes =
+	    (UINT64 *) db_private_alloc (thread_p, STATS_HISTOGRAM_SAMPLE_SIZE * groups[j].n_attrs * sizeof (UINT64));
+	  if (group_sample_p->hashes == NULL)
+	    {
+	      ASSERT_ERROR_AND_SET (error_code);
+	      return error_code;
+	    }
+
+	  if (with_fullscan)
+	    {
+	      group_sample_p->sketch = (unsigned char *) db_private_alloc (thread_p, BTREE_DELTA_HLL_REGISTERS);
+	      if (group_sample_p->sketch == NULL)
+		{
+		  ASSERT_ERROR_AND_SET (error_code);
+		  return error_code;
+		}
+	      memset (group_sample_p->sketch, 0, BTREE_DELTA_HLL_REGISTERS);
+	    }
+
+	  for (k = 0; k < groups[j].n_attrs; k++)
+	    {
+	      for (m = 0; m < *n_read_attrs; m++)
+		{
+		  if (attr_ids[m] == groups[j].attr_ids[k])
+		    {
+		      break;
+		    }
+		}
+	      if (m == *n_read_attrs)
+		{
+		  attr_ids[(*n_read_attrs)++] = groups[j].attr_ids[k];
+		}
+	    }
+	}
+    }
+
+  return NO_ERROR;
+}
+
+/*
+ * stats_build_column_group () - Estimate the statistics of a column group from its sample
+ *   return: error code
+ *   group_sample_p(in/out): sample of column group; its group gets the statistics
+ *
+ *   Note: The distinct values of the group are estimated as those of a column whose values are the rows of the
+ *         group. The dependency degree of an attribute is the fraction of sampled rows whose value of the attribute
+ *         comes with a single combination of the values of the other attributes; 1 means the attribute determines
+ *         the others.
+ */
+static int
+stats_build_column_group (THREAD_ENTRY * thread_p, STATS_COLUMN_GROUP_SAMPLE * group_sample_p)
+{
+  STATS_COLUMN_GROUP *group_p = &group_sample_p->group;
+  STATS_HASH_PAIR *pairs_p = NULL;
+  UINT64 *row_p;
+  UINT64 rest;
+  int n = group_sample_p->n_rows;
+  int n_attrs = group_p->n_attrs;
+  int n_runs, n_singles, n_determined, run_start;
+  int i, r, k;
+  int error_code = NO_ERROR;
+
+  group_p->ndv = 0;
+  for (i = 0; i < n_attrs; i++)
+    {
+      group_p->degrees[i] = 0;
+    }
+  if (n == 0)
+    {
+      return NO_ERROR;
+    }
+
+  pairs_p = (STATS_HASH_PAIR *) db_private_alloc (thread_p, n * sizeof (STATS_HASH_PAIR));
+  if (pairs_p == NULL)
+    {
+      ASSERT_ERROR_AND_SET (error_code);
+      return error_code;
+    }
+
+  /* distinct rows */
+  for (r = 0; r < n; r++)
+    {
+      row_p = &group_sample_p->hashes[r * n_attrs];
+      pairs_p[r].hash = 0;
+      pairs_p[r].rest = 0;
+      for (k = 0; k < n_attrs; k++)
+	{
+	  pairs_p[r].hash = row_p[k] ^ (pairs_p[r].hash * 31);
+	}
+    }
+  qsort (pairs_p, n, sizeof (STATS_HASH_PAIR), stats_compare_hash_pairs);
+
+  n_runs = n_singles = 0;
+  for (r = 0; r < n; r = run_start)
+    {
+      for (run_start = r + 1; run_start < n && pairs_p[run_start].hash == pairs_p[r].hash; run_start++)
+	{
+	  ;
+	}
+      n_runs++;
+      if (run_start - r == 1)
+	{
+	  n_singles++;
+	}
+    }
+  group_p->ndv =
+    stats_estimate_distinct_values (n, n_runs, n_singles, group_sample_p->n_seen * group_sample_p->scale,
+				    group_sample_p->sketch);
+
+  /* dependency degree of each attribute */
+  for (i = 0; i < n_attrs; i++)
+    {
+      for (r = 0; r < n; r++)
+	{
+	  row_p = &group_sample_p->hashes[r * n_attrs];
+	  rest = 0;
+	  for (k = 0; k < n_attrs; k++)
+	    {
+	      if (k != i)
+		{
+		  rest = row_p[k] ^ (rest * 31);
+		}
+	    }
+	  pairs_p[r].hash = row_p[i];
+	  pairs_p[r].rest = rest;
+	}
+      qsort (pairs_p, n, sizeof (STATS_HASH_PAIR), stats_compare_hash_pairs);
+
+      /* pairs are sorted by rest too; a value has a single rest if its first and last pairs have the same rest */
+      n_determined = 0;
+      for (r = 0; r < n; r = run_start)
+	{
+	  for (run_start = r + 1; run_start < n && pairs_p[run_start].hash == pairs_p[r].hash; run_start++)
+	    {
+	      ;
+	    }
+	  if (pairs_p[r].rest == pairs_p[run_start - 1].rest)
+	    {
+	      n_determined += run_start - r;
+	    }
+	}
+      group_p->degrees[i] = (double) n_determined / n;
+    }
+
+  db_private_free_and_init (thread_p, pairs_p);
+
+  return NO_ERROR;
+}
+
+/*
+ * stats_store_column_groups () - Pack the gathered column groups to the attributes leading them
+ *   return: error code
+ *   disk_repr_p(in/out): last representation of class
+ *   groups_p(in): gathered column groups
+ *   n_groups(in): number of gathered column groups
+ *
+ *   Note: Attributes keep only the groups that were gathered; groups left out by stats_prepare_column_groups () are
+ *         removed.
+ */
+static int
+stats_store_column_groups (THREAD_ENTRY * thread_p, DISK_REPR * disk_repr_p, STATS_COLUMN_GROUP_SAMPLE * groups_p,
+			   int n_groups)
+{
+  STATS_COLUMN_GROUP groups[STATS_COLUMN_GROUPS_MAX];
+  DISK_ATTR *disk_attr_p;
+  int n_attrs, n_attr_groups, i, j;
+  int error_code;
+
+  n_attrs = disk_repr_p->n_fixed + disk_repr_p->n_variable;
+  for (i = 0; i < n_attrs; i++)
+    {
+      if (i < disk_repr_p->n_fixed)
+	{
+	  disk_attr_p = disk_repr_p->fixed + i;
+	}
+      else
+	{
+	  disk_attr_p = disk_repr_p->variable + (i - disk_repr_p->n_fixed);
+	}
+      if (disk_attr_p->column_groups_length <= 0)
+	{
+	  continue;
+	}
+
+      n_attr_groups = 0;
+      for (j = 0; j < n_groups; j++)
+	{
+	  if (groups_p[j].disk_attr == disk_attr_p)
+	    {
+	      assert (n_attr_groups < STATS_COLUMN_GROUPS_MAX);
+	      groups[n_attr_groups++] = groups_p[j].group;
+	    }
+	}
+
+      error_code = stats_pack_column_groups (thread_p, groups, n_attr_groups, disk_attr_p);
+      if (error_code != NO_ERROR)
+	{
+	  return error_code;
+	}
+    }
+
+  return NO_ERROR;
+}
+
+static int
+stats_compare_hash_pairs (const void *pair1, const void *pair2)
+{
+  const STATS_HASH_PAIR *p1 = (const STATS_HASH_PAIR *) pair1;
+  const STATS_HASH_PAIR *p2 = (const STATS_HASH_PAIR *) pair2;
+
+  if (p1->hash != p2->hash)
+    {
+      return (p1->hash < p2->hash) ? -1 : 1;
+    }
+  return (p1->rest < p2->rest) ? -1 : (p1->rest > p2->rest);
+}
+
+/*
+ * stats_unpack_column_groups () - Unpack the column groups led by an attribute
+ *   return: number of column groups
+ *   buf_p(in): packed column groups
+ *   length(in): length of packed column groups
+ *   groups_p(out): column groups; room for STATS_COLUMN_GROUPS_MAX
+ *
+ *   Note: The packed groups are:
+ *           version, n_groups, n_groups * { n_attrs, n_attrs * { attr_id }, ndv, n_attrs * { degree } }
+ *         Groups packed by another version are left out.
+ */
+static int
+stats_unpack_column_groups (const char *buf_p, int length, STATS_COLUMN_GROUP * groups_p)
+{
+  OR_BUF buf;
+  int n_groups, i, j, error = NO_ERROR;
+
+  if (buf_p == NULL || length <= 0)
+    {
+      return 0;
+    }
+
+  or_init (&buf, (char *) buf_p, length);
+
+  if (or_get_int (&buf, &error) != STATS_COLUMN_GROUPS_VERSION || error != NO_ERROR)
+    {
+      return 0;
+    }
+  n_groups = or_get_int (&buf, &error);
+  if (error != NO_ERROR || n_groups <= 0 || n_groups > STATS_COLUMN_GROUPS_MAX)
+    {
+      return 0;
+    }
+
+  for (i = 0; i < n_groups; i++)
+    {
+      groups_p[i].n_attrs = or_get_int (&buf, &error);
+      if (error != NO_ERROR || groups_p[i].n_attrs < 2 || groups_p[i].n_attrs > STATS_COLUMN_GROUP_ATTRS_MAX)
+	{
+	  return 0;
+	}
+      for (j = 0; j < groups_p[i].n_attrs && error == NO_ERROR; j++)
+	{
+	  groups_p[i].attr_ids[j] = or_get_int (&buf, &error);
+	}
+      groups_p[i].ndv = (error == NO_ERROR) ? or_get_double (&buf, &error) : 0;
+      for (j = 0; j < groups_p[i].n_attrs && error == NO_ERROR; j++)
+	{
+	  groups_p[i].degrees[j] = or_get_double (&buf, &error);
+	}
+      if (error != NO_ERROR)
+	{
+	  return 0;
+	}
+    }
+
+  return n_groups;
+}
+
+/*
+ * stats_pack_column_groups () - Pack column groups to the attribute leading them
+ *   return: error code
+ *   groups_p(in): column groups
+ *   n_groups(in): number of column groups; none removes the groups of attribute
+ *   disk_attr_p(in/out): attribute leading the groups
+ */
+static int
+stats_pack_column_groups (THREAD_ENTRY * thread_p, STATS_COLUMN_GROUP * groups_p, int n_groups,
+			  DISK_ATTR * disk_attr_p)
+{
+  OR_BUF buf;
+  char *buf_p;
+  int size, i, j;
+  int error_code = NO_ERROR;
+
+  if (disk_attr_p->column_groups != NULL)
+    {
+      db_private_free_and_init (thread_p, disk_attr_p->column_groups);
+    }
+  disk_attr_p->column_groups_length = 0;
+
+  if (n_groups == 0)
+    {
+      return NO_ERROR;
+    }
+
+  size = OR_INT_SIZE + OR_INT_SIZE;
+  for (i = 0; i < n_groups; i++)
+    {
+      size += OR_INT_SIZE + groups_p[i].n_attrs * OR_INT_SIZE + OR_DOUBLE_SIZE + groups_p[i].n_attrs * OR_DOUBLE_SIZE;
+    }
+
+  buf_p = (char *) db_private_alloc (thread_p, size);
+  if (buf_p == NULL)
+    {
+      ASSERT_ERROR_AND_SET (error_code);
+      return error_code;
+    }
+
+  or_init (&buf, buf_p, size);
+  error_code = or_put_int (&buf, STATS_COLUMN_GROUPS_VERSION);
+  error_code = (error_code == NO_ERROR) ? or_put_int (&buf, n_groups) : error_code;
+  for (i = 0; i < n_groups && error_code == NO_ERROR; i++)
+    {
+      error_code = or_put_int (&buf, groups_p[i].n_attrs);
+      for (j = 0; j < groups_p[i].n_attrs && error_code == NO_ERROR; j++)
+	{
+	  error_code = or_put_int (&buf, groups_p[i].attr_ids[j]);
+	}
+      error_code = (error_code == NO_ERROR) ? or_put_double (&buf, groups_p[i].ndv) : error_code;
+      for (j = 0; j < groups_p[i].n_attrs && error_code == NO_ERROR; j++)
+	{
+	  error_code = or_put_double (&buf, groups_p[i].degrees[j]);
+	}
+    }
+  if (error_code != NO_ERROR)
+    {
+      assert (false);
+      db_private_free_and_init (thread_p, buf_p);
+      return error_code;
+    }
+  assert (buf.ptr == buf_p + size);
+
+  disk_attr_p->column_groups = buf_p;
+  disk_attr_p->column_groups_length = size;
+
+  return NO_ERROR;
+}
+
+/*
+ * stats_find_disk_attr () - Find an attribute of a class representation
+ *   return: attribute, or NULL if not found
+ *   disk_repr_p(in): class representation
+ *   attr_id(in): attribute
+ */
+static DISK_ATTR *
+stats_find_disk_attr (DISK_REPR * disk_repr_p, int attr_id)
+{
+  int i;
+
+  for (i = 0; i < disk_repr_p->n_fixed; i++)
+    {
+      if (disk_repr_p->fixed[i].id == attr_id)
+	{
+	  return &disk_repr_p->fixed[i];
+	}
+    }
+  for (i = 0; i < disk_repr_p->n_variable; i++)
+    {
+      if (disk_repr_p->variable[i].id == attr_id)
+	{
+	  return &disk_repr_p->variable[i];
+	}
+    }
+
+  return NULL;
+}
+
+/*
+ * stats_find_column_group () - Find the column group of a set of attributes
+ *   return: index of group, or -1 if not found
+ *   groups_p(in): column groups
+ *   n_groups(in): number of column groups
+ *   n_attrs(in): number of attributes
+ *   attr_ids(in): distinct attributes, in any order
+ */
+static int
+stats_find_column_group (STATS_COLUMN_GROUP * groups_p, int n_groups, int n_attrs, const int *attr_ids)
+{
+  int i, j, k;
+
+  for (i = 0; i < n_groups; i++)
+    {
+      if (groups_p[i].n_attrs != n_attrs)
+	{
+	  continue;
+	}
+      for (j = 0; j < n_attrs; j++)
+	{
+	  for (k = 0; k < n_attrs && groups_p[i].attr_ids[k] != attr_ids[j]; k++)
+	    {
+	      ;
+	    }
+	  if (k == n_attrs)
+	    {
+	      break;
+	    }
+	}
+      if (j == n_attrs)
+	{
+	  return i;
+	}
+    }
+
+  return -1;
+}
+
+/*
+ * stats_get_declared_column_groups () - Get the column groups declared on a class with its schema
+ *   return: error code
+ *   class_id_p(in): class
+ *   groups_p(out): declared column groups, with no statistics; room for STATS_COLUMN_GROUPS_MAX
+ *   n_groups(out): number of declared column groups
+ *
+ *   Note: Partitions use the groups declared on their partitioned class.
+ */
+static int
+stats_get_declared_column_groups (THREAD_ENTRY * thread_p, OID * class_id_p, STATS_COLUMN_GROUP * groups_p,
+				  int *n_groups)
+{
+  int n_attrs[STATS_COLUMN_GROUPS_MAX];
+  int attr_ids[STATS_COLUMN_GROUPS_MAX * STATS_COLUMN_GROUP_ATTRS_MAX];
+  HEAP_SCANCACHE scan_cache;
+  RECDES recdes = RECDES_INITIALIZER;
+  OID root_oid;
+  int i;
+  int error_code = NO_ERROR;
+
+  *n_groups = 0;
+
+  error_code = partition_find_root_class_oid (thread_p, class_id_p, &root_oid);
+  if (error_code != NO_ERROR)
+    {
+      return error_code;
+    }
+
+  error_code = heap_scancache_quick_start_root_hfid (thread_p, &scan_cache);
+  if (error_code != NO_ERROR)
     {
-      /* use statistics info */
-      OR_PUT_INT (buf_p, cls_info_p->ci_tot_objects);	/* #objects */
-      buf_p += OR_INT_SIZE;
+      goto end;
+    }
 
-      OR_PUT_INT (buf_p, MAX (cls_info_p->ci_tot_pages, 1));	/* #pages */
-      buf_p += OR_INT_SIZE;
+  if (heap_get_class_record (thread_p, class_id_p, &recdes, &scan_cache, PEEK) != S_SUCCESS)
+    {
+      ASSERT_ERROR_AND_SET (error_code);
+      goto end;
     }
-  else
+
+  /* a partition has partition information and a single superclass, its partitioned class */
+  if (!OR_VAR_IS_NULL (recdes.data, ORC_PARTITION_INDEX) && !OID_ISNULL (&root_oid)
+      && !OID_EQ (&root_oid, class_id_p))
     {
-      /* use estimates from the heap since it is likely that its estimates are more accurate than the ones gathered at
-       * update statistics time */
-      estimated_nobjs = heap_estimate_num_objects (thread_p, &(cls_info_p->ci_hfid));
-      if (estimated_nobjs < 0)
-	{
-	  /* cannot get estimates from the heap, use ones from the catalog */
-	  estimated_nobjs = cls_info_p->ci_tot_objects;
-	}
-      else
+      if (heap_get_class_record (thread_p, &root_oid, &recdes, &scan_cache, PEEK) != S_SUCCESS)
 	{
-	  /* heuristic is that big nobjs is better than small */
-	  estimated_nobjs = MAX (estimated_nobjs, cls_info_p->ci_tot_objects);
+	  ASSERT_ERROR_AND_SET (error_code);
+	  goto end;
 	}
+    }
 
-      OR_PUT_INT (buf_p, estimated_nobjs);	/* #objects */
-      buf_p += OR_INT_SIZE;
+  error_code =
+    or_class_get_column_groups (&recdes, STATS_COLUMN_GROUPS_MAX, STATS_COLUMN_GROUP_ATTRS_MAX, n_groups, n_attrs,
+				attr_ids);
+  if (error_code != NO_ERROR)
+    {
+      goto end;
+    }
 
-      /* do not use estimated npages, get correct info */
-      assert (!VFID_ISNULL (&cls_info_p->ci_hfid.vfid));
-      if (file_get_num_user_pages (thread_p, &cls_info_p->ci_hfid.vfid, &npages) != NO_ERROR)
-	{
-	  int err;
+  for (i = 0; i < *n_groups; i++)
+    {
+      memset (&groups_p[i], 0, sizeof (STATS_COLUMN_GROUP));
+      groups_p[i].n_attrs = n_attrs[i];
+      memcpy (groups_p[i].attr_ids, &attr_ids[i * STATS_COLUMN_GROUP_ATTRS_MAX], n_attrs[i] * sizeof (int));
+    }
 
-	  ASSERT_ERROR_AND_SET (err);
-	  /* cannot get #pages from the heap, use ones from the catalog */
-	  npages = cls_info_p->ci_tot_pages;
-	  assert (0 < npages || err == ER_INTERRUPTED);
-	  npages = MAX (npages, 1);	/* safe-guard */
-	}
-      assert (npages > 0);
+end:
+  (void) heap_scancache_end (thread_p, &scan_cache);
 
-      OR_PUT_INT (buf_p, npages);	/* #pages */
-      buf_p += OR_INT_SIZE;
-    }
+  return error_code;
+}
 
-  OR_PUT_INT (buf_p, n_attrs);
-  buf_p += OR_INT_SIZE;
+/*
+ * stats_declare_column_groups () - Make the column groups of a class representation those declared with the schema
+ *   return: error code
+ *   class_id_p(in): class
+ *   disk_repr_p(in/out): last representation of class
+ *
+ *   Note: A declared group is led by its first attribute, and keeps the statistics it was gathered with. Groups that
+ *         are no longer declared, or that have an attribute not in the representation, are removed.
+ */
+static int
+stats_declare_column_groups (THREAD_ENTRY * thread_p, OID * class_id_p, DISK_REPR * disk_repr_p)
+{
+  STATS_COLUMN_GROUP declared[STATS_COLUMN_GROUPS_MAX];
+  STATS_COLUMN_GROUP old_groups[STATS_COLUMN_GROUPS_MAX], groups[STATS_COLUMN_GROUPS_MAX];
+  DISK_ATTR *disk_attr_p;
+  int n_declared, n_old_groups, n_attr_groups, n_attrs, found, i, j, k;
+  int error_code = NO_ERROR;
 
-  /* put the statistics information of each attribute to the buffer */
+  error_code = stats_get_declared_column_groups (thread_p, class_id_p, declared, &n_declared);
+  if (error_code != NO_ERROR)
+    {
+      return error_code;
+    }
+
+  n_attrs = disk_repr_p->n_fixed + disk_repr_p->n_variable;
   for (i = 0; i < n_attrs; i++)
     {
       if (i < disk_repr_p->n_fixed)
@@ -655,156 +2701,89 @@ xstats_get_statistics_from_server (THREAD_ENTRY * thread_p, OID * class_id_p, un
 	  disk_attr_p = disk_repr_p->variable + (i - disk_repr_p->n_fixed);
 	}
 
-      OR_PUT_INT (buf_p, disk_attr_p->id);
-      buf_p += OR_INT_SIZE;
-
-      OR_PUT_INT (buf_p, disk_attr_p->type);
-      buf_p += OR_INT_SIZE;
-
-      OR_PUT_INT (buf_p, disk_attr_p->n_btstats);
-      buf_p += OR_INT_SIZE;
-
-      for (j = 0, btree_stats_p = disk_attr_p->bt_stats; j < disk_attr_p->n_btstats; j++, btree_stats_p++)
+      n_old_groups =
+	stats_unpack_column_groups (disk_attr_p->column_groups, disk_attr_p->column_groups_length, old_groups);
+      n_attr_groups = 0;
+      for (j = 0; j < n_declared; j++)
 	{
-	  /* collect maximum unique keys info */
-	  if (xbtree_get_unique_pk (thread_p, &btree_stats_p->btid))
-	    {
-	      max_unique_keys = MAX (max_unique_keys, btree_stats_p->keys);
-	    }
-
-	  OR_PUT_BTID (buf_p, &btree_stats_p->btid);
-	  buf_p += OR_BTID_ALIGNED_SIZE;
-
-	  /* defense for not gathered statistics */
-	  btree_stats_p->leafs = MAX (1, btree_stats_p->leafs);
-	  btree_stats_p->pages = MAX (1, btree_stats_p->pages);
-	  btree_stats_p->height = MAX (1, btree_stats_p->height);
-
-	  /* If the btree file has currently more pages than when we gathered statistics, assume that all growth happen
-	   * at the leaf level. If the btree is smaller, we use the gathered statistics since the btree may have an
-	   * external file (unknown at this level) to keep overflow keys. */
-	  if (file_get_num_user_pages (thread_p, &btree_stats_p->btid.vfid, &npages) != NO_ERROR)
+	  if (declared[j].attr_ids[0] != disk_attr_p->id)
 	    {
-	      int err;
-
-	      /* what to do here? */
-	      ASSERT_ERROR_AND_SET (err);
-	      npages = btree_stats_p->pages;
-	      assert (0 < npages || err == ER_INTERRUPTED);
-	      npages = MAX (npages, 1);	/* safe-guard */
-	    }
-	  assert (npages > 0);
-	  if (npages > btree_stats_p->pages && use_stat_estimation)
-	    {
-	      OR_PUT_INT (buf_p, (btree_stats_p->leafs + (npages - btree_stats_p->pages)));
-	      buf_p += OR_INT_SIZE;
-
-	      OR_PUT_INT (buf_p, npages);
-	      buf_p += OR_INT_SIZE;
+	      continue;
 	    }
-	  else
-	    {
-	      OR_PUT_INT (buf_p, btree_stats_p->leafs);
-	      buf_p += OR_INT_SIZE;
-
-	      OR_PUT_INT (buf_p, btree_stats_p->pages);
-	      buf_p += OR_INT_SIZE;
-	    }
-
-	  OR_PUT_INT (buf_p, btree_stats_p->height);
-	  buf_p += OR_INT_SIZE;
-
-	  OR_PUT_INT (buf_p, btree_stats_p->has_function);
-	  buf_p += OR_INT_SIZE;
-
-	  /* check and handle with estimation, since pkeys[] is not gathered before update stats */
-	  if (estimated_nobjs > 0 && use_stat_estimation)
+	  for (k = 1; k < declared[j].n_attrs; k++)
 	    {
-	      /* is non-empty index */
-	      btree_stats_p->keys = MAX (btree_stats_p->keys, 1);
-
-	      /* If the estimated objects from heap manager is greater than the estimate when the statistics were
-	       * gathered, assume that the difference is in distinct keys. */
-	      if (cls_info_p->ci_tot_objects > 0 && estimated_nobjs > cls_info_p->ci_tot_objects)
+	      if (stats_find_disk_attr (disk_repr_p, declared[j].attr_ids[k]) == NULL)
 		{
-		  btree_stats_p->keys += (estimated_nobjs - cls_info_p->ci_tot_objects);
+		  break;
 		}
 	    }
-
-	  OR_PUT_INT (buf_p, btree_stats_p->keys);
-	  buf_p += OR_INT_SIZE;
-
-	  assert_release (btree_stats_p->leafs >= 1);
-	  assert_release (btree_stats_p->pages >= 1);
-	  assert_release (btree_stats_p->height >= 1);
-	  assert_release (btree_stats_p->keys >= 0);
-
-	  buf_p = or_pack_domain (buf_p, btree_stats_p->key_type, 0, 0);
-
-	  /* get full key size */
-	  if (TP_DOMAIN_TYPE (btree_stats_p->key_type) == DB_TYPE_MIDXKEY)
-	    {
-	      key_size = tp_domain_size (btree_stats_p->key_type->setdomain);
-	    }
-	  else
+	  if (k < declared[j].n_attrs)
 	    {
-	      key_size = 1;
+	      continue;
 	    }
-	  assert (key_size >= btree_stats_p->pkeys_size);
-
-	  assert (btree_stats_p->pkeys_size <= BTREE_STATS_PKEYS_NUM);
-	  for (k = 0; k < btree_stats_p->pkeys_size; k++)
-	    {
-	      /* check and handle with estimation, since pkeys[] is not gathered before update stats */
-	      if (estimated_nobjs > 0 && use_stat_estimation)
-		{
-		  /* is non-empty index */
-		  btree_stats_p->pkeys[k] = MAX (btree_stats_p->pkeys[k], 1);
-		}
 
-	      if (k + 1 == key_size)
-		{
-		  /* this last pkeys must be equal to keys */
-		  btree_stats_p->pkeys[k] = btree_stats_p->keys;
-		}
+	  found = stats_find_column_group (old_groups, n_old_groups, declared[j].n_attrs, declared[j].attr_ids);
+	  groups[n_attr_groups++] = (found >= 0) ? old_groups[found] : declared[j];
+	}
 
-	      OR_PUT_INT (buf_p, btree_stats_p->pkeys[k]);
-	      buf_p += OR_INT_SIZE;
-	    }
-	}			/* for (j = 0, ...) */
+      if (n_attr_groups == 0 && disk_attr_p->column_groups_length <= 0)
+	{
+	  continue;
+	}
+      error_code = stats_pack_column_groups (thread_p, groups, n_attr_groups, disk_attr_p);
+      if (error_code != NO_ERROR)
+	{
+	  return error_code;
+	}
     }
 
-  OR_PUT_INT (buf_p, max_unique_keys);
-  buf_p += OR_INT_SIZE;
-
-  catalog_free_representation_and_init (disk_repr_p);
-  catalog_free_class_info_and_init (cls_info_p);
-
-  *length_p = CAST_STRLEN (buf_p - start_p);
-
-  thread_p->pop_resource_tracks ();
+  return NO_ERROR;
+}
 
-  return start_p;
+/*
+ * stats_combine_partition_column_groups () - Add the column groups of an attribute of a partition to those of the
+ *                                            partitioned class
+ *   return: void
+ *   groups_p(in/out): column groups led by the attribute in partitioned class
+ *   n_groups(in): number of column groups
+ *   subcls_attr_p(in): attribute of partition
+ *   weight(in): objects of partition
+ *
+ *   Note: Distinct values of partitions are added up; dependency degrees are summed weighted by the objects of
+ *         partitions, the caller divides them by the objects of the partitioned class.
+ */
+static void
+stats_combine_partition_column_groups (STATS_COLUMN_GROUP * groups_p, int n_groups, DISK_ATTR * subcls_attr_p,
+				       double weight)
+{
+  STATS_COLUMN_GROUP subcls_groups[STATS_COLUMN_GROUPS_MAX];
+  int n_subcls_groups, found, i, j, k;
 
-exit_on_error:
+  n_subcls_groups =
+    stats_unpack_column_groups (subcls_attr_p->column_groups, subcls_attr_p->column_groups_length, subcls_groups);
 
-  if (catalog_access_info.access_started)
+  for (i = 0; i < n_groups; i++)
     {
-      (void) catalog_end_access_with_dir_oid (thread_p, &catalog_access_info, ER_FAILED);
-    }
+      found = stats_find_column_group (subcls_groups, n_subcls_groups, groups_p[i].n_attrs, groups_p[i].attr_ids);
+      if (found < 0)
+	{
+	  continue;
+	}
 
-  if (disk_repr_p)
-    {
-      catalog_free_representation_and_init (disk_repr_p);
-    }
-  if (cls_info_p)
-    {
-      catalog_free_class_info_and_init (cls_info_p);
+      groups_p[i].ndv += subcls_groups[found].ndv;
+      for (j = 0; j < groups_p[i].n_attrs; j++)
+	{
+	  /* the partition may list the attributes in another order */
+	  for (k = 0; k < groups_p[i].n_attrs; k++)
+	    {
+	      if (subcls_groups[found].attr_ids[k] == groups_p[i].attr_ids[j])
+		{
+		  groups_p[i].degrees[j] += subcls_groups[found].degrees[k] * weight;
+		  break;
+		}
+	    }
+	}
     }
-
-  thread_p->pop_resource_tracks ();
-
-  return NULL;
 }
 
 #if defined(ENABLE_UNUSED_FUNCTION)
@@ -1206,6 +3185,7 @@ stats_dump_class_statistics (CLASS_STATS * class_stats, FILE * fpp)
  * partitions (in) : oids of partitions
  * int partitions_count (in) : number of partitions
  * with_fullscan(in): true iff WITH FULLSCAN
+ * sample_rows(in): objects of WITH SAMPLE, or STATS_SAMPLE_ROWS_DEFAULT
  *
  * Note: Since, during plan generation we only have access to the partitioned
  * class, we have to keep an estimate of average statistics in this class. We
@@ -1221,7 +3201,7 @@ stats_dump_class_statistics (CLASS_STATS * class_stats, FILE * fpp)
  */
 static int
 stats_update_partitioned_statistics (THREAD_ENTRY * thread_p, OID * class_id_p, OID * partitions, int partitions_count,
-				     bool with_fullscan)
+				     bool with_fullscan, int sample_rows)
 {
   int i, j, k, btree_iter, m;
   int error = NO_ERROR;
@@ -1233,6 +3213,8 @@ stats_update_partitioned_statistics (THREAD_ENTRY * thread_p, OID * class_id_p,
   BTREE_STATS *btree_stats_p = NULL;
   int n_btrees = 0;
   PARTITION_STATS_ACUMULATOR *mean = NULL, *stddev = NULL;
+  STATS_COLUMN_GROUP *groups_p = NULL;
+  int *n_groups = NULL;
   OR_CLASSREP *cls_rep = NULL;
   OR_CLASSREP *subcls_rep = NULL;
   int cls_idx_cache = 0, subcls_idx_cache = 0;
@@ -1247,7 +3229,7 @@ stats_update_partitioned_statistics (THREAD_ENTRY * thread_p, OID * class_id_p,
 
   for (i = 0; i < partitions_count; i++)
     {
-      error = xstats_update_statistics (thread_p, &partitions[i], with_fullscan);
+      error = xstats_update_statistics (thread_p, &partitions[i], with_fullscan, sample_rows);
       if (error != NO_ERROR)
 	{
 	  goto cleanup;
@@ -1336,6 +3318,45 @@ stats_update_partitioned_statistics (THREAD_ENTRY * thread_p, OID * class_id_p,
   memset (mean, 0, n_btrees * sizeof (PARTITION_STATS_ACUMULATOR));
   memset (stddev, 0, n_btrees * sizeof (PARTITION_STATS_ACUMULATOR));
 
+  /* column groups of the partitioned class, by attribute; they are gathered by partitions */
+  error = stats_declare_column_groups (thread_p, class_id_p, disk_repr_p);
+  if (error != NO_ERROR)
+    {
+      goto cleanup;
+    }
+  groups_p =
+    (STATS_COLUMN_GROUP *) db_private_alloc (thread_p, (disk_repr_p->n_fixed + disk_repr_p->n_variable)
+					     * STATS_COLUMN_GROUPS_MAX * sizeof (STATS_COLUMN_GROUP));
+  n_groups = (int *) db_private_alloc (thread_p, (disk_repr_p->n_fixed + disk_repr_p->n_variable) * sizeof (int));
+  if (groups_p == NULL || n_groups == NULL)
+    {
+      error = ER_FAILED;
+      goto cleanup;
+    }
+  for (i = 0; i < disk_repr_p->n_fixed + disk_repr_p->n_variable; i++)
+    {
+      if (i < disk_repr_p->n_fixed)
+	{
+	  disk_attr_p = disk_repr_p->fixed + i;
+	}
+      else
+	{
+	  disk_attr_p = disk_repr_p->variable + (i - disk_repr_p->n_fixed);
+	}
+
+      n_groups[i] =
+	stats_unpack_column_groups (disk_attr_p->column_groups, disk_attr_p->column_groups_length,
+				    &groups_p[i * STATS_COLUMN_GROUPS_MAX]);
+      for (j = 0; j < n_groups[i]; j++)
+	{
+	  groups_p[i * STATS_COLUMN_GROUPS_MAX + j].ndv = 0;
+	  for (k = 0; k < groups_p[i * STATS_COLUMN_GROUPS_MAX + j].n_attrs; k++)
+	    {
+	      groups_p[i * STATS_COLUMN_GROUPS_MAX + j].degrees[k] = 0;
+	    }
+	}
+    }
+
   /* initialize pkeys */
   btree_iter = 0;
   for (i = 0; i < disk_repr_p->n_fixed + disk_repr_p->n_variable; i++)
@@ -1477,6 +3498,9 @@ stats_update_partitioned_statistics (THREAD_ENTRY * thread_p, OID * class_id_p,
 	  assert_release (subcls_attr_p->id == disk_attr_p->id);
 	  assert_release (subcls_attr_p->n_btstats == disk_attr_p->n_btstats);
 
+	  stats_combine_partition_column_groups (&groups_p[j * STATS_COLUMN_GROUPS_MAX], n_groups[j], subcls_attr_p,
+						 (double) subcls_info->ci_tot_objects);
+
 	  for (k = 0, btree_stats_p = disk_attr_p->bt_stats; k < disk_attr_p->n_btstats; k++, btree_stats_p++)
 	    {
 	      const BTREE_STATS *subcls_stats;
@@ -1698,6 +3722,22 @@ stats_update_partitioned_statistics (THREAD_ENTRY * thread_p, OID * class_id_p,
 	    }
 	  btree_iter++;
 	}
+
+      if (n_groups[i] > 0)
+	{
+	  for (j = 0; j < n_groups[i]; j++)
+	    {
+	      for (k = 0; k < groups_p[i * STATS_COLUMN_GROUPS_MAX + j].n_attrs; k++)
+		{
+		  groups_p[i * STATS_COLUMN_GROUPS_MAX + j].degrees[k] /= MAX (cls_info_p->ci_tot_objects, 1);
+		}
+	    }
+	  error = stats_pack_column_groups (thread_p, &groups_p[i * STATS_COLUMN_GROUPS_MAX], n_groups[i], disk_attr_p);
+	  if (error != NO_ERROR)
+	    {
+	      goto cleanup;
+	    }
+	}
     }
 
   error = catalog_start_access_with_dir_oid (thread_p, &catalog_access_info, X_LOCK);
@@ -1753,6 +3793,14 @@ cleanup:
 	}
       db_private_free (thread_p, stddev);
     }
+  if (groups_p != NULL)
+    {
+      db_private_free_and_init (thread_p, groups_p);
+    }
+  if (n_groups != NULL)
+    {
+      db_private_free_and_init (thread_p, n_groups);
+    }
   if (subcls_info)
     {
       catalog_free_class_info_and_init (subcls_info);
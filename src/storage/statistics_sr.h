@@ -36,6 +36,7 @@
 #include "object_representation_sr.h"
 
 extern unsigned int stats_get_time_stamp (void);
+extern char *stats_pack_histogram (STATS_HISTOGRAM * histogram_p, int *length_p);
 extern const BTREE_STATS *stats_find_inherited_index_stats (OR_CLASSREP * cls_rep, OR_CLASSREP * subcls_rep,
 							    DISK_ATTR * subcls_attr, BTID * cls_btid);
 #if defined(CUBRID_DEBUG)
@@ -1087,6 +1087,9 @@ extern const int SM_MAX_STRING_LENGTH;
 
 #define SM_PROPERTY_NUM_INDEX_FAMILY         6
 
+/* column groups declared by CREATE STATISTICS; a sequence of sequences of attribute ids */
+#define SM_PROPERTY_COLUMN_GROUPS "*CG"
+
 #define SM_FILTER_INDEX_ID "*FP*"
 #define SM_FUNCTION_INDEX_ID "*FI*"
 #define SM_PREFIX_INDEX_ID "*PLID*"
@@ -103,7 +103,10 @@ static int rv;
 /* Each disk attribute is aligned with MAX_ALIGNMENT
    Each disk attribute may be followed by a "value" which is of
    variable size. The below constants does not consider the
-   optional value field following the attribute structure. */
+   optional value field following the attribute structure.
+   The value may be followed by a packed histogram of the attribute and
+   by the packed column groups led by the attribute; records written
+   before these were kept have no histogram or column groups magic. */
 #define CATALOG_DISK_ATTR_ID_OFF         0
 #define CATALOG_DISK_ATTR_LOCATION_OFF   4
 #define CATALOG_DISK_ATTR_TYPE_OFF       8
@@ -111,8 +114,15 @@ static int rv;
 #define CATALOG_DISK_ATTR_POSITION_OFF   16
 #define CATALOG_DISK_ATTR_CLASSOID_OFF   20
 #define CATALOG_DISK_ATTR_N_BTSTATS_OFF  28
+#define CATALOG_DISK_ATTR_HISTOGRAM_LENGTH_OFF 32
+#define CATALOG_DISK_ATTR_HISTOGRAM_MAGIC_OFF  36
+#define CATALOG_DISK_ATTR_COLUMN_GROUPS_LENGTH_OFF 40
+#define CATALOG_DISK_ATTR_COLUMN_GROUPS_MAGIC_OFF  44
 #define CATALOG_DISK_ATTR_SIZE           80
 
+#define CATALOG_DISK_ATTR_HISTOGRAM_MAGIC 0x48535447	/* "HSTG" */
+#define CATALOG_DISK_ATTR_COLUMN_GROUPS_MAGIC 0x43475250	/* "CGRP" */
+
 #define CATALOG_BT_STATS_BTID_OFF        0
 #define CATALOG_BT_STATS_LEAFS_OFF       OR_BTID_ALIGNED_SIZE
 #define CATALOG_BT_STATS_PAGES_OFF       16
@@ -430,6 +440,23 @@ catalog_get_disk_attribute (DISK_ATTR * attr_p, char *rec_p)
   OR_GET_OID (rec_p + CATALOG_DISK_ATTR_CLASSOID_OFF, &attr_p->classoid);
   attr_p->n_btstats = OR_GET_INT (rec_p + CATALOG_DISK_ATTR_N_BTSTATS_OFF);
   attr_p->bt_stats = NULL;
+
+  /* the histogram fields were reserved space of old records */
+  attr_p->histogram_length = 0;
+  if (OR_GET_INT (rec_p + CATALOG_DISK_ATTR_HISTOGRAM_MAGIC_OFF) == CATALOG_DISK_ATTR_HISTOGRAM_MAGIC)
+    {
+      attr_p->histogram_length = OR_GET_INT (rec_p + CATALOG_DISK_ATTR_HISTOGRAM_LENGTH_OFF);
+      assert (attr_p->histogram_length >= 0);
+    }
+  attr_p->histogram = NULL;
+
+  attr_p->column_groups_length = 0;
+  if (OR_GET_INT (rec_p + CATALOG_DISK_ATTR_COLUMN_GROUPS_MAGIC_OFF) == CATALOG_DISK_ATTR_COLUMN_GROUPS_MAGIC)
+    {
+      attr_p->column_groups_length = OR_GET_INT (rec_p + CATALOG_DISK_ATTR_COLUMN_GROUPS_LENGTH_OFF);
+      assert (attr_p->column_groups_length >= 0);
+    }
+  attr_p->column_groups = NULL;
 }
 
 static void
@@ -467,6 +494,10 @@ catalog_put_disk_attribute (char *rec_p, DISK_ATTR * attr_p)
 
   OR_PUT_OID (rec_p + CATALOG_DISK_ATTR_CLASSOID_OFF, &attr_p->classoid);
   OR_PUT_INT (rec_p + CATALOG_DISK_ATTR_N_BTSTATS_OFF, attr_p->n_btstats);
+  OR_PUT_INT (rec_p + CATALOG_DISK_ATTR_HISTOGRAM_LENGTH_OFF, attr_p->histogram_length);
+  OR_PUT_INT (rec_p + CATALOG_DISK_ATTR_HISTOGRAM_MAGIC_OFF, CATALOG_DISK_ATTR_HISTOGRAM_MAGIC);
+  OR_PUT_INT (rec_p + CATALOG_DISK_ATTR_COLUMN_GROUPS_LENGTH_OFF, attr_p->column_groups_length);
+  OR_PUT_INT (rec_p + CATALOG_DISK_ATTR_COLUMN_GROUPS_MAGIC_OFF, CATALOG_DISK_ATTR_COLUMN_GROUPS_MAGIC);
 }
 
 static void
@@ -847,6 +878,16 @@ catalog_free_representation (DISK_REPR * repr_p)
 	      db_private_free_and_init (NULL, attr_p->value);
 	    }
 
+	  if (attr_p->histogram != NULL)
+	    {
+	      db_private_free_and_init (NULL, attr_p->histogram);
+	    }
+
+	  if (attr_p->column_groups != NULL)
+	    {
+	      db_private_free_and_init (NULL, attr_p->column_groups);
+	    }
+
 	  if (attr_p->bt_stats != NULL)
 	    {
 	      for (j = 0; j < attr_p->n_btstats; j++)
@@ -2546,6 +2587,29 @@ catalog_copy_disk_attributes (DISK_ATTR * new_attrs_p, int new_attr_count, DISK_
 
 	  catalog_copy_btree_statistic (new_attr_p->bt_stats, new_attr_p->n_btstats, pre_attr_p->bt_stats,
 					pre_attr_p->n_btstats);
+
+	  /* the histogram is still valid if the type of the attribute did not change; new attributes come from
+	   * orc_diskrep_from_record () and are freed by orc_free_diskrep () */
+	  if (new_attr_p->type == pre_attr_p->type && pre_attr_p->histogram_length > 0 && new_attr_p->histogram == NULL)
+	    {
+	      new_attr_p->histogram = (char *) malloc (pre_attr_p->histogram_length);
+	      if (new_attr_p->histogram != NULL)
+		{
+		  memcpy (new_attr_p->histogram, pre_attr_p->histogram, pre_attr_p->histogram_length);
+		  new_attr_p->histogram_length = pre_attr_p->histogram_length;
+		}
+	    }
+
+	  /* column groups are kept as declared; groups of dropped attributes are left out when they are gathered */
+	  if (pre_attr_p->column_groups_length > 0 && new_attr_p->column_groups == NULL)
+	    {
+	      new_attr_p->column_groups = (char *) malloc (pre_attr_p->column_groups_length);
+	      if (new_attr_p->column_groups != NULL)
+		{
+		  memcpy (new_attr_p->column_groups, pre_attr_p->column_groups, pre_attr_p->column_groups_length);
+		  new_attr_p->column_groups_length = pre_attr_p->column_groups_length;
+		}
+	    }
 	}
     }
 }
@@ -2783,6 +2847,8 @@ catalog_sum_disk_attribute_size (DISK_ATTR * attrs_p, int count)
     {
       size += CATALOG_DISK_ATTR_SIZE;
       size += disk_attrp->val_length + (MAX_ALIGNMENT * 2);
+      size += disk_attrp->histogram_length;
+      size += disk_attrp->column_groups_length;
       for (j = 0; j < disk_attrp->n_btstats; j++)
 	{
 	  size += CATALOG_BT_STATS_SIZE;
@@ -2947,6 +3013,32 @@ catalog_add_representation (THREAD_ENTRY * thread_p, OID * class_id_p, REPR_ID r
 	  return error_code;
 	}
 
+      if (catalog_store_attribute_value (thread_p, disk_attr_p->histogram, disk_attr_p->histogram_length,
+					 &catalog_record, &remembered_slot_id) != NO_ERROR)
+	{
+	  db_private_free_and_init (thread_p, data);
+
+	  ASSERT_ERROR_AND_SET (error_code);
+	  if (do_end_access)
+	    {
+	      catalog_end_access_with_dir_oid (thread_p, catalog_access_info_p, ER_FAILED);
+	    }
+	  return error_code;
+	}
+
+      if (catalog_store_attribute_value (thread_p, disk_attr_p->column_groups, disk_attr_p->column_groups_length,
+					 &catalog_record, &remembered_slot_id) != NO_ERROR)
+	{
+	  db_private_free_and_init (thread_p, data);
+
+	  ASSERT_ERROR_AND_SET (error_code);
+	  if (do_end_access)
+	    {
+	      catalog_end_access_with_dir_oid (thread_p, catalog_access_info_p, ER_FAILED);
+	    }
+	  return error_code;
+	}
+
       for (j = 0; j < disk_attr_p->n_btstats; j++)
 	{
 	  btree_stats_p = &disk_attr_p->bt_stats[j];
@@ -3819,6 +3911,36 @@ catalog_assign_attribute (THREAD_ENTRY * thread_p, DISK_ATTR * disk_attr_p, CATA
       return ER_FAILED;
     }
 
+  if (disk_attr_p->histogram_length > 0)
+    {
+      disk_attr_p->histogram = (char *) db_private_alloc (thread_p, disk_attr_p->histogram_length);
+      if (disk_attr_p->histogram == NULL)
+	{
+	  return ER_FAILED;
+	}
+
+      if (catalog_fetch_attribute_value (thread_p, disk_attr_p->histogram, disk_attr_p->histogram_length,
+					 catalog_record_p) != NO_ERROR)
+	{
+	  return ER_FAILED;
+	}
+    }
+
+  if (disk_attr_p->column_groups_length > 0)
+    {
+      disk_attr_p->column_groups = (char *) db_private_alloc (thread_p, disk_attr_p->column_groups_length);
+      if (disk_attr_p->column_groups == NULL)
+	{
+	  return ER_FAILED;
+	}
+
+      if (catalog_fetch_attribute_value (thread_p, disk_attr_p->column_groups, disk_attr_p->column_groups_length,
+					 catalog_record_p) != NO_ERROR)
+	{
+	  return ER_FAILED;
+	}
+    }
+
   n_btstats = disk_attr_p->n_btstats;
   if (n_btstats > 0)
     {
@@ -4869,6 +4991,9 @@ catalog_dump_disk_attribute (DISK_ATTR * attr_p)
       fprintf (stdout, " \n");
     }
 
+  fprintf (stdout, " Histogram Length: %d \n", attr_p->histogram_length);
+  fprintf (stdout, " Column Groups Length: %d \n", attr_p->column_groups_length);
+
   fprintf (stdout, " BTree statistics:\n");
 
   for (k = 0; k < attr_p->n_btstats; k++)
@@ -89,6 +89,10 @@ struct disk_attribute
   OID classoid;			/* source class object id */
   int n_btstats;		/* number of B+tree statistics information */
   BTREE_STATS *bt_stats;	/* pointer to array of BTREE_STATS; BTREE_STATS[n_btstats] */
+  int histogram_length;		/* length of packed histogram >= 0 */
+  char *histogram;		/* packed STATS_HISTOGRAM of the attribute; see statistics_sr.c */
+  int column_groups_length;	/* length of packed column groups >= 0 */
+  char *column_groups;		/* packed STATS_COLUMN_GROUPs led by the attribute; see statistics_sr.c */
 };				/* disk attribute structure */
 
 typedef struct cls_info CLS_INFO;
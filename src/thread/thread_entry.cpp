@@ -115,6 +115,7 @@ namespace cubthread
     , log_zip_redo (NULL)
     , log_data_ptr (NULL)
     , log_data_length (0)
+    , page_copy_buffer (NULL)
     , no_logging (false)
     , net_request_index (-1)
     , vacuum_worker (NULL)
@@ -185,6 +186,10 @@ namespace cubthread
     tran_entries[THREAD_TS_HFID_TABLE] = NULL;
     tran_entries[THREAD_TS_XCACHE] = NULL;
     tran_entries[THREAD_TS_FPCACHE] = NULL;
+    tran_entries[THREAD_TS_DWB_SLOTS] = NULL;
+    tran_entries[THREAD_TS_BTREE_AHI] = NULL;
+    tran_entries[THREAD_TS_BTREE_BLOOM] = NULL;
+    tran_entries[THREAD_TS_BTREE_DELTA] = NULL;
 
 #if !defined (NDEBUG)
     fi_thread_init (this);
@@ -215,6 +220,9 @@ namespace cubthread
     tran_entries[THREAD_TS_XCACHE] = lf_tran_request_entry (&xcache_Ts);
     tran_entries[THREAD_TS_FPCACHE] = lf_tran_request_entry (&fpcache_Ts);
     tran_entries[THREAD_TS_DWB_SLOTS] = lf_tran_request_entry (&dwb_slots_Ts);
+    tran_entries[THREAD_TS_BTREE_AHI] = lf_tran_request_entry (&btree_ahi_Ts);
+    tran_entries[THREAD_TS_BTREE_BLOOM] = lf_tran_request_entry (&btree_bloom_Ts);
+    tran_entries[THREAD_TS_BTREE_DELTA] = lf_tran_request_entry (&btree_delta_Ts);
   }
 
   void
@@ -256,6 +264,10 @@ namespace cubthread
       {
 	free (log_data_ptr);
       }
+    if (page_copy_buffer != NULL)
+      {
+	free (page_copy_buffer);
+      }
 
     no_logging = false;
 
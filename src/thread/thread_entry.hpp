@@ -88,6 +88,9 @@ enum
   THREAD_TS_XCACHE,
   THREAD_TS_FPCACHE,
   THREAD_TS_DWB_SLOTS,
+  THREAD_TS_BTREE_AHI,
+  THREAD_TS_BTREE_BLOOM,
+  THREAD_TS_BTREE_DELTA,
   THREAD_TS_LAST
 };
 #define THREAD_TS_COUNT  THREAD_TS_LAST
@@ -256,6 +259,8 @@ namespace cubthread
       char *log_data_ptr;
       int log_data_length;
 
+      char *page_copy_buffer;	/* page copied by pgbuf_copy_page_optimistic () */
+
       bool no_logging;
 
       int net_request_index;	/* request index of net server functions */
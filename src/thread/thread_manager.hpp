@@ -298,6 +298,8 @@ namespace cubthread
   const int LOG_WORKER_POOL_CONNECTIONS = 0x200;
   const int LOG_WORKER_POOL_TRAN_WORKERS = 0x400;
   const int LOG_WORKER_POOL_INDEX_BUILDER = 0x800;
+  const int LOG_WORKER_POOL_CHECKDB = 0x1000;
+  const int LOG_WORKER_POOL_STATS = 0x2000;
   const int LOG_WORKER_POOL_ALL = 0xFF00;    // reserved for thread worker pools
 
   // daemons flags
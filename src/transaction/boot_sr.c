@@ -2549,6 +2549,27 @@ boot_restart_server (THREAD_ENTRY * thread_p, bool print_restart, const char *db
       goto error;
     }
 
+  error_code = btree_ahi_initialize (thread_p);
+  if (error_code != NO_ERROR)
+    {
+      ASSERT_ERROR ();
+      goto error;
+    }
+
+  error_code = btree_bloom_initialize (thread_p);
+  if (error_code != NO_ERROR)
+    {
+      ASSERT_ERROR ();
+      goto error;
+    }
+
+  error_code = btree_delta_initialize (thread_p);
+  if (error_code != NO_ERROR)
+    {
+      ASSERT_ERROR ();
+      goto error;
+    }
+
   /*
    * Initialize system locale using values from db_root system table
    */
@@ -2814,6 +2835,9 @@ error:
 
   log_final (thread_p);
   fpcache_finalize (thread_p);
+  btree_ahi_finalize (thread_p);
+  btree_bloom_finalize (thread_p);
+  btree_delta_finalize (thread_p);
   qfile_finalize_list_cache (thread_p);
   xcache_finalize (thread_p);
 
@@ -3108,6 +3132,9 @@ xboot_shutdown_server (REFPTR (THREAD_ENTRY, thread_p), ER_FINAL_CODE is_er_fina
   qfile_finalize_list_cache (thread_p);
   xcache_finalize (thread_p);
   fpcache_finalize (thread_p);
+  btree_ahi_finalize (thread_p);
+  btree_bloom_finalize (thread_p);
+  btree_delta_finalize (thread_p);
   session_states_finalize (thread_p);
 
   (void) boot_remove_all_temp_volumes (thread_p, REMOVE_TEMP_VOL_DEFAULT_ACTION);
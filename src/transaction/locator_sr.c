@@ -4001,6 +4001,96 @@ locator_end_force_scan_cache (THREAD_ENTRY * thread_p, HEAP_SCANCACHE * scan_cac
   heap_scancache_end_modify (thread_p, scan_cache);
 }
 
+/*
+ * locator_start_index_insert_buffer () - Defer insertion of keys in non-unique indexes until
+ *					  locator_flush_index_insert_buffer is called.
+ *
+ * return:
+ *
+ *   scan_cache(in/out): scan cache of a multi-row insert
+ *
+ * Note: The keys of each index are sorted and merged into the index leaf by leaf when buffer is flushed. Nothing is
+ *	 buffered if index_insert_buffer_size is 0.
+ */
+void
+locator_start_index_insert_buffer (HEAP_SCANCACHE * scan_cache)
+{
+  UINT64 buffer_size = prm_get_bigint_value (PRM_ID_INDEX_INSERT_BUFFER_SIZE);
+
+  assert (scan_cache != NULL && scan_cache->m_index_insert_buffer == NULL);
+
+  if (buffer_size > 0)
+    {
+      scan_cache->m_index_insert_buffer =
+	new multi_index_insert_buffer ((size_t) buffer_size, BTREE_OP_INSERT_NEW_OBJECT);
+    }
+}
+
+/*
+ * locator_start_index_delete_buffer () - Defer adding delete MVCCID to the keys of non-unique indexes until
+ *					  locator_flush_index_insert_buffer is called.
+ *
+ * return:
+ *
+ *   scan_cache(in/out): scan cache of a multi-row delete
+ *
+ * Note: The deleted objects of each index are sorted and marked leaf by leaf when buffer is flushed, instead of
+ *	 traversing the index once for each deleted row. Nothing is buffered if index_insert_buffer_size is 0.
+ */
+void
+locator_start_index_delete_buffer (HEAP_SCANCACHE * scan_cache)
+{
+  UINT64 buffer_size = prm_get_bigint_value (PRM_ID_INDEX_INSERT_BUFFER_SIZE);
+
+  assert (scan_cache != NULL && scan_cache->m_index_insert_buffer == NULL);
+
+  if (buffer_size > 0)
+    {
+      scan_cache->m_index_insert_buffer =
+	new multi_index_insert_buffer ((size_t) buffer_size, BTREE_OP_INSERT_MVCC_DELID);
+    }
+}
+
+/*
+ * locator_flush_index_insert_buffer () - Apply all keys buffered since locator_start_index_insert_buffer or
+ *					  locator_start_index_delete_buffer and stop buffering.
+ *
+ * return: NO_ERROR if all OK, ER_ status otherwise
+ *
+ *   scan_cache(in/out):
+ */
+int
+locator_flush_index_insert_buffer (THREAD_ENTRY * thread_p, HEAP_SCANCACHE * scan_cache)
+{
+  int error_code = NO_ERROR;
+
+  if (scan_cache->m_index_insert_buffer == NULL)
+    {
+      return NO_ERROR;
+    }
+
+  error_code = scan_cache->m_index_insert_buffer->flush (thread_p);
+
+  delete scan_cache->m_index_insert_buffer;
+  scan_cache->m_index_insert_buffer = NULL;
+
+  return error_code;
+}
+
+/*
+ * locator_clear_index_insert_buffer () - Stop buffering index keys and drop the keys buffered so far.
+ *
+ * return:
+ *
+ *   scan_cache(in/out):
+ */
+void
+locator_clear_index_insert_buffer (HEAP_SCANCACHE * scan_cache)
+{
+  delete scan_cache->m_index_insert_buffer;
+  scan_cache->m_index_insert_buffer = NULL;
+}
+
 /*
  * locator_check_foreign_key () -
  *
@@ -7858,6 +7948,20 @@ locator_add_or_remove_index_internal (THREAD_ENTRY * thread_p, RECDES * recdes,
 		    btree_online_index_dispatcher (thread_p, &btid, key_dbvalue, class_oid, inst_oid, unique_pk,
 						   BTREE_OP_ONLINE_INDEX_TRAN_INSERT, NULL);
 		}
+	      else if (scan_cache != NULL && scan_cache->m_index_insert_buffer != NULL
+		       && scan_cache->m_index_insert_buffer->get_purpose () == BTREE_OP_INSERT_NEW_OBJECT
+		       && unique_pk == 0 && index->type != BTREE_FOREIGN_KEY && !DB_IS_NULL (key_dbvalue)
+		       && !btree_multicol_key_is_null (key_dbvalue))
+		{
+		  /* Key is inserted with the other keys of statement, in key order. */
+		  error_code =
+		    scan_cache->m_index_insert_buffer->add_key (thread_p, btid, *class_oid, key_dbvalue, *inst_oid,
+								p_mvcc_rec_header);
+		  if (error_code == NO_ERROR && scan_cache->m_index_insert_buffer->is_full ())
+		    {
+		      error_code = scan_cache->m_index_insert_buffer->flush (thread_p);
+		    }
+		}
 	      else
 		{
 		  error_code =
@@ -7883,6 +7987,20 @@ locator_add_or_remove_index_internal (THREAD_ENTRY * thread_p, RECDES * recdes,
 			btree_online_index_dispatcher (thread_p, &btid, key_dbvalue, class_oid, inst_oid,
 						       unique_pk, BTREE_OP_ONLINE_INDEX_TRAN_DELETE, NULL);
 		    }
+		  else if (scan_cache != NULL && scan_cache->m_index_insert_buffer != NULL
+			   && scan_cache->m_index_insert_buffer->get_purpose () == BTREE_OP_INSERT_MVCC_DELID
+			   && unique_pk == 0 && index->type != BTREE_FOREIGN_KEY && !DB_IS_NULL (key_dbvalue)
+			   && !btree_multicol_key_is_null (key_dbvalue))
+		    {
+		      /* Delete MVCCID is added with the other deleted keys of statement, in key order. */
+		      error_code =
+			scan_cache->m_index_insert_buffer->add_key (thread_p, btid, *class_oid, key_dbvalue,
+								    *inst_oid, p_mvcc_rec_header);
+		      if (error_code == NO_ERROR && scan_cache->m_index_insert_buffer->is_full ())
+			{
+			  error_code = scan_cache->m_index_insert_buffer->flush (thread_p);
+			}
+		    }
 		  else
 		    {
 		      /* in MVCC logical deletion means MVCC DEL_ID insertion */
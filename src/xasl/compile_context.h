@@ -25,11 +25,25 @@
 
 // forward definitions
 struct xasl_node;
+struct xasl_plan_peek;
 
 // note - file should be compatible to C language
 
 #include "sha1.h"
 
+/* most intermediate results whose rows are given back to the optimizer on recompile */
+#define COMPILE_MAX_CARDINALITY_FEEDBACKS 8
+
+/*
+ * COMPILE_CARDINALITY_FEEDBACK rows found by execution for an intermediate result of a plan
+ */
+typedef struct compile_cardinality_feedback COMPILE_CARDINALITY_FEEDBACK;
+struct compile_cardinality_feedback
+{
+  int key;			/* joined nodes of the intermediate result; see qo_get_cardinality_key () */
+  int rows;			/* rows of the intermediate result */
+};
+
 /*
  * COMPILE_CONTEXT cover from user input query string to generated xasl
  */
@@ -49,5 +63,15 @@ struct compile_context
   bool recompile_xasl_pinned;	/* whether recompile again after xasl cache entry has been pinned */
   bool recompile_xasl;
   SHA1Hash sha1;
+
+  bool collect_plan_peeks;	/* optimizer lists bind values whose selectivity changes the plan */
+  bool peek_host_vars;		/* optimizer plans for the values bound to peeked bind values */
+  struct xasl_plan_peek *plan_peeks;	/* bind values listed by optimizer */
+  int plan_variant;		/* selectivity ranges of the bound values; 0 for generic plan */
+  bool is_plan_variant_requested;	/* server asks to recompile for the plan variant of the bound values */
+
+  /* rows found by executions of the plan to be recompiled; used by optimizer instead of its estimates */
+  int n_cardinality_feedbacks;
+  COMPILE_CARDINALITY_FEEDBACK cardinality_feedbacks[COMPILE_MAX_CARDINALITY_FEEDBACKS];
 };
 #endif // _COMPILE_CONTEXT_H_
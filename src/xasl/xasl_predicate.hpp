@@ -91,6 +91,9 @@ typedef enum
   F_SOME
 } QL_FLAG;
 
+/* specialized comparison of two values of the same fixed-width type; see eval_bind_comp_eval_term () */
+typedef DB_LOGICAL (*COMP_EVAL_FAST_FNC) (const DB_VALUE * dbval1, const DB_VALUE * dbval2);
+
 namespace cubxasl
 {
   // forward definitions
@@ -109,6 +112,7 @@ namespace cubxasl
     regu_variable_node *rhs;
     REL_OP rel_op;
     DB_TYPE type;
+    COMP_EVAL_FAST_FNC fast_cmp;	/* server only, bound at XASL unpack time; not packed */
   };
 
   struct alsm_eval_term
@@ -0,0 +1,462 @@
+/*
+ * Copyright 2008 Search Solution Corporation
+ * Copyright 2016 CUBRID Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+#include "test_bloom_filter.hpp"
+
+#include "bloom_filter.h"
+#include "language_support.h"
+#include "object_domain.h"
+#include "thread_manager.hpp"
+
+#include <atomic>
+#include <iostream>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+
+namespace test_bloom_filter
+{
+  static const int existing_keys = 20000;	/* keys of the index before the filter is built */
+  static const int inserted_keys = 5000;	/* keys inserted by each thread while the filter is built */
+  static const int num_inserters = 8;
+  static const int num_readers = 2;
+  static const int build_batch = 64;	/* keys added by the builder at once, as BTREE_BLOOM_BUILD_BATCH */
+  static const int leaf_keys = 50;	/* keys of a leaf before merges */
+  static const int num_merges = 200;
+
+  static THREAD_ENTRY *
+  init_common_cubrid_modules (void)
+  {
+    static THREAD_ENTRY *thread_p = NULL;
+
+    if (thread_p != NULL)
+      {
+	return thread_p;
+      }
+
+    lang_init ();
+    tp_init ();
+    lang_set_charset_lang ("en_US.iso88591");
+
+    cubthread::initialize (thread_p);
+    if (cubthread::initialize_thread_entries () != NO_ERROR)
+      {
+	return NULL;
+      }
+    return thread_p;
+  }
+
+  static unsigned int
+  key_hash (int key)
+  {
+    /* any spread of keys; the filter mixes the hash itself */
+    return (unsigned int) key * 2654435761u;
+  }
+
+  int
+  test_no_false_negatives (void)
+  {
+    THREAD_ENTRY *thread_p = init_common_cubrid_modules ();
+    BLOOM_FILTER *bf;
+    int false_positives = 0;
+    int err = 0;
+
+    std::cout << "test_no_false_negatives";
+
+    bf = bloom_create (thread_p, existing_keys, BLOOM_DEFAULT_BITS_PER_ITEM);
+    if (bf == NULL)
+      {
+	std::cout << std::endl << "    cannot create filter" << std::endl;
+	return 1;
+      }
+
+    for (int key = 0; key < existing_keys; key += 2)
+      {
+	bloom_add (bf, key_hash (key));
+      }
+    for (int key = 0; key < existing_keys; key++)
+      {
+	if (key % 2 == 0 && !bloom_may_contain (bf, key_hash (key)))
+	  {
+	    std::cout << std::endl << "    added key " << key << " is not found" << std::endl;
+	    err = 1;
+	    break;
+	  }
+	if (key % 2 == 1 && bloom_may_contain (bf, key_hash (key)))
+	  {
+	    false_positives++;
+	  }
+      }
+
+    /* about 1% is expected */
+    if (false_positives > existing_keys / 2 / 20)
+      {
+	std::cout << std::endl << "    too many false positives: " << false_positives << std::endl;
+	err = 1;
+      }
+
+    bloom_clear (bf);
+    if (bloom_may_contain (bf, key_hash (0)))
+      {
+	std::cout << std::endl << "    cleared filter is not empty" << std::endl;
+	err = 1;
+      }
+
+    bloom_destroy (thread_p, bf);
+    return err;
+  }
+
+  /*
+   * Model of a unique index with a Bloom filter built in the background (see btree_bloom_build ()):
+   *  - leaf_mutex is the write latch of the leaves; keys are inserted in the filter while it is held;
+   *  - entry_mutex is the mutex of the filter entry of the index;
+   *  - the builder registers the filter before it scans the keys, and the filter is trusted only when the scan is
+   *    complete.
+   */
+  struct unique_index
+  {
+    std::mutex leaf_mutex;
+    std::set<int> keys;
+
+    std::mutex entry_mutex;
+    BLOOM_FILTER *filter = NULL;
+    bool is_ready = false;
+  };
+
+  /* insert key unless it is a duplicate; the filter must never tell that a key of the index is new */
+  static void
+  insert_key (unique_index &index, int key, std::atomic<int> &errors)
+  {
+    std::lock_guard<std::mutex> leaf_latch (index.leaf_mutex);
+    bool is_duplicate = index.keys.find (key) != index.keys.end ();
+    bool is_new_key = false;
+
+    {
+      std::lock_guard<std::mutex> entry_lock (index.entry_mutex);
+      if (index.filter != NULL)
+	{
+	  is_new_key = index.is_ready && !bloom_may_contain (index.filter, key_hash (key));
+	  if (!is_duplicate)
+	    {
+	      bloom_add (index.filter, key_hash (key));
+	    }
+	}
+    }
+
+    if (is_new_key && is_duplicate)
+      {
+	errors++;
+      }
+    if (!is_duplicate)
+      {
+	index.keys.insert (key);
+      }
+  }
+
+  static void
+  build_filter (unique_index &index, BLOOM_FILTER *filter)
+  {
+    std::vector<unsigned int> hashes;
+    int last_key = -1;
+    bool is_end = false;
+
+    {
+      std::lock_guard<std::mutex> entry_lock (index.entry_mutex);
+      index.filter = filter;
+      index.is_ready = false;
+    }
+
+    while (!is_end)
+      {
+	hashes.clear ();
+	{
+	  /* read the next keys of the leaves */
+	  std::lock_guard<std::mutex> leaf_latch (index.leaf_mutex);
+	  auto it = index.keys.upper_bound (last_key);
+	  for (; it != index.keys.end () && (int) hashes.size () < build_batch; ++it)
+	    {
+	      hashes.push_back (key_hash (*it));
+	      last_key = *it;
+	    }
+	  is_end = (it == index.keys.end ());
+	}
+
+	std::lock_guard<std::mutex> entry_lock (index.entry_mutex);
+	for (unsigned int hash : hashes)
+	  {
+	    bloom_add (index.filter, hash);
+	  }
+	std::this_thread::yield ();
+      }
+
+    std::lock_guard<std::mutex> entry_lock (index.entry_mutex);
+    index.is_ready = true;
+  }
+
+  int
+  test_concurrent_insert (void)
+  {
+    THREAD_ENTRY *thread_p = init_common_cubrid_modules ();
+    unique_index index;
+    BLOOM_FILTER *filter;
+    std::vector<std::thread> threads;
+    std::atomic<int> published_keys (0);
+    std::atomic<int> errors (0);
+    std::atomic<bool> stop_readers (false);
+    std::vector<std::atomic<int>> published (num_inserters * inserted_keys);
+    int missing = 0;
+
+    std::cout << "test_concurrent_insert";
+
+    /* existing keys are even, inserted keys are odd and spread over the key range the builder scans */
+    for (int key = 0; key < existing_keys * 2; key += 2)
+      {
+	index.keys.insert (key);
+      }
+
+    filter = bloom_create (thread_p, existing_keys + num_inserters * inserted_keys, BLOOM_DEFAULT_BITS_PER_ITEM);
+    if (filter == NULL)
+      {
+	std::cout << std::endl << "    cannot create filter" << std::endl;
+	return 1;
+      }
+
+    threads.emplace_back (build_filter, std::ref (index), filter);
+    for (int t = 0; t < num_inserters; t++)
+      {
+	threads.emplace_back ([&, t] ()
+	{
+	  for (int i = 0; i < inserted_keys; i++)
+	    {
+	      /* new keys are odd, both behind and ahead of the builder */
+	      int key = 2 * (i * num_inserters + t) + 1;
+
+	      insert_key (index, key, errors);
+	      published[published_keys++] = key;
+
+	      /* duplicate of an existing key */
+	      insert_key (index, 2 * ((i * 7919 + t) % existing_keys), errors);
+	    }
+	});
+      }
+    for (int r = 0; r < num_readers; r++)
+      {
+	threads.emplace_back ([&] ()
+	{
+	  while (!stop_readers)
+	    {
+	      int n = published_keys;
+	      for (int i = 0; i < n; i += 97)
+		{
+		  std::lock_guard<std::mutex> entry_lock (index.entry_mutex);
+		  if (index.is_ready && published[i] != 0 && !bloom_may_contain (index.filter, key_hash (published[i])))
+		    {
+		      errors++;
+		    }
+		}
+	      std::this_thread::yield ();
+	    }
+	});
+      }
+
+    for (int t = 0; t <= num_inserters; t++)
+      {
+	threads[t].join ();
+      }
+    stop_readers = true;
+    for (size_t t = num_inserters + 1; t < threads.size (); t++)
+      {
+	threads[t].join ();
+      }
+
+    for (int key : index.keys)
+      {
+	if (!bloom_may_contain (filter, key_hash (key)))
+	  {
+	    missing++;
+	  }
+      }
+
+    bloom_destroy (thread_p, filter);
+
+    if (missing > 0 || errors > 0)
+      {
+	std::cout << std::endl << "    keys not found: " << missing << ", wrong answers: " << errors << std::endl;
+	return 1;
+      }
+    return 0;
+  }
+
+  /*
+   * Model of the leaves of a unique index scanned left to right by the filter builder while leaves are merged (see
+   * btree_bloom_note_leaf_merge ()). A merge moves the keys of a leaf to its left neighbour, which the builder may
+   * have scanned already, so a filter being built is discarded and built again.
+   */
+  struct merged_index
+  {
+    std::mutex leaf_mutex;
+    std::vector<std::vector<int>> leaves;
+
+    std::mutex entry_mutex;
+    BLOOM_FILTER *filter = NULL;
+    bool is_ready = false;
+  };
+
+  static void
+  merge_leaves (merged_index &index, size_t left)
+  {
+    std::lock_guard<std::mutex> leaf_latch (index.leaf_mutex);
+    if (left + 1 >= index.leaves.size ())
+      {
+	return;
+      }
+    std::vector<int> &right = index.leaves[left + 1];
+
+    index.leaves[left].insert (index.leaves[left].end (), right.begin (), right.end ());
+    index.leaves.erase (index.leaves.begin () + left + 1);
+
+    std::lock_guard<std::mutex> entry_lock (index.entry_mutex);
+    if (index.filter != NULL && !index.is_ready)
+      {
+	index.filter = NULL;
+      }
+  }
+
+  /* return true if the filter is ready, false if it was discarded by a merge */
+  static bool
+  build_filter_of_leaves (merged_index &index, BLOOM_FILTER *filter)
+  {
+    std::vector<unsigned int> hashes;
+
+    {
+      std::lock_guard<std::mutex> entry_lock (index.entry_mutex);
+      index.filter = filter;
+      index.is_ready = false;
+    }
+
+    for (size_t leaf = 0;; leaf++)
+      {
+	hashes.clear ();
+	{
+	  std::lock_guard<std::mutex> leaf_latch (index.leaf_mutex);
+	  if (leaf >= index.leaves.size ())
+	    {
+	      break;
+	    }
+	  for (int key : index.leaves[leaf])
+	    {
+	      hashes.push_back (key_hash (key));
+	    }
+	}
+
+	std::lock_guard<std::mutex> entry_lock (index.entry_mutex);
+	if (index.filter != filter)
+	  {
+	    return false;
+	  }
+	for (unsigned int hash : hashes)
+	  {
+	    bloom_add (filter, hash);
+	  }
+	std::this_thread::yield ();
+      }
+
+    std::lock_guard<std::mutex> entry_lock (index.entry_mutex);
+    if (index.filter != filter)
+      {
+	return false;
+      }
+    index.is_ready = true;
+    return true;
+  }
+
+  int
+  test_merge_during_build (void)
+  {
+    THREAD_ENTRY *thread_p = init_common_cubrid_modules ();
+    merged_index index;
+    BLOOM_FILTER *filter = NULL;
+    std::atomic<bool> stop_merges (false);
+    int builds = 0;
+    int missing = 0;
+
+    std::cout << "test_merge_during_build";
+
+    for (int key = 0; key < existing_keys; key++)
+      {
+	if (key % leaf_keys == 0)
+	  {
+	    index.leaves.emplace_back ();
+	  }
+	index.leaves.back ().push_back (key);
+      }
+
+    std::thread merger ([&] ()
+    {
+      for (int i = 0; i < num_merges && !stop_merges; i++)
+	{
+	  /* merge leaves behind and ahead of the builder */
+	  merge_leaves (index, (size_t) (i * 7919) % (existing_keys / leaf_keys / 2));
+	  std::this_thread::yield ();
+	}
+    });
+
+    /* a discarded filter is built again, as on the next lookup */
+    do
+      {
+	if (filter != NULL)
+	  {
+	    bloom_destroy (thread_p, filter);
+	  }
+	filter = bloom_create (thread_p, existing_keys, BLOOM_DEFAULT_BITS_PER_ITEM);
+	if (filter == NULL)
+	  {
+	    stop_merges = true;
+	    merger.join ();
+	    std::cout << std::endl << "    cannot create filter" << std::endl;
+	    return 1;
+	  }
+	builds++;
+      }
+    while (!build_filter_of_leaves (index, filter));
+
+    stop_merges = true;
+    merger.join ();
+
+    for (auto &leaf : index.leaves)
+      {
+	for (int key : leaf)
+	  {
+	    if (!bloom_may_contain (filter, key_hash (key)))
+	      {
+		missing++;
+	      }
+	  }
+      }
+
+    bloom_destroy (thread_p, filter);
+
+    if (missing > 0)
+      {
+	std::cout << std::endl << "    keys not found: " << missing << " after " << builds << " builds" << std::endl;
+	return 1;
+      }
+    return 0;
+  }
+}
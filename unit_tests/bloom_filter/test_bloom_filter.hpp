@@ -0,0 +1,34 @@
+/*
+ * Copyright 2008 Search Solution Corporation
+ * Copyright 2016 CUBRID Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+#ifndef _TEST_BLOOM_FILTER_HPP_
+#define _TEST_BLOOM_FILTER_HPP_
+
+namespace test_bloom_filter
+{
+  /* every added item is found and few other items are */
+  int test_no_false_negatives (void);
+
+  /* a filter built from the keys of an index while keys are inserted finds every key, as unique indexes use it */
+  int test_concurrent_insert (void);
+
+  /* a filter built while leaves are merged is discarded and built again, so a ready filter finds every key */
+  int test_merge_during_build (void);
+}
+
+#endif /* _TEST_BLOOM_FILTER_HPP_ */
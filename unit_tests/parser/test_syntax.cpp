@@ -0,0 +1,274 @@
+/*
+ * Copyright 2008 Search Solution Corporation
+ * Copyright 2016 CUBRID Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+#include "test_syntax.hpp"
+
+#include "language_support.h"
+#include "object_primitive.h"
+#include "optimizer.h"
+#include "parser.h"
+#include "thread_manager.hpp"
+
+#include <initializer_list>
+#include <iostream>
+
+namespace test_parser
+{
+  static int
+  init_common_cubrid_modules (void)
+  {
+    static bool is_initialized = false;
+    THREAD_ENTRY *thread_p = NULL;
+
+    if (is_initialized)
+      {
+	return NO_ERROR;
+      }
+
+    lang_init ();
+    tp_init ();
+    lang_set_charset_lang ("en_US.iso88591");
+
+    cubthread::initialize (thread_p);
+    if (cubthread::initialize_thread_entries () != NO_ERROR)
+      {
+	return ER_FAILED;
+      }
+    is_initialized = true;
+    return NO_ERROR;
+  }
+
+  /* parse a single statement; return NULL on syntax error */
+  static PT_NODE *
+  parse_statement (PARSER_CONTEXT *parser, const char *sql)
+  {
+    PT_NODE **statements = parser_parse_string (parser, sql);
+
+    if (statements == NULL || pt_has_error (parser))
+      {
+	return NULL;
+      }
+    return statements[0];
+  }
+
+  /* expect sql to parse (or not) and, when it parses, to give a node of the expected type */
+  static bool
+  check_parse (const char *sql, bool expect_error, PT_NODE_TYPE expected_type)
+  {
+    PARSER_CONTEXT *parser = parser_create_parser ();
+    PT_NODE *statement;
+    bool is_ok;
+
+    if (parser == NULL)
+      {
+	return false;
+      }
+
+    statement = parse_statement (parser, sql);
+    if (expect_error)
+      {
+	is_ok = statement == NULL;
+      }
+    else
+      {
+	is_ok = statement != NULL && statement->node_type == expected_type;
+      }
+    if (!is_ok)
+      {
+	std::cout << "  unexpected parse result: " << sql << std::endl;
+      }
+
+    parser_free_parser (parser);
+    return is_ok;
+  }
+
+  /* expect sql to parse to UPDATE STATISTICS with the given scan options */
+  static bool
+  check_update_statistics (const char *sql, int with_fullscan, int sample_rows)
+  {
+    PARSER_CONTEXT *parser = parser_create_parser ();
+    PT_NODE *statement;
+    bool is_ok;
+
+    if (parser == NULL)
+      {
+	return false;
+      }
+
+    statement = parse_statement (parser, sql);
+    is_ok = (statement != NULL && statement->node_type == PT_UPDATE_STATS
+	     && statement->info.update_stats.with_fullscan == with_fullscan
+	     && statement->info.update_stats.sample_rows == sample_rows);
+    if (!is_ok)
+      {
+	std::cout << "  unexpected parse result: " << sql << std::endl;
+      }
+
+    parser_free_parser (parser);
+    return is_ok;
+  }
+
+  int
+  test_update_statistics_sample (void)
+  {
+    if (init_common_cubrid_modules () != NO_ERROR)
+      {
+	return ER_FAILED;
+      }
+
+    if (!check_update_statistics ("update statistics on t", 0, 0)
+	|| !check_update_statistics ("update statistics on t with fullscan", 1, 0)
+	|| !check_update_statistics ("update statistics on t with sample 100 rows", 0, 100)
+	|| !check_update_statistics ("update statistics on t with SAMPLE 0 rows", 0, 1)
+	|| !check_update_statistics ("update statistics on all classes with sample 5000 rows", 0, 5000)
+	|| !check_parse ("update statistics on t with sampl 100 rows", true, PT_UPDATE_STATS)
+	|| !check_parse ("update statistics on t with sample rows", true, PT_UPDATE_STATS)
+	|| !check_parse ("select sample from sample", false, PT_SELECT)
+	|| !check_parse ("create table sample (sample int)", false, PT_CREATE_ENTITY))
+      {
+	return ER_FAILED;
+      }
+    return NO_ERROR;
+  }
+
+  /* expect sql to parse to a column group declaration of class_name with the given columns */
+  static bool
+  check_column_group (const char *sql, int column_group_op, const char *class_name,
+		      std::initializer_list<const char *> columns)
+  {
+    PARSER_CONTEXT *parser = parser_create_parser ();
+    PT_NODE *statement;
+    PT_NODE *name;
+    bool is_ok;
+
+    if (parser == NULL)
+      {
+	return false;
+      }
+
+    statement = parse_statement (parser, sql);
+    is_ok = (statement != NULL && statement->node_type == PT_UPDATE_STATS
+	     && statement->info.update_stats.column_group_op == column_group_op
+	     && statement->info.update_stats.class_list != NULL
+	     && statement->info.update_stats.class_list->next == NULL
+	     && intl_identifier_casecmp (statement->info.update_stats.class_list->info.name.original, class_name) == 0);
+
+    name = is_ok ? statement->info.update_stats.column_group : NULL;
+    for (const char *column : columns)
+      {
+	if (name == NULL || name->node_type != PT_NAME || intl_identifier_casecmp (name->info.name.original, column) != 0)
+	  {
+	    is_ok = false;
+	    break;
+	  }
+	name = name->next;
+      }
+    is_ok = is_ok && name == NULL;
+
+    if (!is_ok)
+      {
+	std::cout << "  unexpected parse result: " << sql << std::endl;
+      }
+
+    parser_free_parser (parser);
+    return is_ok;
+  }
+
+  int
+  test_column_group_statistics (void)
+  {
+    if (init_common_cubrid_modules () != NO_ERROR)
+      {
+	return ER_FAILED;
+      }
+
+    if (!check_column_group ("create statistics on t (a, b)", 1, "t", { "a", "b" })
+	|| !check_column_group ("create statistics on t (c, b, a)", 1, "t", { "c", "b", "a" })
+	|| !check_column_group ("drop statistics on t (a, b)", -1, "t", { "a", "b" })
+	|| !check_parse ("create statistics on t", true, PT_UPDATE_STATS)
+	|| !check_parse ("create statistics on t ()", true, PT_UPDATE_STATS)
+	|| !check_parse ("drop statistics on (a, b)", true, PT_UPDATE_STATS)
+	|| !check_parse ("create statistics on t, u (a, b)", true, PT_UPDATE_STATS))
+      {
+	return ER_FAILED;
+      }
+    return NO_ERROR;
+  }
+
+  /* expect the specs of the FROM list of a query to be null-extended as given */
+  static bool
+  check_null_extension (const char *sql, std::initializer_list<bool> null_extended)
+  {
+    PARSER_CONTEXT *parser = parser_create_parser ();
+    PT_NODE *statement;
+    PT_NODE *spec;
+    bool is_ok;
+
+    if (parser == NULL)
+      {
+	return false;
+      }
+
+    statement = parse_statement (parser, sql);
+    is_ok = statement != NULL && statement->node_type == PT_SELECT;
+
+    spec = is_ok ? statement->info.query.q.select.from : NULL;
+    for (bool is_null_extended : null_extended)
+      {
+	if (spec == NULL || qo_is_null_extended_spec (spec) != is_null_extended)
+	  {
+	    is_ok = false;
+	    break;
+	  }
+	spec = spec->next;
+      }
+    is_ok = is_ok && spec == NULL;
+
+    if (!is_ok)
+      {
+	std::cout << "  unexpected null extension: " << sql << std::endl;
+      }
+
+    parser_free_parser (parser);
+    return is_ok;
+  }
+
+  int
+  test_outer_join_null_extension (void)
+  {
+    if (init_common_cubrid_modules () != NO_ERROR)
+      {
+	return ER_FAILED;
+      }
+
+    if (!check_null_extension ("select * from a, b where a.x not in (select x from c)", { false, false })
+	|| !check_null_extension ("select * from a inner join b on a.x = b.x", { false, false })
+	|| !check_null_extension ("select * from a left outer join b on a.x = b.x", { false, true })
+	|| !check_null_extension ("select * from a right outer join b on a.x = b.x", { true, false })
+	|| !check_null_extension ("select * from a join b on a.x = b.x left join c on b.x = c.x", { false, false, true })
+	|| !check_null_extension ("select * from a left join b on a.x = b.x right join c on b.x = c.x",
+				  { true, true, false })
+	|| !check_null_extension ("select * from a right join b on a.x = b.x left join c on b.x = c.x",
+				  { true, false, true })
+	|| !check_null_extension ("select * from a cross join b left join c on b.x = c.x", { false, false, true }))
+      {
+	return ER_FAILED;
+      }
+    return NO_ERROR;
+  }
+}
@@ -0,0 +1,34 @@
+/*
+ * Copyright 2008 Search Solution Corporation
+ * Copyright 2016 CUBRID Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+#ifndef _TEST_SYNTAX_HPP_
+#define _TEST_SYNTAX_HPP_
+
+namespace test_parser
+{
+  /* UPDATE STATISTICS ... WITH SAMPLE n ROWS, while SAMPLE stays a plain identifier */
+  int test_update_statistics_sample (void);
+
+  /* CREATE STATISTICS and DROP STATISTICS declare and remove column groups */
+  int test_column_group_statistics (void);
+
+  /* specs on the inner side of outer joins are null-extended, so NOT IN is not unnested on their attributes */
+  int test_outer_join_null_extension (void);
+}
+
+#endif /* _TEST_SYNTAX_HPP_ */
@@ -0,0 +1,266 @@
+/*
+ * Copyright 2008 Search Solution Corporation
+ * Copyright 2016 CUBRID Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+#include "test_comp_eval_term.hpp"
+
+#include "dbtype.h"
+#include "language_support.h"
+#include "object_domain.h"
+#include "query_evaluator.h"
+#include "query_executor.h"
+#include "regu_var.hpp"
+#include "thread_manager.hpp"
+#include "xasl.h"
+#include "xasl_predicate.hpp"
+
+#include <iostream>
+
+namespace test_query_evaluator
+{
+  static const REL_OP rel_ops[] = { R_EQ, R_NE, R_GT, R_GE, R_LT, R_LE };
+
+  static THREAD_ENTRY *
+  init_common_cubrid_modules (void)
+  {
+    static THREAD_ENTRY *thread_p = NULL;
+
+    if (thread_p != NULL)
+      {
+	return thread_p;
+      }
+
+    lang_init ();
+    tp_init ();
+    lang_set_charset_lang ("en_US.iso88591");
+
+    cubthread::initialize (thread_p);
+    if (cubthread::initialize_thread_entries () != NO_ERROR)
+      {
+	return NULL;
+      }
+    return thread_p;
+  }
+
+  /* comparison term of a constant with a positional value, as built for inst_num () <= ? */
+  struct comp_term
+  {
+    DB_VALUE constant;
+    DB_VALUE pos_value;
+    REGU_VARIABLE lhs;
+    REGU_VARIABLE rhs;
+    PRED_EXPR pred;
+    VAL_DESCR vd;
+
+    comp_term (TP_DOMAIN *domain, REL_OP rel_op)
+      : constant {}
+      , pos_value {}
+      , lhs {}
+      , rhs {}
+      , pred {}
+      , vd {}
+    {
+      lhs.type = TYPE_CONSTANT;
+      lhs.domain = domain;
+      lhs.value.dbvalptr = &constant;
+
+      rhs.type = TYPE_POS_VALUE;
+      rhs.domain = domain;
+      rhs.value.val_pos = 0;
+
+      vd.dbval_ptr = &pos_value;
+      vd.dbval_cnt = 1;
+
+      pred.type = T_EVAL_TERM;
+      pred.pe.m_eval_term.et_type = T_COMP_EVAL_TERM;
+      pred.pe.m_eval_term.et.et_comp.lhs = &lhs;
+      pred.pe.m_eval_term.et.et_comp.rhs = &rhs;
+      pred.pe.m_eval_term.et.et_comp.type = TP_DOMAIN_TYPE (domain);
+      set_rel_op (rel_op);
+    }
+
+    void
+    set_rel_op (REL_OP rel_op)
+    {
+      pred.pe.m_eval_term.et.et_comp.rel_op = rel_op;
+      eval_bind_comp_eval_term (&pred.pe.m_eval_term.et.et_comp);
+    }
+
+    COMP_EVAL_TERM &
+    comp ()
+    {
+      return pred.pe.m_eval_term.et.et_comp;
+    }
+  };
+
+  static DB_LOGICAL
+  expected_result (REL_OP rel_op, DB_BIGINT v1, DB_BIGINT v2)
+  {
+    bool res;
+
+    switch (rel_op)
+      {
+      case R_EQ:
+	res = v1 == v2;
+	break;
+      case R_NE:
+	res = v1 != v2;
+	break;
+      case R_GT:
+	res = v1 > v2;
+	break;
+      case R_GE:
+	res = v1 >= v2;
+	break;
+      case R_LT:
+	res = v1 < v2;
+	break;
+      case R_LE:
+	res = v1 <= v2;
+	break;
+      default:
+	return V_ERROR;
+      }
+    return res ? V_TRUE : V_FALSE;
+  }
+
+  static int
+  check_result (const char *what, REL_OP rel_op, DB_BIGINT v1, DB_BIGINT v2, DB_LOGICAL result)
+  {
+    if (result != expected_result (rel_op, v1, v2))
+      {
+	std::cout << std::endl << "    " << what << ": wrong result " << result << " of " << v1 << " op(" << rel_op
+		  << ") " << v2 << std::endl;
+	return 1;
+      }
+    return 0;
+  }
+
+  int
+  test_fast_cmp_kernels (void)
+  {
+    THREAD_ENTRY *thread_p = init_common_cubrid_modules ();
+    const DB_BIGINT values[] = { -5, 0, 1, 2, 3, 1000000 };
+    int err = 0;
+
+    std::cout << "test_fast_cmp_kernels";
+
+    for (REL_OP rel_op : rel_ops)
+      {
+	comp_term int_term (&tp_Integer_domain, rel_op);
+	comp_term bigint_term (&tp_Bigint_domain, rel_op);
+	comp_term mixed_term (&tp_Integer_domain, rel_op);
+
+	if (int_term.comp ().fast_cmp == NULL || bigint_term.comp ().fast_cmp == NULL)
+	  {
+	    std::cout << std::endl << "    no kernel bound for op(" << rel_op << ")" << std::endl;
+	    return 1;
+	  }
+
+	for (DB_BIGINT v1 : values)
+	  {
+	    for (DB_BIGINT v2 : values)
+	      {
+		db_make_int (&int_term.constant, (int) v1);
+		db_make_int (&int_term.pos_value, (int) v2);
+		err |= check_result ("int", rel_op, v1, v2, eval_pred (thread_p, &int_term.pred, &int_term.vd, NULL));
+
+		db_make_bigint (&bigint_term.constant, v1);
+		db_make_bigint (&bigint_term.pos_value, v2);
+		err |= check_result ("bigint", rel_op, v1, v2,
+				     eval_pred (thread_p, &bigint_term.pred, &bigint_term.vd, NULL));
+
+		/* a host variable may be bound to another type than the planned one; the kernel must give up */
+		db_make_int (&mixed_term.constant, (int) v1);
+		db_make_bigint (&mixed_term.pos_value, v2);
+		if (mixed_term.comp ().fast_cmp (&mixed_term.constant, &mixed_term.pos_value) != V_UNKNOWN)
+		  {
+		    std::cout << std::endl << "    kernel compared values of another type" << std::endl;
+		    err = 1;
+		  }
+		err |= check_result ("mixed", rel_op, v1, v2,
+				     eval_pred (thread_p, &mixed_term.pred, &mixed_term.vd, NULL));
+	      }
+	  }
+      }
+
+    return err;
+  }
+
+  int
+  test_instnum_rebind (void)
+  {
+    THREAD_ENTRY *thread_p = init_common_cubrid_modules ();
+    const DB_BIGINT limit = 3;
+    DB_LOGICAL ev_res;
+    DB_BIGINT row;
+    xasl_node xasl {};
+    xasl_state state {};
+
+    std::cout << "test_instnum_rebind";
+
+    /* inst_num () <= limit; inst_num () is the constant of the term, counted by qexec_eval_instnum_pred () */
+    comp_term term (&tp_Bigint_domain, R_LE);
+    db_make_bigint (&term.pos_value, limit);
+    db_make_bigint (&term.constant, 0);
+
+    xasl.instnum_pred = &term.pred;
+    xasl.instnum_val = &term.constant;
+    state.vd = term.vd;
+
+    for (row = 1; row <= limit + 1; row++)
+      {
+	ev_res = qexec_eval_instnum_pred (thread_p, &xasl, &state);
+	if (ev_res != V_TRUE)
+	  {
+	    std::cout << std::endl << "    row " << row << " is not accepted" << std::endl;
+	    return 1;
+	  }
+	if (term.comp ().rel_op != R_LE)
+	  {
+	    std::cout << std::endl << "    operator not restored at row " << row << std::endl;
+	    return 1;
+	  }
+	if (xasl.instnum_flag & XASL_INSTNUM_FLAG_SCAN_LAST_STOP)
+	  {
+	    break;
+	  }
+      }
+
+    if (row != limit)
+      {
+	std::cout << std::endl << "    scan did not stop at row " << limit << std::endl;
+	return 1;
+      }
+
+    /* the kernel bound again must be the one of <= */
+    db_make_bigint (&term.constant, limit + 1);
+    if (eval_pred (thread_p, &term.pred, &term.vd, NULL) != V_FALSE)
+      {
+	std::cout << std::endl << "    kernel of < left bound for <=" << std::endl;
+	return 1;
+      }
+    db_make_bigint (&term.constant, limit);
+    if (eval_pred (thread_p, &term.pred, &term.vd, NULL) != V_TRUE)
+      {
+	std::cout << std::endl << "    kernel of < left bound for <=" << std::endl;
+	return 1;
+      }
+
+    return 0;
+  }
+}
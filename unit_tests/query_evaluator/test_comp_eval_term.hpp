@@ -0,0 +1,31 @@
+/*
+ * Copyright 2008 Search Solution Corporation
+ * Copyright 2016 CUBRID Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+#ifndef _TEST_COMP_EVAL_TERM_HPP_
+#define _TEST_COMP_EVAL_TERM_HPP_
+
+namespace test_query_evaluator
+{
+  /* specialized comparison kernels give the same results as the generic comparison */
+  int test_fast_cmp_kernels (void);
+
+  /* the LIMIT rewrite of inst_num () <= n to inst_num () < n stops the scan at the last row */
+  int test_instnum_rebind (void);
+}
+
+#endif /* _TEST_COMP_EVAL_TERM_HPP_ */
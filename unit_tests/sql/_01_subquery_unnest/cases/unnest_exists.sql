@@ -0,0 +1,39 @@
+-- correlated EXISTS and NOT EXISTS rewritten to semi-joins and anti-joins
+drop table if exists t1, t2, t3;
+
+create table t1 (id int primary key, a int, b int);
+create table t2 (id int primary key, a int, c int);
+create table t3 (id int primary key, a int not null);
+
+insert into t1 values (1, 10, 100), (2, 20, null), (3, null, 300), (4, 40, 400), (5, 50, null);
+insert into t2 values (1, 10, 1), (2, 10, 2), (3, 40, 3), (4, null, 4), (5, 60, 5);
+insert into t3 values (1, 10), (2, 20), (3, 30);
+
+update statistics on t1, t2, t3;
+
+-- duplicate keys of t2 must not duplicate rows of t1
+select id from t1 where exists (select 1 from t2 where t2.a = t1.a) order by id;
+
+-- a NULL key has no match, so NOT EXISTS keeps the row
+select id from t1 where not exists (select 1 from t2 where t2.a = t1.a) order by id;
+
+-- several correlated keys
+select id from t1 where exists (select 1 from t2 where t2.a = t1.a and t2.c = t1.id) order by id;
+
+-- semi-join and anti-join in the same query
+select id from t1
+where exists (select 1 from t2 where t2.c = t1.id) and not exists (select 1 from t3 where t3.a = t1.a)
+order by id;
+
+-- outer join in the query: subqueries stay correlated, results must not change
+select t1.id, t3.a from t1 left outer join t3 on t1.a = t3.a
+where not exists (select 1 from t2 where t2.a = t1.a) order by t1.id;
+
+select t1.id from t1 left outer join t3 on t1.a = t3.a
+where exists (select 1 from t2 where t2.c = t3.id) order by t1.id;
+
+-- NO_UNNEST on the query and on the subquery gives the same results
+select /*+ NO_UNNEST */ id from t1 where exists (select 1 from t2 where t2.a = t1.a) order by id;
+select id from t1 where not exists (select /*+ NO_UNNEST */ 1 from t2 where t2.a = t1.a) order by id;
+
+drop table t1, t2, t3;
@@ -0,0 +1,28 @@
+-- correlated IN and NOT IN rewritten to semi-joins and anti-joins; NOT IN only when no column can be NULL
+drop table if exists t1, t2, tnn, t3;
+
+create table t1 (id int primary key, a int);
+create table t2 (id int primary key, a int, c int);
+create table tnn (id int not null, a int not null);
+create table t3 (id int not null, a int not null);
+
+insert into t1 values (1, 10), (2, 20), (3, null), (4, 40), (5, 50);
+insert into t2 values (1, 10, 1), (2, 10, 2), (3, 40, 3), (4, null, 4), (5, 60, 5);
+insert into tnn values (1, 10), (2, 20), (3, 40), (4, 70);
+insert into t3 values (1, 10), (2, 20), (3, 30);
+
+update statistics on t1, t2, tnn, t3;
+
+select id from t1 where t1.a in (select t2.a from t2 where t2.c = t1.id) order by id;
+
+-- NULL on either side makes NOT IN unknown: rows 3 and 4 are not returned
+select id from t1 where t1.a not in (select t2.a from t2 where t2.c = t1.id) order by id;
+
+-- a NULL in the subquery result makes NOT IN unknown for every row
+select count(*) from t1 where t1.a not in (select a from t2);
+
+-- NOT NULL columns: anti-join
+select id from tnn where tnn.a not in (select t3.a from t3) order by id;
+select id from tnn where tnn.a not in (select t3.a from t3 where t3.id = tnn.id) order by id;
+
+drop table t1, t2, tnn, t3;
@@ -0,0 +1,30 @@
+-- outer rows with no partner in the hash list scan of a derived table are skipped by its Bloom filter;
+-- the results must not change with the filter off or without the hash list scan
+drop table if exists tjo, tji;
+
+create table tjo (id int primary key, k int);
+create table tji (id int primary key, k int, w int);
+
+insert into tjo values (1, 1), (2, 2), (3, 3), (4, null), (5, 5), (6, 2);
+insert into tji values (1, 2, 20), (2, 2, 21), (3, 5, 50), (4, null, 0), (5, 7, 70);
+
+update statistics on tjo, tji;
+
+-- filtered: rows 1, 3 and 4 have no partner
+select o.id, d.w from tjo o, (select k, w from tji where w > 0) d where o.k = d.k order by o.id, d.w;
+
+-- outer join keeps the rows with no partner
+select o.id, d.w from tjo o left outer join (select k, w from tji where w > 0) d on o.k = d.k order by o.id, d.w;
+
+-- empty build side
+select count(*) from tjo o, (select k from tji where w > 100) d where o.k = d.k;
+
+-- unfiltered
+set system parameters 'join_bloom_filter=no';
+select o.id, d.w from tjo o, (select k, w from tji where w > 0) d where o.k = d.k order by o.id, d.w;
+set system parameters 'join_bloom_filter=yes';
+
+select /*+ NO_HASH_LIST_SCAN */ o.id, d.w from tjo o, (select k, w from tji where w > 0) d where o.k = d.k
+order by o.id, d.w;
+
+drop table tjo, tji;
@@ -0,0 +1,54 @@
+-- join orders searched by dynamic programming give the results of the permutation search;
+-- with optimizer_dp_join_max_tables=0, joins of up to 4 tables use the permutation of all tables and larger joins
+-- consider 4 tables at a time
+drop table if exists ta, tb, tc, td, te, tf;
+
+create table ta (id int primary key, x int);
+create table tb (id int primary key, a_id int, y int);
+create table tc (id int primary key, b_id int, z int);
+create table td (id int primary key, c_id int, a_id int);
+create table te (id int primary key, a_id int);
+create table tf (id int primary key, a_id int);
+
+insert into ta values (1, 1), (2, 1), (3, 2), (4, 2), (5, 3), (6, 3);
+insert into tb values (1, 1, 10), (2, 2, 20), (3, 3, 30), (4, 3, 40), (5, 7, 50);
+insert into tc values (1, 1, 100), (2, 3, 300), (3, 4, 400), (4, 4, 410), (5, 9, 900);
+insert into td values (1, 2, 3), (2, 3, 1), (3, 4, 3), (4, 8, 3);
+insert into te values (1, 1), (2, 3), (3, 3), (4, 5);
+insert into tf values (1, 3), (2, 5), (3, 6);
+
+update statistics on ta, tb, tc, td, te, tf;
+
+-- chain
+select ta.id a, tb.id b, tc.id c, td.id d from ta, tb, tc, td
+where ta.id = tb.a_id and tb.id = tc.b_id and tc.id = td.c_id order by d;
+
+-- star
+select ta.id, count(*) from ta, tb, te, tf where tb.a_id = ta.id and te.a_id = ta.id and tf.a_id = ta.id
+group by ta.id order by ta.id;
+
+-- cycle
+select ta.id a, tb.id b, tc.id c, td.id d from ta, tb, tc, td
+where ta.id = tb.a_id and tb.id = tc.b_id and tc.id = td.c_id and td.a_id = ta.id order by d;
+
+-- chain with a branch; 5 tables
+select count(*) n, sum (ta.x + tb.y + tc.z) s from ta, tb, tc, td, te
+where ta.id = tb.a_id and tb.id = tc.b_id and tc.id = td.c_id and te.a_id = ta.id;
+
+set system parameters 'optimizer_dp_join_max_tables=0';
+
+select ta.id a, tb.id b, tc.id c, td.id d from ta, tb, tc, td
+where ta.id = tb.a_id and tb.id = tc.b_id and tc.id = td.c_id order by d;
+
+select ta.id, count(*) from ta, tb, te, tf where tb.a_id = ta.id and te.a_id = ta.id and tf.a_id = ta.id
+group by ta.id order by ta.id;
+
+select ta.id a, tb.id b, tc.id c, td.id d from ta, tb, tc, td
+where ta.id = tb.a_id and tb.id = tc.b_id and tc.id = td.c_id and td.a_id = ta.id order by d;
+
+select count(*) n, sum (ta.x + tb.y + tc.z) s from ta, tb, tc, td, te
+where ta.id = tb.a_id and tb.id = tc.b_id and tc.id = td.c_id and te.a_id = ta.id;
+
+set system parameters 'optimizer_dp_join_max_tables=12';
+
+drop table ta, tb, tc, td, te, tf;
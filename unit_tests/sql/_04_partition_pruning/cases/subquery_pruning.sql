@@ -0,0 +1,33 @@
+-- the first scan of a query prunes partitions with the results of subqueries and the values of outer queries
+drop table if exists tp, th, tv;
+
+create table tp (id int, k int) partition by range (k)
+  (partition p0 values less than (10), partition p1 values less than (20), partition p2 values less than maxvalue);
+create table th (id int, k int) partition by hash (k) partitions 3;
+create table tv (v int);
+
+insert into tp values (1, 5), (2, 15), (3, 25), (4, 12), (5, 8);
+insert into th select id, k from tp;
+insert into tv values (12), (25), (40);
+
+update statistics on tp, th, tv;
+
+select id from tp where k = (select min (v) from tv) order by id;
+
+select id from tp where k >= (select min (v) from tv) order by id;
+
+-- out of all ranges
+select count(*) n from tp where k = (select max (v) from tv);
+
+-- null
+select count(*) n from tp where k = (select v from tv where v > 100);
+
+select id from th where k = (select min (v) from tv) order by id;
+
+-- correlated
+select v, (select count(*) from tp where tp.k = tv.v) c from tv order by v;
+
+-- inner scan
+select tp.id from tv, tp where tp.k = tv.v order by 1;
+
+drop table tp, th, tv;
@@ -0,0 +1,43 @@
+-- column groups declared by CREATE STATISTICS are kept with the schema and gathered again by statistics updates
+drop table if exists tc, tq;
+
+create table tc (id int, city varchar(20), zip int, note varchar(20));
+insert into tc values (1, 'a', 100, 'x'), (2, 'a', 100, 'y'), (3, 'b', 200, 'x'), (4, 'b', 200, 'y'), (5, 'c', 300, 'x');
+
+create statistics on tc (city, zip);
+create statistics on tc (zip, note);
+update statistics on tc;
+
+select id from tc where city = 'b' and zip = 200 order by id;
+
+-- a dropped attribute leaves its groups out
+alter table tc drop column note;
+update statistics on tc;
+
+select count(*) n from tc where city = 'a' and zip = 100;
+
+drop statistics on tc (zip, city);
+update statistics on tc;
+
+select count(*) n from tc where city = 'c' and zip = 300;
+
+-- partitions use the groups of their partitioned class, including partitions added later
+create table tq (id int, a int, b int) partition by range (id)
+  (partition p0 values less than (10), partition p1 values less than (20));
+insert into tq values (1, 1, 1), (2, 1, 1), (11, 2, 2), (12, 2, 2);
+
+create statistics on tq (a, b);
+alter table tq add partition (partition p2 values less than maxvalue);
+insert into tq values (21, 3, 3), (22, 3, 3);
+update statistics on tq;
+
+select id from tq where a = 3 and b = 3 order by id;
+
+select id from tq where a = 1 and b = 1 order by id;
+
+drop statistics on tq (a, b);
+update statistics on tq;
+
+select count(*) n from tq where a = 2 and b = 2;
+
+drop table tc, tq;
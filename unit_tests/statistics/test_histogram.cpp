@@ -0,0 +1,251 @@
+/*
+ * Copyright 2008 Search Solution Corporation
+ * Copyright 2016 CUBRID Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+#include "test_histogram.hpp"
+
+#include "dbtype.h"
+#include "language_support.h"
+#include "object_domain.h"
+#include "object_representation.h"
+#include "statistics.h"
+#include "statistics_sr.h"
+#include "thread_manager.hpp"
+
+#include <cstdlib>
+#include <iostream>
+
+namespace test_statistics
+{
+  static int
+  init_common_cubrid_modules (void)
+  {
+    static bool is_initialized = false;
+    THREAD_ENTRY *thread_p = NULL;
+
+    if (is_initialized)
+      {
+	return NO_ERROR;
+      }
+
+    lang_init ();
+    tp_init ();
+    lang_set_charset_lang ("en_US.iso88591");
+
+    cubthread::initialize (thread_p);
+    if (cubthread::initialize_thread_entries () != NO_ERROR)
+      {
+	return ER_FAILED;
+      }
+    is_initialized = true;
+    return NO_ERROR;
+  }
+
+  static bool
+  is_same_value (const DB_VALUE *value1, const DB_VALUE *value2)
+  {
+    return (DB_VALUE_TYPE (value1) == DB_VALUE_TYPE (value2) && tp_value_compare (value1, value2, 0, 1) == DB_EQ);
+  }
+
+  /* pack histogram, unpack it and compare it with the original */
+  static bool
+  check_round_trip (STATS_HISTOGRAM &histogram)
+  {
+    STATS_HISTOGRAM *unpacked_p;
+    char *packed_p;
+    int length = 0;
+    bool is_ok;
+    int i;
+
+    packed_p = stats_pack_histogram (&histogram, &length);
+    if (packed_p == NULL || length <= 0)
+      {
+	std::cout << "  cannot pack histogram" << std::endl;
+	return false;
+      }
+
+    unpacked_p = stats_client_unpack_histogram (packed_p, length);
+    free (packed_p);
+    if (unpacked_p == NULL)
+      {
+	std::cout << "  cannot unpack histogram" << std::endl;
+	return false;
+      }
+
+    is_ok = (unpacked_p->null_frac == histogram.null_frac && unpacked_p->ndv == histogram.ndv
+	     && unpacked_p->n_mcvs == histogram.n_mcvs && unpacked_p->n_bounds == histogram.n_bounds);
+    for (i = 0; is_ok && i < histogram.n_mcvs; i++)
+      {
+	is_ok = (unpacked_p->mcv_freqs[i] == histogram.mcv_freqs[i]
+		 && is_same_value (&unpacked_p->mcvs[i], &histogram.mcvs[i]));
+      }
+    for (i = 0; is_ok && i < histogram.n_bounds; i++)
+      {
+	is_ok = is_same_value (&unpacked_p->bounds[i], &histogram.bounds[i]);
+      }
+    if (!is_ok)
+      {
+	std::cout << "  unpacked histogram differs from packed one" << std::endl;
+      }
+
+    stats_free_histogram (unpacked_p);
+    return is_ok;
+  }
+
+  int
+  test_histogram_round_trip (void)
+  {
+    DB_VALUE int_mcvs[3];
+    double int_freqs[3] = { 0.25, 0.125, 1.0 / 3 };
+    DB_VALUE int_bounds[STATS_HISTOGRAM_BUCKETS_MAX + 1];
+    DB_VALUE string_mcvs[2];
+    double string_freqs[2] = { 0.5, 0.0625 };
+    DB_VALUE double_bounds[3];
+    STATS_HISTOGRAM histogram;
+    int i;
+
+    if (init_common_cubrid_modules () != NO_ERROR)
+      {
+	return ER_FAILED;
+      }
+
+    /* nothing but NULLs */
+    histogram = STATS_HISTOGRAM ();
+    histogram.null_frac = 1.0;
+    if (!check_round_trip (histogram))
+      {
+	return ER_FAILED;
+      }
+
+    /* integers with most common values and the most buckets */
+    for (i = 0; i < 3; i++)
+      {
+	db_make_int (&int_mcvs[i], (i - 1) * 1000);
+      }
+    for (i = 0; i < STATS_HISTOGRAM_BUCKETS_MAX + 1; i++)
+      {
+	db_make_int (&int_bounds[i], i * 37 - 500);
+      }
+    histogram = STATS_HISTOGRAM ();
+    histogram.null_frac = 0.01;
+    histogram.ndv = 123456.5;
+    histogram.n_mcvs = 3;
+    histogram.mcvs = int_mcvs;
+    histogram.mcv_freqs = int_freqs;
+    histogram.n_bounds = STATS_HISTOGRAM_BUCKETS_MAX + 1;
+    histogram.bounds = int_bounds;
+    if (!check_round_trip (histogram))
+      {
+	return ER_FAILED;
+      }
+
+    /* strings as most common values only */
+    db_make_string (&string_mcvs[0], "");
+    db_make_string (&string_mcvs[1], "most common value");
+    histogram = STATS_HISTOGRAM ();
+    histogram.ndv = 2;
+    histogram.n_mcvs = 2;
+    histogram.mcvs = string_mcvs;
+    histogram.mcv_freqs = string_freqs;
+    if (!check_round_trip (histogram))
+      {
+	return ER_FAILED;
+      }
+
+    /* doubles as bucket bounds only */
+    db_make_double (&double_bounds[0], -1.5);
+    db_make_double (&double_bounds[1], 0.0);
+    db_make_double (&double_bounds[2], 1e300);
+    histogram = STATS_HISTOGRAM ();
+    histogram.null_frac = 0.5;
+    histogram.ndv = 1e6;
+    histogram.n_bounds = 3;
+    histogram.bounds = double_bounds;
+    if (!check_round_trip (histogram))
+      {
+	return ER_FAILED;
+      }
+
+    return NO_ERROR;
+  }
+
+  int
+  test_histogram_unpack_rejects (void)
+  {
+    DB_VALUE mcv;
+    double freq = 0.5;
+    STATS_HISTOGRAM histogram = STATS_HISTOGRAM ();
+    STATS_HISTOGRAM *unpacked_p;
+    char *packed_p;
+    int length = 0;
+    int error = NO_ERROR;
+
+    if (init_common_cubrid_modules () != NO_ERROR)
+      {
+	return ER_FAILED;
+      }
+
+    db_make_int (&mcv, 7);
+    histogram.ndv = 1;
+    histogram.n_mcvs = 1;
+    histogram.mcvs = &mcv;
+    histogram.mcv_freqs = &freq;
+
+    packed_p = stats_pack_histogram (&histogram, &length);
+    if (packed_p == NULL)
+      {
+	return ER_FAILED;
+      }
+
+    /* another version */
+    OR_PUT_INT (packed_p, STATS_HISTOGRAM_VERSION + 1);
+    unpacked_p = stats_client_unpack_histogram (packed_p, length);
+    if (unpacked_p != NULL)
+      {
+	std::cout << "  histogram of another version is unpacked" << std::endl;
+	stats_free_histogram (unpacked_p);
+	error = ER_FAILED;
+      }
+    OR_PUT_INT (packed_p, STATS_HISTOGRAM_VERSION);
+
+    /* more most common values than kept; n_mcvs follows version, null_frac and ndv */
+    OR_PUT_INT (packed_p + OR_INT_SIZE + 2 * OR_DOUBLE_SIZE, STATS_HISTOGRAM_MCVS_MAX + 1);
+    unpacked_p = stats_client_unpack_histogram (packed_p, length);
+    if (unpacked_p != NULL)
+      {
+	std::cout << "  histogram with too many most common values is unpacked" << std::endl;
+	stats_free_histogram (unpacked_p);
+	error = ER_FAILED;
+      }
+    OR_PUT_INT (packed_p + OR_INT_SIZE + 2 * OR_DOUBLE_SIZE, 1);
+
+    /* the histogram is whole again */
+    unpacked_p = stats_client_unpack_histogram (packed_p, length);
+    if (unpacked_p == NULL || unpacked_p->n_mcvs != 1 || !is_same_value (&unpacked_p->mcvs[0], &mcv))
+      {
+	std::cout << "  cannot unpack restored histogram" << std::endl;
+	error = ER_FAILED;
+      }
+    if (unpacked_p != NULL)
+      {
+	stats_free_histogram (unpacked_p);
+      }
+
+    free (packed_p);
+    return error;
+  }
+}
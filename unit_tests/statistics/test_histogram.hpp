@@ -0,0 +1,31 @@
+/*
+ * Copyright 2008 Search Solution Corporation
+ * Copyright 2016 CUBRID Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+#ifndef _TEST_HISTOGRAM_HPP_
+#define _TEST_HISTOGRAM_HPP_
+
+namespace test_statistics
+{
+  /* histograms and most common values unpack as they were packed */
+  int test_histogram_round_trip (void);
+
+  /* histograms packed by another version or with corrupt counts are not unpacked */
+  int test_histogram_unpack_rejects (void);
+}
+
+#endif /* _TEST_HISTOGRAM_HPP_ */
@@ -0,0 +1,282 @@
+/*
+ * Copyright 2008 Search Solution Corporation
+ * Copyright 2016 CUBRID Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+#include "test_plan_variant.hpp"
+
+#include "dbtype.h"
+#include "language_support.h"
+#include "object_domain.h"
+#include "thread_manager.hpp"
+#include "xasl_cache.h"
+
+#include <initializer_list>
+#include <iostream>
+#include <set>
+#include <vector>
+
+namespace test_xasl_cache
+{
+  static THREAD_ENTRY *
+  init_common_cubrid_modules (void)
+  {
+    static THREAD_ENTRY *thread_p = NULL;
+
+    if (thread_p != NULL)
+      {
+	return thread_p;
+      }
+
+    lang_init ();
+    tp_init ();
+    lang_set_charset_lang ("en_US.iso88591");
+
+    cubthread::initialize (thread_p);
+    if (cubthread::initialize_thread_entries () != NO_ERROR)
+      {
+	return NULL;
+      }
+    return thread_p;
+  }
+
+  /* most common value listed by the optimizer for a bind value */
+  struct peek_desc
+  {
+    int mcv;
+    int host_var_index;
+    int position;
+    int range;
+  };
+
+  /* plan peeks as listed by the optimizer to the compile context */
+  class plan_peeks
+  {
+    public:
+      plan_peeks (std::initializer_list<peek_desc> descs)
+	: m_values (descs.size ())
+	, m_peeks (descs.size ())
+      {
+	size_t i = 0;
+
+	for (const peek_desc &desc : descs)
+	  {
+	    db_make_int (&m_values[i], desc.mcv);
+	    m_peeks[i].value = &m_values[i];
+	    m_peeks[i].host_var_index = desc.host_var_index;
+	    m_peeks[i].position = desc.position;
+	    m_peeks[i].range = desc.range;
+	    m_peeks[i].next = (i + 1 < descs.size ()) ? &m_peeks[i + 1] : NULL;
+	    i++;
+	  }
+      }
+
+      const XASL_PLAN_PEEK *
+      get_list () const
+      {
+	return m_peeks.empty () ? NULL : &m_peeks[0];
+      }
+
+    private:
+      std::vector<DB_VALUE> m_values;
+      std::vector<XASL_PLAN_PEEK> m_peeks;
+  };
+
+  /* variant the optimizer computes for the ranges of bind values at each position; 0 is no range */
+  static int
+  expected_variant (std::initializer_list<int> digits)
+  {
+    int variant = 0;
+    int multiplier = 1;
+
+    for (int digit : digits)
+      {
+	variant += digit * multiplier;
+	multiplier *= XASL_PLAN_PEEK_RANGES + 1;
+      }
+    return variant;
+  }
+
+  static bool
+  check_variant (const plan_peeks &peeks, std::vector<DB_VALUE> &dbvals, int expected)
+  {
+    int variant = xcache_get_plan_variant (peeks.get_list (), (int) dbvals.size (), dbvals.data ());
+
+    if (variant != expected)
+      {
+	std::cout << "  plan variant is " << variant << " instead of " << expected << std::endl;
+	return false;
+      }
+    return true;
+  }
+
+  static std::vector<DB_VALUE>
+  make_int_binds (std::initializer_list<int> ints)
+  {
+    std::vector<DB_VALUE> dbvals (ints.size ());
+    size_t i = 0;
+
+    for (int value : ints)
+      {
+	db_make_int (&dbvals[i++], value);
+      }
+    return dbvals;
+  }
+
+  int
+  test_plan_variant_digits (void)
+  {
+    std::set<int> variants;
+    int n_variants = 1;
+
+    /* the digit of a bind value is its range plus one, at its position */
+    for (int position = 0; position < XASL_PLAN_MAX_PEEKS; position++)
+      {
+	for (int range = 0; range < XASL_PLAN_PEEK_RANGES; range++)
+	  {
+	    std::vector<int> digits (position + 1, 0);
+
+	    digits[position] = range + 1;
+	    int expected = 0;
+	    for (int i = position; i >= 0; i--)
+	      {
+		expected = expected * (XASL_PLAN_PEEK_RANGES + 1) + digits[i];
+	      }
+	    if (xasl_plan_variant_digit (position, range) != expected)
+	      {
+		std::cout << "  digit of range " << range << " at position " << position << " is "
+			  << xasl_plan_variant_digit (position, range) << " instead of " << expected << std::endl;
+		return ER_FAILED;
+	      }
+	  }
+	n_variants *= XASL_PLAN_PEEK_RANGES + 1;
+      }
+
+    /* each combination of ranges of the bind values, or of no range, is another variant */
+    for (int combination = 0; combination < n_variants; combination++)
+      {
+	int variant = 0;
+	int rest = combination;
+
+	for (int position = 0; position < XASL_PLAN_MAX_PEEKS; position++)
+	  {
+	    int range = rest % (XASL_PLAN_PEEK_RANGES + 1) - 1;
+
+	    rest /= XASL_PLAN_PEEK_RANGES + 1;
+	    if (range >= 0)
+	      {
+		variant += xasl_plan_variant_digit (position, range);
+	      }
+	  }
+	if ((variant == 0) != (combination == 0) || !variants.insert (variant).second)
+	  {
+	    std::cout << "  plan variant " << variant << " is not unique" << std::endl;
+	    return ER_FAILED;
+	  }
+      }
+
+    return NO_ERROR;
+  }
+
+  int
+  test_plan_variant_selection (void)
+  {
+    if (init_common_cubrid_modules () == NULL)
+      {
+	return ER_FAILED;
+      }
+
+    /* plan of no peeked value is generic */
+    plan_peeks no_peeks ({ });
+    std::vector<DB_VALUE> binds = make_int_binds ({ 10 });
+    if (!check_variant (no_peeks, binds, 0))
+      {
+	return ER_FAILED;
+      }
+
+    /* a = ?; 10 is very frequent, 20 is rare, other values are in between */
+    plan_peeks one_peek ({ { 10, 0, 0, 3 }, { 20, 0, 0, 0 } });
+    binds = make_int_binds ({ 10 });
+    if (!check_variant (one_peek, binds, expected_variant ({ 4 })))
+      {
+	return ER_FAILED;
+      }
+    binds = make_int_binds ({ 20 });
+    if (!check_variant (one_peek, binds, expected_variant ({ 1 })))
+      {
+	return ER_FAILED;
+      }
+    binds = make_int_binds ({ 30 });
+    if (!check_variant (one_peek, binds, 0))
+      {
+	return ER_FAILED;
+      }
+
+    /* a bind value of another type equal to a listed value selects its range */
+    db_make_bigint (&binds[0], 10);
+    if (!check_variant (one_peek, binds, expected_variant ({ 4 })))
+      {
+	return ER_FAILED;
+      }
+    db_make_double (&binds[0], 20.0);
+    if (!check_variant (one_peek, binds, expected_variant ({ 1 })))
+      {
+	return ER_FAILED;
+      }
+
+    /* NULL never equals a listed value */
+    db_make_null (&binds[0]);
+    if (!check_variant (one_peek, binds, 0))
+      {
+	return ER_FAILED;
+      }
+
+    /* b = ?2 AND a = ?1; the first listed bind value is the lowest digit of the variant */
+    plan_peeks two_peeks ({ { 5, 1, 0, 2 }, { 7, 0, 1, 0 }, { 8, 0, 1, 3 } });
+    binds = make_int_binds ({ 7, 5 });
+    if (!check_variant (two_peeks, binds, expected_variant ({ 3, 1 })))
+      {
+	return ER_FAILED;
+      }
+    binds = make_int_binds ({ 8, 6 });
+    if (!check_variant (two_peeks, binds, expected_variant ({ 0, 4 })))
+      {
+	return ER_FAILED;
+      }
+    binds = make_int_binds ({ 9, 5 });
+    if (!check_variant (two_peeks, binds, expected_variant ({ 3, 0 })))
+      {
+	return ER_FAILED;
+      }
+
+    /* the most peeked bind values, each in the highest range; bind values not listed are ignored */
+    plan_peeks max_peeks ({ { 1, 0, 0, XASL_PLAN_PEEK_RANGES - 1 }, { 2, 2, 1, XASL_PLAN_PEEK_RANGES - 1 },
+			    { 3, 3, 2, XASL_PLAN_PEEK_RANGES - 1 } });
+    binds = make_int_binds ({ 1, 100, 2, 3 });
+    if (!check_variant (max_peeks, binds, expected_variant ({ XASL_PLAN_PEEK_RANGES, XASL_PLAN_PEEK_RANGES,
+					XASL_PLAN_PEEK_RANGES })))
+      {
+	return ER_FAILED;
+      }
+    binds = make_int_binds ({ 0, 100, 0, 3 });
+    if (!check_variant (max_peeks, binds, expected_variant ({ 0, 0, XASL_PLAN_PEEK_RANGES })))
+      {
+	return ER_FAILED;
+      }
+
+    return NO_ERROR;
+  }
+}
@@ -0,0 +1,31 @@
+/*
+ * Copyright 2008 Search Solution Corporation
+ * Copyright 2016 CUBRID Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+#ifndef _TEST_PLAN_VARIANT_HPP_
+#define _TEST_PLAN_VARIANT_HPP_
+
+namespace test_xasl_cache
+{
+  /* the optimizer and the XASL cache encode the ranges of bind values into the same plan variant */
+  int test_plan_variant_digits (void);
+
+  /* bind values select the plan variant of the selectivity ranges of the most common values they equal */
+  int test_plan_variant_selection (void);
+}
+
+#endif /* _TEST_PLAN_VARIANT_HPP_ */